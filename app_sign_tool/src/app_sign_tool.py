@@ -6,7 +6,7 @@
 ## @brief:      This script fills up application header informations
 ## @date:		20.08.2024
 ## @author:		Ziga Miklosic
-## @version:    V0.4.0
+## @version:    V1.2.0
 ##
 #################################################################################################
 
@@ -14,11 +14,13 @@
 ##  IMPORTS
 #################################################################################################
 import argparse
-import shutil
 import subprocess
+import multiprocessing
+import json
 
 import os
 import struct
+import zlib
 
 import binascii
 from Crypto.Cipher import AES
@@ -35,7 +37,7 @@ from binascii import hexlify
 #################################################################################################
 
 # Script version
-MAIN_SCRIPT_VER     = "V1.0.0"
+MAIN_SCRIPT_VER     = "V1.2.0"
 
 # Tool description
 TOOL_DESCRIPTION = \
@@ -47,12 +49,16 @@ APP_HEADER_VER_EXPECTED         = 1
 # Application header addresses
 APP_HEADER_CRC_ADDR             = 0x00
 APP_HEADER_VER_ADDR             = 0x01
-APP_HEADER_IMG_TYPE_ADDR        = 0x02  # Image type [0-Application, 1-Custom]
+APP_HEADER_IMG_TYPE_ADDR        = 0x02  # Image type [0-Application, 1-Custom, 2-Delta, 3-Multi]
+APP_HEADER_COMP_TYPE_ADDR       = 0x03  # Compression type [0-None, 1-Heatshrink]. NOTE: Reserved field of revision module header!
+APP_HEADER_COMP_PARAM_ADDR      = 0x04  # Compression parameters [window bits (high nibble), lookahead bits (low nibble)]
 
 # Image type
 class ImageType():
     APPLICATION = 0
     CUSTOM      = 1
+    DELTA       = 2
+    MULTI       = 3
 
 # Application header data fields
 # For more info about image header look at Revision module specifications: "revision\doc\Revision_Specifications.xlsx"
@@ -78,6 +84,11 @@ class SigType():
     NONE    = 0
     ECDSA   = 1
 
+# Compression types
+class CompType():
+    NONE        = 0
+    HEATSHRINK  = 1
+
 # Application header size in bytes
 APP_HEADER_SIZE_BYTE            = 256 # bytes
 
@@ -93,6 +104,61 @@ PAD_VALUE                       = 0x00
 # pad block size.
 PAD_BLOCK_SIZE_BYTE             = 64 #bytes 
 
+# Delta image
+# NOTE: Must match bootloader "boot_delta.c"!
+DELTA_MAGIC                     = 0xB00DE17A
+DELTA_OP_COPY                   = 0x01
+DELTA_OP_DATA                   = 0x02
+
+# Size of block used to find matches in base image
+DELTA_MATCH_BLOCK_SIZE          = 8 # bytes
+
+# Minimum size of copy operation, shorter matches are sent as new data
+DELTA_MIN_COPY_SIZE             = 16 # bytes
+
+# Max. number of match candidates checked per position
+DELTA_MAX_CANDIDATES            = 16
+
+# Compression (heatshrink compatible LZSS)
+# NOTE: Window bits must not exceed bootloader "BOOT_CFG_COMP_WINDOW_BITS"!
+COMP_WINDOW_BITS                = 10
+COMP_LOOKAHEAD_BITS             = 4
+
+# Max. number of match candidates checked per position
+COMP_MAX_CANDIDATES             = 32
+
+# Multi-image container
+# NOTE: Must match bootloader "boot_types.h"!
+MULTI_MAGIC                     = 0x544C554D # "MULT"
+MULTI_ENTRY_MAX                 = 8
+MULTI_ENTRY_SIZE                = 44 # bytes
+MULTI_MANIFEST_SIZE             = ( 8 + ( MULTI_ENTRY_MAX * MULTI_ENTRY_SIZE )) # bytes
+
+# Multi-image container sub-image types
+class MultiType():
+    APP         = 0
+    DATA        = 1
+    FORWARD     = 2
+
+# CRC-32 parameters
+# NOTE: Must match bootloader "boot_crc.c"!
+CRC32_POLY                      = 0x04C11DB7
+CRC32_SEED                      = 0x10101010
+
+# Size of chunk CRC-32 is calculated over at once
+CRC32_CHUNK_SIZE                = ( 16 * 1024 ) # bytes
+
+# Size of chunk binary files are streamed in
+STREAM_CHUNK_SIZE               = ( 64 * 1024 ) # bytes
+
+# Image job (batch manifest entry) fields and their defaults
+# NOTE: Same meaning as command line arguments!
+JOB_DEFAULTS                    = { "f": None, "o": None, "a": None, "s": False, "k": None, "c": False, "git": False,
+                                    "z": False, "delta_from": None, "data": [], "forward": [] }
+
+# Job fields holding file paths, relative to batch manifest
+JOB_PATH_FIELDS                 = [ "f", "o", "k", "delta_from" ]
+
 
 #################################################################################################
 ##  FUNCTIONS
@@ -110,13 +176,19 @@ def arg_parser():
                                         epilog="Enjoy the program!")
 
     # Add arguments
-    parser.add_argument("-f",   help="Input binary file",             metavar="bin_in",           type=str,   required=True )
-    parser.add_argument("-o",   help="Output binary file",            metavar="bin_out",          type=str,   required=True )
-    parser.add_argument("-a",   help="Start application address",     metavar="app_addr_start",   type=str,   required=True )
+    parser.add_argument("-f",   help="Input binary file",             metavar="bin_in",           type=str,   required=False )
+    parser.add_argument("-o",   help="Output binary file",            metavar="bin_out",          type=str,   required=False )
+    parser.add_argument("-a",   help="Start application address",     metavar="app_addr_start",   type=str,   required=False )
     parser.add_argument("-s",   help="Signing (ECSDA) binary file",   action="store_true",                    required=False )
     parser.add_argument("-k",   help="Private key for signature",     metavar="private_key",                  required=False )    
     parser.add_argument("-c",   help="Encrypt (AES-CTR) binary file", action="store_true",                    required=False )
     parser.add_argument("-git", help="Store Git SHA to image header", action="store_true",                    required=False )
+    parser.add_argument("-z",   help="Compress (heatshrink) binary file", action="store_true",                 required=False )
+    parser.add_argument("--delta-from", help="Also create delta image against base (previously generated) image", metavar="bin_base", type=str, required=False )
+    parser.add_argument("--data",       help="Also create multi-image container with data sub-image written to address", nargs=2, metavar=("addr", "bin_data"), action="append", default=[], required=False )
+    parser.add_argument("--forward",    help="Also create multi-image container with forwarded sub-image for target address", nargs=2, metavar=("addr", "bin_fwd"), action="append", default=[], required=False )
+    parser.add_argument("--batch",      help="Create all images listed in manifest (JSON) file", metavar="manifest", type=str, required=False )
+    parser.add_argument("-j",           help="Number of parallel batch workers (default: number of CPUs)", metavar="jobs", type=int, required=False )
 
     # Get args
     args = parser.parse_args()
@@ -124,36 +196,51 @@ def arg_parser():
     # Convert namespace to dict
     args = vars(args)
 
-    # Get arguments
-    file_in         = args["f"]
-    file_out        = args["o"]
+    # Single image requires input, output and address
+    if None == args["batch"] and ( None == args["f"] or None == args["o"] or None == args["a"] ):
+        parser.error( "arguments -f, -o and -a are required without --batch" )
 
-    # Convert to number
-    app_addr_start  = int(args["a"], 16)
+    return args
 
-    return file_in, file_out, app_addr_start, args["c"], args["s"], args["k"], args["git"]
+# ===============================================================================
+# @brief  Reflect (bit reverse) 32-bit value
+#
+# @param[in]    val     - Inputed value
+# @return       val     - Reflected value
+# ===============================================================================
+def crc32_reflect(val):
+    return int( "{:032b}".format( val )[::-1], 2 )
+
+# Bit reversal table of byte values
+CRC32_BITREV = bytes( int( "{:08b}".format( i )[::-1], 2 ) for i in range( 256 ))
 
 # ===============================================================================
 # @brief  Calculate CRC-32
 #
+# @note     Bootloader CRC-32 (poly: 0x04C11DB7, seed: 0x10101010) XORs each
+#           byte into low end of register and shifts it 32 times, which is
+#           MSB-first CRC-32 over byte zero-extended to big endian 32-bit word.
+#           Bytes are expanded to such words and fed into zlib CRC-32, which
+#           is reflected (LSB-first) variant of same poly, thus input bytes
+#           and register are bit reversed. Calculation runs in zlib (C code).
+#
 # @param[in]    data    - Inputed data
+# @param[in]    crc32   - CRC-32 of preceding data, seed for first chunk
 # @return       crc32   - Calculated CRC-32
 # ===============================================================================
-def calc_crc32(data):
-    poly = 0x04C11DB7
-    seed = 0x10101010
-    crc32 = seed
+def calc_crc32(data, crc32=CRC32_SEED):
 
-    for byte in data:
-        crc32 = (( crc32 ^ byte ) & 0xFFFFFFFF )
+    for ofs in range( 0, len( data ), CRC32_CHUNK_SIZE ):
+        chunk = bytes( data[ofs:ofs+CRC32_CHUNK_SIZE] )
 
-        for n in range( 32 ):
-            if 0x80000000 == ( crc32 & 0x80000000 ):
-                crc32 = (( crc32 << 1 ) ^ poly )
-            else:
-                crc32 = ( crc32 << 1 );
+        # Each byte into last byte of big endian word
+        words = bytearray( 4 * len( chunk ))
+        words[3::4] = chunk.translate( CRC32_BITREV )
+
+        # zlib inverts register before and after calculation
+        crc32 = crc32_reflect( zlib.crc32( words, crc32_reflect( crc32 ) ^ 0xFFFFFFFF ) ^ 0xFFFFFFFF )
 
-    return crc32 & 0xFFFFFFFF 
+    return crc32 & 0xFFFFFFFF
 
 # ===============================================================================
 # @brief  Calculate CRC-8
@@ -178,12 +265,14 @@ def calc_crc8(data):
     return crc8 & 0xFF
 
 # ===============================================================================
-# @brief  Crypt plaing data to AES with key and initial vector
+# @brief  Create AES cipher with key and initial vector
 #
-# @param[in]    plain_data      - Inputed non-cryptic data
-# @return       crypted_data    - Outputed cryptic data
+# @note     Cipher keeps counter position, thus data can be encrypted in
+#           consecutive chunks.
+#
+# @return       cipher  - AES-CTR cipher at start of image
 # ===============================================================================
-def aes_encode(plain_data):
+def aes_cipher():
 
     # AES Key and IV
     key = b"\x1b\x0e\x6c\x90\x34\xda\x00\x32\x33\xdd\x54\x54\x09\xcf\x23\x41"
@@ -191,101 +280,295 @@ def aes_encode(plain_data):
 
     # Create cipher
     ctr = Counter.new(128, initial_value=int(binascii.hexlify(iv), 16))
-    cipher = AES.new(key, AES.MODE_CTR, counter=ctr)
+
+    return AES.new(key, AES.MODE_CTR, counter=ctr)
+
+# ===============================================================================
+# @brief  Crypt plaing data to AES with key and initial vector
+#
+# @param[in]    plain_data      - Inputed non-cryptic data
+# @return       crypted_data    - Outputed cryptic data
+# ===============================================================================
+def aes_encode(plain_data):
 
     # Encode
-    return cipher.encrypt( bytearray( plain_data ))
+    return aes_cipher().encrypt( bytearray( plain_data ))
 
 # ===============================================================================
-# @brief  Binary file Class
+# @brief  Compress data
+#
+# @note     Greedy LZSS producing heatshrink compatible bit stream, MSB first:
+#               literal:        1, byte (8 bits)
+#               back-reference: 0, offset - 1 (window bits), length - 1 (lookahead bits)
+#           Last byte is padded with zero bits, which never form complete token.
+#
+# @param[in]    data        - Inputed data
+# @return       comp_data   - Compressed data
 # ===============================================================================
-class BinFile:
+def comp_encode(data):
+    window_size = ( 1 << COMP_WINDOW_BITS )
+    max_size    = ( 1 << COMP_LOOKAHEAD_BITS )
+    index       = {}
+    out         = bytearray()
+    acc         = 0
+    acc_cnt     = 0
+    i           = 0
+
+    while i < len( data ):
+        best_size   = 0
+        best_ofs    = 0
+
+        # Search recent positions with same two bytes inside window
+        cands = index.get( data[i:i+2], [] )
+
+        for pos in reversed( cands[-COMP_MAX_CANDIDATES:] ):
+            if ( i - pos ) > window_size:
+                break
+
+            size = 0
+            while size < max_size and ( i + size ) < len( data ) and data[pos+size] == data[i+size]:
+                size += 1
+
+            if size > best_size:
+                best_size   = size
+                best_ofs    = ( i - pos )
+
+                if size == max_size:
+                    break
+
+        # Back-reference is shorter than two literals
+        if best_size >= 2:
+            acc = ( acc << ( 1 + COMP_WINDOW_BITS + COMP_LOOKAHEAD_BITS )) | (( best_ofs - 1 ) << COMP_LOOKAHEAD_BITS ) | ( best_size - 1 )
+            acc_cnt += ( 1 + COMP_WINDOW_BITS + COMP_LOOKAHEAD_BITS )
+            step = best_size
+        else:
+            acc = ( acc << 9 ) | 0x100 | data[i]
+            acc_cnt += 9
+            step = 1
 
-    # Access type
-    READ_WRITE  = "r+b"      # Puts pointer to start of file 
-    WRITE_ONLY  = "wb"       # Erase complete file
-    READ_ONLY   = "rb"
-    APPEND      = "a+b"      # This mode puts pointer to EOF. Access: Read & Write
+        for n in range( step ):
+            index.setdefault( data[i+n:i+n+2], [] ).append( i + n )
 
-    # ===============================================================================
-    # @brief  Binary file constructor
-    #
-    # @param[in]    file    - File name
-    # @param[in]    access  - Access level
-    # @return       void
-    # ===============================================================================
-    def __init__(self, file, access=READ_ONLY):
+        i += step
 
-        # Store file name
-        self.file_name = file
+        while acc_cnt >= 8:
+            acc_cnt -= 8
+            out.append(( acc >> acc_cnt ) & 0xFF )
 
-        try:
-            # Open file if exsist
-            if os.path.isfile(file):
-                self.file = open( file, access )
-            else:
-                self.file = open( file, BinFile.WRITE_ONLY )
-        except Exception as e:
-            print(e)
-
-    # ===============================================================================
-    # @brief  Write to binary file
-    #
-    # @param[in]    addr    - Address to write to
-    # @param[in]    val     - Value to write as list
-    # @return       void
-    # ===============================================================================
-    def write(self, addr, val):
-        self.__set_ptr(addr)
-        self.file.write( bytearray( val ))
-
-    # ===============================================================================
-    # @brief  Read from binary file
-    #
-    # @param[in]    addr    - Address to read from
-    # @param[in]    size    - Sizeof read in bytes
-    # @return       data    - Readed data
-    # ===============================================================================
-    def read(self, addr, size):
-        self.__set_ptr(addr)
-        data = self.file.read(size)
-        return data
-    
-    # ===============================================================================
-    # @brief  Get size of binary file
-    #
-    # @return       data    - Readed data
-    # ===============================================================================    
-    def size(self):
-        return len( self.read( 0, None ))
-
-    # ===============================================================================
-    # @brief  Set file pointer
-    #
-    # @note     Pointer is being evaluated based on binary file value
-    #
-    # @param[in]    offset  - Pointer offset
-    # @return       void
-    # ===============================================================================
-    def __set_ptr(self, offset):
-        self.file.seek(offset)                    
+        acc &= (( 1 << acc_cnt ) - 1 )
+
+    # Pad last byte
+    if acc_cnt > 0:
+        out.append(( acc << ( 8 - acc_cnt )) & 0xFF )
+
+    return bytes( out )
+
+# ===============================================================================
+# @brief  Decompress data
+#
+# @param[in]    comp_data   - Compressed data
+# @param[in]    param       - Compression parameters from image header
+# @param[in]    size        - Size of decompressed data
+# @return       data        - Decompressed data
+# ===============================================================================
+def comp_decode(comp_data, param, size):
+    window_bits     = (( param >> 4 ) & 0x0F )
+    lookahead_bits  = ( param & 0x0F )
+    bits            = "".join( format( byte, "08b" ) for byte in comp_data )
+    out             = bytearray()
+    i               = 0
+
+    while len( out ) < size:
+        if "1" == bits[i]:
+            out.append( int( bits[i+1:i+9], 2 ))
+            i += 9
+        else:
+            ofs = int( bits[i+1:i+1+window_bits], 2 ) + 1
+            cnt = int( bits[i+1+window_bits:i+1+window_bits+lookahead_bits], 2 ) + 1
+            i += ( 1 + window_bits + lookahead_bits )
+
+            for _ in range( cnt ):
+                out.append( out[-ofs] )
+
+    return bytes( out[:size] )
+
+# ===============================================================================
+# @brief  Get plain application part of generated image
+#
+# @param[in]    image   - Generated image (header + application)
+# @return       plain   - Decrypted and decompressed application part of image
+# ===============================================================================
+def image_get_plain(image):
+    size = struct.unpack_from( 'I', image, APP_HEADER_IMAGE_SIZE_ADDR )[0]
+    data = image[APP_HEADER_SIZE_BYTE:]
+
+    if EncType.AES_CTR == image[APP_HEADER_ENC_TYPE_ADDR]:
+        data = aes_encode( data )
+
+    if CompType.HEATSHRINK == image[APP_HEADER_COMP_TYPE_ADDR]:
+        data = comp_decode( data, image[APP_HEADER_COMP_PARAM_ADDR], size )
+
+    return bytes( data[:size] )
+
+# ===============================================================================
+# @brief  Get image header as stored in flash by bootloader
+#
+# @note     Bootloader stores decompressed image, therefore compression
+#           fields are cleared.
+#
+# @param[in]    image   - Generated image (header + application)
+# @return       head    - Installed image header
+# ===============================================================================
+def image_get_installed_head(image):
+    head = bytearray( image[:APP_HEADER_SIZE_BYTE] )
+
+    if CompType.NONE != head[APP_HEADER_COMP_TYPE_ADDR]:
+        head[APP_HEADER_COMP_TYPE_ADDR] = CompType.NONE
+        head[APP_HEADER_COMP_PARAM_ADDR] = 0
+        head[APP_HEADER_CRC_ADDR] = calc_crc8( head[1:] )
+
+    return bytes( head )
+
+# ===============================================================================
+# @brief  Get size of match between base and new image
+#
+# @param[in]    base        - Base image
+# @param[in]    base_ofs    - Offset inside base image
+# @param[in]    new         - New image
+# @param[in]    new_ofs     - Offset inside new image
+# @return       size        - Number of equal bytes
+# ===============================================================================
+def delta_match_size(base, base_ofs, new, new_ofs):
+    size = 0
+    step = 64
+    max_size = min( len( base ) - base_ofs, len( new ) - new_ofs )
+
+    # Compare in blocks first
+    while ( size + step ) <= max_size and base[base_ofs+size:base_ofs+size+step] == new[new_ofs+size:new_ofs+size+step]:
+        size += step
+
+    while size < max_size and base[base_ofs+size] == new[new_ofs+size]:
+        size += 1
+
+    return size
+
+# ===============================================================================
+# @brief  Create delta patch
+#
+# @note     Greedy match search: every position of new image is looked up in
+#           index of base image blocks. Position following previous match
+#           is tried first, so unchanged regions shifted by the same offset
+#           end up in a single copy operation.
+#
+# @param[in]    base    - Base (installed) plain image
+# @param[in]    new     - New plain image
+# @return       ops     - Delta operations
+# ===============================================================================
+def delta_create(base, new):
+    index = {}
+
+    for i in range( len( base ) - DELTA_MATCH_BLOCK_SIZE + 1 ):
+        cands = index.setdefault( base[i:i+DELTA_MATCH_BLOCK_SIZE], [] )
+
+        if len( cands ) < DELTA_MAX_CANDIDATES:
+            cands.append( i )
+
+    ops         = bytearray()
+    new_data    = bytearray()
+    base_ofs    = 0
+    i           = 0
+
+    while i < len( new ):
+        best_size   = 0
+        best_ofs    = 0
+
+        for ofs in [ base_ofs ] + index.get( new[i:i+DELTA_MATCH_BLOCK_SIZE], [] ):
+            if ofs < len( base ):
+                size = delta_match_size( base, ofs, new, i )
+
+                if size > best_size:
+                    best_size   = size
+                    best_ofs    = ofs
+
+        # Copy from base image
+        if best_size >= DELTA_MIN_COPY_SIZE:
+            if len( new_data ) > 0:
+                ops += struct.pack( '<BI', DELTA_OP_DATA, len( new_data )) + new_data
+                new_data = bytearray()
+
+            ops += struct.pack( '<BII', DELTA_OP_COPY, best_ofs, best_size )
+
+            i           += best_size
+            base_ofs    = ( best_ofs + best_size )
+
+        # New data
+        else:
+            new_data.append( new[i] )
+
+            i           += 1
+            base_ofs    += 1
+
+    if len( new_data ) > 0:
+        ops += struct.pack( '<BI', DELTA_OP_DATA, len( new_data )) + new_data
+
+    return ops
+
+# ===============================================================================
+# @brief  Create delta image
+#
+# @note     Delta image header is header of new (full) image with delta image
+#           type. Bootloader stores it as application header after patching,
+#           thus header of delta and full upgrade are the same in flash.
+#
+# @param[in]    full_head   - Header of new (full) generated image
+# @param[in]    new_plain   - New plain image
+# @param[in]    base_image  - Base (previously generated) image
+# @return       delta_image - Delta image
+# ===============================================================================
+def delta_image_create(full_head, new_plain, base_image):
+
+    if APP_HEADER_VER_EXPECTED != base_image[APP_HEADER_VER_ADDR] or ImageType.APPLICATION != base_image[APP_HEADER_IMG_TYPE_ADDR]:
+        raise RuntimeError( "ERROR: Delta base must be full application image generated by this tool!" )
+
+    base_head = image_get_installed_head( base_image )
+    base_plain = image_get_plain( base_image )
+
+    # Patch: delta header + operations
+    patch = struct.pack( '<I', DELTA_MAGIC ) + generate_hash( base_head ) + struct.pack( '<I', len( base_plain ))
+    patch += delta_create( base_plain, new_plain )
+
+    # Same compression as full image
+    if CompType.HEATSHRINK == full_head[APP_HEADER_COMP_TYPE_ADDR]:
+        patch = comp_encode( patch )
+
+    # Same encryption as full image
+    if EncType.AES_CTR == full_head[APP_HEADER_ENC_TYPE_ADDR]:
+        patch = aes_encode( patch )
+
+    # Header of new image with delta image type
+    head = bytearray( full_head[:APP_HEADER_SIZE_BYTE] )
+    head[APP_HEADER_IMG_TYPE_ADDR] = ImageType.DELTA
+    head[APP_HEADER_CRC_ADDR] = calc_crc8( head[1:] )
+
+    return bytes( head ) + bytes( patch )
 
 # ===============================================================================
 # @brief  Generate ECDSA signature
 #
-# @note     Outputed signature is 64 bytes long!
+# @note     Outputed signature is 64 bytes long! Signing SHA-256 digest is
+#           equal to signing data itself, so data can be hashed in chunks.
 #
-# @param[in]    data        - Inputed data to sign
+# @param[in]    hash        - SHA-256 hash of data to sign
 # @param[in]    key_file    - Private key file location
 # @return       sig         - Digital signature
 # ===============================================================================
-def generate_signature(data, key_file):
+def generate_signature(hash, key_file):
 
     with open(key_file, "r") as f:
         key_pem = f.read()
 
     key = SigningKey.from_pem(key_pem)
-    sig = key.sign_deterministic(data, hashfunc=hashlib.sha256, sigencode=sigencode_string)
+    sig = key.sign_digest_deterministic(bytes( hash ), hashfunc=hashlib.sha256, sigencode=sigencode_string)
 
     return bytearray( sig )
 
@@ -311,159 +594,276 @@ def generate_hash(data):
     return bytearray( hash )
 
 # ===============================================================================
-# @brief:  Main 
+# @brief  Stream application part of input binary file
 #
-# @return: void
+# @param[in]    in_file     - Opened input binary file
+# @param[in]    pad_size    - Number of pad bytes appended to application
+# @return       chunk       - Next chunk of application (generator)
 # ===============================================================================
-def main():
-    
-    # Intro informations
-    print("====================================================================")
-    print("     %s" % TOOL_DESCRIPTION )
-    print("====================================================================")
+def image_stream(in_file, pad_size):
 
-    # Get arguments
-    file_path_in, file_path_out, app_addr_start, crypto_en, sign_en, private_key, git_en = arg_parser()
+    # Skip application header
+    in_file.seek( APP_HEADER_SIZE_BYTE )
+
+    chunk = in_file.read( STREAM_CHUNK_SIZE )
+
+    while len( chunk ) > 0:
+        yield chunk
+        chunk = in_file.read( STREAM_CHUNK_SIZE )
+
+    if pad_size > 0:
+        yield bytes([ PAD_VALUE ]) * pad_size
+
+# ===============================================================================
+# @brief  Create multi-image container
+#
+# @note     Application sub-image is stored as installed by bootloader (plain,
+#           not compressed), container itself is never compressed. Container
+#           CRC, hash and signature are calculated over manifest, which holds
+#           SHA-256 of each sub-image. Whole container is encrypted as single
+#           stream, same as full image.
+#
+# @param[in]    full_head   - Header of new (full) generated image
+# @param[in]    app_plain   - New plain image
+# @param[in]    job         - Image job with data and forward sub-images
+# @return       multi_image - Container image
+# ===============================================================================
+def multi_image_create(full_head, app_plain, job):
+
+    # Application first, then data and forwarded sub-images
+    subs = [( MultiType.APP, 0, image_get_installed_head( full_head ) + app_plain )]
+
+    for sub_type, sub_list in [( MultiType.DATA, job["data"] ), ( MultiType.FORWARD, job["forward"] )]:
+        for addr, file_path in sub_list:
+            with open( file_path, "rb" ) as f:
+                subs.append(( sub_type, addr, f.read() ))
+
+    if len( subs ) > MULTI_ENTRY_MAX:
+        raise RuntimeError( "ERROR: Container holds up to %d sub-images!" % MULTI_ENTRY_MAX )
+
+    # Manifest, unused entries are zero
+    manifest = struct.pack( '<IB3x', MULTI_MAGIC, len( subs ))
+
+    for sub_type, addr, data in subs:
+        if 0 == len( data ):
+            raise RuntimeError( "ERROR: Empty container sub-image!" )
+
+        manifest += struct.pack( '<B3xII', sub_type, addr, len( data )) + generate_hash( data )
+
+    manifest += bytes( MULTI_MANIFEST_SIZE - len( manifest ))
+
+    body = manifest + b"".join( data for _, _, data in subs )
+
+    # Header of new image with container image type
+    head = bytearray( full_head[:APP_HEADER_SIZE_BYTE] )
+    head[APP_HEADER_IMG_TYPE_ADDR] = ImageType.MULTI
+    head[APP_HEADER_COMP_TYPE_ADDR:APP_HEADER_COMP_TYPE_ADDR+2] = [ CompType.NONE, 0 ]
+    struct.pack_into( 'I', head, APP_HEADER_IMAGE_SIZE_ADDR, len( body ))
+    struct.pack_into( 'I', head, APP_HEADER_IMAGE_CRC_ADDR, calc_crc32( manifest ))
+
+    # Same signing as full image
+    if SigType.ECDSA == head[APP_HEADER_SIG_TYPE_ADDR]:
+        hash = generate_hash( manifest )
+        head[APP_HEADER_SIGNATURE_ADDR:APP_HEADER_SIGNATURE_ADDR+64] = generate_signature( hash, job["k"] )
+        head[APP_HEADER_HASH_ADDR:APP_HEADER_HASH_ADDR+32] = hash
+
+    # Same encryption as full image
+    if EncType.AES_CTR == head[APP_HEADER_ENC_TYPE_ADDR]:
+        body = aes_encode( body )
+        struct.pack_into( 'I', head, APP_HEADER_ENC_IMAGE_CRC_ADDR, calc_crc32( body ))
+
+    head[APP_HEADER_CRC_ADDR] = calc_crc8( head[1:] )
+
+    return bytes( head ) + bytes( body )
+
+# ===============================================================================
+# @brief  Create image (and its delta and container images)
+#
+# @note     Input binary is streamed twice: first pass calculates CRC and hash
+#           of plain image, second one encrypts and writes it. Complete plain
+#           image is kept in memory only for compression, delta and container.
+#
+# @param[in]    job     - Image job, fields according to "JOB_DEFAULTS"
+# @param[out]   log     - Progress messages
+# @return       void
+# ===============================================================================
+def image_create(job, log):
+
+    file_path_in    = job["f"]
+    file_path_out   = job["o"]
 
     # Check for correct file extension 
     if "bin" != file_path_in.split(".")[-1] or "bin" != file_path_out.split(".")[-1]:
-        print( "ERROR: Invalid file format" )
-        raise RuntimeError 
-    
-    if True == sign_en and None == private_key:
-        print( "ERROR: Missing private key when application signing is enabled!" )
-        raise RuntimeError 
-    
-    # Both files are binary
-    else:
-        # Copy inputed binary file
-        shutil.copyfile( file_path_in, file_path_out )
+        raise RuntimeError( "ERROR: Invalid file format" )
+
+    if os.path.abspath( file_path_in ) == os.path.abspath( file_path_out ):
+        raise RuntimeError( "ERROR: Output file shall differ from input file!" )
+
+    if True == job["s"] and None == job["k"]:
+        raise RuntimeError( "ERROR: Missing private key when application signing is enabled!" )
 
-        # Open outputed binary file
-        out_file = BinFile( file_path_out, access=BinFile.READ_WRITE)
+    with open( file_path_in, "rb" ) as in_file:
+
+        head = bytearray( in_file.read( APP_HEADER_SIZE_BYTE ))
 
         # Is application header version supported
-        if APP_HEADER_VER_EXPECTED == out_file.read( APP_HEADER_VER_ADDR, 1 )[0]:
+        if APP_HEADER_SIZE_BYTE != len( head ) or APP_HEADER_VER_EXPECTED != head[APP_HEADER_VER_ADDR]:
+            raise RuntimeError( "ERROR: Application header version not supported!" )
 
-            ######################################################################################
-            ## GENERAL HEADER INFO
-            ######################################################################################
+        ######################################################################################
+        ## GENERAL HEADER INFO
+        ######################################################################################
 
-            # Preparing image header for application
-            out_file.write( APP_HEADER_IMG_TYPE_ADDR, [ImageType.APPLICATION] )
+        # Preparing image header for application
+        head[APP_HEADER_IMG_TYPE_ADDR] = ImageType.APPLICATION
 
-            # Write app start address into application header
-            out_file.write( APP_HEADER_IMAGE_ADDR_ADDR, struct.pack('I', int(app_addr_start)))
+        # Write app start address into application header
+        struct.pack_into( 'I', head, APP_HEADER_IMAGE_ADDR_ADDR, int( job["a"] ))
 
-            # Git SHA info
-            if git_en:
+        # Git SHA info
+        if job["git"]:
 
-                # Get commit SHA
-                GIT_COMMIT_SHA_CMD = "git rev-parse HEAD"
-                commit_sha = subprocess.check_output( GIT_COMMIT_SHA_CMD )[:-1] 
+            # Get commit SHA
+            GIT_COMMIT_SHA_CMD = "git rev-parse HEAD"
+            commit_sha = subprocess.check_output( GIT_COMMIT_SHA_CMD )[:-1] 
 
-                # Write Git SHA to application header
-                out_file.write( APP_HEADER_GIT_SHA_ADDR, commit_sha[:8] )
+            # Write Git SHA to application header
+            head[APP_HEADER_GIT_SHA_ADDR:APP_HEADER_GIT_SHA_ADDR+8] = commit_sha[:8]
 
-            ######################################################################################
-            ## IMAGE PADDING
-            ######################################################################################
+        ######################################################################################
+        ## IMAGE PADDING
+        ######################################################################################
 
-            # Count application size
-            app_size = out_file.size()
+        # Count application size
+        in_file.seek( 0, os.SEEK_END )
+        file_size = in_file.tell()
+        pad_size = 0
 
-            # Is pad enable
-            if PAD_ENABLE:
+        # Is pad enable
+        if PAD_ENABLE:
 
-                # Calculate number of bytes need to be padded
-                num_of_bytes_to_pad = ( PAD_BLOCK_SIZE_BYTE - ( app_size % PAD_BLOCK_SIZE_BYTE ))
+            # Calculate number of bytes need to be padded
+            num_of_bytes_to_pad = ( PAD_BLOCK_SIZE_BYTE - ( file_size % PAD_BLOCK_SIZE_BYTE ))
 
-                # Binary needs to be padded
-                if ( num_of_bytes_to_pad < PAD_BLOCK_SIZE_BYTE ):
+            # Binary needs to be padded
+            if ( num_of_bytes_to_pad < PAD_BLOCK_SIZE_BYTE ):
 
-                    # Pad file
-                    out_file.write( app_size, [ PAD_VALUE for _ in range( num_of_bytes_to_pad ) ])
+                # Pad while streaming
+                pad_size = num_of_bytes_to_pad
 
-                    print("INFO: Binary padded with %d byte!" % num_of_bytes_to_pad )
+                log.append("INFO: Binary padded with %d byte!" % num_of_bytes_to_pad )
 
-            # Get application size
-            ## NOTE: Application size exclude size of header!
-            app_size = ( out_file.size() - APP_HEADER_SIZE_BYTE )
+        # Get application size
+        ## NOTE: Application size exclude size of header!
+        app_size = ( file_size + pad_size - APP_HEADER_SIZE_BYTE )
 
-            # Write app lenght into application header
-            out_file.write( APP_HEADER_IMAGE_SIZE_ADDR, struct.pack('I', int(app_size)))
+        # Write app lenght into application header
+        struct.pack_into( 'I', head, APP_HEADER_IMAGE_SIZE_ADDR, int( app_size ))
 
+        ######################################################################################
+        ## CALCULATE OPEN APPLICATION PART OF IMAGE CRC AND HASH
+        ######################################################################################
 
-            ######################################################################################
-            ## CALCULATE OPEN APPLICATION PART OF IMAGE CRC
-            ######################################################################################
+        # Calculate application CRC and hash in single pass
+        # NOTE: Start calculation after application header and before crypting of the image!
+        app_crc = CRC32_SEED
+        sha256_hash = hashlib.sha256()
 
-            # Calculate application CRC
-            # NOTE: Start calculation after application header and after crypting of the image!
-            app_crc = calc_crc32( out_file.read( APP_HEADER_SIZE_BYTE, None ))
+        for chunk in image_stream( in_file, pad_size ):
+            app_crc = calc_crc32( chunk, app_crc )
+            sha256_hash.update( chunk )
 
-            # Write app CRC into application header
-            out_file.write( APP_HEADER_IMAGE_CRC_ADDR, struct.pack('I', int(app_crc)))            
+        # Write app CRC into application header
+        struct.pack_into( 'I', head, APP_HEADER_IMAGE_CRC_ADDR, int( app_crc ))
 
+        ######################################################################################
+        ## IMAGE SIGNING
+        ######################################################################################
 
-            ######################################################################################
-            ## IMAGE SIGNING
-            ######################################################################################
+        # Signing application
+        if job["s"]:
 
-            # Signing application
-            if sign_en:
-                
-                # Generate signature
-                signature = generate_signature( out_file.read( APP_HEADER_SIZE_BYTE, None ), private_key )
+            # Generate hash and its signature
+            hash = bytearray( sha256_hash.digest() )
+            signature = generate_signature( hash, job["k"] )
 
-                # Generate hash
-                hash = generate_hash( out_file.read( APP_HEADER_SIZE_BYTE, None ))
+            # Add signature, signature type and hash to application header
+            head[APP_HEADER_SIGNATURE_ADDR:APP_HEADER_SIGNATURE_ADDR+64] = signature
+            head[APP_HEADER_SIG_TYPE_ADDR] = SigType.ECDSA
+            head[APP_HEADER_HASH_ADDR:APP_HEADER_HASH_ADDR+32] = hash
 
-                # Add signature to application header
-                out_file.write( APP_HEADER_SIGNATURE_ADDR, signature )
+            # Succes info
+            log.append("SUCCESS: Firmware image successfully signed!")
+
+        else:
 
-                # Add signature type
-                out_file.write( APP_HEADER_SIG_TYPE_ADDR, [SigType.ECDSA] )
+            # Add signature type
+            head[APP_HEADER_SIG_TYPE_ADDR] = SigType.NONE
+
+        # Complete plain image is needed only by compression, delta and container
+        app_plain = None
+
+        if job["z"] or job["delta_from"] or job["data"] or job["forward"]:
+            app_plain = b"".join( image_stream( in_file, pad_size ))
+
+        with open( file_path_out, "wb" ) as out_file:
+
+            # Header is written at last, when all of its fields are known
+            out_file.write( bytes( APP_HEADER_SIZE_BYTE ))
+
+            ######################################################################################
+            ## IMAGE COMPRESSION
+            ######################################################################################
 
-                # Add hash to application header
-                out_file.write( APP_HEADER_HASH_ADDR, hash )                
+            # Compress after image CRC, hash and signature of plain image are calculated
+            if job["z"]:
+
+                # Compress application part, skip application header
+                app_comp = comp_encode( app_plain )
+                app_data = [ app_comp ]
+
+                # Set compression type and parameters
+                head[APP_HEADER_COMP_TYPE_ADDR:APP_HEADER_COMP_TYPE_ADDR+2] = [ CompType.HEATSHRINK, (( COMP_WINDOW_BITS << 4 ) | COMP_LOOKAHEAD_BITS ) ]
 
                 # Succes info
-                print("SUCCESS: Firmware image successfully signed!")  
+                log.append("SUCCESS: Firmware image successfully compressed, %d -> %d bytes (%.1f %%)!" % ( len( app_plain ), len( app_comp ), ( 100.0 * len( app_comp ) / len( app_plain ))))
 
             else:
+                # Set compression type
+                head[APP_HEADER_COMP_TYPE_ADDR:APP_HEADER_COMP_TYPE_ADDR+2] = [ CompType.NONE, 0 ]
 
-                # Add signature type
-                out_file.write( APP_HEADER_SIG_TYPE_ADDR, [SigType.NONE] )
-
+                # Stream plain image
+                app_data = image_stream( in_file, pad_size )
 
             ######################################################################################
             ## IMAGE ENCRYPTION
             ######################################################################################
 
-            # Add encryption type if encryption enabled
-            if crypto_en:
+            # Encrypt application part chunk by chunk, cipher continues over chunks
+            # NOTE: Encrypted image CRC is calculated after crypting of the image!
+            cipher = ( aes_cipher() if job["c"] else None )
+            enc_crc = CRC32_SEED
 
-                # Set encryption type 
-                out_file.write( APP_HEADER_ENC_TYPE_ADDR, [EncType.AES_CTR] )  
+            for chunk in app_data:
+                if None != cipher:
+                    chunk = cipher.encrypt( chunk )
+                    enc_crc = calc_crc32( chunk, enc_crc )
 
-                # Encrypt application part, skip application header
-                #file_crypted_out.write( APP_HEADER_SIZE_BYTE, aes_encode( out_file.read( APP_HEADER_SIZE_BYTE, out_file.size() - APP_HEADER_SIZE_BYTE )))
-                out_file.write( APP_HEADER_SIZE_BYTE, aes_encode( out_file.read( APP_HEADER_SIZE_BYTE, None )))
+                out_file.write( chunk )
 
-                # Succes info
-                print("SUCCESS: Firmware image successfully crypted!")    
+            # Add encryption type if encryption enabled
+            if job["c"]:
 
-                # Calculate encrypted application CRC
-                # NOTE: Start calculation after application header and after crypting of the image!
-                app_crc = calc_crc32( out_file.read( APP_HEADER_SIZE_BYTE, None ))
+                # Set encryption type and encrypted app CRC
+                head[APP_HEADER_ENC_TYPE_ADDR] = EncType.AES_CTR
+                struct.pack_into( 'I', head, APP_HEADER_ENC_IMAGE_CRC_ADDR, int( enc_crc ))
 
-                # Write encrypted app CRC into application header
-                out_file.write( APP_HEADER_ENC_IMAGE_CRC_ADDR, struct.pack('I', int(app_crc)))
+                # Succes info
+                log.append("SUCCESS: Firmware image successfully crypted!")
 
             else:
                 # Set encryption type
-                out_file.write( APP_HEADER_ENC_TYPE_ADDR, [EncType.NONE] ) 
+                head[APP_HEADER_ENC_TYPE_ADDR] = EncType.NONE
 
             ######################################################################################
             ## LAST STEP IS TO CALCULATE IMAGE (APP) HEADER CRC 
@@ -471,23 +871,185 @@ def main():
 
             # Calculate application header CRC after all fields are header fields are setup!
             # NOTE: Ignore first field as it is CRC value itself!
-            app_header_crc = calc_crc8( out_file.read( 1, APP_HEADER_SIZE_BYTE - 1 ))
+            head[APP_HEADER_CRC_ADDR] = calc_crc8( head[1:] )
 
-            # Write application header crc
-            out_file.write( APP_HEADER_CRC_ADDR, [app_header_crc] )
+            # Write application header
+            out_file.seek( 0 )
+            out_file.write( head )
 
-            # Success info
-            print("SUCCESS: Image (application) header successfully filled!")            
+            out_file.seek( 0, os.SEEK_END )
+            full_size = out_file.tell()
 
-        else:
-            print( "ERROR: Application header version not supported!" ) 
-            raise RuntimeError 
+    # Success info
+    log.append("SUCCESS: Image (application) header successfully filled!")
+
+    ######################################################################################
+    ## DELTA IMAGE
+    ######################################################################################
+
+    if job["delta_from"]:
+
+        # Delta image is stored next to full image
+        file_path_delta = file_path_out[:-len(".bin")] + "__DELTA.bin"
+
+        with open( job["delta_from"], "rb" ) as f:
+            base_image = f.read()
+
+        delta_image = delta_image_create( head, app_plain, base_image )
+
+        with open( file_path_delta, "wb" ) as f:
+            f.write( delta_image )
+
+        # Success info
+        log.append("SUCCESS: Delta image %s created, %d bytes (%.1f %% of full image)!" % ( file_path_delta, len( delta_image ), ( 100.0 * len( delta_image ) / full_size )))
+
+    ######################################################################################
+    ## MULTI-IMAGE CONTAINER
+    ######################################################################################
+
+    if job["data"] or job["forward"]:
+
+        # Container is stored next to full image
+        file_path_multi = file_path_out[:-len(".bin")] + "__MULTI.bin"
+
+        multi_image = multi_image_create( head, app_plain, job )
+
+        with open( file_path_multi, "wb" ) as f:
+            f.write( multi_image )
+
+        # Success info
+        log.append("SUCCESS: Container image %s created, %d sub-images, %d bytes!" % ( file_path_multi, ( 1 + len( job["data"] ) + len( job["forward"] )), len( multi_image )))
+
+# ===============================================================================
+# @brief  Create image job
+#
+# @note     Addresses are hex strings (command line) or numbers, paths are
+#           relative to base directory.
+#
+# @param[in]    fields      - Job fields, missing ones get default value
+# @param[in]    base_dir    - Base directory of relative paths
+# @return       job         - Image job
+# ===============================================================================
+def job_create(fields, base_dir=""):
+    job = dict( JOB_DEFAULTS )
+
+    for key, val in fields.items():
+        if key not in JOB_DEFAULTS:
+            raise RuntimeError( "ERROR: Unknown image field \"%s\"!" % key )
+
+        job[key] = val
+
+    if None == job["f"] or None == job["o"] or None == job["a"]:
+        raise RuntimeError( "ERROR: Image requires input (f), output (o) and address (a)!" )
+
+    for key in JOB_PATH_FIELDS:
+        if None != job[key]:
+            job[key] = os.path.join( base_dir, job[key] )
+
+    to_addr = lambda addr: ( int( addr, 16 ) if isinstance( addr, str ) else int( addr ))
+
+    job["a"]        = to_addr( job["a"] )
+    job["data"]     = [( to_addr( addr ), os.path.join( base_dir, file_path )) for addr, file_path in job["data"] ]
+    job["forward"]  = [( to_addr( addr ), os.path.join( base_dir, file_path )) for addr, file_path in job["forward"] ]
+
+    return job
+
+# ===============================================================================
+# @brief  Run single image job of batch
+#
+# @note     Executed by worker process, errors are reported back instead of
+#           raised, so that other images of batch are still created.
+#
+# @param[in]    job     - Image job
+# @return       result  - Output file, success and progress messages
+# ===============================================================================
+def batch_job(job):
+    log = []
+    ok  = True
+
+    try:
+        image_create( job, log )
+    except Exception as e:
+        log.append( str( e ))
+        ok = False
+
+    return job["o"], ok, log
+
+# ===============================================================================
+# @brief  Create all images listed in batch manifest
+#
+# @note     Manifest is JSON object with optional "defaults" object applied to
+#           each image and "images" list of image objects. Image fields are
+#           named after command line arguments, see "JOB_DEFAULTS". Images are
+#           created in parallel by worker processes.
+#
+# @param[in]    manifest_path   - Batch manifest file
+# @param[in]    workers         - Number of worker processes, None for number of CPUs
+# @return       void
+# ===============================================================================
+def batch_run(manifest_path, workers):
+
+    with open( manifest_path, "r" ) as f:
+        manifest = json.load( f )
+
+    base_dir = os.path.dirname( manifest_path )
+    defaults = manifest.get( "defaults", {} )
+    jobs = [ job_create( { **defaults, **fields }, base_dir ) for fields in manifest["images"] ]
+
+    with multiprocessing.Pool( processes=workers ) as pool:
+        results = pool.map( batch_job, jobs )
+
+    failed = 0
+
+    for file_out, ok, log in results:
+        print( "--- %s" % file_out )
+
+        for line in log:
+            print( line )
+
+        if not ok:
+            failed += 1
+
+    if failed > 0:
+        raise RuntimeError( "ERROR: %d of %d images failed!" % ( failed, len( jobs )))
+
+    print( "SUCCESS: %d images created!" % len( jobs ))
+
+# ===============================================================================
+# @brief:  Main 
+#
+# @return: void
+# ===============================================================================
+def main():
+    
+    # Intro informations
+    print("====================================================================")
+    print("     %s" % TOOL_DESCRIPTION )
+    print("====================================================================")
+
+    # Get arguments
+    args = arg_parser()
+
+    # Images of manifest
+    if args["batch"]:
+        batch_run( args["batch"], args["j"] )
+
+    # Single image
+    else:
+        log = []
+
+        try:
+            image_create( job_create({ key: args[key] for key in JOB_DEFAULTS }), log )
+        finally:
+            for line in log:
+                print( line )
 
 
 #################################################################################################
 ##  MAIN ENTRY
 #################################################################################################   
 if __name__ == "__main__":
+    multiprocessing.freeze_support()
     main()
 
 #################################################################################################
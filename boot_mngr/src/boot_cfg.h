@@ -0,0 +1,956 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_cfg.h
+*@brief     Boot Manager host configuration
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_CFG_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __BOOT_CFG_H
+#define __BOOT_CFG_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// USER CODE BEGIN...
+
+#include <assert.h>
+#include <stdio.h>
+
+// Image header (on target included through project configuration)
+#include "revision/revision/src/version.h"
+
+// Serial ports and time base
+#include "boot_port.h"
+
+// USER CODE END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// USER CODE BEGIN...
+
+/**
+ *      Application header address in flash
+ */
+#define BOOT_CFG_APP_HEAD_ADDR                  ( 0x08010000 )
+
+/**
+ *      Start of application address
+ *
+ *  @note   This is where vector table is starting!
+ *
+ *  @note   For some uC vector offseting must be multiple of sizes larger
+ *          than aplication header (which is 256 bytes in size). Therefore
+ *          for such uC there will be void between application header and
+ *          application start aka. vector table. Therefore application start
+ *          address might not be at the end of application header!
+ */
+#define BOOT_CFG_APP_START_ADDR                 ( 0x08010200 )
+
+/**
+ *      Maximum allowed application size
+ *
+ *  @brief  How much space do we have in memory for application code.
+ *
+ *  @note   Example of 512kB flash: application region 0x08010000 -
+ *          0x0807F800 is 446kB = 512kB (Full flash) - 64kB (bootloader) -
+ *          2kB (DCT). With A/B slots or delta upgrade region is split into
+ *          halves of 222kB, second half at 0x08047800 holds slot B or base
+ *          image copy, each half leaves 1kB for image header.
+ *
+ *  Unit: byte
+ */
+#define BOOT_CFG_APP_SIZE_MAX                   ((( 1 == BOOT_CFG_AB_SLOT_EN ) || ( 1 == BOOT_CFG_DELTA_EN )) ? ( 221U * 1024U ) : ( 446U * 1024U ))
+
+/**
+ *      Enable/Disable A/B application slots
+ *
+ * @note    New image is written to second slot while installed application
+ *          stays intact. Newest valid image is booted, on failed image
+ *          validation or boot counter limit bootloader rolls back to image
+ *          in other slot. "BOOT_CFG_APP_SIZE_MAX" applies to each slot.
+ *
+ * @note    Slot A is described by "BOOT_CFG_APP_HEAD_ADDR" and
+ *          "BOOT_CFG_APP_START_ADDR".
+ */
+#define BOOT_CFG_AB_SLOT_EN                     ( 0 )
+
+#if ( 1 == BOOT_CFG_AB_SLOT_EN )
+
+    /**
+     *  Slot B application header address in flash
+     */
+    #define BOOT_CFG_APP_B_HEAD_ADDR            ( 0x08047800 )
+
+    /**
+     *  Slot B start of application address (vector table)
+     */
+    #define BOOT_CFG_APP_B_START_ADDR           ( 0x08047A00 )
+
+    /**
+     *  Enable/Disable bank swap
+     *
+     *  @note   For dual-bank MCUs. Slot A and slot B are flash banks, image
+     *          is linked for slot A address and slot B image is started by
+     *          swapping banks with "boot_if_bank_swap()". Bootloader must be
+     *          present in both banks!
+     *
+     *          When disabled slots are executed in place, thus image must be
+     *          linked for slot it is written to (reported by info message).
+     */
+    #define BOOT_CFG_BANK_SWAP_EN               ( 0 )
+
+#endif
+
+/**
+ *      Enable/Disable new firmware size check
+ *
+ * @note    At prepare command bootloader will check if new firmware app
+ *          can be fitted into "BOOT_CFG_APP_SIZE" space, if that macro
+ *          is enabled!
+ */
+#define BOOT_CFG_FW_SIZE_CHECK_EN              ( 1 )
+
+/**
+ *      Enable/Disable new firmware version compatibility check
+ */
+#define BOOT_CFG_FW_VER_CHECK_EN               ( 0 )
+
+/**
+ *      New firmware compatibility value
+ *
+ *  @note   New firmware version is compatible up to
+ *          version specified in following defines.
+ */
+#if ( 1 == BOOT_CFG_FW_VER_CHECK_EN )
+    #define BOOT_CFG_FW_VER_MAJOR               ( 0 )
+    #define BOOT_CFG_FW_VER_MINOR               ( 1 )
+    #define BOOT_CFG_FW_VER_DEVELOP             ( 2 )
+    #define BOOT_CFG_FW_VER_TEST                ( 3 )
+#endif
+
+/**
+ *      Enable/Disable firmware downgrade
+ *
+ * @note    At prepare command bootloader will check if new firmware app
+ *          has higher version than current, if that macro is enabled!
+ */
+#define BOOT_CFG_FW_DOWNGRADE_EN                ( 1 )
+
+/**
+ *      Enable/Disable new firmware version compatibility check
+ */
+#define BOOT_CFG_HW_VER_CHECK_EN                ( 0 )
+
+/**
+ *      New firmware hardware compatibility value
+ *
+ *  @note   New firmware hardware version is compatible up to
+ *          version specified in following defines.
+ */
+#if ( 1 == BOOT_CFG_HW_VER_CHECK_EN )
+    #define BOOT_CFG_HW_VER_MAJOR               ( 1 )
+    #define BOOT_CFG_HW_VER_MINOR               ( 0 )
+    #define BOOT_CFG_HW_VER_DEVELOP             ( 0 )
+    #define BOOT_CFG_HW_VER_TEST                ( 0 )
+#endif
+
+/**
+ *      Enable/Disable new firmware version digital signature check
+ *
+ * @note    At prepare command bootloader will check for valid
+ *          digital signature based on hash and signature field in
+ *          new image header.
+ */
+#define BOOT_CFG_DIGITAL_SIGN_EN                ( 1 )
+
+/**
+ *      ECDSA curve
+ *
+ * @note    Options:
+ *              BOOT_ECDSA_CURVE_SECP256K1  - secp256k1
+ *              BOOT_ECDSA_CURVE_SECP256R1  - secp256r1 (NIST P-256), can be
+ *                                            verified by PKA/CryptoCell HW
+ *
+ *          Only selected curve is compiled into micro-ecc. Image signing key
+ *          shall be generated on the same curve!
+ */
+#define BOOT_CFG_ECDSA_CURVE                    ( BOOT_ECDSA_CURVE_SECP256K1 )
+
+/**
+ *      micro-ecc optimization level
+ *
+ * @note    Larger values produce faster but larger code. Supported values
+ *          are 0 to 2, 0 is unusably slow (levels 3 and 4 require unrolled
+ *          ARM assembly not distributed with bootloader).
+ */
+#define BOOT_CFG_ECDSA_OPT_LEVEL                ( 2 )
+
+/**
+ *      Enable/Disable micro-ecc dedicated squaring function
+ *
+ * @note    Faster signature verification for few hundred bytes of flash.
+ */
+#define BOOT_CFG_ECDSA_SQUARE_EN                ( 0 )
+
+/**
+ *      Enable/Disable micro-ecc ARM assembly
+ *
+ * @note    Inline assembly of "asm_arm.inc" used on ARM targets. When
+ *          disabled portable C implementation is used.
+ */
+#define BOOT_CFG_ECDSA_ASM_EN                   ( 0 )
+
+/**
+ *      Enable/Disable hardware ECDSA verification
+ *
+ * @note    Signature is verified with "boot_if_ecdsa_verify()" (PKA,
+ *          CryptoCell or crypto library) instead of micro-ecc. Interface
+ *          shall validate public key on its own.
+ */
+#define BOOT_CFG_ECDSA_HW_EN                    ( 0 )
+
+/**
+ *  Enable/Disable firmware binary encryption
+ */
+#define BOOT_CFG_CRYPTION_EN                    ( 0 )
+
+#if ( 1 == BOOT_CFG_CRYPTION_EN )
+
+    /**
+     *  Enable/Disable in-place decryption
+     *
+     *  @note   When enabled flash data are decrypted directly inside reception
+     *          buffer, thus "boot_if_decrypt_data()" must support same input
+     *          and output buffer. Saves "BOOT_CFG_DATA_PAYLOAD_SIZE" bytes of
+     *          RAM and one copy of data. With asynchronous flash writes data
+     *          are always decrypted directly into write pipeline.
+     */
+    #define BOOT_CFG_DECRYPT_IN_PLACE_EN        ( 1 )
+
+#endif
+
+/**
+ *      Image CRC-32 engine
+ *
+ * @note    All engines produce the same CRC, they only differ in speed and
+ *          flash footprint. Options:
+ *
+ *              BOOT_CRC32_ENGINE_BITWISE   - Bitwise, no tables (slowest)
+ *              BOOT_CRC32_ENGINE_NIBBLE    - Nibble table, 64 bytes of flash
+ *              BOOT_CRC32_ENGINE_SLICE4    - Slice-by-4 tables, 7 kB of flash
+ *              BOOT_CRC32_ENGINE_SLICE8    - Slice-by-8 tables, 11 kB of flash
+ *              BOOT_CRC32_ENGINE_HW        - Hardware CRC unit, implement "boot_if_crc32_hw()"
+ */
+#define BOOT_CFG_CRC32_ENGINE                   ( BOOT_CRC32_ENGINE_SLICE4 )
+
+/**
+ *      Image validation read chunk size
+ *
+ * @note    Size of block in bytes read from flash at once during image
+ *          validation. Not used when flash is memory mapped, see
+ *          "boot_if_flash_is_mapped()".
+ *
+ *  Unit: byte
+ */
+#define BOOT_CFG_VALIDATE_CHUNK_SIZE            ( 256U )
+
+/**
+ *      Enable/Disable flash read-back check
+ *
+ * @note    Image is validated at exit command based on digest calculated
+ *          while flashing. With read-back check enabled each written block
+ *          is additionally read back and compared with received data.
+ */
+#define BOOT_CFG_FLASH_READBACK_EN              ( 0 )
+
+/**
+ *      Enable/Disable validation cache
+ *
+ * @note    After successful full validation bootloader stores validation
+ *          record (header hash, public key fingerprint and sampled CRC) to
+ *          "BOOT_CFG_VALID_CACHE_ADDR". Following boots only check that
+ *          record instead of complete image CRC/signature.
+ *
+ * @note    Record is protected by CRC only, thus anyone with write access
+ *          to flash can forge it. Enable it only when boot time is more
+ *          important than re-checking signature on each boot!
+ */
+#define BOOT_CFG_VALID_CACHE_EN                 ( 0 )
+
+#if ( 1 == BOOT_CFG_VALID_CACHE_EN )
+
+    /**
+     *  Validation cache record address
+     *
+     *  @note   Must be located in its own erasable flash area outside
+     *          application region!
+     */
+    #define BOOT_CFG_VALID_CACHE_ADDR           ( 0x0800F800 )
+
+    /**
+     *  Number of sampled image blocks checked on fast validation
+     */
+    #define BOOT_CFG_VALID_CACHE_SAMPLES        ( 8U )
+
+    /**
+     *  Do full validation every N boots
+     *
+     *  @note   Boots are counted in shared memory, therefore counting
+     *          restarts after power loss.
+     */
+    #define BOOT_CFG_VALID_CACHE_FULL_CHECK_PERIOD  ( 16U )
+
+#endif
+
+/**
+ *      Enable/Disable boot counting check
+ *
+ * @note    Boot count is safety mechanism build into bootloader
+ *          in order to detect malfunctional application!
+ */
+#define BOOT_CFG_APP_BOOT_CNT_CHECK_EN          ( 0 )
+
+/**
+ *      Boot counts limit
+ *
+ *  @note   After boot count reaches that limit it will
+ *          not enter application! Bootloader will declare
+ *          a faulty app and will request new application!
+ */
+#if ( 1 == BOOT_CFG_APP_BOOT_CNT_CHECK_EN )
+    #define BOOT_CFG_BOOT_CNT_LIMIT               ( 5 )
+#endif
+
+/**
+ *      Bootloader back-door entry timeout
+ *
+ * @note    Wait specified amount of time before entering application
+ *          code at bootloader startup if application is validated OK.
+ *
+ *          To disable waiting set to timeout to 0.
+ *
+ *  Unit: ms
+ */
+#define BOOT_CFG_WAIT_AT_STARTUP_MS             ( 100U )
+
+/**
+ *      Enable/Disable fast boot
+ *
+ * @note    Back-door entry window (BOOT_CFG_WAIT_AT_STARTUP_MS) is opened
+ *          only on request, otherwise valid application is started right
+ *          after validation. Window is requested by interface function
+ *          "boot_if_backdoor_requested()" (e.g. strap pin, watchdog or
+ *          brown-out reset) or by application with boot reason
+ *          "eBOOT_REASON_BACKDOOR".
+ *
+ *          Window is counted from start of image validation, frames
+ *          received meanwhile wait in reception buffer.
+ */
+#define BOOT_CFG_FAST_BOOT_EN                   ( 0 )
+
+/**
+ *  Bootloader idle timeout time in various states
+ *
+ *  @note   This timeout resets the bootloader upgrade state machine in case
+ *          FW upgrade started and communication activity stops.
+ *
+ *          After that time bootloader state machine enters IDLE state and waits
+ *          for fw upgrade process to re-start.
+ *
+ * @note    Prepare idle timeout shall be bigger than time to erase app region in flash!
+ *          With erase-ahead enabled only first sector is erased at prepare.
+ *
+ *  Unit: ms
+ */
+#define BOOT_CFG_PREPARE_IDLE_TIMEOUT_MS        ( 5000U )
+#define BOOT_CFG_FLASH_IDLE_TIMEOUT_MS          ( 100U )
+#define BOOT_CFG_EXIT_IDLE_TIMEOUT_MS           ( 5000U )
+
+/**
+ *      Reception buffer size
+ *
+ *  Unit: byte
+ */
+#define BOOT_CFG_RX_BUF_SIZE                    ( 8 * 1024 )
+
+/**
+ *      Enable/Disable block reception
+ *
+ * @note    When enabled, parser reads received data with
+ *          "boot_if_receive_block()" up to the end of currently parsed
+ *          header or payload at once, instead of byte by byte with
+ *          "boot_if_receive()". Suited for DMA/idle-line UART reception
+ *          and for frame based transports (USB bulk, CAN-TP).
+ */
+#define BOOT_CFG_RX_BLOCK_EN                    ( 1 )
+
+/**
+ *      Maximum size of flash data payload command
+ *
+ * @note    Upper limit of flash data payload size negotiated at connect
+ *          command. Boot Manager can request smaller frames for noisy
+ *          links. Complete frame (payload + 14 bytes) must fit into
+ *          reception buffer and size shall be multiple of flash write
+ *          size. Stage buffer, flash write pipeline slots, decryption and
+ *          external flash buffers are sized by it, thus large frames
+ *          (e.g. 4-8 kB for USB) cost RAM accordingly.
+ *
+ *  Unit: byte
+ */
+#define BOOT_CFG_DATA_PAYLOAD_SIZE              ( 1024 )
+
+/**
+ *      Flash write granularity
+ *
+ * @note    Smallest programmable flash unit (e.g. 8 bytes double-word on
+ *          STM32L4/G4, 32 bytes flash word on STM32H7). Reported to Boot
+ *          Manager in info response, negotiated payload size is aligned
+ *          down to it.
+ *
+ *  Unit: byte
+ */
+#define BOOT_CFG_FLASH_WRITE_SIZE               ( 8U )
+
+/**
+ *      Flash program unit
+ *
+ * @note    Size and alignment of single programming operation (e.g.
+ *          256 bytes page of external NOR flash). Flash blocks passed to
+ *          "boot_if_flash_write()" through stage buffer start and end at
+ *          its boundaries, except for end of image. Shall be multiple of
+ *          flash write size and divide data payload size.
+ *
+ *  Unit: byte
+ */
+#define BOOT_CFG_FLASH_PROGRAM_SIZE             ( BOOT_CFG_FLASH_WRITE_SIZE )
+
+/**
+ *      Enable/Disable flash write coalescing
+ *
+ * @note    Decrypted data of plain image is collected in stage buffer
+ *          and written in program unit aligned blocks of up to data
+ *          payload size, instead of one write per received frame. Small
+ *          negotiated payloads thus do not end up in many small flash
+ *          writes. Not supported with asynchronous flash writes.
+ */
+#define BOOT_CFG_FLASH_COALESCE_EN              ( 0 )
+
+/**
+ *      Enable/Disable CRC-16/CRC-32 frame check
+ *
+ * @note    Boot Manager can select CRC-16-CCITT (table-driven) or CRC-32
+ *          (image CRC-32 engine, "BOOT_CFG_CRC32_ENGINE") frame check at
+ *          connect command, appended as trailer to each frame. CRC-8 frame
+ *          check is always supported for older Boot Managers.
+ *          Costs 512 bytes of flash for CRC-16 table.
+ */
+#define BOOT_CFG_COM_FRAME_CRC_EN               ( 1 )
+
+/**
+ *      Node address of this bootloader
+ *
+ * @note    Node 0 keeps original message sources. Nodes 1..15 are
+ *          downstream MCUs reachable only through bridge node, Boot
+ *          Manager addresses them by node number in message source.
+ */
+#define BOOT_CFG_COM_NODE_ID                    ( 0U )
+
+/**
+ *      Enable/Disable pass-through bridge to downstream nodes
+ *
+ * @note    Frames for other nodes are forwarded as received to downstream
+ *          port (communication channel 1), frames of downstream nodes are
+ *          forwarded back to Boot Manager (channel 0). Interface shall
+ *          route transmission and reception by "boot_com_get_ch()".
+ *          Takes "BOOT_CFG_RX_BUF_SIZE" bytes of RAM for downstream parser.
+ */
+#define BOOT_CFG_BRIDGE_EN                      ( 0 )
+
+/**
+ *      Build communication module for Boot Manager side
+ *
+ * @note    Bootloader build parses only requests from Boot Manager, Boot
+ *          Manager build (enabled) parses only responses from Bootloader.
+ *          Messages from other source are dropped.
+ */
+#define BOOT_CFG_COM_MANAGER_EN                 ( 1 )
+
+#if ( 1 == BOOT_CFG_COM_MANAGER_EN )
+
+    /**
+     *  Number of devices (communication channels) of Boot Manager engine
+     *
+     *  @note   Each device takes "BOOT_CFG_RX_BUF_SIZE" bytes of RAM for
+     *          its frame parser.
+     */
+    #define BOOT_CFG_MNGR_DEV_NUM_OF            ( 32U )
+
+    /**
+     *  Maximum number of pipelined flash data frames
+     *
+     *  @note   Window reported by bootloader is limited to this value,
+     *          0 forces stop-and-wait.
+     *
+     *  Unit: frame
+     */
+    #define BOOT_CFG_MNGR_WINDOW_MAX            ( 16U )
+
+    /**
+     *  Frame check type requested at connect command
+     */
+    #define BOOT_CFG_MNGR_CRC_TYPE              ( BOOT_COM_CRC_TYPE_CRC32 )
+
+    /**
+     *  Info, connect and scan response timeout
+     *
+     *  Unit: ms
+     */
+    #define BOOT_CFG_MNGR_RSP_TIMEOUT_MS        ( 1000U )
+
+    /**
+     *  Flash data acknowledge and verify response timeout
+     *
+     *  @note   Shall be shorter than flash idle timeout of bootloader
+     *          (BOOT_CFG_FLASH_IDLE_TIMEOUT_MS), otherwise bootloader
+     *          leaves FLASH state before frames are resent, and longer
+     *          than transfer and programming time of single frame
+     *          and digest calculation of verify request.
+     *
+     *  Unit: ms
+     */
+    #define BOOT_CFG_MNGR_FLASH_TIMEOUT_MS      ( 50U )
+
+    /**
+     *  Prepare (flash erase) and exit (image validation) response timeout
+     *
+     *  Unit: ms
+     */
+    #define BOOT_CFG_MNGR_LONG_TIMEOUT_MS       ( 30000U )
+
+    /**
+     *  Number of retries after response timeout without progress
+     */
+    #define BOOT_CFG_MNGR_RETRY_NUM_OF          ( 3U )
+
+    /**
+     *  Verify flashed image before exit command
+     *
+     *  @note   Plain images are compared sector by sector with verify
+     *          sectors command, other (encrypted) images by CRC-32 of
+     *          complete image against image header. Used with bootloaders
+     *          of protocol version 7 and later.
+     */
+    #define BOOT_CFG_MNGR_VERIFY_EN             ( 1 )
+
+    /**
+     *  Skip sectors of target slot holding same data as new image
+     *
+     *  @note   Sectors are compared with verify sectors command before
+     *          prepare, unchanged ones are kept and not sent. Used for
+     *          plain images with bootloaders reporting prepare skip
+     *          support (BOOT_CFG_FLASH_SKIP_EN).
+     */
+    #define BOOT_CFG_MNGR_SKIP_EN               ( 1 )
+
+#endif
+
+/**
+ *      Enable/Disable verify commands
+ *
+ * @note    Bootloader calculates CRC-32 or SHA-256 of requested flash
+ *          range inside application slots, as single digest (verify) or
+ *          one digest per flash sector (verify sectors). Allows Boot
+ *          Manager to check flash content without reading it back.
+ *          Served only after connect, digests cover whole sectors.
+ */
+#define BOOT_CFG_VERIFY_EN                      ( 0 )
+
+/**
+ *      Enable/Disable prepare skip command
+ *
+ * @note    Boot Manager sends map of changed sectors together with image
+ *          header, unchanged sectors of target slot are neither erased
+ *          nor programmed. Kept data is still covered by image digest.
+ *          Plain images only, requires verify commands (BOOT_CFG_VERIFY_EN).
+ */
+#define BOOT_CFG_FLASH_SKIP_EN                  ( 0 )
+
+/**
+ *      Enable/Disable statistics
+ *
+ * @note    Bootloader measures time of upgrade phases (erase, program,
+ *          decrypt, hash, verify) and counts received frames and errors.
+ *          Reported with statistics command. Image validation time at
+ *          boot is stored into shared memory for application.
+ */
+#define BOOT_CFG_STATS_EN                       ( 0 )
+
+/**
+ *      Statistics timer
+ *
+ * @note    Free running 32-bit timer and its frequency in Hz. For cycle
+ *          resolution use DWT cycle counter, enabled in "boot_if_init()":
+ *
+ *              #define BOOT_CFG_STATS_TIMER()      ( DWT->CYCCNT )
+ *              #define BOOT_CFG_STATS_TIMER_HZ     ( SystemCoreClock )
+ */
+#define BOOT_CFG_STATS_TIMER()                  ((uint32_t) boot_port_get_time_us())
+#define BOOT_CFG_STATS_TIMER_HZ                 ( 1000000U )
+
+/**
+ *      Sequenced flash data window size
+ *
+ * @note    Number of sequenced flash data frames Boot Manager can send
+ *          before waiting for acknowledge. Reported to Boot Manager in
+ *          info response. Received frames are waiting inside interface
+ *          reception buffer (behind "boot_if_receive()") while previous
+ *          one is flashed, thus size it accordingly:
+ *
+ *              rx buffer >= window * ( payload + 14 bytes )
+ *
+ *          Set to 0 to support only stop-and-wait flash data command.
+ *
+ *  Unit: frame
+ */
+#define BOOT_CFG_FLASH_WINDOW_SIZE              ( 4U )
+
+/**
+ *      Flash sector map
+ *
+ * @note    List of "boot_flash_region_t" entries: { start address, sector
+ *          size, number of sectors }. Flash is erased sector by sector,
+ *          therefore map must cover complete application region (both
+ *          slots with A/B slots enabled) and shall match real flash.
+ *          Slot header shall start sector. Both is checked at startup.
+ *
+ *          Example of STM32F4 with mixed sector sizes:
+ *              {{ 0x08000000, ( 16U * 1024U ), 4U }, { 0x08010000, ( 64U * 1024U ), 1U }, { 0x08020000, ( 128U * 1024U ), 7U }}
+ */
+#define BOOT_CFG_FLASH_SECTOR_MAP               {{ 0x08000000, ( 2U * 1024U ), 256U }}
+
+/**
+ *      Enable/Disable erase-ahead
+ *
+ * @note    When disabled, complete application region is erased at prepare
+ *          command. When enabled, only sector holding application header is
+ *          erased at prepare command and remaining sectors are erased while
+ *          data is being received, keeping "BOOT_CFG_FLASH_ERASE_AHEAD_SIZE"
+ *          bytes erased in front of working address.
+ *
+ * @note    Sector erase blocks bootloader, thus flash idle timeout and Boot
+ *          Manager response timeout shall be bigger than time to erase
+ *          largest sector!
+ */
+#define BOOT_CFG_FLASH_ERASE_AHEAD_EN           ( 0 )
+
+#if ( 1 == BOOT_CFG_FLASH_ERASE_AHEAD_EN )
+
+    /**
+     *  Size of erased space kept in front of working address
+     *
+     *  Unit: byte
+     */
+    #define BOOT_CFG_FLASH_ERASE_AHEAD_SIZE     ( 4U * 1024U )
+
+#endif
+
+/**
+ *      Enable/Disable resumable upgrade
+ *
+ * @note    While flashing, bootloader appends progress checkpoints (image
+ *          header hash and number of flashed bytes) to log at
+ *          "BOOT_CFG_RESUME_ADDR". When link drops or power is lost, prepare
+ *          or resume command with same image header continues upgrade
+ *          from last checkpoint instead of erasing whole image.
+ *
+ * @note    Image header is written after complete image, as with A/B
+ *          slots. Only plain images are resumed, delta and compressed
+ *          images always restart.
+ */
+#define BOOT_CFG_RESUME_EN                      ( 0 )
+
+#if ( 1 == BOOT_CFG_RESUME_EN )
+
+    /**
+     *  Checkpoint log address
+     *
+     *  @note   Must be located in its own erasable flash area outside
+     *          application region!
+     */
+    #define BOOT_CFG_RESUME_ADDR                ( 0x0800F000 )
+
+    /**
+     *  Checkpoint log size
+     *
+     *  @note   Each checkpoint takes 48 bytes, log is erased when full.
+     *
+     *  Unit: byte
+     */
+    #define BOOT_CFG_RESUME_SIZE                ( 2U * 1024U )
+
+    /**
+     *  Checkpoint period
+     *
+     *  @note   Checkpoint is also stored when flashing is aborted (e.g. on
+     *          communication timeout), periodic one covers power loss.
+     *
+     *  Unit: byte
+     */
+    #define BOOT_CFG_RESUME_PERIOD              ( 16U * 1024U )
+
+#endif
+
+/**
+ *      Enable/Disable delta (differential) image upgrade
+ *
+ * @note    Delta image carries patch against installed application instead
+ *          of complete image. Before patching installed application is
+ *          copied to "BOOT_CFG_DELTA_BASE_ADDR", as application region is
+ *          overwritten while patching.
+ */
+#define BOOT_CFG_DELTA_EN                       ( 0 )
+
+#if ( 1 == BOOT_CFG_DELTA_EN )
+
+    /**
+     *  Base image (copy of installed application) address
+     *
+     *  @note   Requires "BOOT_CFG_APP_SIZE_MAX" + 256 bytes of flash outside
+     *          application region, covered by sector map! Base copy is
+     *          stored as image header directly followed by image, without
+     *          gap to vector table of application slot.
+     *
+     *  @note   Not used with A/B slots, active slot is patch base.
+     */
+    #define BOOT_CFG_DELTA_BASE_ADDR            ( 0x08047800 )
+
+#endif
+
+/**
+ *      Enable/Disable compressed image transport
+ *
+ * @note    Image payload compressed with heatshrink (LZSS) is decompressed
+ *          on the fly before written to flash. Compression type and
+ *          parameters are part of image header.
+ */
+#define BOOT_CFG_COMP_EN                        ( 0 )
+
+#if ( 1 == BOOT_CFG_COMP_EN )
+
+    /**
+     *  Maximum supported compression window size bits
+     *
+     *  @note   Decompressor RAM usage: 2 ^ BOOT_CFG_COMP_WINDOW_BITS bytes.
+     *          Valid range: 4 - 12. Images compressed with bigger window are
+     *          rejected at prepare command.
+     */
+    #define BOOT_CFG_COMP_WINDOW_BITS           ( 10U )
+
+#endif
+
+/**
+ *      Enable/Disable multi-image container upgrade
+ *
+ * @note    Container carries manifest and several sub-images (application,
+ *          data blobs, images of other MCUs over "boot_if_forward()")
+ *          streamed within single upgrade session and authenticated with
+ *          single signature. Exactly one application sub-image is required.
+ */
+#define BOOT_CFG_MULTI_EN                       ( 0 )
+
+#if ( 1 == BOOT_CFG_MULTI_EN )
+
+    /**
+     *  Flash regions writable by data sub-images
+     *
+     *  @note   Regions shall be sector aligned, outside of bootloader and
+     *          application regions and covered by sector map! Sectors
+     *          touched by data sub-image are erased before written.
+     *
+     *  Format: {{ addr, size }, ... }
+     */
+    #define BOOT_CFG_MULTI_DATA_REGIONS         {{ 0x0807F800, ( 2U * 1024U ) }}
+
+#endif
+
+/**
+ *      Enable/Disable install of staged image from external flash
+ *
+ * @note    Application stores image file (as generated by signature tool)
+ *          into external flash right behind descriptor "boot_ext_image_desc_t",
+ *          writes descriptor last and resets with boot reason
+ *          "eBOOT_REASON_FLASH". Bootloader verifies staged image in place
+ *          and copies it to internal flash over "boot_if_ext_flash_read()".
+ */
+#define BOOT_CFG_EXT_FLASH_EN                   ( 0 )
+
+#if ( 1 == BOOT_CFG_EXT_FLASH_EN )
+
+    /**
+     *  Staged image descriptor address in external flash
+     *
+     *  @note   Image file is stored right after descriptor (8 bytes).
+     */
+    #define BOOT_CFG_EXT_FLASH_IMAGE_ADDR       ( 0x00000000 )
+
+#endif
+
+/**
+ *      Enable/Disable asynchronous flash writes
+ *
+ * @note    Received data is decrypted into write pipeline and programmed
+ *          in background via "boot_if_flash_write_start()" and
+ *          "boot_if_flash_write_poll()", so reception of next frame
+ *          overlaps with programming. Flash data response is sent once
+ *          data is written to flash.
+ */
+#define BOOT_CFG_FLASH_ASYNC_EN                 ( 0 )
+
+#if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+
+    /**
+     *  Flash write pipeline depth
+     *
+     *  @note   Each slot takes "BOOT_CFG_DATA_PAYLOAD_SIZE" bytes of RAM.
+     *
+     *  Unit: frame
+     */
+    #define BOOT_CFG_FLASH_PIPE_DEPTH           ( 2U )
+
+#endif
+
+/**
+ *  Jump to application (if valid) if communication idle
+ *  for more than this value of timeout
+ *
+ *  Unit: ms
+ */
+#define BOOT_CFG_JUMP_TO_APP_TIMEOUT_MS         ( 60000U )
+
+/**
+ *  Get system timetick in 32-bit unsigned integer form
+ *
+ *  Unit: ms
+ */
+#define BOOT_GET_SYSTICK()                      ( boot_port_get_systick())
+
+/**
+ *  Static assert
+ */
+#define BOOT_CFG_STATIC_ASSERT(x)                _Static_assert(x)
+
+/**
+ *  Weak compiler directive
+ */
+#define __BOOT_CFG_WEAK__                        __attribute__((weak))
+
+/**
+ *  Packet compiler directive
+ */
+#define __BOOT_CFG_PACKED__                     __attribute__((__packed__))
+
+/**
+ *  Shared memory section directive for linker
+ */
+#define __BOOT_CFG_SHARED_MEM__
+
+/**
+ *  Shared memory mirror section directive for linker
+ *
+ *  @note   Place it in other RAM bank than "__BOOT_CFG_SHARED_MEM__"!
+ */
+#define __BOOT_CFG_SHARED_MEM_MIRROR__
+
+/**
+ *      Shared memory extension area size
+ *
+ *  @note   Area of type-length-value records appended to shared memory,
+ *          0 disables it. Shared memory linker section shall be at least
+ *          32 bytes plus extension area size!
+ *
+ *  Unit: byte
+ */
+#define BOOT_CFG_SHARED_MEM_EXT_SIZE            ( 0U )
+
+/**
+ *      Enable/Disable shared memory mirror
+ *
+ *  @note   Second copy of shared memory in "__BOOT_CFG_SHARED_MEM_MIRROR__"
+ *          section restores state after torn write or RAM bank corruption.
+ */
+#define BOOT_CFG_SHARED_MEM_MIRROR_EN           ( 0 )
+
+/**
+ *      Enable/Disable debug mode
+ *
+ * @note    Debug prints go to stderr, results are written to stdout.
+ */
+#define BOOT_CFG_DEBUG_EN                       ( 0 )
+
+/**
+ *      Enable/Disable assertions
+ */
+#define BOOT_CFG_ASSERT_EN                      ( 1 )
+
+// USER CODE END...
+
+/**
+ *  Disable debug mode and asserts in release mode
+ */
+#ifndef DEBUG
+    #undef BOOT_CFG_DEBUG_EN
+    #define BOOT_CFG_DEBUG_EN 0
+
+    #undef BOOT_CFG_ASSERT_EN
+    #define BOOT_CFG_ASSERT_EN 0
+#endif
+
+/**
+ *  Debug communication port macros
+ */
+#if ( 1 == BOOT_CFG_DEBUG_EN )
+    // USER CODE BEGIN...
+    #define BOOT_DBG_PRINT( ... )               { fprintf( stderr, __VA_ARGS__ ); fprintf( stderr, "\n" ); }
+    // USER CODE END...
+#else
+    #define BOOT_DBG_PRINT( ... )               { ; }
+
+#endif
+
+/**
+ *   Assertion macros
+ */
+#if ( 1 == BOOT_CFG_ASSERT_EN )
+    // USER CODE BEGIN...
+    #define BOOT_ASSERT(x)                      assert(x)
+    // USER CODE END...
+#else
+    #define BOOT_ASSERT(x)                      { ; }
+#endif
+
+#endif // __BOOT_CFG_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
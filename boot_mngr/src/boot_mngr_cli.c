@@ -0,0 +1,584 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_mngr_cli.c
+*@brief     Boot Manager host command line tool
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup Boot Manager host command line tool
+* @{ <!-- BEGIN GROUP -->
+*
+*   Upgrades all devices on given serial ports with same image (output of
+*   "app_sign_tool.py": 256 bytes header followed by image data) at once.
+*   Single event loop drives Boot Manager engine and all ports without
+*   blocking, failed sessions are restarted.
+*
+*   Device is given as "PORT[@NODE[,IMAGE]]": devices behind bridge
+*   share port and are addressed by node, they are upgraded one after
+*   another in given order, each with its own image if given.
+*
+*   Results of each device are printed as JSON to stdout (or file). Exit
+*   code is 0 when all devices are upgraded, 1 when any failed and 2 on
+*   invalid arguments or image.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "boot_port.h"
+#include "boot/src/boot_mngr.h"
+#include "boot/src/boot_com.h"
+#include "revision/revision/src/version.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Event loop wait for port activity
+ *
+ *  Unit: ms
+ */
+#define BOOT_MNGR_CLI_POLL_MS                   ( 1 )
+
+/**
+ *  Command line options
+ */
+typedef struct
+{
+    const char *    p_image;        /**<Image file */
+    const char *    p_out;          /**<Output file, NULL for stdout */
+    uint32_t        baud;           /**<Port baudrate */
+    uint32_t        sessions;       /**<Maximum number of sessions per device */
+    uint32_t        timeout_s;      /**<Station timeout */
+} boot_mngr_cli_opt_t;
+
+/**
+ *  Device results
+ */
+typedef struct
+{
+    const char *        p_port;     /**<Serial port */
+    const char *        p_image;    /**<Own image file, NULL for common image */
+    ver_image_header_t  head;       /**<Image header */
+    uint8_t *           p_data;     /**<Image data */
+    uint8_t             node;       /**<Node address */
+    bool                open;       /**<Port opened */
+    uint32_t            sessions;   /**<Started sessions */
+    boot_mngr_stats_t   stats;      /**<Statistics of last session */
+} boot_mngr_cli_dev_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Options
+ */
+static boot_mngr_cli_opt_t g_cli_opt =
+{
+    .p_image    = NULL,
+    .p_out      = NULL,
+    .baud       = 921600U,
+    .sessions   = 3U,
+    .timeout_s  = 600U,
+};
+
+/**
+ *  Devices
+ */
+static boot_mngr_cli_dev_t g_cli_dev[BOOT_CFG_MNGR_DEV_NUM_OF] = {0};
+static uint32_t gu32_cli_dev_num_of = 0U;
+
+/**
+ *  Image
+ */
+static ver_image_header_t   g_cli_head  = {0};
+static uint8_t *            gp_cli_data = NULL;
+
+/**
+ *  Session state names
+ */
+static const char * const gp_cli_state_str[eBOOT_MNGR_STATE_NUM_OF] =
+{
+    "idle", "info", "connect", "scan", "prepare", "flash", "verify", "exit", "done", "error",
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_mngr_cli_args      (int argc, char ** argv);
+static bool boot_mngr_cli_dev       (char * const p_arg);
+static bool boot_mngr_cli_image     (const char * const p_path, ver_image_header_t * const p_head, uint8_t ** pp_data);
+static bool boot_mngr_cli_port_busy (const uint32_t dev);
+static void boot_mngr_cli_start     (const uint32_t dev);
+static void boot_mngr_cli_next      (const uint32_t dev);
+static bool boot_mngr_cli_run       (uint32_t * const p_station_ms);
+static void boot_mngr_cli_report    (FILE * const p_file, const uint32_t station_ms);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Parse command line arguments
+*
+* @param[in]    argc    - Number of arguments
+* @param[in]    argv    - Arguments
+* @return       true if arguments are valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_mngr_cli_args(int argc, char ** argv)
+{
+    static const struct option options[] =
+    {
+        { "image",      required_argument, NULL, 'i' },
+        { "baud",       required_argument, NULL, 'b' },
+        { "sessions",   required_argument, NULL, 's' },
+        { "timeout-s",  required_argument, NULL, 't' },
+        { "output",     required_argument, NULL, 'o' },
+        { NULL,         0,                 NULL, 0   },
+    };
+
+    bool    valid   = true;
+    int     opt     = 0;
+
+    while (( true == valid ) && ( -1 != ( opt = getopt_long( argc, argv, "i:b:s:t:o:", options, NULL ))))
+    {
+        const uint32_t value = (( 'i' != opt ) && ( 'o' != opt ) && ( NULL != optarg )) ? (uint32_t) strtoul( optarg, NULL, 0 ) : 0U;
+
+        switch ( opt )
+        {
+            case 'i':   g_cli_opt.p_image   = optarg;   break;
+            case 'b':   g_cli_opt.baud      = value;    break;
+            case 's':   g_cli_opt.sessions  = value;    break;
+            case 't':   g_cli_opt.timeout_s = value;    break;
+            case 'o':   g_cli_opt.p_out     = optarg;   break;
+            default:    valid = false;                  break;
+        }
+    }
+
+    // Remaining arguments are devices
+    while (( true == valid ) && ( optind < argc ))
+    {
+        if ( gu32_cli_dev_num_of < BOOT_CFG_MNGR_DEV_NUM_OF )
+        {
+            valid = boot_mngr_cli_dev( argv[optind] );
+            gu32_cli_dev_num_of++;
+            optind++;
+        }
+        else
+        {
+            fprintf( stderr, "Too many ports, maximum is %u\n", BOOT_CFG_MNGR_DEV_NUM_OF );
+            valid = false;
+        }
+    }
+
+    if  (   ( NULL == g_cli_opt.p_image )
+        ||  ( 0U == gu32_cli_dev_num_of )
+        ||  ( 0U == g_cli_opt.sessions )
+        ||  ( 0U == g_cli_opt.timeout_s ))
+    {
+        valid = false;
+    }
+
+    return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Parse device argument
+*
+* @note     Format "PORT[@NODE[,IMAGE]]", argument is split in place.
+*
+* @param[in]    p_arg   - Device argument
+* @return       true if device is valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_mngr_cli_dev(char * const p_arg)
+{
+    boot_mngr_cli_dev_t * const p_dev   = &g_cli_dev[ gu32_cli_dev_num_of ];
+    char *                      p_node  = strchr( p_arg, '@' );
+    char *                      p_end   = NULL;
+    bool                        valid   = true;
+
+    p_dev->p_port = p_arg;
+
+    if ( NULL != p_node )
+    {
+        *p_node = '\0';
+        p_node++;
+
+        const unsigned long node = strtoul( p_node, &p_end, 0 );
+
+        p_dev->node = (uint8_t) node;
+        valid = (( p_end != p_node ) && ( node < BOOT_COM_NODE_NUM_OF ) && (( '\0' == *p_end ) || ( ',' == *p_end )));
+
+        // Own image
+        if (( true == valid ) && ( ',' == *p_end ))
+        {
+            p_dev->p_image = ( p_end + 1 );
+            valid = ( '\0' != *p_dev->p_image );
+        }
+    }
+
+    if ( false == valid )
+    {
+        fprintf( stderr, "Invalid device %s, expected PORT[@NODE[,IMAGE]]\n", p_arg );
+    }
+
+    return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Load image file
+*
+* @param[in]    p_path  - Image file (header followed by image data)
+* @param[out]   p_head  - Image header
+* @param[out]   pp_data - Allocated image data
+* @return       true if image is loaded
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_mngr_cli_image(const char * const p_path, ver_image_header_t * const p_head, uint8_t ** pp_data)
+{
+    FILE *  p_file  = fopen( p_path, "rb" );
+    long    size    = 0;
+    bool    ok      = ( NULL != p_file );
+
+    if ( true == ok )
+    {
+        ok =    (   ( 0 == fseek( p_file, 0, SEEK_END ))
+                &&  (( size = ftell( p_file )) > (long) sizeof( ver_image_header_t ))
+                &&  ( 0 == fseek( p_file, 0, SEEK_SET ))
+                &&  ( 1U == fread( p_head, sizeof( ver_image_header_t ), 1U, p_file )));
+    }
+
+    // Image data shall be complete
+    if ( true == ok )
+    {
+        ok =    (   ( p_head->data.image_size > 0U )
+                &&  ( p_head->data.image_size <= (uint32_t)( size - (long) sizeof( ver_image_header_t ))));
+    }
+
+    if ( true == ok )
+    {
+        *pp_data = malloc( p_head->data.image_size );
+
+        ok =    (   ( NULL != *pp_data )
+                &&  ( 1U == fread( *pp_data, p_head->data.image_size, 1U, p_file )));
+    }
+
+    if ( NULL != p_file )
+    {
+        fclose( p_file );
+    }
+
+    return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if port of device is used by other device
+*
+* @param[in]    dev     - Device index
+* @return       true if other device on same port has its port opened
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_mngr_cli_port_busy(const uint32_t dev)
+{
+    bool busy = false;
+
+    for ( uint32_t other = 0U; other < gu32_cli_dev_num_of; other++ )
+    {
+        if  (   ( other != dev )
+            &&  ( true == g_cli_dev[other].open )
+            &&  ( 0 == strcmp( g_cli_dev[other].p_port, g_cli_dev[dev].p_port )))
+        {
+            busy = true;
+        }
+    }
+
+    return busy;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Open port of device and start its first session
+*
+* @param[in]    dev     - Device index
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_mngr_cli_start(const uint32_t dev)
+{
+    boot_mngr_cli_dev_t * const p_dev = &g_cli_dev[dev];
+
+    p_dev->open = boot_port_open((uint8_t) dev, p_dev->p_port, g_cli_opt.baud );
+
+    // Device is not started again
+    p_dev->sessions++;
+
+    if ( true == p_dev->open )
+    {
+        boot_mngr_set_node((uint8_t) dev, p_dev->node );
+        (void) boot_mngr_start((uint8_t) dev, &p_dev->head, p_dev->p_data );
+    }
+    else
+    {
+        fprintf( stderr, "Cannot open port %s\n", p_dev->p_port );
+
+        // Give port to next device
+        boot_mngr_cli_next( dev );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Hand port of finished device over to next device on same port
+*
+* @param[in]    dev     - Finished device index
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_mngr_cli_next(const uint32_t dev)
+{
+    boot_mngr_get_stats((uint8_t) dev, &g_cli_dev[dev].stats );
+    boot_port_close((uint8_t) dev );
+    g_cli_dev[dev].open = false;
+
+    for ( uint32_t next = ( dev + 1U ); next < gu32_cli_dev_num_of; next++ )
+    {
+        if  (   ( 0U == g_cli_dev[next].sessions )
+            &&  ( 0 == strcmp( g_cli_dev[next].p_port, g_cli_dev[dev].p_port )))
+        {
+            boot_mngr_cli_start( next );
+            break;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Upgrade all devices
+*
+* @note     Event loop: engine pass over all devices, then wait for activity
+*           of any port. Failed sessions are restarted till all sessions of
+*           device are used. Devices sharing port (nodes behind bridge) are
+*           upgraded one after another.
+*
+* @param[out]   p_station_ms    - Time till last device finished
+* @return       true if all devices are upgraded
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_mngr_cli_run(uint32_t * const p_station_ms)
+{
+    const uint32_t  start   = boot_port_get_systick();
+    bool            ok      = true;
+
+    boot_mngr_init();
+
+    // First device of each port
+    for ( uint32_t dev = 0U; dev < gu32_cli_dev_num_of; dev++ )
+    {
+        if ( false == boot_mngr_cli_port_busy( dev ))
+        {
+            boot_mngr_cli_start( dev );
+        }
+    }
+
+    while   (   ( true == boot_mngr_is_busy())
+            &&  ((uint32_t)( boot_port_get_systick() - start ) < ( g_cli_opt.timeout_s * 1000U )))
+    {
+        boot_mngr_hndl();
+
+        // Restart failed sessions
+        for ( uint32_t dev = 0U; dev < gu32_cli_dev_num_of; dev++ )
+        {
+            if  (   ( eBOOT_MNGR_STATE_ERROR == boot_mngr_get_state((uint8_t) dev ))
+                &&  ( g_cli_dev[dev].sessions < g_cli_opt.sessions ))
+            {
+                boot_mngr_get_stats((uint8_t) dev, &g_cli_dev[dev].stats );
+                fprintf( stderr, "%s: session %u failed in %s state, restarting\n", g_cli_dev[dev].p_port,
+                                 g_cli_dev[dev].sessions, gp_cli_state_str[ g_cli_dev[dev].stats.err_state ] );
+
+                (void) boot_mngr_start((uint8_t) dev, &g_cli_dev[dev].head, g_cli_dev[dev].p_data );
+                g_cli_dev[dev].sessions++;
+            }
+
+            // Finished -> next device on same port
+            else if (   ( true == g_cli_dev[dev].open )
+                    &&  (   ( eBOOT_MNGR_STATE_DONE == boot_mngr_get_state((uint8_t) dev ))
+                        ||  ( eBOOT_MNGR_STATE_ERROR == boot_mngr_get_state((uint8_t) dev ))))
+            {
+                boot_mngr_cli_next( dev );
+            }
+            else
+            {
+                // No actions...
+            }
+        }
+
+        boot_port_poll( BOOT_MNGR_CLI_POLL_MS );
+    }
+
+    *p_station_ms = (uint32_t)( boot_port_get_systick() - start );
+
+    for ( uint32_t dev = 0U; dev < gu32_cli_dev_num_of; dev++ )
+    {
+        if ( true == g_cli_dev[dev].open )
+        {
+            boot_mngr_get_stats((uint8_t) dev, &g_cli_dev[dev].stats );
+            boot_port_close((uint8_t) dev );
+        }
+
+        ok = (( true == ok ) && ( eBOOT_MNGR_STATE_DONE == boot_mngr_get_state((uint8_t) dev )));
+    }
+
+    return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Print results as JSON
+*
+* @param[in]    p_file      - Output file
+* @param[in]    station_ms  - Time till last device finished
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_mngr_cli_report(FILE * const p_file, const uint32_t station_ms)
+{
+    uint32_t sum_ms = 0U;
+
+    fprintf( p_file, "{\n" );
+    fprintf( p_file, "  \"image\": \"%s\",\n", g_cli_opt.p_image );
+    fprintf( p_file, "  \"image_size\": %u,\n", g_cli_head.data.image_size );
+    fprintf( p_file, "  \"baud\": %u,\n", g_cli_opt.baud );
+    fprintf( p_file, "  \"devices\": [\n" );
+
+    for ( uint32_t dev = 0U; dev < gu32_cli_dev_num_of; dev++ )
+    {
+        const boot_mngr_cli_dev_t * const   p_dev   = &g_cli_dev[dev];
+        const boot_mngr_state_t             state   = boot_mngr_get_state((uint8_t) dev );
+        boot_port_cnt_t                     cnt     = {0};
+
+        boot_port_get_cnt((uint8_t) dev, &cnt );
+        sum_ms += p_dev->stats.time_ms;
+
+        fprintf( p_file, "    { \"port\": \"%s\", \"node\": %u, \"ok\": %s, \"state\": \"%s\", \"sessions\": %u, \"time_ms\": %u, \"flash_ms\": %u, \"bytes_per_s\": %u, "
+                         "\"payload\": %u, \"window\": %u, \"crc_type\": %u, \"frames\": %u, \"sent\": %u, \"retransmits\": %u, \"timeouts\": %u, "
+                         "\"verify_err\": %u, \"kept\": %u, \"tx_bytes\": %u, \"rx_bytes\": %u, \"err_state\": \"%s\", \"msg_status\": %u }%s\n",
+                         p_dev->p_port, p_dev->node, (( eBOOT_MNGR_STATE_DONE == state ) ? "true" : "false" ), gp_cli_state_str[state], p_dev->sessions,
+                         p_dev->stats.time_ms, p_dev->stats.flash_ms, p_dev->stats.bytes_per_s, p_dev->stats.payload_size, p_dev->stats.window,
+                         p_dev->stats.crc_type, p_dev->stats.frames, p_dev->stats.sent, p_dev->stats.retransmits, p_dev->stats.timeouts,
+                         p_dev->stats.verify_err, p_dev->stats.kept, cnt.tx_bytes, cnt.rx_bytes, gp_cli_state_str[ p_dev->stats.err_state ], p_dev->stats.msg_status,
+                         ((( dev + 1U ) < gu32_cli_dev_num_of ) ? "," : "" ));
+    }
+
+    fprintf( p_file, "  ],\n" );
+
+    // Station time versus upgrading one device after another
+    fprintf( p_file, "  \"station_ms\": %u,\n", station_ms );
+    fprintf( p_file, "  \"sequential_ms\": %u\n", sum_ms );
+    fprintf( p_file, "}\n" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Boot Manager host command line tool
+*
+* @param[in]    argc    - Number of arguments
+* @param[in]    argv    - Arguments
+* @return       exit code
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+    FILE *      p_file      = stdout;
+    uint32_t    station_ms  = 0U;
+    bool        ok          = false;
+
+    if ( false == boot_mngr_cli_args( argc, argv ))
+    {
+        fprintf( stderr, "usage: %s --image FILE [--baud BPS] [--sessions N] [--timeout-s S] [--output FILE] PORT[@NODE[,IMAGE]]...\n", argv[0] );
+        return 2;
+    }
+
+    if ( false == boot_mngr_cli_image( g_cli_opt.p_image, &g_cli_head, &gp_cli_data ))
+    {
+        fprintf( stderr, "Invalid image %s\n", g_cli_opt.p_image );
+        return 2;
+    }
+
+    // Common image or own image of device
+    for ( uint32_t dev = 0U; dev < gu32_cli_dev_num_of; dev++ )
+    {
+        boot_mngr_cli_dev_t * const p_dev = &g_cli_dev[dev];
+
+        if ( NULL == p_dev->p_image )
+        {
+            memcpy( &p_dev->head, &g_cli_head, sizeof( ver_image_header_t ));
+            p_dev->p_data = gp_cli_data;
+        }
+        else if ( false == boot_mngr_cli_image( p_dev->p_image, &p_dev->head, &p_dev->p_data ))
+        {
+            fprintf( stderr, "Invalid image %s\n", p_dev->p_image );
+            return 2;
+        }
+        else
+        {
+            // Own image loaded...
+        }
+    }
+
+    ok = boot_mngr_cli_run( &station_ms );
+
+    if ( NULL != g_cli_opt.p_out )
+    {
+        p_file = fopen( g_cli_opt.p_out, "w" );
+
+        if ( NULL == p_file )
+        {
+            return 2;
+        }
+    }
+
+    boot_mngr_cli_report( p_file, station_ms );
+
+    if ( stdout != p_file )
+    {
+        fclose( p_file );
+    }
+
+    for ( uint32_t dev = 0U; dev < gu32_cli_dev_num_of; dev++ )
+    {
+        if ( gp_cli_data != g_cli_dev[dev].p_data )
+        {
+            free( g_cli_dev[dev].p_data );
+        }
+    }
+
+    free( gp_cli_data );
+
+    return (( true == ok ) ? 0 : 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
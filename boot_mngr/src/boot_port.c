@@ -0,0 +1,586 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_port.c
+*@brief     Boot Manager host serial ports
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup Boot Manager host serial ports
+* @{ <!-- BEGIN GROUP -->
+*
+*   Implements communication part of "boot_if_*" interface for Boot Manager
+*   engine on POSIX host. Each communication channel (device) has own serial
+*   port (UART, USB CDC or pseudo terminal) opened in non-blocking mode:
+*
+*       - Transmission is queued and written out by "boot_port_poll()",
+*         thus engine never blocks on slow port.
+*       - Reception reads whatever port has, when buffer runs empty.
+*
+*   Interface calls are routed to port of channel selected by engine
+*   ("boot_com_get_ch()"). Other transports (CAN, USB bulk) shall provide
+*   same functions.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "boot_port.h"
+#include "boot_if.h"
+#include "boot/src/boot_com.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Serial port
+ */
+typedef struct
+{
+    int             fd;                             /**<File descriptor, -1 when closed */
+    uint8_t         tx[BOOT_PORT_TX_BUF_SIZE];      /**<Transmit queue */
+    uint32_t        tx_head;                        /**<Transmit queue write position */
+    uint32_t        tx_tail;                        /**<Transmit queue read position */
+    uint8_t         rx[BOOT_PORT_RX_BUF_SIZE];      /**<Reception buffer */
+    uint32_t        rx_head;                        /**<Reception buffer write position */
+    uint32_t        rx_tail;                        /**<Reception buffer read position */
+    boot_port_cnt_t cnt;                            /**<Counters */
+} boot_port_t;
+
+/**
+ *  Baudrate to termios speed
+ */
+typedef struct
+{
+    uint32_t    baud;   /**<Baudrate in bit/s */
+    speed_t     speed;  /**<Termios speed */
+} boot_port_baud_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Serial ports, one per communication channel
+ */
+static boot_port_t g_port[BOOT_COM_CH_NUM_OF];
+
+/**
+ *  Ports initialized (closed)
+ */
+static bool gb_port_init = false;
+
+/**
+ *  Supported baudrates
+ */
+static const boot_port_baud_t g_port_baud[] =
+{
+    { 9600U,    B9600    },
+    { 19200U,   B19200   },
+    { 38400U,   B38400   },
+    { 57600U,   B57600   },
+    { 115200U,  B115200  },
+    { 230400U,  B230400  },
+#ifdef B460800
+    { 460800U,  B460800  },
+#endif
+#ifdef B921600
+    { 921600U,  B921600  },
+#endif
+#ifdef B1000000
+    { 1000000U, B1000000 },
+#endif
+#ifdef B2000000
+    { 2000000U, B2000000 },
+#endif
+#ifdef B3000000
+    { 3000000U, B3000000 },
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void         boot_port_init      (void);
+static void         boot_port_flush     (boot_port_t * const p_port);
+static void         boot_port_read      (boot_port_t * const p_port);
+static uint16_t     boot_port_rx        (boot_port_t * const p_port, uint8_t * const p_data, const uint16_t max);
+static boot_port_t* boot_port_get       (void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize ports as closed
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_port_init(void)
+{
+    if ( false == gb_port_init )
+    {
+        for ( uint32_t ch = 0U; ch < BOOT_COM_CH_NUM_OF; ch++ )
+        {
+            g_port[ch].fd = -1;
+        }
+
+        gb_port_init = true;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Write queued data to port
+*
+* @param[in]    p_port - Serial port
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_port_flush(boot_port_t * const p_port)
+{
+    while ( p_port->tx_tail < p_port->tx_head )
+    {
+        const ssize_t n = write( p_port->fd, &p_port->tx[ p_port->tx_tail ], ( p_port->tx_head - p_port->tx_tail ));
+
+        if ( n <= 0 )
+        {
+            break;
+        }
+
+        p_port->tx_tail         += (uint32_t) n;
+        p_port->cnt.tx_bytes    += (uint32_t) n;
+    }
+
+    // Queue empty
+    if ( p_port->tx_tail == p_port->tx_head )
+    {
+        p_port->tx_tail = 0U;
+        p_port->tx_head = 0U;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Read available data from port
+*
+* @param[in]    p_port - Serial port
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_port_read(boot_port_t * const p_port)
+{
+    // Move unread data to beginning of buffer
+    if ( p_port->rx_tail > 0U )
+    {
+        memmove( &p_port->rx[0], &p_port->rx[ p_port->rx_tail ], ( p_port->rx_head - p_port->rx_tail ));
+        p_port->rx_head -= p_port->rx_tail;
+        p_port->rx_tail  = 0U;
+    }
+
+    if ( p_port->rx_head < BOOT_PORT_RX_BUF_SIZE )
+    {
+        const ssize_t n = read( p_port->fd, &p_port->rx[ p_port->rx_head ], ( BOOT_PORT_RX_BUF_SIZE - p_port->rx_head ));
+
+        if ( n > 0 )
+        {
+            p_port->rx_head         += (uint32_t) n;
+            p_port->cnt.rx_bytes    += (uint32_t) n;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Take received data
+*
+* @note     Port is read when reception buffer runs empty.
+*
+* @param[in]    p_port  - Serial port
+* @param[out]   p_data  - Received data
+* @param[in]    max     - Maximum number of bytes
+* @return       got     - Number of received bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t boot_port_rx(boot_port_t * const p_port, uint8_t * const p_data, const uint16_t max)
+{
+    uint16_t got = 0U;
+
+    if ( p_port->rx_tail == p_port->rx_head )
+    {
+        boot_port_read( p_port );
+    }
+
+    got = (uint16_t)((( p_port->rx_head - p_port->rx_tail ) < max ) ? ( p_port->rx_head - p_port->rx_tail ) : max );
+
+    memcpy( p_data, &p_port->rx[ p_port->rx_tail ], got );
+    p_port->rx_tail += got;
+
+    return got;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get port of selected communication channel
+*
+* @return       p_port - Serial port, NULL when closed
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_port_t * boot_port_get(void)
+{
+    boot_port_t * p_port = &g_port[ boot_com_get_ch() ];
+
+    boot_port_init();
+
+    if ( p_port->fd < 0 )
+    {
+        p_port = NULL;
+    }
+
+    return p_port;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_PORT_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of Boot Manager host serial ports API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Open serial port of communication channel
+*
+* @note     Port is set to raw mode, 8N1 without flow control. Baudrate is
+*           ignored by pseudo terminals.
+*
+* @param[in]    ch      - Communication channel (device) index
+* @param[in]    p_path  - Path of serial port
+* @param[in]    baud    - Baudrate in bit/s
+* @return       true if port is opened
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool boot_port_open(const uint8_t ch, const char * const p_path, const uint32_t baud)
+{
+    struct termios  tio     = {0};
+    speed_t         speed   = 0;
+    bool            ok      = false;
+
+    boot_port_init();
+
+    for ( uint32_t i = 0U; i < ( sizeof( g_port_baud ) / sizeof( g_port_baud[0] )); i++ )
+    {
+        if ( baud == g_port_baud[i].baud )
+        {
+            speed   = g_port_baud[i].speed;
+            ok      = true;
+        }
+    }
+
+    if (( true == ok ) && ( ch < BOOT_COM_CH_NUM_OF ) && ( g_port[ch].fd < 0 ))
+    {
+        const int fd = open( p_path, ( O_RDWR | O_NOCTTY | O_NONBLOCK ));
+
+        ok = ( fd >= 0 );
+
+        if (( true == ok ) && ( 0 == tcgetattr( fd, &tio )))
+        {
+            cfmakeraw( &tio );
+            tio.c_cflag |= ( CLOCAL | CREAD );
+            tio.c_cflag &= ~CRTSCTS;
+            tio.c_cc[VMIN]  = 0;
+            tio.c_cc[VTIME] = 0;
+            (void) cfsetispeed( &tio, speed );
+            (void) cfsetospeed( &tio, speed );
+            ok = ( 0 == tcsetattr( fd, TCSANOW, &tio ));
+        }
+
+        if ( true == ok )
+        {
+            (void) tcflush( fd, TCIOFLUSH );
+
+            memset( &g_port[ch], 0, sizeof( boot_port_t ));
+            g_port[ch].fd = fd;
+        }
+        else if ( fd >= 0 )
+        {
+            (void) close( fd );
+        }
+        else
+        {
+            // Open failed...
+        }
+    }
+    else
+    {
+        ok = false;
+    }
+
+    return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Close serial port of communication channel
+*
+* @note     Queued data is written out before closing.
+*
+* @param[in]    ch - Communication channel (device) index
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_port_close(const uint8_t ch)
+{
+    boot_port_init();
+
+    if (( ch < BOOT_COM_CH_NUM_OF ) && ( g_port[ch].fd >= 0 ))
+    {
+        (void) fcntl( g_port[ch].fd, F_SETFL, ( fcntl( g_port[ch].fd, F_GETFL ) & ~O_NONBLOCK ));
+        boot_port_flush( &g_port[ch] );
+        (void) close( g_port[ch].fd );
+        g_port[ch].fd = -1;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Service all ports
+*
+* @note     Waits at most "timeout_ms" for any port to become readable or
+*           writable (with data queued), then writes queued data and reads
+*           available data of all ports. Shall be called from event loop
+*           after "boot_mngr_hndl()".
+*
+* @param[in]    timeout_ms - Maximum wait time, 0 for no wait
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_port_poll(const int timeout_ms)
+{
+    struct pollfd   fds[BOOT_COM_CH_NUM_OF] = {0};
+    uint32_t        ch_of[BOOT_COM_CH_NUM_OF] = {0};
+    nfds_t          n = 0;
+
+    boot_port_init();
+
+    for ( uint32_t ch = 0U; ch < BOOT_COM_CH_NUM_OF; ch++ )
+    {
+        if ( g_port[ch].fd >= 0 )
+        {
+            fds[n].fd       = g_port[ch].fd;
+            fds[n].events   = (short)( POLLIN | (( g_port[ch].tx_head > g_port[ch].tx_tail ) ? POLLOUT : 0 ));
+            ch_of[n]        = ch;
+            n++;
+        }
+    }
+
+    if ( poll( fds, n, timeout_ms ) > 0 )
+    {
+        for ( nfds_t i = 0; i < n; i++ )
+        {
+            if ( 0 != ( fds[i].revents & POLLOUT ))
+            {
+                boot_port_flush( &g_port[ ch_of[i] ] );
+            }
+
+            if ( 0 != ( fds[i].revents & POLLIN ))
+            {
+                boot_port_read( &g_port[ ch_of[i] ] );
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get port counters
+*
+* @param[in]    ch      - Communication channel (device) index
+* @param[out]   p_cnt   - Port counters
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_port_get_cnt(const uint8_t ch, boot_port_cnt_t * const p_cnt)
+{
+    boot_port_init();
+
+    if ( ch < BOOT_COM_CH_NUM_OF )
+    {
+        memcpy( p_cnt, &g_port[ch].cnt, sizeof( boot_port_cnt_t ));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get Boot Manager time base
+*
+* @return       systick - Monotonic time in ms
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t boot_port_get_systick(void)
+{
+    return (uint32_t)( boot_port_get_time_us() / 1000ULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get monotonic time
+*
+* @return       time in microseconds
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint64_t boot_port_get_time_us(void)
+{
+    struct timespec ts = {0};
+
+    (void) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return (( (uint64_t) ts.tv_sec * 1000000ULL ) + ( (uint64_t) ts.tv_nsec / 1000ULL ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Transmit data
+*
+* @note     Data is queued, frame that does not fit into queue is dropped
+*           and recovered by engine on response timeout.
+*
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of data in bytes
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_if_transmit(const uint8_t * const p_data, const uint16_t size)
+{
+    boot_status_t           status  = eBOOT_OK;
+    boot_port_t * const     p_port  = boot_port_get();
+
+    if ( NULL == p_port )
+    {
+        status = eBOOT_ERROR;
+    }
+    else if (( p_port->tx_head + size ) > BOOT_PORT_TX_BUF_SIZE )
+    {
+        p_port->cnt.tx_overflows++;
+        status = eBOOT_WAR_FULL;
+    }
+    else
+    {
+        memcpy( &p_port->tx[ p_port->tx_head ], p_data, size );
+        p_port->tx_head += size;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Receive single byte
+*
+* @param[out]   p_data  - Received byte
+* @return       status  - eBOOT_OK when byte received, else eBOOT_WAR_EMPTY
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_if_receive(uint8_t * const p_data)
+{
+    boot_status_t           status  = eBOOT_WAR_EMPTY;
+    boot_port_t * const     p_port  = boot_port_get();
+
+    if  (   ( NULL != p_port )
+        &&  ( 1U == boot_port_rx( p_port, p_data, 1U )))
+    {
+        status = eBOOT_OK;
+    }
+
+    return status;
+}
+
+#if ( 1 == BOOT_CFG_RX_BLOCK_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Receive block of data
+    *
+    * @param[out]   p_data  - Received data
+    * @param[in]    max     - Maximum number of bytes
+    * @param[out]   p_got   - Number of received bytes
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    boot_status_t boot_if_receive_block(uint8_t * const p_data, const uint16_t max, uint16_t * const p_got)
+    {
+        boot_status_t           status  = eBOOT_OK;
+        boot_port_t * const     p_port  = boot_port_get();
+
+        *p_got = 0U;
+
+        if ( NULL == p_port )
+        {
+            status = eBOOT_ERROR;
+        }
+        else
+        {
+            *p_got = boot_port_rx( p_port, p_data, max );
+        }
+
+        return status;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Clear reception buffer
+*
+* @return       status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_if_clear_rx_buf(void)
+{
+    boot_status_t           status  = eBOOT_OK;
+    boot_port_t * const     p_port  = boot_port_get();
+
+    if ( NULL == p_port )
+    {
+        status = eBOOT_ERROR;
+    }
+    else
+    {
+        p_port->rx_head = 0U;
+        p_port->rx_tail = 0U;
+        (void) tcflush( p_port->fd, TCIFLUSH );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,78 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_port.h
+*@brief     Boot Manager host serial ports
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_PORT_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __BOOT_PORT_H
+#define __BOOT_PORT_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Transmit queue size of single port
+ *
+ *  @note   Shall hold at least two windows of flash data frames, as frames
+ *          resent after acknowledge timeout can be queued behind old ones.
+ *
+ *  Unit: byte
+ */
+#define BOOT_PORT_TX_BUF_SIZE                   ( 64U * 1024U )
+
+/**
+ *  Reception buffer size of single port
+ *
+ *  Unit: byte
+ */
+#define BOOT_PORT_RX_BUF_SIZE                   ( 16U * 1024U )
+
+/**
+ *  Port counters
+ */
+typedef struct
+{
+    uint32_t    tx_bytes;       /**<Bytes written to device */
+    uint32_t    rx_bytes;       /**<Bytes read from device */
+    uint32_t    tx_overflows;   /**<Frames dropped on full transmit queue */
+} boot_port_cnt_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+bool        boot_port_open          (const uint8_t ch, const char * const p_path, const uint32_t baud);
+void        boot_port_close         (const uint8_t ch);
+void        boot_port_poll          (const int timeout_ms);
+void        boot_port_get_cnt       (const uint8_t ch, boot_port_cnt_t * const p_cnt);
+uint32_t    boot_port_get_systick   (void);
+uint64_t    boot_port_get_time_us   (void);
+
+#endif // __BOOT_PORT_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
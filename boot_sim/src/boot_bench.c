@@ -0,0 +1,1195 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_bench.c
+*@brief     Bootloader host benchmark
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup Bootloader host benchmark
+* @{ <!-- BEGIN GROUP -->
+*
+*   Runs bootloader core against simulated interface ("boot_sim.c") and
+*   acts as Boot Manager on the other side of simulated link:
+*
+*       parser      - Flash data frames over ideal link (no latency, no
+*                     loss), host processing time -> frames per second
+*       update      - Complete upgrade (info, connect, prepare, flash,
+*                     exit) over configured link and flash latencies,
+*                     simulated time from connect to start of application
+*       boot_crc    - Cold boot validation of CRC image, host time
+*       boot_ecdsa  - Cold boot validation of ECDSA signed image, host time
+*       ram         - Static RAM of bootloader core and peak stack usage
+*
+*   Results are printed as single JSON object to stdout (or file). Exit
+*   code is non-zero if any step fails.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "boot_sim.h"
+#include "boot.h"
+#include "boot_if.h"
+#include "boot_crc.h"
+
+#include "micro_ecc/uECC.h"
+#include "cifra/sha2.h"
+#include "revision/revision/src/version.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Static RAM of bootloader core (.data + .bss), provided by build
+ */
+#ifndef BOOT_BENCH_CORE_RAM
+    #define BOOT_BENCH_CORE_RAM                 ( 0U )
+#endif
+
+/**
+ *  Frame layout
+ */
+#define BOOT_BENCH_PREAMBLE_0                   ( 0xB0U )
+#define BOOT_BENCH_PREAMBLE_1                   ( 0x07U )
+#define BOOT_BENCH_HEAD_SIZE                    ( 8U )
+#define BOOT_BENCH_SRC_MANAGER                  ( 0x2BU )
+#define BOOT_BENCH_SRC_BOOT                     ( 0xB2U )
+#define BOOT_BENCH_SEQ_SIZE                     ( 2U )
+
+/**
+ *  Commands
+ */
+#define BOOT_BENCH_CMD_CONNECT                  ( 0x10U )
+#define BOOT_BENCH_CMD_PREPARE                  ( 0x20U )
+#define BOOT_BENCH_CMD_FLASH                    ( 0x30U )
+#define BOOT_BENCH_CMD_FLASH_SEQ                ( 0x32U )
+#define BOOT_BENCH_CMD_EXIT                     ( 0x40U )
+#define BOOT_BENCH_CMD_INFO                     ( 0xA0U )
+#define BOOT_BENCH_CMD_STATS                    ( 0xA2U )
+
+/**
+ *  Response command
+ */
+#define BOOT_BENCH_RSP(cmd)                     ((uint8_t)(( cmd ) + 1U ))
+
+/**
+ *  Host reception buffer size
+ *
+ *  Unit: byte
+ */
+#define BOOT_BENCH_RX_BUF_SIZE                  ( 16U * 1024U )
+
+/**
+ *  Request retries before session is declared failed
+ */
+#define BOOT_BENCH_RETRY_MAX                    ( 5U )
+
+/**
+ *  Response timeout of prepare and exit commands (flash erase and image check)
+ *
+ *  Unit: us
+ */
+#define BOOT_BENCH_LONG_TIMEOUT_US              ( 30000000ULL )
+
+/**
+ *  Maximum skip of idle simulated time
+ *
+ *  Unit: us
+ */
+#define BOOT_BENCH_IDLE_SKIP_US                 ( 1000ULL )
+
+/**
+ *  Stack painting
+ */
+#define BOOT_BENCH_STACK_PAINT_SIZE             ( 256U * 1024U )
+#define BOOT_BENCH_STACK_PAINT                  ( 0xA5U )
+
+/**
+ *  Benchmark options
+ */
+typedef struct
+{
+    boot_sim_cfg_t  sim;            /**<Link and flash model of update benchmark */
+    uint32_t        image_size;     /**<Size of image */
+    uint16_t        payload;        /**<Requested flash data payload size, 0 for maximum */
+    uint8_t         window;         /**<Maximum flash data window, 0 for bootloader maximum */
+    uint32_t        seed;           /**<Image content seed */
+    const char *    p_out;          /**<Output file, NULL for stdout */
+} boot_bench_opt_t;
+
+/**
+ *  Received frame
+ */
+typedef struct
+{
+    uint8_t     payload[BOOT_BENCH_RX_BUF_SIZE];    /**<Payload */
+    uint16_t    size;                               /**<Size of payload */
+    uint8_t     cmd;                                /**<Command */
+    uint8_t     status;                             /**<Message status */
+} boot_bench_frame_t;
+
+/**
+ *  Session results
+ */
+typedef struct
+{
+    uint64_t    time_us;            /**<Simulated time from connect to start of application */
+    uint32_t    flash_host_us;      /**<Host time of flash data transfer */
+    uint32_t    frames;             /**<Number of flash data frames */
+    uint32_t    sent;               /**<Number of sent flash data frames (with retransmits) */
+    uint32_t    sessions;           /**<Number of started sessions */
+    uint32_t    lost;               /**<Number of lost transfers (both directions) */
+    uint32_t    writes;             /**<Number of flash write operations */
+    uint16_t    payload;            /**<Negotiated payload size */
+    uint8_t     window;             /**<Used flash data window */
+    bool        ok;                 /**<Application started with new image */
+
+    #if ( 1 == BOOT_CFG_STATS_EN )
+        boot_stats_t stats;         /**<Bootloader statistics */
+    #endif
+} boot_bench_session_t;
+
+/**
+ *  Cold boot results
+ */
+typedef struct
+{
+    uint32_t    host_us;            /**<Host time of bootloader initialization till start of application */
+    uint32_t    valid_us;           /**<Host time of image validation */
+    bool        ok;                 /**<Application started */
+} boot_bench_boot_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Benchmark options
+ */
+static boot_bench_opt_t g_bench_opt =
+{
+    .sim =
+    {
+        .baud                  = 921600U,
+        .rtt_us                = 200U,
+        .loss_ppm              = 0U,
+        .erase_us_per_kb       = 11000U,
+        .program_us_per_kb     = 10500U,
+        .program_us_per_write  = 0U,
+        .loop_us               = 10U,
+        .seed                  = 1U,
+    },
+    .image_size = ( 128U * 1024U ),
+    .payload    = 0U,
+    .window     = 0U,
+    .seed       = 1U,
+    .p_out      = NULL,
+};
+
+/**
+ *  Ideal link and flash (parser benchmark)
+ */
+static const boot_sim_cfg_t g_bench_ideal = { .loop_us = 1U, .seed = 1U };
+
+/**
+ *  Image
+ */
+static ver_image_header_t   g_bench_head        = {0};     /**<Upgrade image header */
+static ver_image_header_t   g_bench_head_crc    = {0};     /**<CRC image header */
+static ver_image_header_t   g_bench_head_ecdsa  = {0};     /**<ECDSA signed image header */
+static uint8_t *            gp_bench_image      = NULL;
+
+/**
+ *  Signing key
+ */
+static uint8_t gu8_bench_priv_key[32]   = {0};
+static uint8_t gu8_bench_pub_key[64]    = {0};
+
+/**
+ *  Random generator state (image content and key)
+ */
+static uint32_t gu32_bench_rand = 1U;
+
+/**
+ *  Host reception
+ */
+static uint8_t  gu8_bench_rx[BOOT_BENCH_RX_BUF_SIZE]   = {0};
+static uint32_t gu32_bench_rx_size                      = 0U;
+static boot_bench_frame_t g_bench_frame                 = {0};
+
+/**
+ *  Encoded flash data frames
+ */
+static uint8_t *    gp_bench_frames     = NULL;
+static uint32_t *   gp_bench_frame_ofs  = NULL;
+
+/**
+ *  Painted stack region
+ */
+static uintptr_t gu_bench_stack_addr = 0U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t boot_bench_rand             (void);
+static int      boot_bench_uecc_rng         (uint8_t * dest, unsigned size);
+static uint32_t boot_bench_frame_make       (uint8_t * const p_frame, const uint8_t cmd, const uint8_t * const p_payload, const uint16_t size);
+static void     boot_bench_send             (const uint8_t cmd, const uint8_t * const p_payload, const uint16_t size);
+static bool     boot_bench_frame_get        (boot_bench_frame_t * const p_frame);
+static void     boot_bench_hndl             (void);
+static bool     boot_bench_wait             (const uint8_t rsp_cmd, const uint64_t timeout_us);
+static bool     boot_bench_request          (const uint8_t cmd, const uint8_t * const p_payload, const uint16_t size, const uint64_t timeout_us);
+static void     boot_bench_image_make       (const uint32_t size);
+static void     boot_bench_head_make        (const bool sign, ver_image_header_t * const p_head);
+static bool     boot_bench_frames_make      (const uint16_t payload, const bool seq, uint32_t * const p_frames);
+static bool     boot_bench_flash            (boot_bench_session_t * const p_ses, const uint64_t timeout_us);
+static bool     boot_bench_session          (boot_bench_session_t * const p_ses);
+static void     boot_bench_update           (const boot_sim_cfg_t * const p_sim, boot_bench_session_t * const p_ses);
+static void     boot_bench_cold_boot        (const ver_image_header_t * const p_head, boot_bench_boot_t * const p_boot);
+static void     boot_bench_stack_paint      (void);
+static uint32_t boot_bench_stack_used       (void);
+static bool     boot_bench_args             (int argc, char ** argv);
+static void     boot_bench_report           (FILE * const p_file, const boot_bench_session_t * const p_parser, const boot_bench_session_t * const p_update,
+                                             const boot_bench_boot_t * const p_crc, const boot_bench_boot_t * const p_ecdsa, const uint32_t stack);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Random generator (xorshift32)
+*
+* @return       rand - Random value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t boot_bench_rand(void)
+{
+    gu32_bench_rand ^= ( gu32_bench_rand << 13U );
+    gu32_bench_rand ^= ( gu32_bench_rand >> 17U );
+    gu32_bench_rand ^= ( gu32_bench_rand << 5U );
+
+    return gu32_bench_rand;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       micro-ecc random generator for key generation and signing
+*
+* @param[out]   dest    - Random data
+* @param[in]    size    - Size of random data
+* @return       1 on success
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int boot_bench_uecc_rng(uint8_t * dest, unsigned size)
+{
+    for ( unsigned i = 0U; i < size; i++ )
+    {
+        dest[i] = (uint8_t) boot_bench_rand();
+    }
+
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Encode Boot Manager frame
+*
+* @note     CRC-8 frame check: field-wise CRC-8 of header XOR-ed with
+*           CRC-8 of payload, same as "boot_com_calc_crc_packet()".
+*
+* @param[out]   p_frame     - Pointer to frame buffer
+* @param[in]    cmd         - Command
+* @param[in]    p_payload   - Pointer to payload
+* @param[in]    size        - Size of payload in bytes
+* @return       size of frame in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t boot_bench_frame_make(uint8_t * const p_frame, const uint8_t cmd, const uint8_t * const p_payload, const uint16_t size)
+{
+    uint8_t crc8 = 0U;
+
+    p_frame[0] = BOOT_BENCH_PREAMBLE_0;
+    p_frame[1] = BOOT_BENCH_PREAMBLE_1;
+    p_frame[2] = (uint8_t)( size & 0xFFU );
+    p_frame[3] = (uint8_t)( size >> 8U );
+    p_frame[4] = BOOT_BENCH_SRC_MANAGER;
+    p_frame[5] = cmd;
+    p_frame[6] = 0U;
+
+    crc8 ^= boot_crc8_calc( &p_frame[2], 2U );
+    crc8 ^= boot_crc8_calc( &p_frame[4], 1U );
+    crc8 ^= boot_crc8_calc( &p_frame[5], 1U );
+    crc8 ^= boot_crc8_calc( &p_frame[6], 1U );
+
+    if ( size > 0U )
+    {
+        memcpy( &p_frame[ BOOT_BENCH_HEAD_SIZE ], p_payload, size );
+        crc8 ^= boot_crc8_calc( p_payload, size );
+    }
+
+    p_frame[7] = crc8;
+
+    return ( BOOT_BENCH_HEAD_SIZE + size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Send Boot Manager frame
+*
+* @param[in]    cmd         - Command
+* @param[in]    p_payload   - Pointer to payload
+* @param[in]    size        - Size of payload in bytes
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_bench_send(const uint8_t cmd, const uint8_t * const p_payload, const uint16_t size)
+{
+    static uint8_t frame[ BOOT_BENCH_HEAD_SIZE + 512U ];
+
+    if ( size <= ( sizeof( frame ) - BOOT_BENCH_HEAD_SIZE ))
+    {
+        boot_sim_host_send( frame, boot_bench_frame_make( frame, cmd, p_payload, size ));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get next received bootloader frame
+*
+* @note     Bytes are dropped until valid frame (preamble, source and CRC)
+*           is found, thus lost or partial frames resynchronize.
+*
+* @param[out]   p_frame - Received frame
+* @return       true if frame was received
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_bench_frame_get(boot_bench_frame_t * const p_frame)
+{
+    bool     found  = false;
+    uint32_t ofs    = 0U;
+
+    gu32_bench_rx_size += boot_sim_host_receive( &gu8_bench_rx[ gu32_bench_rx_size ], ( sizeof( gu8_bench_rx ) - gu32_bench_rx_size ));
+
+    while (( false == found ) && (( ofs + BOOT_BENCH_HEAD_SIZE ) <= gu32_bench_rx_size ))
+    {
+        const uint8_t * const   p_head  = &gu8_bench_rx[ofs];
+        const uint16_t          size    = (uint16_t)( p_head[2] | ( p_head[3] << 8U ));
+
+        if  (   ( BOOT_BENCH_PREAMBLE_0 != p_head[0] )
+            ||  ( BOOT_BENCH_PREAMBLE_1 != p_head[1] )
+            ||  ( BOOT_BENCH_SRC_BOOT != p_head[4] )
+            ||  (( BOOT_BENCH_HEAD_SIZE + size ) > sizeof( gu8_bench_rx )))
+        {
+            ofs++;
+        }
+
+        // Wait for rest of frame
+        else if (( ofs + BOOT_BENCH_HEAD_SIZE + size ) > gu32_bench_rx_size )
+        {
+            break;
+        }
+        else
+        {
+            uint8_t crc8 = 0U;
+
+            crc8 ^= boot_crc8_calc( &p_head[2], 2U );
+            crc8 ^= boot_crc8_calc( &p_head[4], 1U );
+            crc8 ^= boot_crc8_calc( &p_head[5], 1U );
+            crc8 ^= boot_crc8_calc( &p_head[6], 1U );
+
+            if ( size > 0U )
+            {
+                crc8 ^= boot_crc8_calc( &p_head[ BOOT_BENCH_HEAD_SIZE ], size );
+            }
+
+            if ( crc8 == p_head[7] )
+            {
+                p_frame->cmd    = p_head[5];
+                p_frame->status = p_head[6];
+                p_frame->size   = size;
+                memcpy( p_frame->payload, &p_head[ BOOT_BENCH_HEAD_SIZE ], size );
+
+                ofs  += ( BOOT_BENCH_HEAD_SIZE + size );
+                found = true;
+            }
+            else
+            {
+                ofs++;
+            }
+        }
+    }
+
+    // Remove processed bytes
+    memmove( gu8_bench_rx, &gu8_bench_rx[ofs], ( gu32_bench_rx_size - ofs ));
+    gu32_bench_rx_size -= ofs;
+
+    return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Run single bootloader handler loop
+*
+* @note     When nothing is pending for bootloader, simulated time skips to
+*           next event (at most by "BOOT_BENCH_IDLE_SKIP_US") so idle
+*           periods, timeouts and flash latencies do not cost host time.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_bench_hndl(void)
+{
+    (void) boot_hndl();
+    boot_sim_step();
+
+    const uint64_t now  = boot_sim_get_time_us();
+    const uint64_t next = boot_sim_next_event_us();
+
+    if ( next > now )
+    {
+        boot_sim_advance_to((( next - now ) > BOOT_BENCH_IDLE_SKIP_US ) ? ( now + BOOT_BENCH_IDLE_SKIP_US ) : next );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Wait for bootloader response
+*
+* @param[in]    rsp_cmd     - Expected response command
+* @param[in]    timeout_us  - Timeout in simulated time
+* @return       true if response received, response is in "g_bench_frame"
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_bench_wait(const uint8_t rsp_cmd, const uint64_t timeout_us)
+{
+    const uint64_t  start   = boot_sim_get_time_us();
+    bool            rcv     = false;
+
+    while (( false == rcv ) && (( boot_sim_get_time_us() - start ) < timeout_us ))
+    {
+        boot_bench_hndl();
+
+        while (( false == rcv ) && ( true == boot_bench_frame_get( &g_bench_frame )))
+        {
+            rcv = ( rsp_cmd == g_bench_frame.cmd );
+        }
+    }
+
+    return rcv;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Send request and wait for successful response
+*
+* @param[in]    cmd         - Command
+* @param[in]    p_payload   - Pointer to payload
+* @param[in]    size        - Size of payload in bytes
+* @param[in]    timeout_us  - Response timeout in simulated time
+* @return       true if response with OK status received
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_bench_request(const uint8_t cmd, const uint8_t * const p_payload, const uint16_t size, const uint64_t timeout_us)
+{
+    bool ok = false;
+
+    for ( uint32_t retry = 0U; ( retry < BOOT_BENCH_RETRY_MAX ) && ( false == ok ); retry++ )
+    {
+        boot_bench_send( cmd, p_payload, size );
+
+        if ( true == boot_bench_wait( BOOT_BENCH_RSP( cmd ), timeout_us ))
+        {
+            // Rejected request is not repeated
+            if ( eBOOT_MSG_OK != g_bench_frame.status )
+            {
+                break;
+            }
+
+            ok = true;
+        }
+    }
+
+    return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Generate image content
+*
+* @param[in]    size    - Size of image in bytes
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_bench_image_make(const uint32_t size)
+{
+    gu32_bench_rand = (( 0U != g_bench_opt.seed ) ? g_bench_opt.seed : 1U );
+
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        gp_bench_image[i] = (uint8_t) boot_bench_rand();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Generate image header
+*
+* @param[in]    sign    - Sign image with ECDSA, otherwise CRC image
+* @param[out]   p_head  - Pointer to image header
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_bench_head_make(const bool sign, ver_image_header_t * const p_head)
+{
+    const uint32_t      size = g_bench_opt.image_size;
+    cf_sha256_context   ctx;
+
+    memset( p_head, 0, sizeof( ver_image_header_t ));
+
+    p_head->ctrl.ver           = 1U;
+    p_head->ctrl.image_type    = eVER_IMAGE_TYPE_APP;
+    p_head->data.sw_ver        = 0x00020000U;
+    p_head->data.image_size    = size;
+    p_head->data.image_addr    = BOOT_CFG_APP_HEAD_ADDR;
+    p_head->data.image_crc     = boot_crc32_update( boot_crc32_init(), gp_bench_image, size );
+    p_head->data.sig_type      = (( true == sign ) ? eVER_SIG_TYPE_ECSDA : eVER_SIG_TYPE_NONE );
+
+    cf_sha256_init( &ctx );
+    cf_sha256_update( &ctx, gp_bench_image, size );
+    cf_sha256_digest_final( &ctx, p_head->data.hash );
+
+    if ( true == sign )
+    {
+        (void) uECC_sign( gu8_bench_priv_key, p_head->data.hash, sizeof( p_head->data.hash ), p_head->data.signature,
+                        #if ( BOOT_ECDSA_CURVE_SECP256R1 == BOOT_CFG_ECDSA_CURVE )
+                            uECC_secp256r1());
+                        #else
+                            uECC_secp256k1());
+                        #endif
+    }
+
+    p_head->ctrl.crc = boot_crc8_calc( &p_head->ctrl.ver, ( sizeof( ver_image_header_t ) - 1U ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Encode all flash data frames of image
+*
+* @note     Frames are encoded in advance so that benchmark measures
+*           bootloader processing only.
+*
+* @param[in]    payload     - Negotiated payload size
+* @param[in]    seq         - Sequenced flash data frames
+* @param[out]   p_frames    - Number of frames
+* @return       true on success
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_bench_frames_make(const uint16_t payload, const bool seq, uint32_t * const p_frames)
+{
+    const uint32_t frames   = (( g_bench_head.data.image_size + payload - 1U ) / payload );
+    uint32_t       ofs      = 0U;
+
+    free( gp_bench_frames );
+    free( gp_bench_frame_ofs );
+
+    gp_bench_frames     = malloc( g_bench_head.data.image_size + ( frames * ( BOOT_BENCH_HEAD_SIZE + BOOT_BENCH_SEQ_SIZE )));
+    gp_bench_frame_ofs  = malloc(( frames + 1U ) * sizeof( uint32_t ));
+
+    if (( NULL == gp_bench_frames ) || ( NULL == gp_bench_frame_ofs ))
+    {
+        return false;
+    }
+
+    for ( uint32_t i = 0U; i < frames; i++ )
+    {
+        static uint8_t  data[ BOOT_BENCH_SEQ_SIZE + 0xFFFFU ];
+        const uint32_t  pos     = ( i * payload );
+        const uint16_t  size    = (uint16_t)((( g_bench_head.data.image_size - pos ) > payload ) ? payload : ( g_bench_head.data.image_size - pos ));
+
+        gp_bench_frame_ofs[i] = ofs;
+
+        if ( true == seq )
+        {
+            data[0] = (uint8_t)( i & 0xFFU );
+            data[1] = (uint8_t)(( i >> 8U ) & 0xFFU );
+            memcpy( &data[ BOOT_BENCH_SEQ_SIZE ], &gp_bench_image[pos], size );
+
+            ofs += boot_bench_frame_make( &gp_bench_frames[ofs], BOOT_BENCH_CMD_FLASH_SEQ, data, (uint16_t)( size + BOOT_BENCH_SEQ_SIZE ));
+        }
+        else
+        {
+            ofs += boot_bench_frame_make( &gp_bench_frames[ofs], BOOT_BENCH_CMD_FLASH, &gp_bench_image[pos], size );
+        }
+    }
+
+    gp_bench_frame_ofs[frames] = ofs;
+    *p_frames = frames;
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Transfer flash data frames
+*
+* @note     With sequenced flash data up to "window" frames are in flight,
+*           acknowledge is cumulative (next expected sequence number).
+*           On timeout or retransmission request sending goes back to
+*           first not acknowledged frame. Without window support frames
+*           are sent stop-and-wait. Transfer fails after
+*           "BOOT_BENCH_RETRY_MAX" go-backs without progress.
+*
+* @param[in]    p_ses       - Pointer to session results
+* @param[in]    timeout_us  - Acknowledge timeout in simulated time
+* @return       true if all frames were acknowledged
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_bench_flash(boot_bench_session_t * const p_ses, const uint64_t timeout_us)
+{
+    const uint32_t  window  = (( 0U == p_ses->window ) ? 1U : p_ses->window );
+    const uint8_t   rsp_cmd = (( 0U == p_ses->window ) ? BOOT_BENCH_RSP( BOOT_BENCH_CMD_FLASH ) : BOOT_BENCH_RSP( BOOT_BENCH_CMD_FLASH_SEQ ));
+    uint32_t        base    = 0U;
+    uint32_t        next    = 0U;
+    uint32_t        nak     = UINT32_MAX;
+    uint32_t        retry   = 0U;
+    uint64_t        ack_ts  = boot_sim_get_time_us();
+    bool            ok      = true;
+
+    while (( base < p_ses->frames ) && ( true == ok ))
+    {
+        const uint32_t base_prev = base;
+
+        // Fill window
+        while (( next < p_ses->frames ) && ( next < ( base + window )))
+        {
+            boot_sim_host_send( &gp_bench_frames[ gp_bench_frame_ofs[next] ], ( gp_bench_frame_ofs[ next + 1U ] - gp_bench_frame_ofs[next] ));
+            p_ses->sent++;
+            next++;
+        }
+
+        boot_bench_hndl();
+
+        while (( true == ok ) && ( true == boot_bench_frame_get( &g_bench_frame )))
+        {
+            if ( rsp_cmd != g_bench_frame.cmd )
+            {
+                continue;
+            }
+
+            // Stop-and-wait
+            if ( 0U == p_ses->window )
+            {
+                if ( eBOOT_MSG_OK == g_bench_frame.status )
+                {
+                    base++;
+                }
+                else
+                {
+                    ok = false;
+                }
+            }
+
+            // Cumulative acknowledge, unwrap 16-bit sequence number
+            else if ( g_bench_frame.size >= BOOT_BENCH_SEQ_SIZE )
+            {
+                const uint16_t  seq = (uint16_t)( g_bench_frame.payload[0] | ( g_bench_frame.payload[1] << 8U ));
+                uint32_t        ack = (( base & 0xFFFF0000U ) | seq );
+
+                if (( ack < base ) && (( base - ack ) > 0x8000U ))
+                {
+                    ack += 0x10000U;
+                }
+
+                if (( eBOOT_MSG_OK == g_bench_frame.status ) && ( ack > base ))
+                {
+                    base = ack;
+                }
+
+                // Frames missing -> go back once, frames already in flight
+                // after missing one are rejected as well
+                else if ( eBOOT_MSG_ERROR_INVALID_REQ == g_bench_frame.status )
+                {
+                    if (( ack > base ) || (( ack == base ) && ( nak != base )))
+                    {
+                        base    = ack;
+                        next    = base;
+                        nak     = base;
+                        ack_ts  = boot_sim_get_time_us();
+                        retry++;
+                    }
+                }
+                else if ( eBOOT_MSG_OK != g_bench_frame.status )
+                {
+                    ok = false;
+                }
+            }
+        }
+
+        // Progress
+        if ( base != base_prev )
+        {
+            ack_ts  = boot_sim_get_time_us();
+            retry   = 0U;
+        }
+
+        // Acknowledge timeout -> go back
+        if (( boot_sim_get_time_us() - ack_ts ) > timeout_us )
+        {
+            ack_ts  = boot_sim_get_time_us();
+            next    = base;
+            nak     = UINT32_MAX;
+            retry++;
+        }
+
+        // Bootloader does not accept frames anymore
+        if ( retry > BOOT_BENCH_RETRY_MAX )
+        {
+            ok = false;
+        }
+    }
+
+    return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Run complete upgrade session
+*
+* @param[in]    p_ses   - Pointer to session results
+* @return       true if application was started with new image
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_bench_session(boot_bench_session_t * const p_ses)
+{
+    boot_info_t info        = {0};
+    uint8_t     connect[3]  = { (uint8_t)( g_bench_opt.payload & 0xFFU ), (uint8_t)( g_bench_opt.payload >> 8U ), 0U };
+    uint64_t    timeout_us  = 0ULL;
+    bool        ok          = false;
+
+    p_ses->sessions++;
+
+    // Capabilities
+    if ( true == boot_bench_request( BOOT_BENCH_CMD_INFO, NULL, 0U, 100000ULL + g_bench_opt.sim.rtt_us ))
+    {
+        memcpy( &info, g_bench_frame.payload, (( g_bench_frame.size < sizeof( info )) ? g_bench_frame.size : sizeof( info )));
+
+        p_ses->window = info.flash_window;
+
+        if (( 0U != g_bench_opt.window ) && ( g_bench_opt.window < p_ses->window ))
+        {
+            p_ses->window = g_bench_opt.window;
+        }
+
+        ok = boot_bench_request( BOOT_BENCH_CMD_CONNECT, connect, sizeof( connect ), 100000ULL + g_bench_opt.sim.rtt_us );
+    }
+
+    // Negotiated payload size
+    if ( true == ok )
+    {
+        p_ses->payload = (uint16_t)( g_bench_frame.payload[0] | ( g_bench_frame.payload[1] << 8U ));
+        ok = (( p_ses->payload > 0U ) && ( true == boot_bench_frames_make( p_ses->payload, ( 0U != p_ses->window ), &p_ses->frames )));
+    }
+
+    if ( true == ok )
+    {
+        ok = boot_bench_request( BOOT_BENCH_CMD_PREPARE, (const uint8_t*) &g_bench_head, sizeof( g_bench_head ), BOOT_BENCH_LONG_TIMEOUT_US );
+    }
+
+    if ( true == ok )
+    {
+        // Window of frames on the wire plus flash program time
+        const uint64_t frame_us = (( 0U != g_bench_opt.sim.baud ) ? (( p_ses->payload + 16ULL ) * 10000000ULL / g_bench_opt.sim.baud ) : 0ULL );
+        timeout_us = ( g_bench_opt.sim.rtt_us + ( 2ULL * ( p_ses->window + 1U ) * frame_us ) + 50000ULL );
+
+        const uint32_t start = boot_sim_host_time_us();
+        ok = boot_bench_flash( p_ses, timeout_us );
+        p_ses->flash_host_us = ( boot_sim_host_time_us() - start );
+    }
+
+    #if ( 1 == BOOT_CFG_STATS_EN )
+        if  (   ( true == ok )
+            &&  ( true == boot_bench_request( BOOT_BENCH_CMD_STATS, NULL, 0U, 100000ULL + g_bench_opt.sim.rtt_us )))
+        {
+            memcpy( &p_ses->stats, g_bench_frame.payload, (( g_bench_frame.size < sizeof( p_ses->stats )) ? g_bench_frame.size : sizeof( p_ses->stats )));
+        }
+    #endif
+
+    if ( true == ok )
+    {
+        ok = boot_bench_request( BOOT_BENCH_CMD_EXIT, NULL, 0U, BOOT_BENCH_LONG_TIMEOUT_US );
+    }
+
+    // Application is started after exit response
+    if ( true == ok )
+    {
+        const uint64_t start = boot_sim_get_time_us();
+
+        while (( false == boot_sim_app_started()) && (( boot_sim_get_time_us() - start ) < BOOT_BENCH_LONG_TIMEOUT_US ))
+        {
+            boot_bench_hndl();
+        }
+
+        ok = boot_sim_app_started();
+    }
+
+    return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Upgrade benchmark
+*
+* @note     Lost connect, prepare or exit responses can leave bootloader
+*           in other state, thus failed session is restarted from the
+*           beginning (connect in non-idle state returns bootloader to idle).
+*
+* @param[in]    p_sim   - Link and flash model
+* @param[out]   p_ses   - Session results
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_bench_update(const boot_sim_cfg_t * const p_sim, boot_bench_session_t * const p_ses)
+{
+    boot_sim_cnt_t cnt = {0};
+
+    memset( p_ses, 0, sizeof( boot_bench_session_t ));
+
+    boot_sim_flash_clear();
+    boot_sim_init( p_sim );
+    gu32_bench_rx_size = 0U;
+
+    if ( eBOOT_OK == boot_init())
+    {
+        const uint64_t start = boot_sim_get_time_us();
+
+        for ( uint32_t i = 0U; ( i < BOOT_BENCH_RETRY_MAX ) && ( false == p_ses->ok ); i++ )
+        {
+            p_ses->ok = boot_bench_session( p_ses );
+        }
+
+        p_ses->time_us = ( boot_sim_get_time_us() - start );
+
+        boot_sim_get_cnt( &cnt );
+        p_ses->lost     = cnt.lost;
+        p_ses->writes   = cnt.writes;
+
+        // Installed image must match
+        p_ses->ok = (   ( true == p_ses->ok )
+                    &&  ( 0 == memcmp( boot_sim_flash_ptr( BOOT_CFG_APP_HEAD_ADDR + sizeof( ver_image_header_t )), gp_bench_image, g_bench_head.data.image_size )));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Cold boot benchmark
+*
+* @note     Image is installed directly into flash and bootloader is
+*           initialized once, as after reset. Validation time is taken
+*           from shared memory (statistics), without statistics it falls
+*           back to complete initialization time (includes back-door wait
+*           without fast boot).
+*
+* @param[in]    p_head  - Pointer to header of installed image
+* @param[out]   p_boot  - Cold boot results
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_bench_cold_boot(const ver_image_header_t * const p_head, boot_bench_boot_t * const p_boot)
+{
+    memset( p_boot, 0, sizeof( boot_bench_boot_t ));
+
+    boot_sim_flash_clear();
+    boot_sim_flash_load( BOOT_CFG_APP_HEAD_ADDR, (const uint8_t*) p_head, sizeof( ver_image_header_t ));
+    boot_sim_flash_load( BOOT_CFG_APP_HEAD_ADDR + sizeof( ver_image_header_t ), gp_bench_image, p_head->data.image_size );
+    boot_sim_init( &g_bench_ideal );
+
+    // Shared memory survives reset, application left it clean
+    (void) boot_shared_mem_set_boot_reason( eBOOT_REASON_NONE );
+    (void) boot_shared_mem_set_boot_cnt( 0U );
+
+    // Validation, back-door entry wait and start of application
+    const uint32_t start = boot_sim_host_time_us();
+    (void) boot_init();
+    p_boot->host_us = ( boot_sim_host_time_us() - start );
+    p_boot->ok      = boot_sim_app_started();
+
+    #if ( 1 == BOOT_CFG_STATS_EN )
+        (void) boot_shared_mem_get_valid_time( &p_boot->valid_us );
+    #else
+        p_boot->valid_us = p_boot->host_us;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Paint stack below caller
+*
+* @note     Deeper calls made later reuse painted region, first overwritten
+*           byte gives peak stack depth relative to caller of this function.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void __attribute__((noinline)) boot_bench_stack_paint(void)
+{
+    volatile uint8_t paint[ BOOT_BENCH_STACK_PAINT_SIZE ];
+
+    for ( uint32_t i = 0U; i < BOOT_BENCH_STACK_PAINT_SIZE; i++ )
+    {
+        paint[i] = BOOT_BENCH_STACK_PAINT;
+    }
+
+    gu_bench_stack_addr = (uintptr_t) &paint[0];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get peak stack usage
+*
+* @return       used stack in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t boot_bench_stack_used(void)
+{
+    uint32_t i = 0U;
+
+    while (( i < BOOT_BENCH_STACK_PAINT_SIZE ) && ( BOOT_BENCH_STACK_PAINT == ((volatile const uint8_t*) gu_bench_stack_addr )[i] ))
+    {
+        i++;
+    }
+
+    return ( BOOT_BENCH_STACK_PAINT_SIZE - i );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Parse command line arguments
+*
+* @param[in]    argc    - Number of arguments
+* @param[in]    argv    - Arguments
+* @return       true if arguments are valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_bench_args(int argc, char ** argv)
+{
+    static const struct option options[] =
+    {
+        { "image-size",           required_argument, NULL, 's' },
+        { "payload",              required_argument, NULL, 'p' },
+        { "window",               required_argument, NULL, 'w' },
+        { "baud",                 required_argument, NULL, 'b' },
+        { "rtt-us",               required_argument, NULL, 'r' },
+        { "loss-ppm",             required_argument, NULL, 'l' },
+        { "erase-us-per-kb",      required_argument, NULL, 'e' },
+        { "program-us-per-kb",    required_argument, NULL, 'g' },
+        { "program-us-per-write", required_argument, NULL, 'y' },
+        { "loop-us",              required_argument, NULL, 'u' },
+        { "seed",                 required_argument, NULL, 'x' },
+        { "output",               required_argument, NULL, 'o' },
+        { NULL,                   0,                 NULL, 0   },
+    };
+
+    bool    valid   = true;
+    int     opt     = 0;
+
+    while (( true == valid ) && ( -1 != ( opt = getopt_long( argc, argv, "s:p:w:b:r:l:e:g:y:u:x:o:", options, NULL ))))
+    {
+        const uint32_t value = (( 'o' != opt ) && ( NULL != optarg )) ? (uint32_t) strtoul( optarg, NULL, 0 ) : 0U;
+
+        switch ( opt )
+        {
+            case 's':   g_bench_opt.image_size               = value;                  break;
+            case 'p':   g_bench_opt.payload                  = (uint16_t) value;       break;
+            case 'w':   g_bench_opt.window                   = (uint8_t) value;        break;
+            case 'b':   g_bench_opt.sim.baud                 = value;                  break;
+            case 'r':   g_bench_opt.sim.rtt_us               = value;                  break;
+            case 'l':   g_bench_opt.sim.loss_ppm             = value;                  break;
+            case 'e':   g_bench_opt.sim.erase_us_per_kb      = value;                  break;
+            case 'g':   g_bench_opt.sim.program_us_per_kb    = value;                  break;
+            case 'y':   g_bench_opt.sim.program_us_per_write = value;                  break;
+            case 'u':   g_bench_opt.sim.loop_us              = value;                  break;
+            case 'x':   g_bench_opt.seed = value; g_bench_opt.sim.seed = value;        break;
+            case 'o':   g_bench_opt.p_out                    = optarg;                 break;
+            default:    valid = false;                                                 break;
+        }
+    }
+
+    // Busy waits of bootloader advance simulated time by handler loop
+    if  (   ( 0U == g_bench_opt.image_size )
+        ||  ( g_bench_opt.image_size > BOOT_CFG_APP_SIZE_MAX )
+        ||  ( 0U == g_bench_opt.sim.loop_us ))
+    {
+        valid = false;
+    }
+
+    return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Print benchmark results as JSON
+*
+* @param[in]    p_file      - Output file
+* @param[in]    p_parser    - Parser benchmark results
+* @param[in]    p_update    - Upgrade benchmark results
+* @param[in]    p_crc       - CRC image cold boot results
+* @param[in]    p_ecdsa     - ECDSA image cold boot results, NULL when signature is disabled
+* @param[in]    stack       - Peak stack usage
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_bench_report(FILE * const p_file, const boot_bench_session_t * const p_parser, const boot_bench_session_t * const p_update,
+                              const boot_bench_boot_t * const p_crc, const boot_bench_boot_t * const p_ecdsa, const uint32_t stack)
+{
+    const double    parser_s    = (( p_parser->flash_host_us > 0U ) ? ( p_parser->flash_host_us / 1e6 ) : 1e-6 );
+    const double    update_s    = (( p_update->time_us > 0U ) ? ( p_update->time_us / 1e6 ) : 1e-6 );
+
+    fprintf( p_file, "{\n" );
+    fprintf( p_file, "  \"bench\": \"boot_sim\",\n" );
+    fprintf( p_file, "  \"config\": { \"image_size\": %u, \"payload\": %u, \"window\": %u, \"baud\": %u, \"rtt_us\": %u, \"loss_ppm\": %u, "
+                     "\"erase_us_per_kb\": %u, \"program_us_per_kb\": %u, \"program_us_per_write\": %u, \"loop_us\": %u, \"seed\": %u },\n",
+                     g_bench_opt.image_size, g_bench_opt.payload, g_bench_opt.window, g_bench_opt.sim.baud, g_bench_opt.sim.rtt_us, g_bench_opt.sim.loss_ppm,
+                     g_bench_opt.sim.erase_us_per_kb, g_bench_opt.sim.program_us_per_kb, g_bench_opt.sim.program_us_per_write, g_bench_opt.sim.loop_us, g_bench_opt.seed );
+
+    fprintf( p_file, "  \"parser\": { \"ok\": %s, \"frames\": %u, \"payload\": %u, \"host_us\": %u, \"frames_per_s\": %.0f, \"bytes_per_s\": %.0f },\n",
+                     ( p_parser->ok ? "true" : "false" ), p_parser->frames, p_parser->payload, p_parser->flash_host_us,
+                     ( p_parser->frames / parser_s ), ( g_bench_opt.image_size / parser_s ));
+
+    fprintf( p_file, "  \"update\": { \"ok\": %s, \"time_ms\": %.3f, \"frames\": %u, \"sent\": %u, \"sessions\": %u, \"payload\": %u, \"window\": %u, "
+                     "\"bytes_per_s\": %.0f, \"lost\": %u, \"writes\": %u",
+                     ( p_update->ok ? "true" : "false" ), ( p_update->time_us / 1e3 ), p_update->frames, p_update->sent, p_update->sessions,
+                     p_update->payload, p_update->window, ( g_bench_opt.image_size / update_s ), p_update->lost, p_update->writes );
+
+    #if ( 1 == BOOT_CFG_STATS_EN )
+        fprintf( p_file, ",\n    \"stats\": { \"erase_us\": %u, \"program_us\": %u, \"decrypt_us\": %u, \"hash_us\": %u, \"verify_us\": %u, "
+                         "\"programmed\": %u, \"frames\": %u, \"crc_err\": %u, \"timeouts\": %u, \"rx_overflows\": %u }",
+                         p_update->stats.erase_us, p_update->stats.program_us, p_update->stats.decrypt_us, p_update->stats.hash_us,
+                         p_update->stats.verify_us, p_update->stats.programmed, p_update->stats.com.frames, p_update->stats.com.crc_err,
+                         p_update->stats.com.timeouts, p_update->stats.com.rx_overflows );
+    #endif
+
+    fprintf( p_file, " },\n" );
+    fprintf( p_file, "  \"boot_crc\": { \"ok\": %s, \"valid_us\": %u, \"host_us\": %u },\n", ( p_crc->ok ? "true" : "false" ), p_crc->valid_us, p_crc->host_us );
+
+    if ( NULL != p_ecdsa )
+    {
+        fprintf( p_file, "  \"boot_ecdsa\": { \"ok\": %s, \"valid_us\": %u, \"host_us\": %u },\n", ( p_ecdsa->ok ? "true" : "false" ), p_ecdsa->valid_us, p_ecdsa->host_us );
+    }
+    else
+    {
+        fprintf( p_file, "  \"boot_ecdsa\": null,\n" );
+    }
+
+    fprintf( p_file, "  \"ram\": { \"static_bytes\": %u, \"stack_peak_bytes\": %u, \"peak_bytes\": %u }\n",
+                     (uint32_t) BOOT_BENCH_CORE_RAM, stack, ((uint32_t) BOOT_BENCH_CORE_RAM + stack ));
+    fprintf( p_file, "}\n" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Benchmark entry
+*
+* @param[in]    argc    - Number of arguments
+* @param[in]    argv    - Arguments
+* @return       0 if all benchmarks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+    static boot_bench_session_t parser  = {0};
+    static boot_bench_session_t update  = {0};
+    boot_bench_boot_t           crc     = {0};
+    const boot_bench_boot_t *   p_ecdsa = NULL;
+    FILE *                      p_file  = stdout;
+    bool                        ok      = true;
+
+    #if ( 1 == BOOT_CFG_DIGITAL_SIGN_EN )
+        boot_bench_boot_t       ecdsa   = {0};
+    #endif
+
+    if ( false == boot_bench_args( argc, argv ))
+    {
+        fprintf( stderr, "usage: %s [--image-size B] [--payload B] [--window N] [--baud BPS] [--rtt-us US] [--loss-ppm PPM]\n"
+                         "          [--erase-us-per-kb US] [--program-us-per-kb US] [--program-us-per-write US]\n"
+                         "          [--loop-us US] [--seed N] [--output FILE]\n", argv[0] );
+        return 2;
+    }
+
+    gp_bench_image = malloc( g_bench_opt.image_size );
+
+    if ( NULL == gp_bench_image )
+    {
+        return 2;
+    }
+
+    // Signing key
+    gu32_bench_rand = (( 0U != g_bench_opt.seed ) ? g_bench_opt.seed : 1U );
+    uECC_set_rng( boot_bench_uecc_rng );
+    #if ( BOOT_ECDSA_CURVE_SECP256R1 == BOOT_CFG_ECDSA_CURVE )
+        (void) uECC_make_key( gu8_bench_pub_key, gu8_bench_priv_key, uECC_secp256r1());
+    #else
+        (void) uECC_make_key( gu8_bench_pub_key, gu8_bench_priv_key, uECC_secp256k1());
+    #endif
+    boot_sim_set_public_key( gu8_bench_pub_key );
+
+    // Images are prepared in advance, signing is not part of stack usage
+    boot_bench_image_make( g_bench_opt.image_size );
+    boot_bench_head_make( false, &g_bench_head_crc );
+    boot_bench_head_make( true, &g_bench_head_ecdsa );
+    g_bench_head = (( 1 == BOOT_CFG_DIGITAL_SIGN_EN ) ? g_bench_head_ecdsa : g_bench_head_crc );
+
+    boot_bench_stack_paint();
+
+    // Upgrade
+    boot_bench_update( &g_bench_ideal, &parser );
+    boot_bench_update( &g_bench_opt.sim, &update );
+
+    // Cold boot
+    boot_bench_cold_boot( &g_bench_head_crc, &crc );
+
+    #if ( 1 == BOOT_CFG_DIGITAL_SIGN_EN )
+        boot_bench_cold_boot( &g_bench_head_ecdsa, &ecdsa );
+        p_ecdsa = &ecdsa;
+    #endif
+
+    ok = (( true == parser.ok ) && ( true == update.ok ) && ( true == crc.ok ) && (( NULL == p_ecdsa ) || ( true == p_ecdsa->ok )));
+
+    if ( NULL != g_bench_opt.p_out )
+    {
+        p_file = fopen( g_bench_opt.p_out, "w" );
+
+        if ( NULL == p_file )
+        {
+            return 2;
+        }
+    }
+
+    boot_bench_report( p_file, &parser, &update, &crc, p_ecdsa, boot_bench_stack_used());
+
+    if ( stdout != p_file )
+    {
+        fclose( p_file );
+    }
+
+    return (( true == ok ) ? 0 : 1 );
+}
@@ -0,0 +1,1309 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_sim.c
+*@brief     Host simulation of bootloader interface
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup Bootloader host simulation
+* @{ <!-- BEGIN GROUP -->
+*
+*   Implements "boot_if_*" interface on host with simulated time:
+*
+*       - RAM backed flash with erase and program latency. Erase sets
+*         bytes to 0xFF, program fails on non-erased bytes (NOR flash).
+*       - Loopback link between Boot Manager (host) and bootloader with
+*         serialization time (baudrate), propagation delay (RTT/2) and
+*         random loss of complete transfers. Transfers issued at the same
+*         simulated time (header, payload and trailer of one frame) are
+*         lost together.
+*
+*   Simulated time advances only with flash operations, link transfers and
+*   handler loops ("boot_sim_step()"), thus results are reproducible and do
+*   not depend on host speed. Bootloader systick is derived from it.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <time.h>
+
+#include "boot_sim.h"
+#include "boot_if.h"
+#include "boot/src/boot_com.h"
+
+#if ( 1 == BOOT_CFG_ECDSA_HW_EN )
+    #include "micro_ecc/uECC.h"
+#endif
+
+// Bootloader version
+#include "revision/revision/src/version.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Bits per transferred byte (start + 8 data + stop)
+ */
+#define BOOT_SIM_BITS_PER_BYTE                  ( 10ULL )
+
+/**
+ *  Simulated bootloader software version
+ */
+#define BOOT_SIM_BOOT_VER                       ( 0x01010000U )
+
+/**
+ *  Link pipe (one direction)
+ */
+typedef struct
+{
+    uint8_t     data[BOOT_SIM_LINK_BUF_SIZE];       /**<Transferred data */
+    uint32_t    xfer_end[BOOT_SIM_LINK_XFER_MAX];   /**<End of transfer inside data */
+    uint64_t    xfer_ns[BOOT_SIM_LINK_XFER_MAX];    /**<Arrival time of transfer */
+    uint32_t    head;                               /**<Write position */
+    uint32_t    tail;                               /**<Read position */
+    uint32_t    xfer_head;                          /**<Transfer write index */
+    uint32_t    xfer_tail;                          /**<Transfer read index */
+    uint64_t    busy_ns;                            /**<Link busy until */
+    uint64_t    burst_ns;                           /**<Time of last transfer */
+    bool        burst_lost;                         /**<Last transfer lost */
+} boot_sim_pipe_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Simulation configuration
+ */
+static boot_sim_cfg_t g_sim_cfg = {0};
+
+/**
+ *  Simulated time
+ *
+ *  Unit: ns
+ */
+static uint64_t gu64_sim_ns = 0ULL;
+
+/**
+ *  Link pipes
+ */
+static boot_sim_pipe_t g_sim_to_boot = {0};
+static boot_sim_pipe_t g_sim_to_host = {0};
+
+/**
+ *  Downstream link pipes of bridge (BOOT_CFG_BRIDGE_EN)
+ */
+static boot_sim_pipe_t g_sim_to_node    = {0};
+static boot_sim_pipe_t g_sim_from_node  = {0};
+
+/**
+ *  Link loss random generator state
+ */
+static uint32_t gu32_sim_rand = 1U;
+
+/**
+ *  Simulated flash
+ */
+static uint8_t gu8_sim_flash[BOOT_SIM_FLASH_SIZE];
+
+#if ( 1 == BOOT_CFG_EXT_FLASH_EN )
+
+    /**
+     *  Simulated external flash
+     */
+    static uint8_t gu8_sim_ext_flash[BOOT_SIM_EXT_FLASH_SIZE];
+
+#endif
+
+/**
+ *  Public key
+ */
+static uint8_t gu8_sim_pub_key[64] = {0};
+
+/**
+ *  Counters
+ */
+static boot_sim_cnt_t g_sim_cnt = {0};
+
+/**
+ *  Application started (bootloader de-initialized)
+ */
+static bool gb_sim_app_started = false;
+
+#if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+
+    /**
+     *  Pending asynchronous flash write
+     */
+    static struct
+    {
+        const uint8_t * p_data;     /**<Data to write */
+        uint64_t        done_ns;    /**<Write completion time */
+        uint32_t        addr;       /**<Flash address */
+        uint32_t        size;       /**<Size of data */
+        boot_status_t   status;     /**<Status of last write */
+        bool            busy;       /**<Write in progress */
+    } g_sim_async = { .status = eBOOT_OK };
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t         boot_sim_rand       (void);
+static void             boot_sim_pipe_reset (boot_sim_pipe_t * const p_pipe);
+static void             boot_sim_pipe_push  (boot_sim_pipe_t * const p_pipe, const uint8_t * const p_data, const uint32_t size);
+static uint32_t         boot_sim_pipe_pop   (boot_sim_pipe_t * const p_pipe, uint8_t * const p_data, const uint32_t max);
+static boot_sim_pipe_t * boot_sim_tx_pipe   (void);
+static boot_sim_pipe_t * boot_sim_rx_pipe   (void);
+static bool             boot_sim_flash_in   (const uint32_t addr, const uint32_t size);
+static uint64_t         boot_sim_flash_ns   (const uint32_t us_per_kb, const uint32_t size);
+static boot_status_t    boot_sim_program    (const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Link loss random generator (xorshift32)
+*
+* @return       rand - Random value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t boot_sim_rand(void)
+{
+    gu32_sim_rand ^= ( gu32_sim_rand << 13U );
+    gu32_sim_rand ^= ( gu32_sim_rand >> 17U );
+    gu32_sim_rand ^= ( gu32_sim_rand << 5U );
+
+    return gu32_sim_rand;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset link pipe
+*
+* @param[in]    p_pipe  - Pointer to link pipe
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_sim_pipe_reset(boot_sim_pipe_t * const p_pipe)
+{
+    p_pipe->head        = 0U;
+    p_pipe->tail        = 0U;
+    p_pipe->xfer_head   = 0U;
+    p_pipe->xfer_tail   = 0U;
+    p_pipe->busy_ns     = 0ULL;
+    p_pipe->burst_ns    = UINT64_MAX;
+    p_pipe->burst_lost  = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Push transfer to link pipe
+*
+* @note     Transfer occupies link for its serialization time and arrives
+*           half of RTT later. Lost transfer occupies link as well.
+*
+* @param[in]    p_pipe  - Pointer to link pipe
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of data in bytes
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_sim_pipe_push(boot_sim_pipe_t * const p_pipe, const uint8_t * const p_data, const uint32_t size)
+{
+    // Parts of one frame share the fate
+    if ( p_pipe->burst_ns != gu64_sim_ns )
+    {
+        p_pipe->burst_ns    = gu64_sim_ns;
+        p_pipe->burst_lost  = (( boot_sim_rand() % 1000000U ) < g_sim_cfg.loss_ppm );
+
+        if ( true == p_pipe->burst_lost )
+        {
+            g_sim_cnt.lost++;
+        }
+    }
+
+    // Serialization
+    if ( p_pipe->busy_ns < gu64_sim_ns )
+    {
+        p_pipe->busy_ns = gu64_sim_ns;
+    }
+
+    if ( 0U != g_sim_cfg.baud )
+    {
+        p_pipe->busy_ns += (( size * BOOT_SIM_BITS_PER_BYTE * 1000000000ULL ) / g_sim_cfg.baud );
+    }
+
+    if ( false == p_pipe->burst_lost )
+    {
+        // Make space
+        if  (   (( p_pipe->head + size ) > BOOT_SIM_LINK_BUF_SIZE )
+            ||  ( p_pipe->xfer_head >= BOOT_SIM_LINK_XFER_MAX ))
+        {
+            const uint32_t xfers = ( p_pipe->xfer_head - p_pipe->xfer_tail );
+
+            memmove( &p_pipe->data[0], &p_pipe->data[ p_pipe->tail ], ( p_pipe->head - p_pipe->tail ));
+            memmove( &p_pipe->xfer_ns[0], &p_pipe->xfer_ns[ p_pipe->xfer_tail ], ( xfers * sizeof( uint64_t )));
+            memmove( &p_pipe->xfer_end[0], &p_pipe->xfer_end[ p_pipe->xfer_tail ], ( xfers * sizeof( uint32_t )));
+
+            for ( uint32_t i = 0U; i < xfers; i++ )
+            {
+                p_pipe->xfer_end[i] -= p_pipe->tail;
+            }
+
+            p_pipe->head       -= p_pipe->tail;
+            p_pipe->tail        = 0U;
+            p_pipe->xfer_head   = xfers;
+            p_pipe->xfer_tail   = 0U;
+        }
+
+        // Pipe overflow -> transfer lost
+        if  (   (( p_pipe->head + size ) > BOOT_SIM_LINK_BUF_SIZE )
+            ||  ( p_pipe->xfer_head >= BOOT_SIM_LINK_XFER_MAX ))
+        {
+            g_sim_cnt.lost++;
+        }
+        else
+        {
+            memcpy( &p_pipe->data[ p_pipe->head ], p_data, size );
+            p_pipe->head += size;
+
+            p_pipe->xfer_end[ p_pipe->xfer_head ]   = p_pipe->head;
+            p_pipe->xfer_ns[ p_pipe->xfer_head ]    = ( p_pipe->busy_ns + ( g_sim_cfg.rtt_us * 500ULL ));
+            p_pipe->xfer_head++;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Pop arrived data from link pipe
+*
+* @param[in]    p_pipe  - Pointer to link pipe
+* @param[out]   p_data  - Pointer to data, NULL to discard data
+* @param[in]    max     - Maximum number of bytes
+* @return       size    - Number of popped bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t boot_sim_pipe_pop(boot_sim_pipe_t * const p_pipe, uint8_t * const p_data, const uint32_t max)
+{
+    uint32_t size = 0U;
+
+    while   (   ( size < max )
+            &&  ( p_pipe->xfer_tail < p_pipe->xfer_head )
+            &&  ( p_pipe->xfer_ns[ p_pipe->xfer_tail ] <= gu64_sim_ns ))
+    {
+        const uint32_t avail    = ( p_pipe->xfer_end[ p_pipe->xfer_tail ] - p_pipe->tail );
+        const uint32_t take     = ((( max - size ) < avail ) ? ( max - size ) : avail );
+
+        if ( NULL != p_data )
+        {
+            memcpy( &p_data[size], &p_pipe->data[ p_pipe->tail ], take );
+        }
+
+        size            += take;
+        p_pipe->tail    += take;
+
+        if ( p_pipe->tail == p_pipe->xfer_end[ p_pipe->xfer_tail ] )
+        {
+            p_pipe->xfer_tail++;
+        }
+    }
+
+    // Drained
+    if ( p_pipe->xfer_tail == p_pipe->xfer_head )
+    {
+        p_pipe->head        = 0U;
+        p_pipe->tail        = 0U;
+        p_pipe->xfer_head   = 0U;
+        p_pipe->xfer_tail   = 0U;
+    }
+
+    return size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get transmission pipe of selected communication channel
+*
+* @return       p_pipe  - Pipe towards Boot Manager or downstream nodes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_sim_pipe_t * boot_sim_tx_pipe(void)
+{
+    boot_sim_pipe_t * p_pipe = &g_sim_to_host;
+
+    #if ( 1 == BOOT_CFG_BRIDGE_EN )
+        if ( BOOT_COM_CH_DOWNSTREAM == boot_com_get_ch())
+        {
+            p_pipe = &g_sim_to_node;
+        }
+    #endif
+
+    return p_pipe;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get reception pipe of selected communication channel
+*
+* @return       p_pipe  - Pipe from Boot Manager or downstream nodes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_sim_pipe_t * boot_sim_rx_pipe(void)
+{
+    boot_sim_pipe_t * p_pipe = &g_sim_to_boot;
+
+    #if ( 1 == BOOT_CFG_BRIDGE_EN )
+        if ( BOOT_COM_CH_DOWNSTREAM == boot_com_get_ch())
+        {
+            p_pipe = &g_sim_from_node;
+        }
+    #endif
+
+    return p_pipe;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if region is inside simulated flash
+*
+* @param[in]    addr    - Start address
+* @param[in]    size    - Size of region in bytes
+* @return       true if inside flash
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_sim_flash_in(const uint32_t addr, const uint32_t size)
+{
+    return  (   ( addr >= BOOT_SIM_FLASH_ADDR )
+            &&  ((uint64_t)( addr - BOOT_SIM_FLASH_ADDR ) + size <= BOOT_SIM_FLASH_SIZE ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Flash operation duration
+*
+* @param[in]    us_per_kb   - Operation time per kB
+* @param[in]    size        - Size of region in bytes
+* @return       duration of operation in ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t boot_sim_flash_ns(const uint32_t us_per_kb, const uint32_t size)
+{
+    return ((( uint64_t ) us_per_kb * size * 1000ULL ) / 1024ULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Program simulated flash
+*
+* @param[in]    addr    - Flash address
+* @param[in]    size    - Size of data in bytes
+* @param[in]    p_data  - Pointer to data
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_sim_program(const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    boot_status_t status = eBOOT_OK;
+
+    if ( true == boot_sim_flash_in( addr, size ))
+    {
+        uint8_t * const p_flash = &gu8_sim_flash[ addr - BOOT_SIM_FLASH_ADDR ];
+
+        for ( uint32_t i = 0U; i < size; i++ )
+        {
+            // Programming over non-erased flash
+            if ( 0xFFU != p_flash[i] )
+            {
+                status = eBOOT_ERROR;
+                break;
+            }
+        }
+
+        if ( eBOOT_OK == status )
+        {
+            memcpy( p_flash, p_data, size );
+            g_sim_cnt.programmed += size;
+            g_sim_cnt.writes++;
+        }
+    }
+    else
+    {
+        status = eBOOT_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_SIM_API
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of Bootloader host simulation API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize simulation
+*
+* @note     Resets simulated time, link and counters. Flash content is kept.
+*
+* @param[in]    p_cfg   - Pointer to simulation configuration
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_sim_init(const boot_sim_cfg_t * const p_cfg)
+{
+    g_sim_cfg       = *p_cfg;
+    gu64_sim_ns     = 0ULL;
+    gu32_sim_rand   = (( 0U != p_cfg->seed ) ? p_cfg->seed : 1U );
+
+    boot_sim_link_reset();
+    memset( &g_sim_cnt, 0, sizeof( g_sim_cnt ));
+
+    gb_sim_app_started = false;
+
+    #if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+        g_sim_async.busy    = false;
+        g_sim_async.status  = eBOOT_OK;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Drop all data inside link
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_sim_link_reset(void)
+{
+    boot_sim_pipe_reset( &g_sim_to_boot );
+    boot_sim_pipe_reset( &g_sim_to_host );
+    boot_sim_pipe_reset( &g_sim_to_node );
+    boot_sim_pipe_reset( &g_sim_from_node );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get simulation counters
+*
+* @param[out]   p_cnt   - Pointer to counters
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_sim_get_cnt(boot_sim_cnt_t * const p_cnt)
+{
+    *p_cnt = g_sim_cnt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get simulated time
+*
+* @return       time in microseconds
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint64_t boot_sim_get_time_us(void)
+{
+    return ( gu64_sim_ns / 1000ULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get simulated systick
+*
+* @return       time in milliseconds
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t boot_sim_get_systick(void)
+{
+    return (uint32_t)( gu64_sim_ns / 1000000ULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Account single bootloader handler loop
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_sim_step(void)
+{
+    gu64_sim_ns += ( g_sim_cfg.loop_us * 1000ULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Advance simulated time
+*
+* @note     Used to skip idle time, simulated time never goes back.
+*
+* @param[in]    time_us - Simulated time in microseconds
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_sim_advance_to(const uint64_t time_us)
+{
+    if (( time_us * 1000ULL ) > gu64_sim_ns )
+    {
+        gu64_sim_ns = ( time_us * 1000ULL );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get time of next simulated event
+*
+* @note     Arrival of pending transfer (either direction) or completion of
+*           asynchronous flash write. Used to skip idle time.
+*
+* @return       time in microseconds, UINT64_MAX if nothing is pending
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint64_t boot_sim_next_event_us(void)
+{
+    uint64_t next = UINT64_MAX;
+
+    if ( g_sim_to_boot.xfer_tail < g_sim_to_boot.xfer_head )
+    {
+        next = g_sim_to_boot.xfer_ns[ g_sim_to_boot.xfer_tail ];
+    }
+
+    if  (   ( g_sim_to_host.xfer_tail < g_sim_to_host.xfer_head )
+        &&  ( g_sim_to_host.xfer_ns[ g_sim_to_host.xfer_tail ] < next ))
+    {
+        next = g_sim_to_host.xfer_ns[ g_sim_to_host.xfer_tail ];
+    }
+
+    if  (   ( g_sim_to_node.xfer_tail < g_sim_to_node.xfer_head )
+        &&  ( g_sim_to_node.xfer_ns[ g_sim_to_node.xfer_tail ] < next ))
+    {
+        next = g_sim_to_node.xfer_ns[ g_sim_to_node.xfer_tail ];
+    }
+
+    if  (   ( g_sim_from_node.xfer_tail < g_sim_from_node.xfer_head )
+        &&  ( g_sim_from_node.xfer_ns[ g_sim_from_node.xfer_tail ] < next ))
+    {
+        next = g_sim_from_node.xfer_ns[ g_sim_from_node.xfer_tail ];
+    }
+
+    #if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+        if  (   ( true == g_sim_async.busy )
+            &&  ( g_sim_async.done_ns < next ))
+        {
+            next = g_sim_async.done_ns;
+        }
+    #endif
+
+    return (( UINT64_MAX == next ) ? next : (( next + 999ULL ) / 1000ULL ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get host (wall clock) time
+*
+* @note     Used to measure processing time of bootloader on host.
+*
+* @return       time in microseconds
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t boot_sim_host_time_us(void)
+{
+    struct timespec ts;
+
+    (void) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return (uint32_t)(((uint64_t) ts.tv_sec * 1000000ULL ) + ((uint64_t) ts.tv_nsec / 1000ULL ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Send data from Boot Manager (host) to bootloader
+*
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of data in bytes
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_sim_host_send(const uint8_t * const p_data, const uint32_t size)
+{
+    g_sim_cnt.rx_bytes += size;
+    boot_sim_pipe_push( &g_sim_to_boot, p_data, size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Receive data from bootloader at Boot Manager (host) side
+*
+* @param[out]   p_data  - Pointer to data
+* @param[in]    max     - Maximum number of bytes
+* @return       size    - Number of received bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t boot_sim_host_receive(uint8_t * const p_data, const uint32_t max)
+{
+    return boot_sim_pipe_pop( &g_sim_to_host, p_data, max );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Send data from downstream node to bridge
+*
+* @note     Downstream link has same model (speed, latency, loss) as link
+*           to Boot Manager.
+*
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of data in bytes
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_sim_node_send(const uint8_t * const p_data, const uint32_t size)
+{
+    boot_sim_pipe_push( &g_sim_from_node, p_data, size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Receive data from bridge at downstream node side
+*
+* @param[out]   p_data  - Pointer to data
+* @param[in]    max     - Maximum number of bytes
+* @return       size    - Number of received bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t boot_sim_node_receive(uint8_t * const p_data, const uint32_t max)
+{
+    return boot_sim_pipe_pop( &g_sim_to_node, p_data, max );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Erase complete simulated flash
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_sim_flash_clear(void)
+{
+    memset( gu8_sim_flash, 0xFF, sizeof( gu8_sim_flash ));
+
+    #if ( 1 == BOOT_CFG_EXT_FLASH_EN )
+        memset( gu8_sim_ext_flash, 0xFF, sizeof( gu8_sim_ext_flash ));
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Load data directly into simulated flash
+*
+* @note     No latency and no erase check, used to install images.
+*
+* @param[in]    addr    - Flash address
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of data in bytes
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_sim_flash_load(const uint32_t addr, const uint8_t * const p_data, const uint32_t size)
+{
+    if ( true == boot_sim_flash_in( addr, size ))
+    {
+        memcpy( &gu8_sim_flash[ addr - BOOT_SIM_FLASH_ADDR ], p_data, size );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get pointer to simulated flash
+*
+* @param[in]    addr    - Flash address
+* @return       pointer to flash content, NULL if outside flash
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint8_t * boot_sim_flash_ptr(const uint32_t addr)
+{
+    return (( true == boot_sim_flash_in( addr, 1U )) ? &gu8_sim_flash[ addr - BOOT_SIM_FLASH_ADDR ] : NULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set public key returned to bootloader
+*
+* @param[in]    p_key   - Pointer to public key (64 bytes)
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_sim_set_public_key(const uint8_t * const p_key)
+{
+    memcpy( gu8_sim_pub_key, p_key, sizeof( gu8_sim_pub_key ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if bootloader started application
+*
+* @return       true if bootloader de-initialized to start application
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool boot_sim_app_started(void)
+{
+    return gb_sim_app_started;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Clear application started flag
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_sim_app_clear(void)
+{
+    gb_sim_app_started = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_IF_API
+* @{ <!-- BEGIN GROUP -->
+*
+*   Bootloader interface implemented by host simulation.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get bootloader software version
+*
+* @note     Stands for version module of target build.
+*
+* @return       sw_ver - Software version
+*/
+////////////////////////////////////////////////////////////////////////////////
+ver_sw_t version_get_sw(void)
+{
+    ver_sw_t sw_ver;
+
+    sw_ver.U = BOOT_SIM_BOOT_VER;
+
+    return sw_ver;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize bootloader interface
+*
+* @return       status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_if_init(void)
+{
+    #if ( 1 == BOOT_CFG_CRYPTION_EN )
+        boot_if_decrypt_reset();
+    #endif
+
+    return eBOOT_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       De-initialize bootloader interface
+*
+* @note     Returns error so that bootloader does not jump to application,
+*           start of application is recorded instead.
+*
+* @return       status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_if_deinit(void)
+{
+    gb_sim_app_started = true;
+
+    return eBOOT_ERROR;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Transmit data to Boot Manager
+*
+* @note     Bridge (BOOT_CFG_BRIDGE_EN) transmits to downstream nodes while
+*           downstream channel is selected, same for reception.
+*
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of data in bytes
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_if_transmit(const uint8_t * const p_data, const uint16_t size)
+{
+    g_sim_cnt.tx_bytes += size;
+    boot_sim_pipe_push( boot_sim_tx_pipe(), p_data, size );
+
+    return eBOOT_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Receive single byte from Boot Manager
+*
+* @param[out]   p_data  - Pointer to received byte
+* @return       status  - Status of operation, "eBOOT_WAR_EMPTY" if none arrived
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_if_receive(uint8_t * const p_data)
+{
+    return (( 1U == boot_sim_pipe_pop( boot_sim_rx_pipe(), p_data, 1U )) ? eBOOT_OK : eBOOT_WAR_EMPTY );
+}
+
+#if ( 1 == BOOT_CFG_RX_BLOCK_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Receive block of data from Boot Manager
+    *
+    * @param[out]   p_data  - Pointer to received data
+    * @param[in]    max     - Maximum number of bytes
+    * @param[out]   p_got   - Number of received bytes
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    boot_status_t boot_if_receive_block(uint8_t * const p_data, const uint16_t max, uint16_t * const p_got)
+    {
+        *p_got = (uint16_t) boot_sim_pipe_pop( boot_sim_rx_pipe(), p_data, max );
+
+        return eBOOT_OK;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Clear reception buffer
+*
+* @return       status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_if_clear_rx_buf(void)
+{
+    // Drop already arrived data
+    (void) boot_sim_pipe_pop( boot_sim_rx_pipe(), NULL, UINT32_MAX );
+
+    return eBOOT_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Write data to flash
+*
+* @param[in]    addr    - Flash address
+* @param[in]    size    - Size of data in bytes
+* @param[in]    p_data  - Pointer to data
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_if_flash_write(const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+    gu64_sim_ns += ( boot_sim_flash_ns( g_sim_cfg.program_us_per_kb, size ) + ( g_sim_cfg.program_us_per_write * 1000ULL ));
+
+    return boot_sim_program( addr, size, p_data );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Read data from flash
+*
+* @param[in]    addr    - Flash address
+* @param[in]    size    - Size of data in bytes
+* @param[out]   p_data  - Pointer to data
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_if_flash_read(const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+    boot_status_t status = eBOOT_OK;
+
+    if ( true == boot_sim_flash_in( addr, size ))
+    {
+        memcpy( p_data, &gu8_sim_flash[ addr - BOOT_SIM_FLASH_ADDR ], size );
+        g_sim_cnt.read += size;
+    }
+    else
+    {
+        status = eBOOT_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Erase flash region
+*
+* @param[in]    addr    - Start address
+* @param[in]    size    - Size of region in bytes
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_if_flash_erase(const uint32_t addr, const uint32_t size)
+{
+    boot_status_t status = eBOOT_OK;
+
+    if ( true == boot_sim_flash_in( addr, size ))
+    {
+        memset( &gu8_sim_flash[ addr - BOOT_SIM_FLASH_ADDR ], 0xFF, size );
+
+        g_sim_cnt.erased   += size;
+        gu64_sim_ns         += boot_sim_flash_ns( g_sim_cfg.erase_us_per_kb, size );
+    }
+    else
+    {
+        status = eBOOT_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if flash region is memory mapped
+*
+* @note     Simulated flash addresses are not host addresses, thus image is
+*           always read through "boot_if_flash_read()".
+*
+* @param[in]    addr    - Start address
+* @param[in]    size    - Size of region in bytes
+* @return       false
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool boot_if_flash_is_mapped(const uint32_t addr, const uint32_t size)
+{
+    (void) addr;
+    (void) size;
+
+    return false;
+}
+
+#if ( 1 == BOOT_CFG_EXT_FLASH_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Read data from external flash
+    *
+    * @param[in]    addr    - External flash address
+    * @param[in]    size    - Size of data in bytes
+    * @param[out]   p_data  - Pointer to data
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    boot_status_t boot_if_ext_flash_read(const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+    {
+        boot_status_t status = eBOOT_OK;
+
+        if (((uint64_t) addr + size ) <= BOOT_SIM_EXT_FLASH_SIZE )
+        {
+            memcpy( p_data, &gu8_sim_ext_flash[addr], size );
+        }
+        else
+        {
+            status = eBOOT_ERROR;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_MULTI_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Forward part of container sub-image to other target
+    *
+    * @note     No other target on host, forwarded data is dropped.
+    *
+    * @param[in]    p_entry - Manifest entry of sub-image
+    * @param[in]    ofs     - Offset of block within sub-image
+    * @param[in]    p_data  - Block of (plain) sub-image
+    * @param[in]    size    - Size of block in bytes
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    boot_status_t boot_if_forward(const boot_multi_entry_t * const p_entry, const uint32_t ofs, const uint8_t * const p_data, const uint32_t size)
+    {
+        // Unused
+        (void) p_entry;
+        (void) ofs;
+        (void) p_data;
+        (void) size;
+
+        return eBOOT_OK;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get public key
+*
+* @return       p_key - Pointer to public key
+*/
+////////////////////////////////////////////////////////////////////////////////
+const uint8_t * boot_if_get_public_key(void)
+{
+    return (const uint8_t*) &gu8_sim_pub_key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Kick watchdog
+*
+* @note     Bootloader busy waits ("boot_wait()") kick watchdog on every
+*           loop, thus it accounts one handler loop of simulated time.
+*           Otherwise waits on systick would never end.
+*
+* @return       status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_if_kick_wdt(void)
+{
+    boot_sim_step();
+
+    return eBOOT_OK;
+}
+
+#if ( 1 == BOOT_CFG_FAST_BOOT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check if back-door entry window is requested
+    *
+    * @note     Simulation has no strap pin and always starts from power-on
+    *           reset, thus only shared memory request opens window.
+    *
+    * @return       requested - True if back-door window shall be opened
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    bool boot_if_backdoor_requested(void)
+    {
+        return false;
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_ECDSA_HW_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Verify signature with micro-ecc in place of hardware
+    *
+    * @param[in]    p_key   - Pointer to public key
+    * @param[in]    p_hash  - Pointer to image hash
+    * @param[in]    p_sig   - Pointer to signature
+    * @return       status  - Status of verification
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    boot_status_t boot_if_ecdsa_verify(const uint8_t * const p_key, const uint8_t * const p_hash, const uint8_t * const p_sig)
+    {
+        #if ( BOOT_ECDSA_CURVE_SECP256R1 == BOOT_CFG_ECDSA_CURVE )
+            const uECC_Curve curve = uECC_secp256r1();
+        #else
+            const uECC_Curve curve = uECC_secp256k1();
+        #endif
+
+        return (( 1 == uECC_verify( p_key, p_hash, 32U, p_sig, curve )) ? eBOOT_OK : eBOOT_ERROR );
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_CRYPTION_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Decrypt data
+    *
+    * @note     Simulation has no cipher, images are sent in plain form.
+    *
+    * @param[in]    p_crypt_data    - Pointer to encrypted data
+    * @param[out]   p_decrypt_data  - Pointer to decrypted data
+    * @param[in]    size            - Size of data in bytes
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void boot_if_decrypt_data(const uint8_t * const p_crypt_data, uint8_t * const p_decrypt_data, const uint32_t size)
+    {
+        memmove( p_decrypt_data, p_crypt_data, size );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Reset decryption
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void boot_if_decrypt_reset(void)
+    {
+        // No actions...
+    }
+
+    #if (( 1 == BOOT_CFG_RESUME_EN ) || ( 1 == BOOT_CFG_FLASH_SKIP_EN ))
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Move decryption to image offset
+        *
+        * @param[in]    ofs     - Image offset
+        * @return       status  - Status of operation
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        boot_status_t boot_if_decrypt_seek(const uint32_t ofs)
+        {
+            (void) ofs;
+
+            return eBOOT_OK;
+        }
+
+    #endif
+
+#endif
+
+#if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Start asynchronous flash write
+    *
+    * @param[in]    addr    - Flash address
+    * @param[in]    size    - Size of data in bytes
+    * @param[in]    p_data  - Pointer to data
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    boot_status_t boot_if_flash_write_start(const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+    {
+        boot_status_t status = eBOOT_OK;
+
+        if ( true == g_sim_async.busy )
+        {
+            status = eBOOT_ERROR;
+        }
+        else
+        {
+            g_sim_async.p_data  = p_data;
+            g_sim_async.addr    = addr;
+            g_sim_async.size    = size;
+            g_sim_async.done_ns = ( gu64_sim_ns + boot_sim_flash_ns( g_sim_cfg.program_us_per_kb, size ) + ( g_sim_cfg.program_us_per_write * 1000ULL ));
+            g_sim_async.busy    = true;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Poll asynchronous flash write
+    *
+    * @return       status - "eBOOT_WAR_BUSY" while write is in progress
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    boot_status_t boot_if_flash_write_poll(void)
+    {
+        if ( true == g_sim_async.busy )
+        {
+            if ( gu64_sim_ns < g_sim_async.done_ns )
+            {
+                return eBOOT_WAR_BUSY;
+            }
+
+            g_sim_async.status  = boot_sim_program( g_sim_async.addr, g_sim_async.size, g_sim_async.p_data );
+            g_sim_async.busy    = false;
+        }
+
+        return g_sim_async.status;
+    }
+
+#endif
+
+#if ( BOOT_CRC32_ENGINE_HW == BOOT_CFG_CRC32_ENGINE )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Calculate CRC-32 in place of CRC unit
+    *
+    * @param[in]    crc     - Current CRC value
+    * @param[in]    p_data  - Pointer to data
+    * @param[in]    size    - Size of data in bytes
+    * @return       crc32   - Updated CRC value
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    uint32_t boot_if_crc32_hw(const uint32_t crc, const uint8_t * const p_data, const uint32_t size)
+    {
+        uint32_t crc32 = crc;
+
+        for ( uint32_t i = 0U; i < size; i++ )
+        {
+            crc32 ^= p_data[i];
+
+            for ( uint8_t j = 0U; j < 32U; j++ )
+            {
+                crc32 = (( crc32 & 0x80000000U ) ? (( crc32 << 1U ) ^ 0x04C11DB7U ) : ( crc32 << 1U ));
+            }
+        }
+
+        return crc32;
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_BANK_SWAP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Swap flash banks
+    *
+    * @return       status - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    boot_status_t boot_if_bank_swap(void)
+    {
+        // Not supported on host
+        return eBOOT_ERROR;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,120 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_sim.h
+*@brief     Host simulation of bootloader interface
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_SIM_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __BOOT_SIM_H
+#define __BOOT_SIM_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Simulated flash
+ */
+#define BOOT_SIM_FLASH_ADDR                     ( 0x08000000U )
+#define BOOT_SIM_FLASH_SIZE                     ( 1024U * 1024U )
+
+/**
+ *  Simulated external flash size
+ */
+#define BOOT_SIM_EXT_FLASH_SIZE                 ( 1024U * 1024U )
+
+/**
+ *  Link pipe buffer size (one direction)
+ *
+ *  Unit: byte
+ */
+#define BOOT_SIM_LINK_BUF_SIZE                  ( 256U * 1024U )
+
+/**
+ *  Maximum number of transfers in flight (one direction)
+ */
+#define BOOT_SIM_LINK_XFER_MAX                  ( 1024U )
+
+/**
+ *  Simulation configuration
+ */
+typedef struct
+{
+    uint32_t    baud;                   /**<Link speed in bit/s, 10 bits per byte, 0 for unlimited */
+    uint32_t    rtt_us;                 /**<Link round trip time */
+    uint32_t    loss_ppm;               /**<Probability of lost transfer in parts per million */
+    uint32_t    erase_us_per_kb;        /**<Flash erase time per kB */
+    uint32_t    program_us_per_kb;      /**<Flash program time per kB */
+    uint32_t    program_us_per_write;   /**<Flash program setup time per write operation */
+    uint32_t    loop_us;                /**<Time of single bootloader handler loop */
+    uint32_t    seed;                   /**<Link loss random generator seed */
+} boot_sim_cfg_t;
+
+/**
+ *  Simulation counters
+ */
+typedef struct
+{
+    uint32_t    erased;             /**<Erased bytes */
+    uint32_t    programmed;         /**<Programmed bytes */
+    uint32_t    writes;             /**<Flash write (program) operations */
+    uint32_t    read;               /**<Read bytes */
+    uint32_t    tx_bytes;           /**<Bytes sent by bootloader */
+    uint32_t    rx_bytes;           /**<Bytes sent to bootloader */
+    uint32_t    lost;               /**<Lost transfers (both directions) */
+} boot_sim_cnt_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+void        boot_sim_init               (const boot_sim_cfg_t * const p_cfg);
+void        boot_sim_link_reset         (void);
+void        boot_sim_get_cnt            (boot_sim_cnt_t * const p_cnt);
+
+uint64_t    boot_sim_get_time_us        (void);
+uint32_t    boot_sim_get_systick        (void);
+void        boot_sim_step               (void);
+void        boot_sim_advance_to         (const uint64_t time_us);
+uint64_t    boot_sim_next_event_us      (void);
+uint32_t    boot_sim_host_time_us       (void);
+
+void        boot_sim_host_send          (const uint8_t * const p_data, const uint32_t size);
+uint32_t    boot_sim_host_receive       (uint8_t * const p_data, const uint32_t max);
+void        boot_sim_node_send          (const uint8_t * const p_data, const uint32_t size);
+uint32_t    boot_sim_node_receive       (uint8_t * const p_data, const uint32_t max);
+
+void        boot_sim_flash_clear        (void);
+void        boot_sim_flash_load         (const uint32_t addr, const uint8_t * const p_data, const uint32_t size);
+uint8_t *   boot_sim_flash_ptr          (const uint32_t addr);
+void        boot_sim_set_public_key     (const uint8_t * const p_key);
+
+bool        boot_sim_app_started        (void);
+void        boot_sim_app_clear          (void);
+
+#endif // __BOOT_SIM_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
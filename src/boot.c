@@ -27,6 +27,9 @@
 
 #include "boot.h"
 #include "boot_com.h"
+#include "boot_crc.h"
+#include "boot_delta.h"
+#include "boot_comp.h"
 #include "../../boot_if.h"
 
 // External libs
@@ -44,9 +47,15 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
- *  Start address of application code
+ *  Start address of application image (after header) in slot
  */
-#define BOOT_APP_ADDR_START     ((uint32_t*)( BOOT_CFG_APP_HEAD_ADDR + sizeof( ver_image_header_t )))
+#define BOOT_APP_ADDR_START(slot)               ((uint32_t)( g_boot_slot[(slot)].head_addr + sizeof( ver_image_header_t )))
+
+/**
+ *  Application image slots
+ */
+#define BOOT_SLOT_A                             ( 0U )
+#define BOOT_SLOT_B                             ( 1U )
 
 /**
  *  Compatibility check with REVISION
@@ -65,53 +74,565 @@ _Static_assert( 2 == FSM_VER_MAJOR );
 /**
  *  Compiler compatibility check
  */
-BOOT_CFG_STATIC_ASSERT( sizeof(boot_shared_mem_t) == 32U );
+BOOT_CFG_STATIC_ASSERT( sizeof(boot_shared_mem_t) == ( 32U + BOOT_CFG_SHARED_MEM_EXT_SIZE ));
 BOOT_CFG_STATIC_ASSERT( sizeof(ver_image_header_t) == 256U );
 
+/**
+ *  Flash data payload shall be multiple of flash write size
+ */
+BOOT_CFG_STATIC_ASSERT(( BOOT_CFG_FLASH_WRITE_SIZE > 0U ) && ( 0U == ( BOOT_CFG_DATA_PAYLOAD_SIZE % BOOT_CFG_FLASH_WRITE_SIZE )));
+
+/**
+ *  Flash program unit shall be multiple of flash write size and divide flash data payload
+ */
+BOOT_CFG_STATIC_ASSERT(( 0U == ( BOOT_CFG_FLASH_PROGRAM_SIZE % BOOT_CFG_FLASH_WRITE_SIZE )) && ( 0U == ( BOOT_CFG_DATA_PAYLOAD_SIZE % BOOT_CFG_FLASH_PROGRAM_SIZE )));
+
+/**
+ *  Flash writes are coalesced only when written synchronously
+ */
+BOOT_CFG_STATIC_ASSERT(( 0 == BOOT_CFG_FLASH_COALESCE_EN ) || ( 0 == BOOT_CFG_FLASH_ASYNC_EN ));
+
+/**
+ *  Shared memory extension area shall hold version and at least one record header
+ */
+BOOT_CFG_STATIC_ASSERT(( 0U == BOOT_CFG_SHARED_MEM_EXT_SIZE ) || (( BOOT_CFG_SHARED_MEM_EXT_SIZE >= 3U ) && ( BOOT_CFG_SHARED_MEM_EXT_SIZE <= 255U )));
+
+/**
+ *  micro-ecc optimization levels 3 and 4 require unrolled ARM assembly
+ */
+BOOT_CFG_STATIC_ASSERT( BOOT_CFG_ECDSA_OPT_LEVEL <= 2 );
+
+/**
+ *  Application slots shall not overlap
+ */
+#if ( 1 == BOOT_CFG_AB_SLOT_EN )
+    BOOT_CFG_STATIC_ASSERT(     (( BOOT_CFG_APP_HEAD_ADDR + sizeof( ver_image_header_t ) + BOOT_CFG_APP_SIZE_MAX ) <= BOOT_CFG_APP_B_HEAD_ADDR )
+                            ||  (( BOOT_CFG_APP_B_HEAD_ADDR + sizeof( ver_image_header_t ) + BOOT_CFG_APP_SIZE_MAX ) <= BOOT_CFG_APP_HEAD_ADDR ));
+#endif
+
+/**
+ *  Delta base copy shall not overlap application slot
+ */
+#if (( 1 == BOOT_CFG_DELTA_EN ) && ( 0 == BOOT_CFG_AB_SLOT_EN ))
+    BOOT_CFG_STATIC_ASSERT(     (( BOOT_CFG_APP_HEAD_ADDR + sizeof( ver_image_header_t ) + BOOT_CFG_APP_SIZE_MAX ) <= BOOT_CFG_DELTA_BASE_ADDR )
+                            ||  (( BOOT_CFG_DELTA_BASE_ADDR + sizeof( ver_image_header_t ) + BOOT_CFG_APP_SIZE_MAX ) <= BOOT_CFG_APP_HEAD_ADDR ));
+#endif
+
 /**
  *      Shared memory layout version
  */
-#define BOOT_SHARED_MEM_VER                     ( 1 )
+#define BOOT_SHARED_MEM_VER                     ( 4 )
+
+#if ( BOOT_CFG_SHARED_MEM_EXT_SIZE > 0U )
+
+    /**
+     *      Shared memory extension area layout version
+     */
+    #define BOOT_SHARED_MEM_EXT_VER             ( 1 )
+
+    /**
+     *  Size of extension records space
+     */
+    #define BOOT_SHARED_MEM_EXT_TLV_SIZE        ( BOOT_CFG_SHARED_MEM_EXT_SIZE - 1U )
+
+    /**
+     *  Size of extension record header (type and length)
+     */
+    #define BOOT_SHARED_MEM_EXT_HEAD_SIZE       ( 2U )
+
+    /**
+     *  Extension record not found
+     */
+    #define BOOT_SHARED_MEM_EXT_NONE            ( 0xFFFFFFFFU )
+
+#endif
+
+/**
+ *  Delta image type
+ *
+ *  @note   Not (yet) part of revision module image types. Delta image header
+ *          describes new image, payload is patch against installed image.
+ */
+#define BOOT_IMAGE_TYPE_DELTA                   ( 2U )
+
+/**
+ *  Image compression type and parameters
+ *
+ *  @note   Not (yet) part of revision module image header, stored in
+ *          reserved fields of header control part. Values according to
+ *          "boot_comp.h".
+ */
+#define BOOT_IMAGE_COMP_TYPE(p_head)            ((p_head)->ctrl.res[0])
+#define BOOT_IMAGE_COMP_PARAM(p_head)           ((p_head)->ctrl.res[1])
+
+/**
+ *  Flash data is decoded (patched, decompressed or split from container)
+ *  or coalesced through staging buffer
+ */
+#if (( 1 == BOOT_CFG_DELTA_EN ) || ( 1 == BOOT_CFG_COMP_EN ) || ( 1 == BOOT_CFG_MULTI_EN ) || ( 1 == BOOT_CFG_FLASH_COALESCE_EN ))
+    #define BOOT_FLASH_STAGE_EN                 ( 1 )
+#else
+    #define BOOT_FLASH_STAGE_EN                 ( 0 )
+#endif
+
+/**
+ *  External flash staged image addresses
+ */
+#define BOOT_EXT_IMAGE_HEAD_ADDR                ((uint32_t)( BOOT_CFG_EXT_FLASH_IMAGE_ADDR + sizeof( boot_ext_image_desc_t )))
+#define BOOT_EXT_IMAGE_DATA_ADDR                ((uint32_t)( BOOT_EXT_IMAGE_HEAD_ADDR + sizeof( ver_image_header_t )))
+
+/**
+ *  Statistics time measurement
+ *
+ *  @note   Measured time is converted to microseconds and accumulated
+ *          into statistics field.
+ */
+#if ( 1 == BOOT_CFG_STATS_EN )
+    #define BOOT_STATS_TICKS_TO_US(ticks)       (( BOOT_CFG_STATS_TIMER_HZ >= 1000000U ) ? (( ticks ) / ( BOOT_CFG_STATS_TIMER_HZ / 1000000U )) : (( ticks ) * ( 1000000U / BOOT_CFG_STATS_TIMER_HZ )))
+    #define BOOT_STATS_START(ts)                const uint32_t ts = BOOT_CFG_STATS_TIMER()
+    #define BOOT_STATS_STOP(ts,field)           ( g_boot_stats.field += BOOT_STATS_TICKS_TO_US( BOOT_CFG_STATS_TIMER() - ( ts )))
+    #define BOOT_STATS_ADD(field,val)           ( g_boot_stats.field += ( val ))
+#else
+    #define BOOT_STATS_START(ts)
+    #define BOOT_STATS_STOP(ts,field)
+    #define BOOT_STATS_ADD(field,val)
+#endif
+
+/**
+ *  ECDSA curve context
+ */
+#if ( BOOT_ECDSA_CURVE_SECP256R1 == BOOT_CFG_ECDSA_CURVE )
+    #define BOOT_ECDSA_CURVE()                  ( uECC_secp256r1())
+#else
+    #define BOOT_ECDSA_CURVE()                  ( uECC_secp256k1())
+#endif
+
+/**
+ *  Public key validation state
+ */
+typedef enum
+{
+    eBOOT_KEY_UNCHECKED = 0,    /**<Public key not (yet) validated */
+    eBOOT_KEY_VALID,            /**<Public key valid */
+    eBOOT_KEY_INVALID,          /**<Public key invalid */
+} boot_key_state_t;
 
 /**
  *  Reset vector function pointer
  */
 typedef void (*p_func)(void);
 
+/**
+ *  Image read block callback
+ */
+typedef void (*pf_boot_read_cb_t)(const uint8_t * const p_data, const uint32_t size, void * const p_ctx);
+
+/**
+ *  Image digest types
+ */
+#define BOOT_DIGEST_CRC32                       ( 0x01U )   /**<CRC-32 of image */
+#define BOOT_DIGEST_SHA256                      ( 0x02U )   /**<SHA-256 hash of image */
+
+/**
+ *  Verify command digest types are passed to digest calculation as they are
+ */
+BOOT_CFG_STATIC_ASSERT(( BOOT_DIGEST_CRC32 == BOOT_VERIFY_TYPE_CRC32 ) && ( BOOT_DIGEST_SHA256 == BOOT_VERIFY_TYPE_SHA256 ));
+
+/**
+ *  Boot Manager finds unchanged sectors with verify sectors command
+ */
+BOOT_CFG_STATIC_ASSERT(( 0 == BOOT_CFG_FLASH_SKIP_EN ) || ( 1 == BOOT_CFG_VERIFY_EN ));
+
+/**
+ *  Image digest
+ */
+typedef struct
+{
+    cf_sha256_context   sha_ctx;                    /**<SHA-256 calculation context */
+    uint8_t             hash[CF_SHA256_HASHSZ];     /**<SHA-256 hash */
+    uint32_t            crc32;                      /**<CRC-32 */
+    uint8_t             type;                       /**<Digest types to calculate */
+} boot_digest_t;
+
+#if ( 1 == BOOT_CFG_VALID_CACHE_EN )
+
+    /**
+     *  Validation cache record magic
+     */
+    #define BOOT_VALID_CACHE_MAGIC              ( 0xB007CA5EU )
+
+    /**
+     *  Public key fingerprint size
+     */
+    #define BOOT_VALID_CACHE_KEY_FPR_SIZE       ( 8U )
+
+    /**
+     *  Validation cache record
+     *
+     *  @note   Written to "BOOT_CFG_VALID_CACHE_ADDR" after successful
+     *          full image validation.
+     *
+     *  Sizeof: 56 bytes
+     */
+    typedef struct __BOOT_CFG_PACKED__
+    {
+        uint32_t magic;                                     /**<Record magic number */
+        uint8_t  head_hash[CF_SHA256_HASHSZ];               /**<SHA-256 of application header (incl. image hash, CRC and signature) */
+        uint8_t  key_fpr[BOOT_VALID_CACHE_KEY_FPR_SIZE];    /**<Public key fingerprint */
+        uint32_t sample_crc;                                /**<CRC-32 of sampled image blocks */
+        uint8_t  res[4];                                    /**<Reserved space */
+        uint32_t crc;                                       /**<CRC-32 of record */
+    } boot_valid_rec_t;
+
+    BOOT_CFG_STATIC_ASSERT( sizeof(boot_valid_rec_t) == 56U );
+
+#endif
+
+#if ( 1 == BOOT_CFG_RESUME_EN )
+
+    /**
+     *  Upgrade progress checkpoint magic
+     */
+    #define BOOT_RESUME_MAGIC                   ( 0xB007C0DEU )
+
+    /**
+     *  Upgrade progress checkpoint
+     *
+     *  @note   Appended to checkpoint log at "BOOT_CFG_RESUME_ADDR", latest
+     *          valid record describes progress of interrupted upgrade.
+     *
+     *  Sizeof: 48 bytes
+     */
+    typedef struct __BOOT_CFG_PACKED__
+    {
+        uint32_t magic;                         /**<Record magic number */
+        uint8_t  head_hash[CF_SHA256_HASHSZ];   /**<SHA-256 of received image header */
+        uint32_t ofs;                           /**<Number of image bytes committed to flash */
+        uint8_t  res[4];                        /**<Reserved space */
+        uint32_t crc;                           /**<CRC-32 of record */
+    } boot_resume_rec_t;
+
+    BOOT_CFG_STATIC_ASSERT( sizeof(boot_resume_rec_t) == 48U );
+
+    /**
+     *  Number of checkpoints in log
+     */
+    #define BOOT_RESUME_REC_NUM_OF              ( BOOT_CFG_RESUME_SIZE / sizeof( boot_resume_rec_t ))
+
+#endif
+
 /**
  *  Flashing data info
  */
 typedef struct
 {
-    uint32_t working_addr;      /**<Working address of FLASH */
-    uint32_t flashed_bytes;     /**<Number of flashed bytes */
-    uint32_t fw_size;           /**<New firmware image size in bytes */
+    ver_image_header_t  head;               /**<New image header */
+    boot_digest_t       digest;             /**<Running digest of flashed (plain) image */
+    uint32_t            working_addr;       /**<Working address of FLASH */
+    uint32_t            erased_addr;        /**<End of erased space (exclusive) */
+    uint32_t            erase_end;          /**<End of space to erase (exclusive) */
+    uint32_t            received_bytes;     /**<Number of received (accepted) bytes */
+    uint32_t            flashed_bytes;      /**<Number of flashed bytes */
+    uint32_t            fw_size;            /**<New firmware image size in bytes */
+    uint16_t            seq_next;           /**<Next expected sequence number of sequenced flash data */
+    uint16_t            seq_ack;            /**<Sequence number of first not yet flashed frame */
+    bool                is_delta;           /**<Received data is patch against installed image */
+    bool                is_comp;            /**<Received data is compressed */
+    bool                is_multi;           /**<Received data is multi-image container */
+    bool                is_erased;          /**<Erasing of target slot started */
+
+    #if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+        uint8_t         keep_map[BOOT_SKIP_MAP_SIZE];   /**<Sectors kept unchanged, bit per sector from image header sector on */
+    #endif
 } boot_flashing_t;
 
+/**
+ *  Application image slot
+ */
+typedef struct
+{
+    uint32_t    head_addr;      /**<Image (app) header address */
+    uint32_t    start_addr;     /**<Application start (vector table) address */
+} boot_slot_t;
+
+#if ( 1 == BOOT_FLASH_STAGE_EN )
+
+    /**
+     *  Decoded image staging buffer
+     *
+     *  @note   Patched, decompressed or coalesced data is collected into
+     *          program unit aligned blocks of up to flash data payload size
+     *          before written to flash.
+     */
+    typedef struct
+    {
+        uint8_t     data[BOOT_CFG_DATA_PAYLOAD_SIZE];   /**<Plain image data */
+        uint32_t    size;                               /**<Number of bytes in buffer */
+    } boot_flash_stage_t;
+
+#endif
+
+#if (( 1 == BOOT_CFG_DELTA_EN ) && ( 0 == BOOT_CFG_AB_SLOT_EN ))
+
+    /**
+     *  Base image copy context
+     */
+    typedef struct
+    {
+        uint32_t        addr;       /**<Current destination address */
+        boot_status_t   status;     /**<Status of copy */
+    } boot_delta_base_copy_t;
+
+#endif
+
+#if ( 1 == BOOT_CFG_EXT_FLASH_EN )
+
+    /**
+     *  Staged image verification context
+     */
+    typedef struct
+    {
+        boot_digest_t   digest;     /**<Running digest of plain image */
+        uint32_t        size;       /**<Size of decoded plain image */
+        uint32_t        size_max;   /**<Size of plain image from header */
+        bool            is_delta;   /**<Staged image is delta image */
+        bool            is_multi;   /**<Staged image is multi-image container */
+    } boot_nvm_verify_t;
+
+#endif
+
+#if ( 1 == BOOT_CFG_MULTI_EN )
+
+    /**
+     *  Multi-image container reception
+     */
+    typedef struct
+    {
+        ver_image_header_t      head;           /**<Container header */
+        boot_digest_t           digest;         /**<Running digest of manifest */
+        boot_multi_manifest_t   manifest;       /**<Container manifest */
+        ver_image_header_t      app_head;       /**<Header of application sub-image */
+        cf_sha256_context       sha_ctx;        /**<Running hash of current sub-image */
+        uint32_t                received;       /**<Number of received container bytes */
+        uint32_t                ofs;            /**<Offset within manifest or current sub-image */
+        uint32_t                write_addr;     /**<Flash address of staged data sub-image block */
+        uint32_t                erased_addr;    /**<End of erased space of data sub-image (exclusive) */
+        uint8_t                 idx;            /**<Current sub-image */
+        bool                    is_manifest;    /**<Manifest completely received */
+    } boot_multi_t;
+
+#endif
+
+#if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+
+    /**
+     *  Flash write pipeline slot
+     */
+    typedef struct
+    {
+        uint8_t     data[BOOT_CFG_DATA_PAYLOAD_SIZE];   /**<Plain data to flash */
+        uint32_t    addr;                               /**<Flash address */
+        uint16_t    size;                               /**<Size of data in bytes */
+        uint16_t    seq;                                /**<Sequence number of frame */
+        bool        is_seq;                             /**<Sequenced flash data frame */
+    } boot_flash_slot_t;
+
+    /**
+     *  Flash write pipeline
+     */
+    typedef struct
+    {
+        boot_flash_slot_t   slot[BOOT_CFG_FLASH_PIPE_DEPTH];    /**<Pipeline slots */
+        uint8_t             head;                               /**<Oldest slot, programmed first */
+        uint8_t             num_of;                             /**<Number of used slots */
+        bool                busy;                               /**<Programming of oldest slot ongoing */
+
+        #if ( 1 == BOOT_CFG_STATS_EN )
+            uint32_t        write_ts;                           /**<Start time of ongoing programming */
+        #endif
+    } boot_flash_pipe_t;
+
+#endif
+
+#if ( 1 == BOOT_CFG_FLASH_READBACK_EN )
+
+    /**
+     *  Flash read-back compare context
+     */
+    typedef struct
+    {
+        const uint8_t * p_expected;     /**<Expected (written) data */
+        uint32_t        ofs;            /**<Current compare offset */
+        bool            match;          /**<Flash content matches */
+    } boot_readback_t;
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Function prototypes
 ////////////////////////////////////////////////////////////////////////////////
-static uint8_t              boot_calc_crc               (const uint8_t * const p_data, const uint16_t size);
-static boot_status_t        boot_app_head_read          (const ver_image_header_t * p_head);
-static boot_status_t        boot_app_head_erase         (void);
+static boot_status_t        boot_app_head_read          (const uint8_t slot, const ver_image_header_t * p_head);
+static boot_status_t        boot_app_head_erase         (const uint8_t slot);
+static bool                 boot_slot_select            (void);
+static boot_status_t        boot_slot_map_check         (void);
 static uint8_t              boot_app_head_calc_crc      (const ver_image_header_t * const p_head);
 static boot_status_t        boot_app_header_check       (const ver_image_header_t * const p_head);
 
-static boot_status_t        boot_fw_image_check_crc     (const ver_image_header_t * const p_head);
-static boot_status_t        boot_fw_image_check_sig     (const ver_image_header_t * const p_head);
-static void                 boot_calc_hash              (const void *p_data, const uint32_t size, uint8_t * const p_hash_out);
+static boot_status_t        boot_image_read             (const uint32_t addr, const uint32_t size, pf_boot_read_cb_t pf_read_cb, void * const p_ctx);
+static void                 boot_image_digest_cb        (const uint8_t * const p_data, const uint32_t size, void * const p_ctx);
+static boot_status_t        boot_image_digest           (const uint32_t addr, const uint32_t size, boot_digest_t * const p_digest);
+static boot_status_t        boot_fw_image_check_crc     (const ver_image_header_t * const p_head, const boot_digest_t * const p_digest);
+static bool                 boot_hash_is_equal          (const uint8_t * const p_a, const uint8_t * const p_b);
+static bool                 boot_ecdsa_key_is_valid     (void);
+static bool                 boot_ecdsa_verify           (const uint8_t * const p_hash, const uint8_t * const p_sig);
+static boot_status_t        boot_fw_image_check_sig     (const ver_image_header_t * const p_head, const boot_digest_t * const p_digest);
+static boot_status_t        boot_fw_image_check_digest  (const ver_image_header_t * const p_head, boot_digest_t * const p_digest);
 static boot_status_t        boot_fw_image_validate      (void);
+static boot_status_t        boot_fw_image_validate_fast (void);
+static boot_status_t        boot_fw_image_validate_slots(void);
 static boot_status_t        boot_start_application      (void);
-static boot_status_t        boot_shared_mem_calc_crc    (const boot_shared_mem_t * const p_mem);
+static uint8_t              boot_shared_mem_calc_crc    (const boot_shared_mem_t * const p_mem);
+static bool                 boot_shared_mem_is_valid    (void);
+static void                 boot_shared_mem_update      (void);
 static void                 boot_init_shared_mem        (void);
 static void                 boot_wait                   (const uint32_t ms);
+
+#if ( BOOT_CFG_SHARED_MEM_EXT_SIZE > 0U )
+    static void             boot_shared_mem_ext_clear   (void);
+    static uint32_t         boot_shared_mem_ext_find    (const uint8_t type, uint32_t * const p_end);
+    static boot_status_t    boot_shared_mem_ext_publish (const uint8_t type, const void * const p_value, const uint8_t size);
+#endif
+
+#if ( 1 == BOOT_CFG_FAST_BOOT_EN )
+    static bool             boot_backdoor_requested     (void);
+#endif
+
+#if ( 1 == BOOT_CFG_STATS_EN )
+    static void             boot_stats_clear            (void);
+#endif
+
+#if ( 1 == BOOT_CFG_VERIFY_EN )
+    static boot_msg_status_t    boot_verify_check       (const boot_verify_t * const p_range, uint32_t * const p_size);
+    static boot_status_t        boot_verify_digest      (const uint32_t addr, const uint32_t size, const uint8_t type, uint8_t * const p_digest);
+#endif
 static boot_msg_status_t    boot_fw_size_check          (const uint32_t fw_size);
 static boot_msg_status_t    boot_fw_ver_check           (const uint32_t fw_ver);
 static boot_msg_status_t    boot_hw_ver_check           (const uint32_t hw_ver);
 static boot_msg_status_t    boot_signature_check        (const uint8_t * const p_sig, const uint8_t * const p_hash);
 static void                 boot_init_boot_counter      (void);
+static boot_status_t        boot_flash_sector_get       (const uint32_t addr, uint32_t * const p_start, uint32_t * const p_size);
+static boot_msg_status_t    boot_flash_erase_to         (const uint32_t addr_end);
+#if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+    static bool                 boot_flash_skip_is_kept (const uint32_t addr);
+    static bool                 boot_flash_skip_overlap (const uint32_t addr, const uint32_t size);
+    static uint32_t             boot_flash_skip_size    (const uint32_t addr);
+    static boot_msg_status_t    boot_flash_skip_digest  (const uint32_t addr);
+    static void                 boot_flash_skip_set     (const uint8_t * const p_map, uint8_t * const p_applied);
+#endif
 static boot_msg_status_t    boot_prepare_flash          (const uint32_t image_addr, const uint32_t image_size);
 static boot_msg_status_t    boot_pre_validate_image     (const ver_image_header_t * const p_head);
+static boot_msg_status_t    boot_pre_validate_app       (const ver_image_header_t * const p_head);
+static boot_msg_status_t    boot_flash_start            (const ver_image_header_t * const p_head);
+static boot_msg_status_t    boot_flash_begin            (const ver_image_header_t * const p_head);
+static boot_msg_status_t    boot_flash_accept           (const uint8_t * const p_data, const uint32_t size);
+static boot_msg_status_t    boot_flash_commit           (const uint32_t addr, const uint8_t * const p_data, const uint32_t size);
+static boot_status_t        boot_flash_finish           (void);
+static boot_msg_status_t    boot_flash_data             (const uint8_t * const p_data, const uint16_t size, const bool is_seq, const uint16_t seq);
+static void                 boot_flash_activate         (void);
+static void                 boot_flash_abort            (void);
+static bool                 boot_flash_rsp_is_deferred  (void);
+static bool                 boot_flash_is_plain         (void);
+static bool                 boot_flash_is_received      (void);
+static boot_msg_status_t    boot_flash_prepare_resume   (const ver_image_header_t * const p_head, uint32_t * const p_ofs);
+
+#if (( 0 == BOOT_CFG_FLASH_ASYNC_EN ) || ( 1 == BOOT_FLASH_STAGE_EN ) || ( 1 == BOOT_CFG_EXT_FLASH_EN ))
+    static const uint8_t *  boot_flash_decrypt          (const uint8_t * const p_data, const uint16_t size);
+    static boot_msg_status_t boot_flash_write_block     (const uint8_t * const p_plain, const uint32_t size);
+#endif
+
+#if (( 0 == BOOT_CFG_FLASH_ASYNC_EN ) || ( 1 == BOOT_CFG_EXT_FLASH_EN ))
+    static boot_msg_status_t boot_flash_write_plain     (const uint8_t * const p_plain, const uint32_t size);
+#endif
+
+#if ((( 1 == BOOT_CFG_DELTA_EN ) && ( 0 == BOOT_CFG_AB_SLOT_EN )) || ( 1 == BOOT_CFG_MULTI_EN ))
+    static boot_msg_status_t boot_flash_erase_range     (const uint32_t addr, const uint32_t size);
+#endif
+
+#if (( 1 == BOOT_CFG_DELTA_EN ) && ( 0 == BOOT_CFG_AB_SLOT_EN ))
+    static void             boot_delta_base_copy_cb     (const uint8_t * const p_data, const uint32_t size, void * const p_ctx);
+#endif
+
+#if ( 1 == BOOT_CFG_DELTA_EN )
+    static boot_msg_status_t boot_delta_base_prepare    (void);
+#endif
+
+#if ( 1 == BOOT_CFG_AB_SLOT_EN )
+    static void             boot_slot_activate_target   (void);
+#endif
+
+#if ( 1 == BOOT_FLASH_STAGE_EN )
+    static uint32_t         boot_flash_stage_capacity   (const uint32_t addr);
+    static bool             boot_flash_stage_is_full    (void);
+    static boot_status_t    boot_flash_stage_out_cb     (const uint8_t * const p_data, const uint32_t size, void * const p_ctx);
+    static boot_status_t    boot_flash_plain_out_cb     (const uint8_t * const p_data, const uint32_t size, void * const p_ctx);
+    static boot_msg_status_t boot_flash_staged          (const uint8_t * const p_data, const uint16_t size);
+#endif
+
+#if ( 1 == BOOT_CFG_MULTI_EN )
+    static boot_msg_status_t boot_multi_pre_validate    (const ver_image_header_t * const p_head);
+    static boot_msg_status_t boot_multi_begin           (const ver_image_header_t * const p_head);
+    static boot_msg_status_t boot_multi_manifest_check  (void);
+    static bool             boot_multi_region_is_valid  (const boot_multi_entry_t * const p_entry);
+    static void             boot_multi_entry_select     (const uint8_t idx);
+    static boot_msg_status_t boot_multi_app_begin       (const boot_multi_entry_t * const p_entry);
+    static boot_msg_status_t boot_multi_data_flush      (void);
+    static boot_msg_status_t boot_multi_entry_data      (const boot_multi_entry_t * const p_entry, const uint8_t * const p_data, const uint32_t size);
+    static boot_msg_status_t boot_multi_entry_end       (const boot_multi_entry_t * const p_entry);
+    static boot_msg_status_t boot_multi_data            (const uint8_t * const p_data, const uint32_t size);
+#endif
+
+#if ( 1 == BOOT_CFG_EXT_FLASH_EN )
+    static boot_status_t    boot_nvm_hndl               (void);
+    static boot_status_t    boot_nvm_install            (void);
+    static boot_status_t    boot_nvm_verify             (const ver_image_header_t * const p_head, const uint32_t size);
+    static boot_status_t    boot_nvm_verify_out_cb      (const uint8_t * const p_data, const uint32_t size, void * const p_ctx);
+    static boot_status_t    boot_nvm_verify_plain_cb    (const uint8_t * const p_data, const uint32_t size, void * const p_ctx);
+
+    #if ( 1 == BOOT_CFG_MULTI_EN )
+        static boot_status_t boot_nvm_verify_multi      (const uint8_t * const p_data, const uint32_t size);
+    #endif
+    static boot_msg_status_t boot_nvm_copy              (const ver_image_header_t * const p_head, const uint32_t size);
+#endif
+
+#if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+    static void             boot_flash_pipe_reset       (void);
+    static void             boot_flash_pipe_hndl        (void);
+    static void             boot_flash_pipe_send_rsp    (const boot_flash_slot_t * const p_slot, const boot_msg_status_t msg_status);
+#endif
+
+#if ( 1 == BOOT_CFG_FLASH_ERASE_AHEAD_EN )
+    static void             boot_flash_erase_ahead      (void);
+#endif
+
+#if ( 1 == BOOT_CFG_FLASH_READBACK_EN )
+    static void             boot_flash_readback_cb      (const uint8_t * const p_data, const uint32_t size, void * const p_ctx);
+#endif
+
+#if ( 1 == BOOT_CFG_VALID_CACHE_EN )
+    static boot_status_t    boot_valid_cache_build      (const ver_image_header_t * const p_head, boot_valid_rec_t * const p_rec);
+    static boot_status_t    boot_valid_cache_check      (const ver_image_header_t * const p_head);
+    static boot_status_t    boot_valid_cache_write      (const ver_image_header_t * const p_head);
+    static boot_status_t    boot_valid_cache_invalidate (void);
+#endif
+
+#if ( 1 == BOOT_CFG_RESUME_EN )
+    static void             boot_resume_build           (const ver_image_header_t * const p_head, const uint32_t ofs, boot_resume_rec_t * const p_rec);
+    static boot_status_t    boot_resume_read            (boot_resume_rec_t * const p_rec);
+    static void             boot_resume_save            (void);
+    static boot_status_t    boot_resume_invalidate      (void);
+    static uint32_t         boot_resume_ofs_get         (const ver_image_header_t * const p_head);
+    static boot_msg_status_t boot_flash_resume          (const ver_image_header_t * const p_head, const uint32_t ofs);
+#endif
 
 // FSM state handlers
 static void boot_fsm_idle_hndl      (const p_fsm_t fsm_inst);
@@ -128,6 +649,32 @@ static void boot_fsm_exit_hndl      (const p_fsm_t fsm_inst);
 */
 static volatile boot_shared_mem_t __BOOT_CFG_SHARED_MEM__ g_boot_shared_mem;
 
+#if ( 1 == BOOT_CFG_SHARED_MEM_MIRROR_EN )
+
+    /**
+    *  Mirror of shared memory, preferably in other RAM bank
+    */
+    static volatile boot_shared_mem_t __BOOT_CFG_SHARED_MEM_MIRROR__ g_boot_shared_mem_mirror;
+
+#endif
+
+/**
+ *  Shared memory CRC checked and valid
+ *
+ *  @note   CRC is checked only on first read, afterwards shared memory
+ *          is changed only through "boot_shared_mem_update()".
+ */
+static bool gb_boot_shared_mem_valid = false;
+
+#if ( BOOT_CFG_SHARED_MEM_EXT_SIZE > 0U )
+
+    /**
+     *  Bootloader start time in ms
+     */
+    static uint32_t gu32_boot_start_ms = 0U;
+
+#endif
+
 /**
  *  Bootloader FSM
  */
@@ -154,59 +701,139 @@ static const fsm_cfg_t g_boot_fsm_cfg_table =
  */
 static boot_flashing_t g_boot_flashing = { 0 };
 
-////////////////////////////////////////////////////////////////////////////////
-// Functions
-////////////////////////////////////////////////////////////////////////////////
-
-////////////////////////////////////////////////////////////////////////////////
 /**
-*       Calculate CRC-8
-*
-* @param[in]    p_data  - Pointer to data
-* @param[in]    size    - Size of data to calc crc
-* @return       crc8    - Calculated CRC
-*/
-////////////////////////////////////////////////////////////////////////////////
-static uint8_t boot_calc_crc(const uint8_t * const p_data, const uint16_t size)
+ *  Application image slots
+ */
+static const boot_slot_t g_boot_slot[] =
 {
-    const   uint8_t poly    = 0x07U;    // CRC-8-CCITT
-    const   uint8_t seed    = 0xB6U;    // Custom seed
-            uint8_t crc8    = seed;
+    { .head_addr = BOOT_CFG_APP_HEAD_ADDR,      .start_addr = BOOT_CFG_APP_START_ADDR   },
 
-    for (uint16_t i = 0; i < size; i++)
-    {
-        crc8 = ( crc8 ^ p_data[i] );
+#if ( 1 == BOOT_CFG_AB_SLOT_EN )
+    { .head_addr = BOOT_CFG_APP_B_HEAD_ADDR,    .start_addr = BOOT_CFG_APP_B_START_ADDR },
+#endif
+};
 
-        for (uint16_t j = 0U; j < 8U; j++)
-        {
-            if ( crc8 & 0x80U )
-            {
-                crc8 = (( crc8 << 1U ) ^ poly );
-            }
-            else
-            {
-                crc8 = ( crc8 << 1U );
-            }
-        }
-    }
+/**
+ *  Slot of application to boot
+ */
+static uint8_t g_boot_slot_active = BOOT_SLOT_A;
 
-    return crc8;
-}
+/**
+ *  Slot written by upgrade
+ */
+static uint8_t g_boot_slot_target = BOOT_SLOT_A;
 
-////////////////////////////////////////////////////////////////////////////////
+/**
+ *  Flash data payload size negotiated at connect
+ */
+static uint16_t g_boot_payload_size = BOOT_CFG_DATA_PAYLOAD_SIZE;
+
+#if ( 1 == BOOT_CFG_STATS_EN )
+
+    /**
+     *  Bootloader statistics
+     */
+    static boot_stats_t g_boot_stats = {0};
+
+    /**
+     *  Start time of communication session (connect command) in ms
+     */
+    static uint32_t gu32_stats_session_ms = 0U;
+
+#endif
+
+/**
+ *  Public key validation result, checked once per boot
+ */
+static boot_key_state_t g_boot_key_state = eBOOT_KEY_UNCHECKED;
+
+#if ( 1 == BOOT_CFG_DIGITAL_SIGN_EN )
+
+    /**
+     *  Image hash with signature verified at pre-validation
+     *
+     *  @note   Kept in RAM only, thus cold boot always verifies signature.
+     */
+    static uint8_t  g_boot_sig_hash[CF_SHA256_HASHSZ]   = {0};
+    static bool     g_boot_sig_hash_valid               = false;
+
+#endif
+
+/**
+ *  Flash sector map
+ */
+static const boot_flash_region_t g_boot_flash_sector_map[] = BOOT_CFG_FLASH_SECTOR_MAP;
+
+/**
+ *  Number of flash sector map regions
+ */
+#define BOOT_FLASH_SECTOR_MAP_NUM_OF            ( sizeof( g_boot_flash_sector_map ) / sizeof( boot_flash_region_t ))
+
+#if ( 1 == BOOT_FLASH_STAGE_EN )
+
+    /**
+     *  Decoded image staging buffer
+     */
+    static boot_flash_stage_t g_boot_flash_stage = { 0 };
+
+#endif
+
+#if ( 1 == BOOT_CFG_MULTI_EN )
+
+    /**
+     *  Multi-image container reception
+     */
+    static boot_multi_t g_boot_multi = { 0 };
+
+    /**
+     *  Flash regions of container data sub-images
+     */
+    static const boot_data_region_t g_boot_multi_region[] = BOOT_CFG_MULTI_DATA_REGIONS;
+
+    /**
+     *  Number of data sub-image regions
+     */
+    #define BOOT_MULTI_REGION_NUM_OF            ( sizeof( g_boot_multi_region ) / sizeof( boot_data_region_t ))
+
+#endif
+
+#if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+
+    /**
+     *  Flash write pipeline
+     */
+    static boot_flash_pipe_t g_boot_flash_pipe = { 0 };
+
+#endif
+
+#if ( 1 == BOOT_CFG_EXT_FLASH_EN )
+
+    /**
+     *  External flash read buffer
+     */
+    static uint8_t g_boot_nvm_buf[BOOT_CFG_DATA_PAYLOAD_SIZE] = { 0 };
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
 /**
 *       Read application header
 *
+* @param[in]    slot    - Application image slot
 * @param[in]    p_head  - Pointer to application header
 * @return       status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static boot_status_t boot_app_head_read(const ver_image_header_t * p_head)
+static boot_status_t boot_app_head_read(const uint8_t slot, const ver_image_header_t * p_head)
 {
     boot_status_t status = eBOOT_OK;
 
     // Read application header
-    if ( eBOOT_OK == boot_if_flash_read( BOOT_CFG_APP_HEAD_ADDR, sizeof(ver_image_header_t), (uint8_t*) p_head ))
+    if ( eBOOT_OK == boot_if_flash_read( g_boot_slot[slot].head_addr, sizeof(ver_image_header_t), (uint8_t*) p_head ))
     {
         // Validate (check) application heaer
         status = boot_app_header_check( p_head );
@@ -227,15 +854,28 @@ static boot_status_t boot_app_head_read(const ver_image_header_t * p_head)
 *           gets either canceled, timeouted or interrupted of any other reasons.
 *           Erasing application header creates fresh starts for upgrade process.
 *
+* @param[in]    slot    - Application image slot
 * @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static boot_status_t boot_app_head_erase(void)
+static boot_status_t boot_app_head_erase(const uint8_t slot)
 {
     boot_status_t status = eBOOT_OK;
 
+    #if ( 1 == BOOT_CFG_RESUME_EN )
+        static ver_image_header_t head = {0};
+
+        // Header of interrupted upgrade is not written yet
+        // NOTE: Keep image data sharing sector with header for resume!
+        if ( eBOOT_OK != boot_app_head_read( slot, &head ))
+        {
+            // No actions...
+        }
+        else
+    #endif
+
     // Erase application header
-    if ( eBOOT_OK != boot_if_flash_erase( BOOT_CFG_APP_HEAD_ADDR, sizeof(ver_image_header_t)))
+    if ( eBOOT_OK != boot_if_flash_erase( g_boot_slot[slot].head_addr, sizeof(ver_image_header_t)))
     {
         status = eBOOT_ERROR;
     }
@@ -243,6 +883,128 @@ static boot_status_t boot_app_head_erase(void)
     return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Select application image slots
+*
+* @note     Active slot holds newest (by SW version) image with valid header,
+*           slot A when versions are equal. Upgrade is written to the other
+*           slot, so active application stays bootable while flashing.
+*           Without any valid image upgrade is written to slot A.
+*
+*           With bank swap active image is always mapped to slot A address,
+*           therefore upgrade is always written to slot B. Selected slot B
+*           is booted by swapping banks.
+*
+*           Without A/B slots both are always slot A.
+*
+* @return       true if valid image header found
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_slot_select(void)
+{
+    bool found = false;
+
+    #if ( 1 == BOOT_CFG_AB_SLOT_EN )
+
+        static  ver_image_header_t  head_a  = {0};
+        static  ver_image_header_t  head_b  = {0};
+        const   bool                valid_a = ( eBOOT_OK == boot_app_head_read( BOOT_SLOT_A, &head_a ));
+        const   bool                valid_b = ( eBOOT_OK == boot_app_head_read( BOOT_SLOT_B, &head_b ));
+
+        // Newest image
+        if  (   ( true == valid_b )
+            &&  (   ( false == valid_a )
+                ||  ( head_b.data.sw_ver > head_a.data.sw_ver )))
+        {
+            g_boot_slot_active = BOOT_SLOT_B;
+        }
+        else
+        {
+            g_boot_slot_active = BOOT_SLOT_A;
+        }
+
+        found = (( true == valid_a ) || ( true == valid_b ));
+
+        #if ( 1 == BOOT_CFG_BANK_SWAP_EN )
+            g_boot_slot_target = BOOT_SLOT_B;
+        #else
+            g_boot_slot_target = (( true == found ) ? ( BOOT_SLOT_B - g_boot_slot_active ) : BOOT_SLOT_A );
+        #endif
+
+        BOOT_DBG_PRINT( "Active slot: %c, upgrade slot: %c", ( 'A' + g_boot_slot_active ), ( 'A' + g_boot_slot_target ));
+
+    #else
+
+        static ver_image_header_t head = {0};
+
+        found = ( eBOOT_OK == boot_app_head_read( BOOT_SLOT_A, &head ));
+
+    #endif
+
+    return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check that application slots are covered by flash sector map
+*
+* @note     Sector map is a list initializer, which cannot be evaluated by
+*           static assert, therefore it is checked once at startup. Slot
+*           outside of map could never be erased thus never upgraded.
+*           Erase is rounded down to sector start, therefore slot header
+*           (and delta base copy) shall start flash sector, otherwise data
+*           in front of it (e.g. bootloader) would be erased as well.
+*
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_slot_map_check(void)
+{
+    boot_status_t   status          = eBOOT_OK;
+    uint32_t        sector_start    = 0U;
+    uint32_t        sector_size     = 0U;
+
+    for ( uint32_t slot = 0U; slot < ( sizeof( g_boot_slot ) / sizeof( boot_slot_t )); slot++ )
+    {
+        const uint32_t  slot_end    = ( g_boot_slot[slot].head_addr + sizeof( ver_image_header_t ) + BOOT_CFG_APP_SIZE_MAX );
+              uint32_t  addr        = g_boot_slot[slot].head_addr;
+
+        // Header shall start sector
+        if  (   ( eBOOT_OK == boot_flash_sector_get( addr, &sector_start, &sector_size ))
+            &&  ( sector_start != addr ))
+        {
+            BOOT_DBG_PRINT( "ERROR: Slot %c header not aligned to flash sector at 0x%08X!", ( 'A' + slot ), addr );
+            status = eBOOT_ERROR;
+        }
+
+        // Walk sector by sector as map regions might not be contiguous
+        while ( addr < slot_end )
+        {
+            if ( eBOOT_OK != boot_flash_sector_get( addr, &sector_start, &sector_size ))
+            {
+                BOOT_DBG_PRINT( "ERROR: Slot %c not covered by flash sector map at 0x%08X!", ( 'A' + slot ), addr );
+                status = eBOOT_ERROR;
+                break;
+            }
+
+            addr = ( sector_start + sector_size );
+        }
+    }
+
+    // Base copy is erased the same way
+    #if (( 1 == BOOT_CFG_DELTA_EN ) && ( 0 == BOOT_CFG_AB_SLOT_EN ))
+        if  (   ( eBOOT_OK != boot_flash_sector_get( BOOT_CFG_DELTA_BASE_ADDR, &sector_start, &sector_size ))
+            ||  ( sector_start != BOOT_CFG_DELTA_BASE_ADDR ))
+        {
+            BOOT_DBG_PRINT( "ERROR: Delta base not aligned to flash sector at 0x%08X!", BOOT_CFG_DELTA_BASE_ADDR );
+            status = eBOOT_ERROR;
+        }
+    #endif
+
+    return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *       Calculate application header CRC
@@ -257,7 +1019,7 @@ static uint8_t boot_app_head_calc_crc(const ver_image_header_t * const p_head)
 
     // Calculate CRC
     // NOTE: Skip CRC at the end and start calculation at version field!
-    crc8 = boot_calc_crc((uint8_t*) &(p_head->ctrl.ver), ( sizeof(ver_image_header_t) - 1U ));
+    crc8 = boot_crc8_calc((uint8_t*) &(p_head->ctrl.ver), ( sizeof(ver_image_header_t) - 1U ));
 
     return crc8;
 }
@@ -290,56 +1052,51 @@ static boot_status_t boot_app_header_check(const ver_image_header_t * const p_he
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Check firmware image CRC32
-*
-* @note     Firmware image CRC is being calculated only across application code,
-*           application header is not included into CRC calculations.
+*       Read image from flash block by block
 *
-* @note     This function expects application header at the top
-*           of new firmware image!
+* @brief    Every image check (CRC, hash, ...) reads flash through that function.
+*           Data is handed to callback in blocks of "BOOT_CFG_VALIDATE_CHUNK_SIZE"
+*           bytes, or as one block directly from flash when it is memory mapped.
 *
-* @param[in]    p_head  - Image (app) header
-* @return       status  - Status of validation
+* @param[in]    addr        - Start address of image
+* @param[in]    size        - Size of image in bytes
+* @param[in]    pf_read_cb  - Callback for each read block
+* @param[in]    p_ctx       - Callback context
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static boot_status_t boot_fw_image_check_crc(const ver_image_header_t * const p_head)
+static boot_status_t boot_image_read(const uint32_t addr, const uint32_t size, pf_boot_read_cb_t pf_read_cb, void * const p_ctx)
 {
-            boot_status_t   status  = eBOOT_OK;
-    const   uint32_t    	poly    = 0x04C11DB7;
-    const   uint32_t    	seed    = 0x10101010;
-            uint32_t    	crc32   = seed;
-            uint8_t     	data    = 0U;
+            boot_status_t   status                                  = eBOOT_OK;
+    static  uint8_t         buf[BOOT_CFG_VALIDATE_CHUNK_SIZE]       = {0};
 
-    // Calculate CRC
-    for (uint32_t i = 0; i < p_head->data.image_size; i++)
+    // Flash memory mapped -> zero copy
+    if ( true == boot_if_flash_is_mapped( addr, size ))
     {
-    	// Ignore application header from CRC calc
-        const uint32_t addr = BOOT_CFG_APP_HEAD_ADDR + sizeof(ver_image_header_t) + i;
-
-        // Read byte from application
-        (void) boot_if_flash_read( addr, 1U, (uint8_t*)&data );
-
-        // Calc CRC-32
-        crc32 = (( crc32 ^ data ) & 0xFFFFFFFFU );
+        pf_read_cb((const uint8_t*)(uintptr_t) addr, size, p_ctx );
+    }
 
-        for (uint8_t j = 0U; j < 32U; j++)
+    // Read block by block
+    else
+    {
+        for ( uint32_t ofs = 0U; ofs < size; ofs += BOOT_CFG_VALIDATE_CHUNK_SIZE )
         {
-            if ( crc32 & 0x80000000U )
-            {
-                crc32 = (( crc32 << 1U ) ^ poly );
-            }
-            else
+            // Size of block
+            const uint32_t block_size = ((( size - ofs ) > BOOT_CFG_VALIDATE_CHUNK_SIZE ) ? BOOT_CFG_VALIDATE_CHUNK_SIZE : ( size - ofs ));
+
+            // Read block from flash
+            if ( eBOOT_OK != boot_if_flash_read(( addr + ofs ), block_size, (uint8_t*) &buf ))
             {
-                crc32 = ( crc32 << 1U );
+                status = eBOOT_ERROR;
+                BOOT_DBG_PRINT( "ERROR: Flash read error at 0x%08X!", ( addr + ofs ));
+                break;
             }
-        }
-    }
 
-    // Check CRC
-    if (( crc32 & 0xFFFFFFFFU ) != p_head->data.image_crc )
-    {
-        status = eBOOT_ERROR;
-        BOOT_DBG_PRINT( "POST-VALIDATION ERROR: Firmware image CRC invalid!" );
+            pf_read_cb((const uint8_t*) &buf, block_size, p_ctx );
+
+            // Process WDT in between
+            boot_if_kick_wdt();
+        }
     }
 
     return status;
@@ -347,137 +1104,86 @@ static boot_status_t boot_fw_image_check_crc(const ver_image_header_t * const p_
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Check firmware image digital signature using ECSDA
+*       Image digest read block callback
 *
-* @param[in]    p_head  - Image (app) header
-* @return       status  - Status of validation
+* @param[in]    p_data  - Read block of image
+* @param[in]    size    - Size of block in bytes
+* @param[in]    p_ctx   - Digest context
+* @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-static boot_status_t boot_fw_image_check_sig(const ver_image_header_t * const p_head)
+static void boot_image_digest_cb(const uint8_t * const p_data, const uint32_t size, void * const p_ctx)
 {
-            boot_status_t   status                  = eBOOT_OK;
-    static  uint8_t         hash[CF_SHA256_HASHSZ]  = {0};
-
-    // Clean hash value
-    memset( hash, 0U, sizeof(hash));
+    boot_digest_t * p_digest = (boot_digest_t*) p_ctx;
 
-    // Get application image start address
-    void * addr = BOOT_APP_ADDR_START;
-
-    // Calculate image hash
-    boot_calc_hash( addr, p_head->data.image_size, hash );
-
-    // Create curve context
-    const struct uECC_Curve_t * p_curve = uECC_secp256k1();
-
-    // Public key invalid
-    if ( 0 == uECC_valid_public_key( boot_if_get_public_key(), p_curve ))
+    if ( BOOT_DIGEST_CRC32 & p_digest->type )
     {
-        status = eBOOT_ERROR;
-        BOOT_DBG_PRINT( "POST-VALIDATION ERROR: Public key invalid!" );
+        p_digest->crc32 = boot_crc32_update( p_digest->crc32, p_data, size );
     }
 
-    // Public key valid
-    else
+    if ( BOOT_DIGEST_SHA256 & p_digest->type )
     {
-        // Signature invalid
-        if ( 0 == uECC_verify( boot_if_get_public_key(), hash, CF_SHA256_HASHSZ, p_head->data.signature, p_curve ))
-        {
-            status = eBOOT_ERROR;
-            BOOT_DBG_PRINT( "POST-VALIDATION ERROR: Signature invalid!" );
-        }
+        cf_sha256_update( &p_digest->sha_ctx, p_data, size );
     }
-
-    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Calculate image hash
+*       Calculate image digest
 *
-* @brief    That function generates SHA256 of inputed data!
+* @note     All selected digests (p_digest->type) are calculated within
+*           single pass over the image.
 *
-* @param[in]    p_data      - Inputed data
-* @param[in]    size        - Size of inputed data
-* @param[out]   p_hash_out  - Hash-SHA256 if inputed data
-* @return       void
+* @param[in]    addr        - Start address of image
+* @param[in]    size        - Size of image in bytes
+* @param[in,out] p_digest   - Digest, type shall be set by caller
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_calc_hash(const void *p_data, const uint32_t size, uint8_t * const p_hash_out)
+static boot_status_t boot_image_digest(const uint32_t addr, const uint32_t size, boot_digest_t * const p_digest)
 {
-  cf_sha256_context ctx;
-  cf_sha256_init(&ctx);
-  cf_sha256_update(&ctx, p_data, size);
-  cf_sha256_digest_final(&ctx, p_hash_out);
+    boot_status_t status = eBOOT_OK;
+
+    // Prepare digests
+    p_digest->crc32 = boot_crc32_init();
+    cf_sha256_init( &p_digest->sha_ctx );
+
+    // Read complete image
+    status = boot_image_read( addr, size, boot_image_digest_cb, (void*) p_digest );
+
+    // Finish hash
+    if ( BOOT_DIGEST_SHA256 & p_digest->type )
+    {
+        cf_sha256_digest_final( &p_digest->sha_ctx, p_digest->hash );
+    }
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Validate firmware image
+*       Check firmware image CRC32
 *
-* @note     That function checks for application header CRC and complete
-*           firmware image CRC.
+* @note     Firmware image CRC is being calculated only across application code,
+*           application header is not included into CRC calculations.
 *
-*           Time execution on Cortex-M4 @150MHz:
-*               -O0:    137 ms
-*               -Ofast: 110 ms
+* @note     This function expects application header at the top
+*           of new firmware image!
 *
-* @return       status - Status of validation
+* @param[in]    p_head      - Image (app) header
+* @param[in]    p_digest    - Calculated image digest
+* @return       status      - Status of validation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static boot_status_t boot_fw_image_validate(void)
+static boot_status_t boot_fw_image_check_crc(const ver_image_header_t * const p_head, const boot_digest_t * const p_digest)
 {
-            boot_status_t       status      = eBOOT_OK;
-    static  ver_image_header_t  app_header  = {0};
-
-    // Read application header
-    status = boot_app_head_read((ver_image_header_t*) &app_header );
+    boot_status_t status = eBOOT_OK;
 
-    // Application header OK
-    if ( eBOOT_OK == status )
+    // Check CRC
+    if ( p_digest->crc32 != p_head->data.image_crc )
     {
-        // Check for ECSDA signature
-        if ( eVER_SIG_TYPE_ECSDA == app_header.data.sig_type )
-        {
-            BOOT_DBG_PRINT( "Image validation method: ECDSA" );
-            status = boot_fw_image_check_sig((ver_image_header_t*) &app_header );
-        }
-
-        // Check for image CRC only when signature is disabled
-        else if ( eVER_SIG_TYPE_NONE == app_header.data.sig_type )
-        {
-            BOOT_DBG_PRINT( "Image validation method: CRC" );
-            status = boot_fw_image_check_crc( (ver_image_header_t*) &app_header );
-        }
-
-        // Other validation methods
-        else
-        {
-            // Add support for new validation method
-            BOOT_DBG_PRINT( "ERROR: Image validation method: UNDEFINED" );
-            BOOT_ASSERT(0);
-        }
-
-        // Image validation OK
-        if ( eBOOT_OK == status )
-        {
-            BOOT_DBG_PRINT( "Firmware image validated OK!" );
-        }
-
-        // FW image corrupted - validation error
-        else
-        {
-            status = eBOOT_ERROR;
-
-            /**
-             *  Erase application header -> This will enable re-flashing
-             *  same version of application as FW compatibility checks
-             *  will not failed!
-             */
-            (void) boot_app_head_erase();
-
-            BOOT_DBG_PRINT( "ERROR: Firmware image corrupted! Validation failed!" );
-        }
+        status = eBOOT_ERROR;
+        BOOT_DBG_PRINT( "POST-VALIDATION ERROR: Firmware image CRC invalid!" );
     }
 
     return status;
@@ -485,277 +1191,1346 @@ static boot_status_t boot_fw_image_validate(void)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Start (Jump) to application code
+*       Compare two SHA-256 hashes in constant time
 *
-* @note 	That function has ARM Cortex-M specific commands! If bootloader will
-* 			be used on other uC then this part of code shall be adopted!
+* @note     Compare time does not depend on position of first difference.
 *
-* @return       status - Status of operation
+* @param[in]    p_a     - First hash
+* @param[in]    p_b     - Second hash
+* @return       equal   - True if hashes are equal
 */
 ////////////////////////////////////////////////////////////////////////////////
-static boot_status_t boot_start_application(void)
+static bool boot_hash_is_equal(const uint8_t * const p_a, const uint8_t * const p_b)
 {
-	boot_status_t status = eBOOT_OK;
-
-	// Disable interrupts
-	__disable_irq();
+    uint8_t diff = 0U;
 
-	// De-init application level code
-	status = boot_if_deinit();
+    for ( uint32_t i = 0U; i < CF_SHA256_HASHSZ; i++ )
+    {
+        diff |= (uint8_t)( p_a[i] ^ p_b[i] );
+    }
 
-	if ( eBOOT_OK == status )
-	{
-		// Set stack pointer
-		__set_MSP( BOOT_CFG_APP_START_ADDR );
+    return ( 0U == diff );
+}
 
-		// Next address is reset vector for app
-		const uint32_t app_addr = *(uint32_t*)( BOOT_CFG_APP_START_ADDR + 4U );
-		p_func p_app = (p_func) app_addr;
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if public key is valid
+*
+* @note     Public key is validated only at first call after boot, result
+*           is kept for all following signature checks. Key validation
+*           is left to interface at hardware ECDSA verification.
+*
+* @return       valid - True if public key is valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_ecdsa_key_is_valid(void)
+{
+#if ( 0 == BOOT_CFG_ECDSA_HW_EN )
 
-		// Start Application
-		p_app();
-	}
+    if ( eBOOT_KEY_UNCHECKED == g_boot_key_state )
+    {
+        if ( 0 == uECC_valid_public_key( boot_if_get_public_key(), BOOT_ECDSA_CURVE()))
+        {
+            g_boot_key_state = eBOOT_KEY_INVALID;
+        }
+        else
+        {
+            g_boot_key_state = eBOOT_KEY_VALID;
+        }
+    }
+#else
+    g_boot_key_state = eBOOT_KEY_VALID;
+#endif
 
-	return status;
+    return ( eBOOT_KEY_VALID == g_boot_key_state );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Calculate shared memory CRC
+*       Verify ECDSA signature of image hash
 *
-* @param[in]    p_mem   - Pointer to shared memory
-* @return       status  - Status of validation
+* @param[in]    p_hash  - SHA-256 hash of image
+* @param[in]    p_sig   - Image digital signature
+* @return       valid   - True if signature is valid
 */
 ////////////////////////////////////////////////////////////////////////////////
-static boot_status_t boot_shared_mem_calc_crc(const boot_shared_mem_t * const p_mem)
+static bool boot_ecdsa_verify(const uint8_t * const p_hash, const uint8_t * const p_sig)
 {
-    uint8_t crc8 = 0U;
+    bool valid = false;
 
-    // Calculate crc
-    // NOTE: Ignore CRC value at the end (-1)
-    crc8 = boot_calc_crc((uint8_t*) &( p_mem->ctrl.ver ), ( sizeof(boot_shared_mem_t) - 1U ));
+#if ( 1 == BOOT_CFG_ECDSA_HW_EN )
+    valid = ( eBOOT_OK == boot_if_ecdsa_verify( boot_if_get_public_key(), p_hash, p_sig ));
+#else
+    valid = ( 0 != uECC_verify( boot_if_get_public_key(), p_hash, CF_SHA256_HASHSZ, p_sig, BOOT_ECDSA_CURVE()));
+#endif
 
-    return crc8;
+    return valid;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Initialize shared memory
-*
-* @note     In case of CRC failure -> all fields are set to default!
+*       Check firmware image digital signature using ECSDA
 *
-* @return       void
+* @param[in]    p_head      - Image (app) header
+* @param[in]    p_digest    - Calculated image digest
+* @return       status      - Status of validation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_init_shared_mem(void)
+static boot_status_t boot_fw_image_check_sig(const ver_image_header_t * const p_head, const boot_digest_t * const p_digest)
 {
-    // Shared memory CRC OK
-    if ( boot_shared_mem_calc_crc((const boot_shared_mem_t *) &g_boot_shared_mem ) == g_boot_shared_mem.ctrl.crc )
+    boot_status_t status = eBOOT_OK;
+
+    // Public key invalid
+    if ( false == boot_ecdsa_key_is_valid())
     {
-        // Count boot ups
-        if ( g_boot_shared_mem.data.boot_cnt < UINT8_MAX )
-        {
-            g_boot_shared_mem.data.boot_cnt++;
-        }
+        status = eBOOT_ERROR;
+        BOOT_DBG_PRINT( "POST-VALIDATION ERROR: Public key invalid!" );
     }
 
-    // CRC error
+    // Public key valid
     else
     {
-        g_boot_shared_mem.data.boot_cnt      = 0U;
-        g_boot_shared_mem.data.boot_reason   = eBOOT_REASON_NONE;
-
-        BOOT_DBG_PRINT( "ERROR: Shared memory corrupted!" );
+        // Signature invalid
+        if ( false == boot_ecdsa_verify( p_digest->hash, p_head->data.signature ))
+        {
+            status = eBOOT_ERROR;
+            BOOT_DBG_PRINT( "POST-VALIDATION ERROR: Signature invalid!" );
+        }
     }
 
-    // Set shared memory data
-    g_boot_shared_mem.ctrl.ver      = BOOT_SHARED_MEM_VER;
-    g_boot_shared_mem.data.boot_ver = version_get_sw().U;
-
-    // Calculate CRC
-    g_boot_shared_mem.ctrl.crc = boot_shared_mem_calc_crc((const boot_shared_mem_t *) &g_boot_shared_mem );
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Wait (delay) and handle bootloader in between
+*       Check running digest of firmware image
 *
-* @param[in]    ms  - Time to wait in miliseconds
-* @return       void
+* @note     Digest shall be calculated over complete (plain) image, SHA-256
+*           digest is finalized here. Signature is not verified again if
+*           digest matches hash with signature verified at pre-validation.
+*
+* @param[in]    p_head      - Image (app) header
+* @param[in]    p_digest    - Calculated image digest
+* @return       status      - Status of validation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_wait(const uint32_t ms)
+static boot_status_t boot_fw_image_check_digest(const ver_image_header_t * const p_head, boot_digest_t * const p_digest)
 {
-    uint32_t safety_cnt = 0U;
-
-    // Get current ticks
-    const uint32_t now = BOOT_GET_SYSTICK();
+    boot_status_t status = eBOOT_OK;
 
-    if ( ms > 0 )
+    // Check for ECSDA signature
+    if ( eVER_SIG_TYPE_ECSDA == p_head->data.sig_type )
     {
-        // Wait
-        while(      ((uint32_t)( BOOT_GET_SYSTICK() - now ) <= ms )
-                &&  ( safety_cnt < 0xEFFFFFFFU ))
+        cf_sha256_digest_final( &p_digest->sha_ctx, p_digest->hash );
+
+        // Hash must match the one from header
+        if ( false == boot_hash_is_equal( p_digest->hash, p_head->data.hash ))
         {
-            // Handle bootloader tasks
-            boot_hndl();
+            status = eBOOT_ERROR;
+            BOOT_DBG_PRINT( "POST-VALIDATION ERROR: Firmware image hash invalid!" );
+        }
 
-            // Process WDT
-            boot_if_kick_wdt();
+        // Signature of that hash already verified at pre-validation
+    #if ( 1 == BOOT_CFG_DIGITAL_SIGN_EN )
+        else if (   ( true == g_boot_sig_hash_valid )
+                &&  ( true == boot_hash_is_equal( p_digest->hash, g_boot_sig_hash )))
+        {
+            BOOT_DBG_PRINT( "Signature verified at pre-validation" );
+        }
+    #endif
 
-            // Increment safety counter
-            safety_cnt++;
+        else
+        {
+            status = boot_fw_image_check_sig( p_head, p_digest );
         }
     }
+
+    // Check for image CRC
+    else if ( eVER_SIG_TYPE_NONE == p_head->data.sig_type )
+    {
+        status = boot_fw_image_check_crc( p_head, p_digest );
+    }
+
+    // Other validation methods
+    else
+    {
+        status = eBOOT_ERROR;
+        BOOT_DBG_PRINT( "ERROR: Image validation method: UNDEFINED" );
+    }
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Check for new application image size
+*       Validate firmware image
 *
-* @param[in]    fw_size     - New application image size in bytes
-* @return       status      - Status of check
+* @note     That function checks for application header CRC and complete
+*           firmware image CRC or signature. Image is read only once.
+*
+*           Time execution on Cortex-M4 @150MHz:
+*               -O0:    137 ms
+*               -Ofast: 110 ms
+*
+* @return       status - Status of validation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static boot_msg_status_t boot_fw_size_check(const uint32_t fw_size)
+static boot_status_t boot_fw_image_validate(void)
 {
-    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+            boot_status_t       status      = eBOOT_OK;
+    static  ver_image_header_t  app_header  = {0};
+    static  boot_digest_t       digest      = {0};
 
-    #if ( 1 == BOOT_CFG_FW_SIZE_CHECK_EN )
+    // Read application header
+    status = boot_app_head_read( g_boot_slot_active, (ver_image_header_t*) &app_header );
 
-        // New application image to big!
-        if ( fw_size > BOOT_CFG_APP_SIZE_MAX )
+    // Application header OK
+    if ( eBOOT_OK == status )
+    {
+        // Check for ECSDA signature
+        if ( eVER_SIG_TYPE_ECSDA == app_header.data.sig_type )
         {
-            msg_status = eBOOT_MSG_ERROR_FW_SIZE;
+            BOOT_DBG_PRINT( "Image validation method: ECDSA" );
+
+            digest.type = BOOT_DIGEST_SHA256;
+            status = boot_image_digest( BOOT_APP_ADDR_START( g_boot_slot_active ), app_header.data.image_size, &digest );
+
+            if ( eBOOT_OK == status )
+            {
+                status = boot_fw_image_check_sig((ver_image_header_t*) &app_header, &digest );
+            }
         }
 
-    #else
-        // Unused
-        (void) fw_size;
-    #endif
+        // Check for image CRC only when signature is disabled
+        else if ( eVER_SIG_TYPE_NONE == app_header.data.sig_type )
+        {
+            BOOT_DBG_PRINT( "Image validation method: CRC" );
 
-    return msg_status;
+            digest.type = BOOT_DIGEST_CRC32;
+            status = boot_image_digest( BOOT_APP_ADDR_START( g_boot_slot_active ), app_header.data.image_size, &digest );
+
+            if ( eBOOT_OK == status )
+            {
+                status = boot_fw_image_check_crc((ver_image_header_t*) &app_header, &digest );
+            }
+        }
+
+        // Other validation methods
+        else
+        {
+            // Add support for new validation method
+            BOOT_DBG_PRINT( "ERROR: Image validation method: UNDEFINED" );
+            BOOT_ASSERT(0);
+        }
+
+        // Image validation OK
+        if ( eBOOT_OK == status )
+        {
+            BOOT_DBG_PRINT( "Firmware image validated OK!" );
+        }
+
+        // FW image corrupted - validation error
+        else
+        {
+            status = eBOOT_ERROR;
+
+            /**
+             *  Erase application header -> This will enable re-flashing
+             *  same version of application as FW compatibility checks
+             *  will not failed!
+             */
+            (void) boot_app_head_erase( g_boot_slot_active );
+
+            BOOT_DBG_PRINT( "ERROR: Firmware image corrupted! Validation failed!" );
+        }
+    }
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Check for new application SW version compatibility
+*       Validate firmware image with help of validation cache
 *
-* @param[in]    fw_ver  - New application FW version in form of uint32_t: 0xMAJOR.MINOR.DEVELOP.TEST
-* @return       status  - Status of check
+* @note     When validation cache is enabled and valid cache record is found
+*           image is accepted based on fast check (header hash, public key
+*           fingerprint and sampled CRC). Full validation is done when record
+*           is missing/stale or every "BOOT_CFG_VALID_CACHE_FULL_CHECK_PERIOD"
+*           boots.
+*
+*           When validation cache is disabled that function is same as
+*           "boot_fw_image_validate()".
+*
+* @return       status - Status of validation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static boot_msg_status_t boot_fw_ver_check(const uint32_t fw_ver)
+static boot_status_t boot_fw_image_validate_fast(void)
 {
-    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+    boot_status_t status = eBOOT_OK;
 
-    #if ( 1 == BOOT_CFG_FW_VER_CHECK_EN )
+    #if ( 1 == BOOT_CFG_VALID_CACHE_EN )
 
-        // Assemble limit FW version (compatible up to that version/limit value)
-        const uint32_t fw_ver_lim = (uint32_t) ((( BOOT_CFG_FW_VER_MAJOR & 0xFFU ) << 24U )    | (( BOOT_CFG_FW_VER_MINOR & 0xFFU ) << 16U )
-                                            |   (( BOOT_CFG_FW_VER_DEVELOP & 0xFFU ) << 8U )   | ( BOOT_CFG_FW_VER_TEST & 0xFFU ));
+        static  ver_image_header_t  app_header  = {0};
+                boot_status_t       cache_ok    = eBOOT_ERROR;
 
-        // New application firmware version not supported!
-        if ( fw_ver > fw_ver_lim )
-        {
-            msg_status = eBOOT_MSG_ERROR_FW_VER;
-        }
+        // Read application header
+        status = boot_app_head_read( g_boot_slot_active, (ver_image_header_t*) &app_header );
 
-    #else
-        // Unused
-        (void) fw_ver;
-    #endif
+        // Application header OK
+        if ( eBOOT_OK == status )
+        {
+            // Check validation cache record
+            cache_ok = boot_valid_cache_check((ver_image_header_t*) &app_header );
 
-#if ( 0 == BOOT_CFG_FW_DOWNGRADE_EN )
+            // Record valid and full check not yet required
+            if  (   ( eBOOT_OK == cache_ok )
+                &&  ( g_boot_shared_mem.data.valid_cnt < BOOT_CFG_VALID_CACHE_FULL_CHECK_PERIOD ))
+            {
+                g_boot_shared_mem.data.valid_cnt++;
 
-        static ver_image_header_t app_header = {0};
+                BOOT_DBG_PRINT( "Firmware image validated OK (cached)!" );
+            }
 
-        // Application header valid
-        if ( eBOOT_OK == boot_app_head_read( &app_header ))
-        {
-            // If new application version is older of the same -> invalid firmware version
-            if ( fw_ver <= app_header.sw_ver )
+            // Full validation
+            else
             {
-                msg_status = eBOOT_MSG_ERROR_FW_VER;
+                status = boot_fw_image_validate();
+
+                if ( eBOOT_OK == status )
+                {
+                    g_boot_shared_mem.data.valid_cnt = 0U;
+
+                    // Refresh record only when stale, to save flash wear
+                    if ( eBOOT_OK != cache_ok )
+                    {
+                        cache_ok = boot_valid_cache_write((ver_image_header_t*) &app_header );
+                    }
+                }
             }
+
+            #if ( BOOT_CFG_SHARED_MEM_EXT_SIZE > 0U )
+
+                // Hand validation cache token over to application
+                if  (   ( eBOOT_OK == status )
+                    &&  ( eBOOT_OK == cache_ok ))
+                {
+                    boot_shared_mem_valid_t valid = {0};
+
+                    // Token is CRC of stored record, placed at the end of it
+                    (void) boot_if_flash_read(( BOOT_CFG_VALID_CACHE_ADDR + sizeof( boot_valid_rec_t ) - sizeof( valid.token )), sizeof( valid.token ), (uint8_t*) &valid.token );
+                    valid.valid_cnt = g_boot_shared_mem.data.valid_cnt;
+
+                    (void) boot_shared_mem_ext_publish( eBOOT_SHARED_MEM_EXT_VALID, &valid, sizeof( valid ));
+                }
+
+            #endif
+
+            // Calculate CRC
+            boot_shared_mem_update();
         }
 
-#endif
+    #else
 
-    return msg_status;
+        status = boot_fw_image_validate();
+
+    #endif
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Check for new application HW version compatibility
+*       Validate firmware image of active slot
 *
-* @param[in]    hw_ver  - New application HW version in form of uint32_t: 0xMAJOR.MINOR.DEVELOP.TEST
-* @return       status  - Status of check
+* @note     With A/B slots corrupted image (its header is erased by
+*           validation) is skipped and image of other slot is validated.
+*
+* @return       status - Status of validation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static boot_msg_status_t boot_hw_ver_check(const uint32_t hw_ver)
+static boot_status_t boot_fw_image_validate_slots(void)
 {
-    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+    boot_status_t status = boot_fw_image_validate_fast();
 
-    #if ( 1 == BOOT_CFG_HW_VER_CHECK_EN )
+    #if ( 1 == BOOT_CFG_AB_SLOT_EN )
 
-        // Assemble limit HW version (compatible up to that version/limit value)
-        const uint32_t hw_ver_lim = (uint32_t) ((( BOOT_CFG_HW_VER_MAJOR & 0xFFU ) << 24U )    | (( BOOT_CFG_HW_VER_MINOR & 0xFFU ) << 16U )
-                                            |   (( BOOT_CFG_HW_VER_DEVELOP & 0xFFU ) << 8U )   | ( BOOT_CFG_HW_VER_TEST & 0xFFU ));
+        const uint8_t failed_slot = g_boot_slot_active;
 
-        // New application firmware version not supported!
-        if ( hw_ver > hw_ver_lim )
+        // Fall back to image in other slot
+        if  (   ( eBOOT_OK != status )
+            &&  ( true == boot_slot_select())
+            &&  ( failed_slot != g_boot_slot_active ))
         {
-            msg_status = eBOOT_MSG_ERROR_HW_VER;
+            BOOT_DBG_PRINT( "Falling back to slot %c!", ( 'A' + g_boot_slot_active ));
+
+            status = boot_fw_image_validate_fast();
         }
 
-    #else
-        // Unused
-        (void) hw_ver;
     #endif
 
-    return msg_status;
+    return status;
+}
+
+#if ( 1 == BOOT_CFG_AB_SLOT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Activate newly flashed image slot
+    *
+    * @note     Newly flashed image shall be booted even if it is not newer
+    *           (downgrade), therefore image in other slot with same or newer
+    *           SW version is invalidated.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_slot_activate_target(void)
+    {
+        static ver_image_header_t other_head = {0};
+
+        const uint8_t other_slot = ( BOOT_SLOT_B - g_boot_slot_target );
+
+        if  (   ( eBOOT_OK == boot_app_head_read( other_slot, &other_head ))
+            &&  ( other_head.data.sw_ver >= g_boot_flashing.head.data.sw_ver ))
+        {
+            (void) boot_app_head_erase( other_slot );
+        }
+
+        g_boot_slot_active = g_boot_slot_target;
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_VALID_CACHE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Build validation cache record for current image
+    *
+    * @note     Sampled CRC is calculated over "BOOT_CFG_VALID_CACHE_SAMPLES"
+    *           blocks of "BOOT_CFG_VALIDATE_CHUNK_SIZE" bytes evenly spread
+    *           across image.
+    *
+    * @param[in]    p_head  - Image (app) header
+    * @param[out]   p_rec   - Validation cache record
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_valid_cache_build(const ver_image_header_t * const p_head, boot_valid_rec_t * const p_rec)
+    {
+                boot_status_t       status                      = eBOOT_OK;
+        static  boot_digest_t       digest                      = {0};
+                uint8_t             key_hash[CF_SHA256_HASHSZ]  = {0};
+                cf_sha256_context   sha_ctx                     = {0};
+
+        memset( p_rec, 0U, sizeof( boot_valid_rec_t ));
+
+        p_rec->magic = BOOT_VALID_CACHE_MAGIC;
+
+        // Hash application header
+        cf_sha256_init( &sha_ctx );
+        cf_sha256_update( &sha_ctx, (const uint8_t*) p_head, sizeof( ver_image_header_t ));
+        cf_sha256_digest_final( &sha_ctx, p_rec->head_hash );
+
+        // Public key fingerprint
+        cf_sha256_init( &sha_ctx );
+        cf_sha256_update( &sha_ctx, boot_if_get_public_key(), 64U );
+        cf_sha256_digest_final( &sha_ctx, key_hash );
+        memcpy( &p_rec->key_fpr, &key_hash, BOOT_VALID_CACHE_KEY_FPR_SIZE );
+
+        // Sampled image CRC
+        const uint32_t stride = ( p_head->data.image_size / BOOT_CFG_VALID_CACHE_SAMPLES );
+
+        digest.type     = BOOT_DIGEST_CRC32;
+        digest.crc32    = boot_crc32_init();
+
+        for ( uint32_t i = 0U; ( i < BOOT_CFG_VALID_CACHE_SAMPLES ) && ( eBOOT_OK == status ); i++ )
+        {
+            const uint32_t ofs  = ( i * stride );
+            const uint32_t size = ((( p_head->data.image_size - ofs ) > BOOT_CFG_VALIDATE_CHUNK_SIZE ) ? BOOT_CFG_VALIDATE_CHUNK_SIZE : ( p_head->data.image_size - ofs ));
+
+            status = boot_image_read(( BOOT_APP_ADDR_START( g_boot_slot_active ) + ofs ), size, boot_image_digest_cb, (void*) &digest );
+        }
+
+        p_rec->sample_crc = digest.crc32;
+
+        // Record CRC
+        p_rec->crc = boot_crc32_update( boot_crc32_init(), (const uint8_t*) p_rec, ( sizeof( boot_valid_rec_t ) - sizeof( p_rec->crc )));
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check validation cache record against current image
+    *
+    * @param[in]    p_head  - Image (app) header
+    * @return       status  - eBOOT_OK if record is present and matches image
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_valid_cache_check(const ver_image_header_t * const p_head)
+    {
+                boot_status_t       status  = eBOOT_OK;
+        static  boot_valid_rec_t    rec     = {0};
+        static  boot_valid_rec_t    calc    = {0};
+
+        // Read stored record
+        status = boot_if_flash_read( BOOT_CFG_VALID_CACHE_ADDR, sizeof( boot_valid_rec_t ), (uint8_t*) &rec );
+
+        if ( eBOOT_OK == status )
+        {
+            // Record missing or corrupted
+            if  (   ( BOOT_VALID_CACHE_MAGIC != rec.magic )
+                ||  ( rec.crc != boot_crc32_update( boot_crc32_init(), (const uint8_t*) &rec, ( sizeof( boot_valid_rec_t ) - sizeof( rec.crc )))))
+            {
+                status = eBOOT_ERROR;
+                BOOT_DBG_PRINT( "Validation cache record missing!" );
+            }
+
+            // Compare with current image
+            else if (   ( eBOOT_OK != boot_valid_cache_build( p_head, &calc ))
+                    ||  ( 0 != memcmp( &rec, &calc, sizeof( boot_valid_rec_t ))))
+            {
+                status = eBOOT_ERROR;
+                BOOT_DBG_PRINT( "Validation cache record stale!" );
+            }
+            else
+            {
+                // Record valid...
+            }
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Write validation cache record for current image
+    *
+    * @note     Shall be called only after successful full image validation!
+    *
+    * @param[in]    p_head  - Image (app) header
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_valid_cache_write(const ver_image_header_t * const p_head)
+    {
+                boot_status_t       status  = eBOOT_OK;
+        static  boot_valid_rec_t    rec     = {0};
+
+        // Build record
+        status = boot_valid_cache_build( p_head, &rec );
+
+        if ( eBOOT_OK == status )
+        {
+            status = boot_valid_cache_invalidate();
+        }
+
+        if ( eBOOT_OK == status )
+        {
+            status = boot_if_flash_write( BOOT_CFG_VALID_CACHE_ADDR, sizeof( boot_valid_rec_t ), (const uint8_t*) &rec );
+        }
+
+        if ( eBOOT_OK != status )
+        {
+            BOOT_DBG_PRINT( "ERROR: Validation cache record write failed!" );
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Invalidate (erase) validation cache record
+    *
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_valid_cache_invalidate(void)
+    {
+        boot_status_t status = eBOOT_OK;
+
+        if ( eBOOT_OK != boot_if_flash_erase( BOOT_CFG_VALID_CACHE_ADDR, sizeof( boot_valid_rec_t )))
+        {
+            status = eBOOT_ERROR;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_RESUME_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Build upgrade progress checkpoint
+    *
+    * @param[in]    p_head  - Received image header
+    * @param[in]    ofs     - Number of image bytes committed to flash
+    * @param[out]   p_rec   - Checkpoint record
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_resume_build(const ver_image_header_t * const p_head, const uint32_t ofs, boot_resume_rec_t * const p_rec)
+    {
+        cf_sha256_context sha_ctx = {0};
+
+        memset( p_rec, 0U, sizeof( boot_resume_rec_t ));
+
+        p_rec->magic    = BOOT_RESUME_MAGIC;
+        p_rec->ofs      = ofs;
+
+        // Hash image header
+        cf_sha256_init( &sha_ctx );
+        cf_sha256_update( &sha_ctx, (const uint8_t*) p_head, sizeof( ver_image_header_t ));
+        cf_sha256_digest_final( &sha_ctx, p_rec->head_hash );
+
+        // Record CRC
+        p_rec->crc = boot_crc32_update( boot_crc32_init(), (const uint8_t*) p_rec, ( sizeof( boot_resume_rec_t ) - sizeof( p_rec->crc )));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Read latest upgrade progress checkpoint
+    *
+    * @note     Log is scanned up to first empty (erased) record, record
+    *           interrupted while written is skipped.
+    *
+    * @param[out]   p_rec   - Checkpoint record
+    * @return       status  - eBOOT_OK if valid checkpoint found
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_resume_read(boot_resume_rec_t * const p_rec)
+    {
+        boot_status_t       status  = eBOOT_ERROR;
+        boot_resume_rec_t   rec     = {0};
+
+        for ( uint32_t i = 0U; i < BOOT_RESUME_REC_NUM_OF; i++ )
+        {
+            if ( eBOOT_OK != boot_if_flash_read(( BOOT_CFG_RESUME_ADDR + ( i * sizeof( boot_resume_rec_t ))), sizeof( boot_resume_rec_t ), (uint8_t*) &rec ))
+            {
+                break;
+            }
+
+            // End of log
+            if ( 0xFFFFFFFFU == rec.magic )
+            {
+                break;
+            }
+
+            // Valid record
+            if  (   ( BOOT_RESUME_MAGIC == rec.magic )
+                &&  ( rec.crc == boot_crc32_update( boot_crc32_init(), (const uint8_t*) &rec, ( sizeof( boot_resume_rec_t ) - sizeof( rec.crc )))))
+            {
+                memcpy( p_rec, &rec, sizeof( boot_resume_rec_t ));
+                status = eBOOT_OK;
+            }
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Store upgrade progress checkpoint
+    *
+    * @note     Record is appended to log, log is erased only when full.
+    *           Only plain image progress is stored, delta, compressed and
+    *           container images depend on decoder state and are always
+    *           restarted.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_resume_save(void)
+    {
+                boot_status_t       status  = eBOOT_OK;
+        static  boot_resume_rec_t   rec     = {0};
+                uint32_t            magic   = 0U;
+                uint32_t            idx     = 0U;
+
+        if  (   ( g_boot_flashing.flashed_bytes > 0U )
+            &&  ( true == boot_flash_is_plain()))
+        {
+            // Find first empty record
+            for ( idx = 0U; idx < BOOT_RESUME_REC_NUM_OF; idx++ )
+            {
+                if  (   ( eBOOT_OK != boot_if_flash_read(( BOOT_CFG_RESUME_ADDR + ( idx * sizeof( boot_resume_rec_t ))), sizeof( magic ), (uint8_t*) &magic ))
+                    ||  ( 0xFFFFFFFFU == magic ))
+                {
+                    break;
+                }
+            }
+
+            // Log full -> start over
+            if ( idx >= BOOT_RESUME_REC_NUM_OF )
+            {
+                status  = boot_resume_invalidate();
+                idx     = 0U;
+            }
+
+            if ( eBOOT_OK == status )
+            {
+                boot_resume_build((const ver_image_header_t*) &g_boot_flashing.head, g_boot_flashing.flashed_bytes, &rec );
+
+                status = boot_if_flash_write(( BOOT_CFG_RESUME_ADDR + ( idx * sizeof( boot_resume_rec_t ))), sizeof( boot_resume_rec_t ), (const uint8_t*) &rec );
+            }
+
+            if ( eBOOT_OK != status )
+            {
+                BOOT_DBG_PRINT( "ERROR: Resume checkpoint write failed!" );
+            }
+            else
+            {
+                BOOT_DBG_PRINT( "Resume checkpoint at %d bytes", g_boot_flashing.flashed_bytes );
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Invalidate (erase) upgrade progress checkpoint log
+    *
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_resume_invalidate(void)
+    {
+        boot_status_t status = eBOOT_OK;
+
+        if ( eBOOT_OK != boot_if_flash_erase( BOOT_CFG_RESUME_ADDR, BOOT_CFG_RESUME_SIZE ))
+        {
+            status = eBOOT_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get image offset to resume upgrade from
+    *
+    * @note     Checkpoint must belong to same (plain) image. Upgrade resumes
+    *           at start of flash sector holding first not committed byte,
+    *           as that sector might be partially programmed. Sector holding
+    *           image header is never re-erased, thus progress inside it is
+    *           dropped.
+    *
+    * @param[in]    p_head  - Received image header, shall be pre-validated
+    * @return       ofs     - Image offset to resume from, 0 for fresh start
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t boot_resume_ofs_get(const ver_image_header_t * const p_head)
+    {
+                uint32_t            ofs             = 0U;
+        static  boot_resume_rec_t   rec             = {0};
+        static  boot_resume_rec_t   calc            = {0};
+                uint32_t            sector_start    = 0U;
+                uint32_t            sector_size     = 0U;
+        const   uint32_t            data_addr       = BOOT_APP_ADDR_START( g_boot_slot_target );
+
+        if  (   ( eVER_IMAGE_TYPE_APP == p_head->ctrl.image_type )
+            &&  ( BOOT_COMP_TYPE_NONE == BOOT_IMAGE_COMP_TYPE( p_head ))
+            &&  ( eBOOT_OK == boot_resume_read( &rec ))
+            &&  ( rec.ofs < p_head->data.image_size ))
+        {
+            boot_resume_build( p_head, rec.ofs, &calc );
+
+            if  (   ( 0 == memcmp( &rec.head_hash, &calc.head_hash, CF_SHA256_HASHSZ ))
+                &&  ( eBOOT_OK == boot_flash_sector_get(( data_addr + rec.ofs ), &sector_start, &sector_size ))
+                &&  ( sector_start > data_addr ))
+            {
+                ofs = ( sector_start - data_addr );
+            }
+        }
+
+        return ofs;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Start (Jump) to application code
+*
+* @note 	That function has ARM Cortex-M specific commands! If bootloader will
+* 			be used on other uC then this part of code shall be adopted!
+*
+* @return       status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_start_application(void)
+{
+	boot_status_t status = eBOOT_OK;
+
+	#if ( BOOT_CFG_SHARED_MEM_EXT_SIZE > 0U )
+
+		// Report boot timing to application
+		boot_shared_mem_timing_t timing = {0};
+
+		timing.boot_ms  = (uint32_t)( BOOT_GET_SYSTICK() - gu32_boot_start_ms );
+		timing.valid_us = g_boot_shared_mem.data.valid_us;
+
+		(void) boot_shared_mem_ext_publish( eBOOT_SHARED_MEM_EXT_TIMING, &timing, sizeof( timing ));
+		boot_shared_mem_update();
+
+	#endif
+
+	// Disable interrupts
+	__disable_irq();
+
+	// De-init application level code
+	status = boot_if_deinit();
+
+	#if ( 1 == BOOT_CFG_BANK_SWAP_EN )
+
+		// Image in other bank -> swap banks, MCU is reset
+		if  (   ( eBOOT_OK == status )
+			&&  ( BOOT_SLOT_B == g_boot_slot_active ))
+		{
+			status = boot_if_bank_swap();
+
+			// This line is reached only if swap failed...
+			status = eBOOT_ERROR;
+		}
+
+	#endif
+
+	if ( eBOOT_OK == status )
+	{
+		const uint32_t app_start = g_boot_slot[ g_boot_slot_active ].start_addr;
+
+		// Set stack pointer
+		__set_MSP( app_start );
+
+		// Next address is reset vector for app
+		const uint32_t app_addr = *(uint32_t*)(uintptr_t)( app_start + 4U );
+		p_func p_app = (p_func)(uintptr_t) app_addr;
+
+		// Start Application
+		p_app();
+	}
+
+	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Check for new application authentic
+*       Calculate shared memory CRC
 *
-* @param[in]    p_sig   - Iamge digital signature
-* @param[in]    p_hash  - Image hash
-* @return       status  - Status of check
+* @note     CRC-8 is table driven, see "boot_crc8_calc()".
+*
+* @param[in]    p_mem   - Pointer to shared memory
+* @return       crc8    - CRC of shared memory
 */
 ////////////////////////////////////////////////////////////////////////////////
-static boot_msg_status_t boot_signature_check(const uint8_t * const p_sig, const uint8_t * const p_hash)
+static uint8_t boot_shared_mem_calc_crc(const boot_shared_mem_t * const p_mem)
 {
-    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+    uint8_t crc8 = 0U;
 
-#if ( 1 == BOOT_CFG_DIGITAL_SIGN_EN )
+    // Calculate crc
+    // NOTE: Ignore CRC value at the end (-1)
+    crc8 = boot_crc8_calc((uint8_t*) &( p_mem->ctrl.ver ), ( sizeof(boot_shared_mem_t) - 1U ));
 
-    // Create curve context
-    const struct uECC_Curve_t * p_curve = uECC_secp256k1();
+    return crc8;
+}
 
-    // Public key invalid
-    if ( 0 == uECC_valid_public_key( boot_if_get_public_key(), p_curve ))
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check shared memory validity
+*
+* @note     CRC is calculated only till shared memory is found valid, then
+*           result is cached. Corrupted shared memory is restored from its
+*           mirror, if mirror is valid.
+*
+* @return       valid - True if shared memory is valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_shared_mem_is_valid(void)
+{
+    if ( false == gb_boot_shared_mem_valid )
     {
-        msg_status = eBOOT_MSG_ERROR_VALIDATION;
-        BOOT_DBG_PRINT( "PRE-VALIDATION ERROR: Public key invalid!" );
+        gb_boot_shared_mem_valid = ( g_boot_shared_mem.ctrl.crc == boot_shared_mem_calc_crc((const boot_shared_mem_t *) &g_boot_shared_mem ));
+
+        #if ( 1 == BOOT_CFG_SHARED_MEM_MIRROR_EN )
+
+            // Restore from mirror
+            if  (   ( false == gb_boot_shared_mem_valid )
+                &&  ( g_boot_shared_mem_mirror.ctrl.crc == boot_shared_mem_calc_crc((const boot_shared_mem_t *) &g_boot_shared_mem_mirror )))
+            {
+                memcpy((void*) &g_boot_shared_mem, (const void*) &g_boot_shared_mem_mirror, sizeof( boot_shared_mem_t ));
+                gb_boot_shared_mem_valid = true;
+
+                BOOT_DBG_PRINT( "Shared memory restored from mirror!" );
+            }
+
+        #endif
     }
 
-    // Public key valid
-    else
+    return gb_boot_shared_mem_valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Update shared memory CRC (and mirror) after change
+*
+* @note     Primary copy is completed before mirror is touched, thus one
+*           of both copies is always valid.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_shared_mem_update(void)
+{
+    // Calculate CRC
+    g_boot_shared_mem.ctrl.crc = boot_shared_mem_calc_crc((const boot_shared_mem_t *) &g_boot_shared_mem );
+
+    #if ( 1 == BOOT_CFG_SHARED_MEM_MIRROR_EN )
+        memcpy((void*) &g_boot_shared_mem_mirror, (const void*) &g_boot_shared_mem, sizeof( boot_shared_mem_t ));
+    #endif
+
+    gb_boot_shared_mem_valid = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize shared memory
+*
+* @note     In case of CRC failure of both copies -> all fields are set to default!
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_init_shared_mem(void)
+{
+    // Shared memory CRC OK
+    if ( true == boot_shared_mem_is_valid())
     {
-        // Signature invalid
-        if ( 0 == uECC_verify( boot_if_get_public_key(), p_hash, CF_SHA256_HASHSZ, p_sig, p_curve ))
+        // Count boot ups
+        if ( g_boot_shared_mem.data.boot_cnt < UINT8_MAX )
         {
-            msg_status = eBOOT_MSG_ERROR_SIGNATURE;
-            BOOT_DBG_PRINT( "PRE-VALIDATION ERROR: Signature invalid!" );
+            g_boot_shared_mem.data.boot_cnt++;
         }
     }
-#else
-    //Unused
-    (void) p_sig;
-    (void) p_hash;
+
+    // CRC error
+    else
+    {
+        g_boot_shared_mem.data.boot_cnt      = 0U;
+        g_boot_shared_mem.data.boot_reason   = eBOOT_REASON_NONE;
+        g_boot_shared_mem.data.valid_cnt     = 0U;
+
+        BOOT_DBG_PRINT( "ERROR: Shared memory corrupted!" );
+    }
+
+    #if ( BOOT_CFG_SHARED_MEM_EXT_SIZE > 0U )
+
+        // Records of other layout are dropped
+        if  (   ( false == gb_boot_shared_mem_valid )
+            ||  ( BOOT_SHARED_MEM_VER != g_boot_shared_mem.ctrl.ver )
+            ||  ( BOOT_CFG_SHARED_MEM_EXT_SIZE != g_boot_shared_mem.ctrl.ext_size )
+            ||  ( BOOT_SHARED_MEM_EXT_VER != g_boot_shared_mem.ext.ver ))
+        {
+            boot_shared_mem_ext_clear();
+        }
+
+        // Records of bootloader are refreshed on each boot
+        else
+        {
+            (void) boot_shared_mem_ext_publish( eBOOT_SHARED_MEM_EXT_TIMING, NULL, 0U );
+            (void) boot_shared_mem_ext_publish( eBOOT_SHARED_MEM_EXT_VALID, NULL, 0U );
+            (void) boot_shared_mem_ext_publish( eBOOT_SHARED_MEM_EXT_RESUME, NULL, 0U );
+        }
+
+        g_boot_shared_mem.ctrl.ext_size = BOOT_CFG_SHARED_MEM_EXT_SIZE;
+
+    #endif
+
+    // Set shared memory data
+    g_boot_shared_mem.ctrl.ver      = BOOT_SHARED_MEM_VER;
+    g_boot_shared_mem.data.boot_ver = version_get_sw().U;
+    g_boot_shared_mem.data.valid_us = 0U;
+
+    // Calculate CRC
+    boot_shared_mem_update();
+}
+
+#if ( BOOT_CFG_SHARED_MEM_EXT_SIZE > 0U )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Clear shared memory extension area
+    *
+    * @note     CRC is not updated!
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_shared_mem_ext_clear(void)
+    {
+        memset((void*) &g_boot_shared_mem.ext, 0U, BOOT_CFG_SHARED_MEM_EXT_SIZE );
+        g_boot_shared_mem.ext.ver = BOOT_SHARED_MEM_EXT_VER;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Find shared memory extension record
+    *
+    * @note     Walk stops at end record, at end of area or at record
+    *           exceeding it.
+    *
+    * @param[in]    type    - Record type
+    * @param[out]   p_end   - Size of used records space
+    * @return       ofs     - Record offset, BOOT_SHARED_MEM_EXT_NONE if not found
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t boot_shared_mem_ext_find(const uint8_t type, uint32_t * const p_end)
+    {
+        const   volatile uint8_t * const    p_tlv   = g_boot_shared_mem.ext.tlv;
+                uint32_t                    found   = BOOT_SHARED_MEM_EXT_NONE;
+                uint32_t                    ofs     = 0U;
+
+        while   (   (( ofs + BOOT_SHARED_MEM_EXT_HEAD_SIZE ) <= BOOT_SHARED_MEM_EXT_TLV_SIZE )
+                &&  ( eBOOT_SHARED_MEM_EXT_END != p_tlv[ofs] )
+                &&  (( ofs + BOOT_SHARED_MEM_EXT_HEAD_SIZE + p_tlv[ ofs + 1U ] ) <= BOOT_SHARED_MEM_EXT_TLV_SIZE ))
+        {
+            if ( type == p_tlv[ofs] )
+            {
+                found = ofs;
+            }
+
+            ofs += ( BOOT_SHARED_MEM_EXT_HEAD_SIZE + p_tlv[ ofs + 1U ] );
+        }
+
+        *p_end = ofs;
+
+        return found;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Add, replace or remove shared memory extension record
+    *
+    * @note     CRC is not updated! Records behind removed one are moved
+    *           forward, so list stays contiguous.
+    *
+    * @param[in]    type    - Record type
+    * @param[in]    p_value - Record value, NULL removes record
+    * @param[in]    size    - Record value size
+    * @return       status  - eBOOT_ERROR if there is no space for record
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_shared_mem_ext_publish(const uint8_t type, const void * const p_value, const uint8_t size)
+    {
+                boot_status_t   status      = eBOOT_OK;
+                uint8_t * const p_tlv       = (uint8_t*) g_boot_shared_mem.ext.tlv;
+                uint32_t        end         = 0U;
+        const   uint32_t        found       = boot_shared_mem_ext_find( type, &end );
+        const   uint32_t        old_size    = (( BOOT_SHARED_MEM_EXT_NONE != found ) ? ( BOOT_SHARED_MEM_EXT_HEAD_SIZE + p_tlv[ found + 1U ] ) : 0U );
+
+        // No space for new record, keep old one
+        if  (   ( NULL != p_value )
+            &&  (( end - old_size + BOOT_SHARED_MEM_EXT_HEAD_SIZE + size ) > BOOT_SHARED_MEM_EXT_TLV_SIZE ))
+        {
+            status = eBOOT_ERROR;
+        }
+        else
+        {
+            // Remove old record
+            if ( BOOT_SHARED_MEM_EXT_NONE != found )
+            {
+                memmove( &p_tlv[found], &p_tlv[ found + old_size ], ( end - found - old_size ));
+                end -= old_size;
+            }
+
+            // Append new record
+            if ( NULL != p_value )
+            {
+                p_tlv[end]      = type;
+                p_tlv[end + 1U] = size;
+                memcpy( &p_tlv[ end + BOOT_SHARED_MEM_EXT_HEAD_SIZE ], p_value, size );
+                end += ( BOOT_SHARED_MEM_EXT_HEAD_SIZE + size );
+            }
+
+            // Unused space is zero (end record)
+            memset( &p_tlv[end], 0U, ( BOOT_SHARED_MEM_EXT_TLV_SIZE - end ));
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_STATS_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Clear statistics at start of communication session
+    *
+    * @note     Image validation time at boot is kept.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_stats_clear(void)
+    {
+        const uint32_t boot_valid_us = g_boot_stats.boot_valid_us;
+
+        memset( &g_boot_stats, 0U, sizeof( boot_stats_t ));
+        g_boot_stats.boot_valid_us = boot_valid_us;
+
+        gu32_stats_session_ms = BOOT_GET_SYSTICK();
+
+        boot_com_clear_stats();
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_VERIFY_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check verify request
+    *
+    * @note     Verify is served only inside connected or flash session.
+    *           Range shall lie inside one of application slots (header
+    *           included) and start at sector or slot data start. End is
+    *           rounded up to end of sector, so digests always cover whole
+    *           sectors and any flash content cannot be read out byte by
+    *           byte from them. Queued flash writes are finished first, so
+    *           digest covers all acknowledged data.
+    *
+    * @param[in]    p_range     - Requested range
+    * @param[out]   p_size      - Size of verified range (whole sectors)
+    * @return       msg_status  - Status of check
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_verify_check(const boot_verify_t * const p_range, uint32_t * const p_size)
+    {
+        boot_msg_status_t msg_status = eBOOT_MSG_ERROR_INVALID_REQ;
+
+        *p_size = 0U;
+
+        for ( uint32_t slot = 0U; slot < ( sizeof( g_boot_slot ) / sizeof( boot_slot_t )); slot++ )
+        {
+            const uint32_t  data_addr       = ( g_boot_slot[slot].head_addr + sizeof( ver_image_header_t ));
+            const uint32_t  slot_end        = ( data_addr + BOOT_CFG_APP_SIZE_MAX );
+                  uint32_t  sector_start    = 0U;
+                  uint32_t  sector_size     = 0U;
+
+            if  (   ( p_range->addr >= g_boot_slot[slot].head_addr )
+                &&  ( p_range->addr < slot_end )
+                &&  ( p_range->size > 0U )
+                &&  ( p_range->size <= ( slot_end - p_range->addr ))
+                &&  ( eBOOT_OK == boot_flash_sector_get( p_range->addr, &sector_start, &sector_size ))
+                &&  (( sector_start == p_range->addr ) || ( data_addr == p_range->addr ))
+                &&  ( eBOOT_OK == boot_flash_sector_get(( p_range->addr + p_range->size - 1U ), &sector_start, &sector_size )))
+            {
+                // Round up to end of sector
+                *p_size = ((( sector_start + sector_size ) < slot_end ) ? ( sector_start + sector_size ) : slot_end ) - p_range->addr;
+                msg_status = eBOOT_MSG_OK;
+            }
+        }
+
+        // Only inside session
+        if ( eBOOT_STATE_IDLE == boot_get_state())
+        {
+            msg_status = eBOOT_MSG_ERROR_INVALID_REQ;
+        }
+
+        // Unknown digest type
+        if  (   ( BOOT_VERIFY_TYPE_CRC32  != p_range->type )
+            &&  ( BOOT_VERIFY_TYPE_SHA256 != p_range->type ))
+        {
+            msg_status = eBOOT_MSG_ERROR_INVALID_REQ;
+        }
+
+        #if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+
+            // Finish queued writes
+            while (( 0U < g_boot_flash_pipe.num_of ) && ( eBOOT_STATE_FLASH == boot_get_state()))
+            {
+                boot_flash_pipe_hndl();
+                boot_if_kick_wdt();
+            }
+
+        #endif
+
+        return msg_status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Calculate digest of flash range
+    *
+    * @param[in]    addr        - Start address
+    * @param[in]    size        - Size in bytes
+    * @param[in]    type        - Digest type
+    * @param[out]   p_digest    - Digest, "BOOT_VERIFY_DIGEST_SIZE( type )" bytes
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_verify_digest(const uint32_t addr, const uint32_t size, const uint8_t type, uint8_t * const p_digest)
+    {
+                boot_status_t   status  = eBOOT_OK;
+        static  boot_digest_t   digest  = {0};
+
+        digest.type = type;
+        status      = boot_image_digest( addr, size, &digest );
+
+        if ( BOOT_VERIFY_TYPE_SHA256 == type )
+        {
+            memcpy( p_digest, &digest.hash, sizeof( digest.hash ));
+        }
+        else
+        {
+            memcpy( p_digest, &digest.crc32, sizeof( digest.crc32 ));
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_FAST_BOOT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check if back-door entry window is requested
+    *
+    * @note     Back-door request in shared memory is consumed, thus window
+    *           is opened only once per request.
+    *
+    * @return       requested - True if back-door window shall be opened
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool boot_backdoor_requested(void)
+    {
+        bool requested = false;
+
+        // Requested by application over shared memory
+        if ( eBOOT_REASON_BACKDOOR == g_boot_shared_mem.data.boot_reason )
+        {
+            (void) boot_shared_mem_set_boot_reason( eBOOT_REASON_NONE );
+            requested = true;
+        }
+
+        // Requested by strap pin or reset cause
+        if ( true == boot_if_backdoor_requested())
+        {
+            requested = true;
+        }
+
+        return requested;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Wait (delay) and handle bootloader in between
+*
+* @param[in]    ms  - Time to wait in miliseconds
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_wait(const uint32_t ms)
+{
+    uint32_t safety_cnt = 0U;
+
+    // Get current ticks
+    const uint32_t now = BOOT_GET_SYSTICK();
+
+    if ( ms > 0 )
+    {
+        // Wait
+        while(      ((uint32_t)( BOOT_GET_SYSTICK() - now ) <= ms )
+                &&  ( safety_cnt < 0xEFFFFFFFU ))
+        {
+            // Handle bootloader tasks
+            boot_hndl();
+
+            // Process WDT
+            boot_if_kick_wdt();
+
+            // Increment safety counter
+            safety_cnt++;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check for new application image size
+*
+* @param[in]    fw_size     - New application image size in bytes
+* @return       status      - Status of check
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_fw_size_check(const uint32_t fw_size)
+{
+    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+    #if ( 1 == BOOT_CFG_FW_SIZE_CHECK_EN )
+
+        // New application image to big!
+        if ( fw_size > BOOT_CFG_APP_SIZE_MAX )
+        {
+            msg_status = eBOOT_MSG_ERROR_FW_SIZE;
+        }
+
+    #else
+        // Unused
+        (void) fw_size;
+    #endif
+
+    return msg_status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check for new application SW version compatibility
+*
+* @param[in]    fw_ver  - New application FW version in form of uint32_t: 0xMAJOR.MINOR.DEVELOP.TEST
+* @return       status  - Status of check
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_fw_ver_check(const uint32_t fw_ver)
+{
+    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+    #if ( 1 == BOOT_CFG_FW_VER_CHECK_EN )
+
+        // Assemble limit FW version (compatible up to that version/limit value)
+        const uint32_t fw_ver_lim = (uint32_t) ((( BOOT_CFG_FW_VER_MAJOR & 0xFFU ) << 24U )    | (( BOOT_CFG_FW_VER_MINOR & 0xFFU ) << 16U )
+                                            |   (( BOOT_CFG_FW_VER_DEVELOP & 0xFFU ) << 8U )   | ( BOOT_CFG_FW_VER_TEST & 0xFFU ));
+
+        // New application firmware version not supported!
+        if ( fw_ver > fw_ver_lim )
+        {
+            msg_status = eBOOT_MSG_ERROR_FW_VER;
+        }
+
+    #else
+        // Unused
+        (void) fw_ver;
+    #endif
+
+#if ( 0 == BOOT_CFG_FW_DOWNGRADE_EN )
+
+        static ver_image_header_t app_header = {0};
+
+        // Application header valid
+        if ( eBOOT_OK == boot_app_head_read( g_boot_slot_active, &app_header ))
+        {
+            // If new application version is older of the same -> invalid firmware version
+            if ( fw_ver <= app_header.data.sw_ver )
+            {
+                msg_status = eBOOT_MSG_ERROR_FW_VER;
+            }
+        }
+
 #endif
 
     return msg_status;
@@ -763,121 +2538,3016 @@ static boot_msg_status_t boot_signature_check(const uint8_t * const p_sig, const
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Initialize (handle) boot counter
+*       Check for new application HW version compatibility
+*
+* @param[in]    hw_ver  - New application HW version in form of uint32_t: 0xMAJOR.MINOR.DEVELOP.TEST
+* @return       status  - Status of check
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_hw_ver_check(const uint32_t hw_ver)
+{
+    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+    #if ( 1 == BOOT_CFG_HW_VER_CHECK_EN )
+
+        // Assemble limit HW version (compatible up to that version/limit value)
+        const uint32_t hw_ver_lim = (uint32_t) ((( BOOT_CFG_HW_VER_MAJOR & 0xFFU ) << 24U )    | (( BOOT_CFG_HW_VER_MINOR & 0xFFU ) << 16U )
+                                            |   (( BOOT_CFG_HW_VER_DEVELOP & 0xFFU ) << 8U )   | ( BOOT_CFG_HW_VER_TEST & 0xFFU ));
+
+        // New application firmware version not supported!
+        if ( hw_ver > hw_ver_lim )
+        {
+            msg_status = eBOOT_MSG_ERROR_HW_VER;
+        }
+
+    #else
+        // Unused
+        (void) hw_ver;
+    #endif
+
+    return msg_status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check for new application authentic
+*
+* @param[in]    p_sig   - Iamge digital signature
+* @param[in]    p_hash  - Image hash
+* @return       status  - Status of check
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_signature_check(const uint8_t * const p_sig, const uint8_t * const p_hash)
+{
+    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+#if ( 1 == BOOT_CFG_DIGITAL_SIGN_EN )
+
+    // Forget previously verified hash
+    g_boot_sig_hash_valid = false;
+
+    // Public key invalid
+    if ( false == boot_ecdsa_key_is_valid())
+    {
+        msg_status = eBOOT_MSG_ERROR_VALIDATION;
+        BOOT_DBG_PRINT( "PRE-VALIDATION ERROR: Public key invalid!" );
+    }
+
+    // Public key valid
+    else
+    {
+        // Signature invalid
+        if ( false == boot_ecdsa_verify( p_hash, p_sig ))
+        {
+            msg_status = eBOOT_MSG_ERROR_SIGNATURE;
+            BOOT_DBG_PRINT( "PRE-VALIDATION ERROR: Signature invalid!" );
+        }
+
+        // Keep verified hash for post-validation
+        else
+        {
+            memcpy( &g_boot_sig_hash, p_hash, CF_SHA256_HASHSZ );
+            g_boot_sig_hash_valid = true;
+        }
+    }
+#else
+    //Unused
+    (void) p_sig;
+    (void) p_hash;
+#endif
+
+    return msg_status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize (handle) boot counter
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_init_boot_counter(void)
+{
+    #if ( 1 == BOOT_CFG_APP_BOOT_CNT_CHECK_EN )
+
+        uint8_t cnt         = 0U;
+        bool    rollback    = false;
+
+        // Get boot counter
+        if ( eBOOT_OK == boot_shared_mem_get_boot_cnt( &cnt ))
+        {
+            // Limit reached
+            if ( cnt >= BOOT_CFG_BOOT_CNT_LIMIT )
+            {
+                // Corrupt app header in order to prevent entering app
+                boot_app_head_erase( g_boot_slot_active );
+
+                BOOT_DBG_PRINT( "Boot counts limit reached! Declaring invalid application!" );
+
+                // Roll back to image in other slot
+                #if ( 1 == BOOT_CFG_AB_SLOT_EN )
+                    rollback = boot_slot_select();
+                #endif
+
+                if ( true == rollback )
+                {
+                    cnt = 0U;
+
+                    BOOT_DBG_PRINT( "Rolling back to slot %c!", ( 'A' + g_boot_slot_active ));
+                }
+                else
+                {
+                    // Stay in bootloader
+                    boot_shared_mem_set_boot_reason( eBOOT_REASON_COM );
+                }
+            }
+        }
+
+        // Store boot counter
+        (void) boot_shared_mem_set_boot_cnt( cnt );
+
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get flash sector holding address
+*
+* @param[in]    addr        - Flash address
+* @param[out]   p_start     - Start address of sector
+* @param[out]   p_size      - Size of sector in bytes
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_flash_sector_get(const uint32_t addr, uint32_t * const p_start, uint32_t * const p_size)
+{
+    boot_status_t status = eBOOT_ERROR;
+
+    for ( uint32_t i = 0U; i < BOOT_FLASH_SECTOR_MAP_NUM_OF; i++ )
+    {
+        const boot_flash_region_t * const p_region = &g_boot_flash_sector_map[i];
+
+        if  (   ( addr >= p_region->addr )
+            &&  (( addr - p_region->addr ) < ( p_region->sector_size * p_region->num_of )))
+        {
+            *p_start    = ( p_region->addr + ((( addr - p_region->addr ) / p_region->sector_size ) * p_region->sector_size ));
+            *p_size     = p_region->sector_size;
+            status      = eBOOT_OK;
+            break;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Erase flash sectors up to address
+*
+* @note     Erases sector by sector from end of already erased space on, until
+*           complete space in front of "addr_end" is erased.
+*
+* @param[in]    addr_end    - End address of space needed erased (exclusive)
+* @return       msg_status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_flash_erase_to(const uint32_t addr_end)
+{
+    boot_msg_status_t   msg_status      = eBOOT_MSG_OK;
+    uint32_t            sector_start    = 0U;
+    uint32_t            sector_size     = 0U;
+
+    BOOT_STATS_START( erase_ts );
+
+    // Do until all space is erased
+    while ( g_boot_flashing.erased_addr < addr_end )
+    {
+        // Target slot no longer holds previous image
+        g_boot_flashing.is_erased = true;
+
+        // Erase sector by sector
+        if ( eBOOT_OK != boot_flash_sector_get( g_boot_flashing.erased_addr, &sector_start, &sector_size ))
+        {
+            msg_status = eBOOT_MSG_ERROR_FLASH_ERASE;
+            break;
+        }
+
+        // Unchanged sector is kept as is
+        #if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+            else if ( true == boot_flash_skip_is_kept( sector_start ))
+            {
+                // No actions...
+            }
+        #endif
+
+        else if ( eBOOT_OK != boot_if_flash_erase( sector_start, sector_size ))
+        {
+            msg_status = eBOOT_MSG_ERROR_FLASH_ERASE;
+            break;
+        }
+        else
+        {
+            // No actions...
+        }
+
+        // Move to next sector
+        g_boot_flashing.erased_addr = ( sector_start + sector_size );
+
+        // Process WDT in between
+        boot_if_kick_wdt();
+    }
+
+    BOOT_STATS_STOP( erase_ts, erase_us );
+
+    return msg_status;
+}
+
+#if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check if flash sector is kept unchanged
+    *
+    * @note     Sectors are numbered across flash sector map from sector
+    *           holding image header of target slot on.
+    *
+    * @param[in]    addr        - Flash address within sector
+    * @return       is_kept     - Sector is kept
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool boot_flash_skip_is_kept(const uint32_t addr)
+    {
+        const   uint32_t    head_addr   = g_boot_slot[ g_boot_slot_target ].head_addr;
+                uint32_t    num         = 0U;
+                uint32_t    head_num    = 0U;
+                bool        is_kept     = false;
+
+        for ( uint32_t i = 0U; i < BOOT_FLASH_SECTOR_MAP_NUM_OF; i++ )
+        {
+            const boot_flash_region_t * const p_region  = &g_boot_flash_sector_map[i];
+            const uint32_t                    region_sz = ( p_region->sector_size * p_region->num_of );
+
+            // Sector number of image header
+            if  (   ( head_addr >= p_region->addr )
+                &&  (( head_addr - p_region->addr ) < region_sz ))
+            {
+                head_num += (( head_addr - p_region->addr ) / p_region->sector_size );
+            }
+            else if ( head_addr >= p_region->addr )
+            {
+                head_num += p_region->num_of;
+            }
+            else
+            {
+                // No actions...
+            }
+
+            // Sector number of address
+            if  (   ( addr >= p_region->addr )
+                &&  (( addr - p_region->addr ) < region_sz ))
+            {
+                num += (( addr - p_region->addr ) / p_region->sector_size );
+            }
+            else if ( addr >= p_region->addr )
+            {
+                num += p_region->num_of;
+            }
+            else
+            {
+                // No actions...
+            }
+        }
+
+        // Sectors beyond map are never kept
+        if  (   ( num >= head_num )
+            &&  (( num - head_num ) < ( BOOT_SKIP_MAP_SIZE * 8U )))
+        {
+            num -= head_num;
+            is_kept = ( 0U != ( g_boot_flashing.keep_map[ num / 8U ] & ( 1U << ( num % 8U ))));
+        }
+
+        return is_kept;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check if flash space overlaps any kept sector
+    *
+    * @param[in]    addr        - Start flash address
+    * @param[in]    size        - Size of space in bytes
+    * @return       is_overlap  - Space overlaps kept sector
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool boot_flash_skip_overlap(const uint32_t addr, const uint32_t size)
+    {
+        uint32_t    sector_start    = 0U;
+        uint32_t    sector_size     = 0U;
+        bool        is_overlap      = false;
+
+        for ( uint32_t a = addr; a < ( addr + size ); a = ( sector_start + sector_size ))
+        {
+            if ( eBOOT_OK != boot_flash_sector_get( a, &sector_start, &sector_size ))
+            {
+                break;
+            }
+            else if ( true == boot_flash_skip_is_kept( sector_start ))
+            {
+                is_overlap = true;
+                break;
+            }
+            else
+            {
+                // No actions...
+            }
+        }
+
+        return is_overlap;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get size of kept image data starting at address
+    *
+    * @note     Kept data is run of consecutive kept sectors starting at
+    *           address, limited to end of new image.
+    *
+    * @param[in]    addr        - Flash address of next image data
+    * @return       size        - Size of kept data in bytes
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t boot_flash_skip_size(const uint32_t addr)
+    {
+        const   uint32_t    data_end        = ( BOOT_APP_ADDR_START( g_boot_slot_target ) + g_boot_flashing.fw_size );
+                uint32_t    end             = addr;
+                uint32_t    sector_start    = 0U;
+                uint32_t    sector_size     = 0U;
+
+        while   (   ( end < data_end )
+                &&  ( eBOOT_OK == boot_flash_sector_get( end, &sector_start, &sector_size ))
+                &&  ( true == boot_flash_skip_is_kept( sector_start )))
+        {
+            end = ( sector_start + sector_size );
+        }
+
+        // Limit to image
+        if ( end > data_end )
+        {
+            end = data_end;
+        }
+
+        return ( end - addr );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Account kept image data starting at address
+    *
+    * @note     Kept data is read back from flash into running digest, so
+    *           that validation covers complete image.
+    *
+    * @param[in]    addr        - Flash address of next image data
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_flash_skip_digest(const uint32_t addr)
+    {
+                boot_msg_status_t   msg_status  = eBOOT_MSG_OK;
+        const   uint32_t            size        = boot_flash_skip_size( addr );
+
+        if ( size > 0U )
+        {
+            BOOT_STATS_START( hash_ts );
+
+            if ( eBOOT_OK != boot_image_read( addr, size, boot_image_digest_cb, (void*) &g_boot_flashing.digest ))
+            {
+                msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+            }
+
+            BOOT_STATS_STOP( hash_ts, hash_us );
+
+            if ( eBOOT_MSG_OK == msg_status )
+            {
+                g_boot_flashing.received_bytes += size;
+
+                // Encrypted data of kept sectors is not sent
+                #if ( 1 == BOOT_CFG_CRYPTION_EN )
+                    if ( eBOOT_OK != boot_if_decrypt_seek( g_boot_flashing.received_bytes ))
+                    {
+                        msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+                    }
+                #endif
+            }
+        }
+
+        return msg_status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set sectors to keep from requested sector map
+    *
+    * @note     Sector holding image header is always programmed.
+    *
+    * @param[in]    p_map       - Requested map, set bit - program sector
+    * @param[out]   p_applied   - Applied map, set bit - program sector
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_flash_skip_set(const uint8_t * const p_map, uint8_t * const p_applied)
+    {
+        for ( uint32_t i = 0U; i < BOOT_SKIP_MAP_SIZE; i++ )
+        {
+            g_boot_flashing.keep_map[i] = (uint8_t) ~p_map[i];
+        }
+
+        g_boot_flashing.keep_map[0] &= (uint8_t) ~0x01U;
+
+        for ( uint32_t i = 0U; i < BOOT_SKIP_MAP_SIZE; i++ )
+        {
+            p_applied[i] = (uint8_t) ~g_boot_flashing.keep_map[i];
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Prepare internal uC flash for new image
+*
+* @note     With erase-ahead enabled only sector(s) holding image header
+*           are erased, rest of image space is erased while flashing.
+*
+* @param[in]    image_addr  - Start of new image address
+* @param[in]    image_size  - Size of new image in bytes (note: without image header)
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_prepare_flash(const uint32_t image_addr, const uint32_t image_size)
+{
+    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+    // Nothing erased yet
+    // NOTE: Image header is not counted into image size!
+    g_boot_flashing.erased_addr = image_addr;
+    g_boot_flashing.erase_end   = ( image_addr + image_size + sizeof( ver_image_header_t ));
+
+    #if ( 1 == BOOT_CFG_FLASH_ERASE_AHEAD_EN )
+        msg_status = boot_flash_erase_to( image_addr + sizeof( ver_image_header_t ));
+    #else
+        msg_status = boot_flash_erase_to( g_boot_flashing.erase_end );
+    #endif
+
+    return msg_status;
+}
+
+#if ( 1 == BOOT_CFG_FLASH_ERASE_AHEAD_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Erase next sector in front of working address
+    *
+    * @note     Erases at most one sector per call in order to keep
+    *           bootloader responsive while data is streaming in.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_flash_erase_ahead(void)
+    {
+        uint32_t addr_end = ( g_boot_flashing.working_addr + BOOT_CFG_FLASH_ERASE_AHEAD_SIZE );
+
+        // Limit to image space
+        if ( addr_end > g_boot_flashing.erase_end )
+        {
+            addr_end = g_boot_flashing.erase_end;
+        }
+
+        if ( g_boot_flashing.erased_addr < addr_end )
+        {
+            // Erase single sector following erased space
+            if ( eBOOT_MSG_OK != boot_flash_erase_to( g_boot_flashing.erased_addr + 1U ))
+            {
+                boot_flash_abort();
+
+                BOOT_DBG_PRINT( "ERROR: Erase-ahead failed!" );
+            }
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Pre-validate new image
+*
+* @param[in]    p_head      - Image (app) header
+* @return       msg_status  - Status of validation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_pre_validate_image(const ver_image_header_t * const p_head)
+{
+    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+    // Validate image header
+    if ( eBOOT_OK == boot_app_header_check( p_head ))
+    {
+        // Check for authentic image
+        msg_status |= boot_signature_check((const uint8_t*) &p_head->data.signature, (const uint8_t*) &p_head->data.hash );
+
+        // Container of sub-images
+        #if ( 1 == BOOT_CFG_MULTI_EN )
+            if ( BOOT_IMAGE_TYPE_MULTI == p_head->ctrl.image_type )
+            {
+                msg_status |= boot_multi_pre_validate( p_head );
+            }
+            else
+        #endif
+            {
+                msg_status |= boot_pre_validate_app( p_head );
+            }
+    }
+
+    // Image (app) header invalid
+    else
+    {
+        msg_status = eBOOT_MSG_ERROR_VALIDATION;
+    }
+
+    return msg_status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Pre-validate new application image
+*
+* @note     Image header shall already be checked, signature is checked
+*           by caller.
+*
+* @param[in]    p_head      - Image (app) header
+* @return       msg_status  - Status of validation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_pre_validate_app(const ver_image_header_t * const p_head)
+{
+    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+    // Check for FW size
+    msg_status |= boot_fw_size_check( p_head->data.image_size );
+
+    // Check for FW version compatibility
+    msg_status |= boot_fw_ver_check( p_head->data.sw_ver );
+
+    // Check for HW version compatibility
+    msg_status |= boot_hw_ver_check( p_head->data.hw_ver );
+
+    // Application image (full or delta)
+    if  (   ( eVER_IMAGE_TYPE_APP != p_head->ctrl.image_type )
+    #if ( 1 == BOOT_CFG_DELTA_EN )
+        &&  ( BOOT_IMAGE_TYPE_DELTA != p_head->ctrl.image_type )
+    #endif
+        )
+    {
+        msg_status = eBOOT_MSG_ERROR_VALIDATION;
+    }
+
+    // Check for supported compression
+    #if ( 1 == BOOT_CFG_COMP_EN )
+        if  (   ( BOOT_COMP_TYPE_NONE != BOOT_IMAGE_COMP_TYPE( p_head ))
+            &&  ( false == boot_comp_is_supported( BOOT_IMAGE_COMP_TYPE( p_head ), BOOT_IMAGE_COMP_PARAM( p_head ))))
+    #else
+        if ( BOOT_COMP_TYPE_NONE != BOOT_IMAGE_COMP_TYPE( p_head ))
+    #endif
+        {
+            msg_status = eBOOT_MSG_ERROR_VALIDATION;
+        }
+
+    // Image must be linked for slot it is written to
+    #if ( 1 == BOOT_CFG_AB_SLOT_EN )
+
+        (void) boot_slot_select();
+
+        #if ( 1 == BOOT_CFG_BANK_SWAP_EN )
+            if ( g_boot_slot[ BOOT_SLOT_A ].head_addr != p_head->data.image_addr )
+        #else
+            if ( g_boot_slot[ g_boot_slot_target ].head_addr != p_head->data.image_addr )
+        #endif
+            {
+                msg_status = eBOOT_MSG_ERROR_VALIDATION;
+
+                BOOT_DBG_PRINT( "ERROR: Image not linked for slot %c!", ( 'A' + g_boot_slot_target ));
+            }
+
+    #endif
+
+    return msg_status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Start flashing of new image or container
+*
+* @note     Application of container is begun once its header is received.
+*
+* @param[in]    p_head      - Image header, shall be pre-validated
+* @return       msg_status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_flash_start(const ver_image_header_t * const p_head)
+{
+    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+    g_boot_flashing.is_multi = false;
+
+    #if ( 1 == BOOT_CFG_MULTI_EN )
+        if ( BOOT_IMAGE_TYPE_MULTI == p_head->ctrl.image_type )
+        {
+            msg_status = boot_multi_begin( p_head );
+        }
+        else
+    #endif
+        {
+            msg_status = boot_flash_begin( p_head );
+        }
+
+    return msg_status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Begin flashing of new image
+*
+* @note     Erases application region, stores image header and prepares
+*           running digest of image.
+*
+* @param[in]    p_head      - Image (app) header, shall be pre-validated
+* @return       msg_status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_flash_begin(const ver_image_header_t * const p_head)
+{
+            boot_msg_status_t   msg_status  = eBOOT_MSG_OK;
+    const   uint32_t            head_addr   = g_boot_slot[ g_boot_slot_target ].head_addr;
+
+    // Stored header describes new image
+    memcpy( &g_boot_flashing.head, p_head, sizeof( ver_image_header_t ));
+    g_boot_flashing.is_delta = false;
+    g_boot_flashing.is_comp  = false;
+
+    #if ( 1 == BOOT_CFG_COMP_EN )
+        if ( BOOT_COMP_TYPE_NONE != BOOT_IMAGE_COMP_TYPE( p_head ))
+        {
+            // Decompressed image is stored as plain image
+            g_boot_flashing.is_comp                         = true;
+            BOOT_IMAGE_COMP_TYPE( &g_boot_flashing.head )   = BOOT_COMP_TYPE_NONE;
+            BOOT_IMAGE_COMP_PARAM( &g_boot_flashing.head )  = 0U;
+
+            boot_comp_init( BOOT_IMAGE_COMP_PARAM( p_head ));
+        }
+    #endif
+
+    #if ( 1 == BOOT_CFG_DELTA_EN )
+        if ( BOOT_IMAGE_TYPE_DELTA == p_head->ctrl.image_type )
+        {
+            // Patched image is stored as ordinary application
+            g_boot_flashing.is_delta                = true;
+            g_boot_flashing.head.ctrl.image_type    = eVER_IMAGE_TYPE_APP;
+
+            // Keep installed application as patch base
+            msg_status = boot_delta_base_prepare();
+        }
+    #endif
+
+    #if ( 1 == BOOT_FLASH_STAGE_EN )
+        if  (   ( true == g_boot_flashing.is_delta )
+            ||  ( true == g_boot_flashing.is_comp ))
+        {
+            g_boot_flashing.head.ctrl.crc = boot_app_head_calc_crc( &g_boot_flashing.head );
+        }
+
+        g_boot_flash_stage.size = 0U;
+    #endif
+
+    // Prepare flash memory for new image
+    if ( eBOOT_MSG_OK == msg_status )
+    {
+        // Header of container application is already erased, rest is erased while flashing
+        #if ( 1 == BOOT_CFG_MULTI_EN )
+            if ( true == g_boot_flashing.is_multi )
+            {
+                g_boot_flashing.erase_end = ( head_addr + p_head->data.image_size + sizeof( ver_image_header_t ));
+            }
+            else
+        #endif
+            {
+                msg_status = boot_prepare_flash( head_addr, p_head->data.image_size );
+            }
+    }
+
+    // Old validation verdict no longer applies
+    #if ( 1 == BOOT_CFG_VALID_CACHE_EN )
+        if  (   ( eBOOT_MSG_OK == msg_status )
+            &&  ( eBOOT_OK != boot_valid_cache_invalidate()))
+        {
+            msg_status = eBOOT_MSG_ERROR_FLASH_ERASE;
+        }
+    #endif
+
+    // Progress of previous upgrade no longer applies
+    #if ( 1 == BOOT_CFG_RESUME_EN )
+        if  (   ( eBOOT_MSG_OK == msg_status )
+            &&  ( eBOOT_OK != boot_resume_invalidate()))
+        {
+            msg_status = eBOOT_MSG_ERROR_FLASH_ERASE;
+        }
+    #endif
+
+    if ( eBOOT_MSG_OK == msg_status )
+    {
+        // Flash application header, with A/B slots or resume header is written after complete image
+        #if (( 1 == BOOT_CFG_AB_SLOT_EN ) || ( 1 == BOOT_CFG_RESUME_EN ))
+            const boot_status_t head_status = eBOOT_OK;
+        #else
+            const boot_status_t head_status = boot_if_flash_write( head_addr, sizeof( ver_image_header_t ), (const uint8_t*) &g_boot_flashing.head );
+        #endif
+
+        if ( eBOOT_OK == head_status )
+        {
+            // Prepare flashing data
+            g_boot_flashing.fw_size         = ( p_head->data.image_size );
+            g_boot_flashing.working_addr    = ( head_addr + sizeof( ver_image_header_t ));
+            g_boot_flashing.received_bytes  = 0U;
+            g_boot_flashing.flashed_bytes   = 0U;
+            g_boot_flashing.seq_next        = 0U;
+            g_boot_flashing.seq_ack         = 0U;
+
+            // Prepare running digest
+            g_boot_flashing.digest.type     = (( eVER_SIG_TYPE_ECSDA == p_head->data.sig_type ) ? BOOT_DIGEST_SHA256 : BOOT_DIGEST_CRC32 );
+            g_boot_flashing.digest.crc32    = boot_crc32_init();
+            cf_sha256_init( &g_boot_flashing.digest.sha_ctx );
+        }
+
+        // Flashing application header error
+        else
+        {
+            msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+        }
+    }
+
+    return msg_status;
+}
+
+#if ( 1 == BOOT_CFG_RESUME_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Resume flashing of interrupted image
+    *
+    * @note     Image data in front of resume offset is kept, running digest
+    *           is rebuilt by reading it back from flash. Flash is erased from
+    *           resume offset on.
+    *
+    * @param[in]    p_head      - Image (app) header, shall be pre-validated
+    * @param[in]    ofs         - Image offset to resume from
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_flash_resume(const ver_image_header_t * const p_head, const uint32_t ofs)
+    {
+                boot_msg_status_t   msg_status  = eBOOT_MSG_OK;
+        const   uint32_t            head_addr   = g_boot_slot[ g_boot_slot_target ].head_addr;
+        const   uint32_t            data_addr   = ( head_addr + sizeof( ver_image_header_t ));
+
+        // Only plain images are resumed
+        memcpy( &g_boot_flashing.head, p_head, sizeof( ver_image_header_t ));
+        g_boot_flashing.is_delta    = false;
+        g_boot_flashing.is_comp     = false;
+
+        // Target slot already holds part of new image
+        g_boot_flashing.is_erased   = true;
+
+        // Continue decryption at resume offset
+        #if ( 1 == BOOT_CFG_CRYPTION_EN )
+            if ( eBOOT_OK != boot_if_decrypt_seek( ofs ))
+            {
+                msg_status = eBOOT_MSG_ERROR_VALIDATION;
+            }
+        #endif
+
+        // Prepare flash memory for rest of image
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            g_boot_flashing.erased_addr = ( data_addr + ofs );
+            g_boot_flashing.erase_end   = ( data_addr + p_head->data.image_size );
+
+            #if ( 0 == BOOT_CFG_FLASH_ERASE_AHEAD_EN )
+                msg_status = boot_flash_erase_to( g_boot_flashing.erase_end );
+            #endif
+        }
+
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            // Prepare flashing data
+            g_boot_flashing.fw_size         = ( p_head->data.image_size );
+            g_boot_flashing.working_addr    = ( data_addr + ofs );
+            g_boot_flashing.received_bytes  = ofs;
+            g_boot_flashing.flashed_bytes   = ofs;
+            g_boot_flashing.seq_next        = 0U;
+            g_boot_flashing.seq_ack         = 0U;
+
+            // Coalesced data not yet written is sent again
+            #if ( 1 == BOOT_FLASH_STAGE_EN )
+                g_boot_flash_stage.size     = 0U;
+            #endif
+
+            // Rebuild running digest of already flashed part
+            g_boot_flashing.digest.type     = (( eVER_SIG_TYPE_ECSDA == p_head->data.sig_type ) ? BOOT_DIGEST_SHA256 : BOOT_DIGEST_CRC32 );
+            g_boot_flashing.digest.crc32    = boot_crc32_init();
+            cf_sha256_init( &g_boot_flashing.digest.sha_ctx );
+
+            if ( eBOOT_OK != boot_image_read( data_addr, ofs, boot_image_digest_cb, (void*) &g_boot_flashing.digest ))
+            {
+                msg_status = eBOOT_MSG_ERROR_VALIDATION;
+            }
+        }
+
+        return msg_status;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Begin or resume flashing of new image
+*
+* @note     Without resume support or without matching checkpoint flashing
+*           begins from start of image.
+*
+* @param[in]    p_head      - Image (app) header, shall be pre-validated
+* @param[out]   p_ofs       - Image offset Boot Manager shall continue from
+* @return       msg_status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_flash_prepare_resume(const ver_image_header_t * const p_head, uint32_t * const p_ofs)
+{
+    boot_msg_status_t   msg_status  = eBOOT_MSG_OK;
+    uint32_t            ofs         = 0U;
+
+    #if ( 1 == BOOT_CFG_RESUME_EN )
+        ofs = boot_resume_ofs_get( p_head );
+
+        if ( ofs > 0U )
+        {
+            msg_status = boot_flash_resume( p_head, ofs );
+
+            // Restart from scratch
+            if ( eBOOT_MSG_OK != msg_status )
+            {
+                ofs = 0U;
+
+                #if ( 1 == BOOT_CFG_CRYPTION_EN )
+                    boot_if_decrypt_reset();
+                #endif
+            }
+            else
+            {
+                BOOT_DBG_PRINT( "Resuming upgrade at %d bytes", ofs );
+            }
+        }
+
+        if ( 0U == ofs )
+    #endif
+        {
+            msg_status = boot_flash_start( p_head );
+        }
+
+    *p_ofs = ofs;
+
+    return msg_status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Accept next block of (decrypted) image for flashing
+*
+* @note     Block is added to running image digest, so that image does not
+*           need to be read back at the end of flashing.
+*
+* @param[in]    p_data      - Plain image data
+* @param[in]    size        - Size of data in bytes
+* @return       msg_status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_flash_accept(const uint8_t * const p_data, const uint32_t size)
+{
+    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+    // More data than announced
+    if (( g_boot_flashing.received_bytes + size ) > g_boot_flashing.fw_size )
+    {
+        msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+    }
+
+    // Data of kept sector shall not be sent
+    #if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+        else if ( true == boot_flash_skip_overlap( g_boot_flashing.working_addr, size ))
+        {
+            msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+        }
+    #endif
+
+    else
+    {
+        // Update running digest
+        BOOT_STATS_START( hash_ts );
+        boot_image_digest_cb( p_data, size, (void*) &g_boot_flashing.digest );
+        BOOT_STATS_STOP( hash_ts, hash_us );
+
+        // Increment received bytes
+        g_boot_flashing.received_bytes += size;
+
+        // Account kept sectors following block
+        #if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+            msg_status = boot_flash_skip_digest( g_boot_flashing.working_addr + size );
+        #endif
+    }
+
+    return msg_status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Commit flashed block of image
+*
+* @note     Called after block has been written to flash. Enters EXIT state
+*           when complete image is flashed.
+*
+* @param[in]    addr        - Flash address of block
+* @param[in]    p_data      - Written (plain) data
+* @param[in]    size        - Size of data in bytes
+* @return       msg_status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_flash_commit(const uint32_t addr, const uint8_t * const p_data, const uint32_t size)
+{
+    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+    // Read back and compare written data
+    #if ( 1 == BOOT_CFG_FLASH_READBACK_EN )
+        boot_readback_t readback = { .p_expected = p_data, .ofs = 0U, .match = true };
+
+        if  (   ( eBOOT_OK != boot_image_read( addr, size, boot_flash_readback_cb, (void*) &readback ))
+            ||  ( false == readback.match ))
+        {
+            msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+            BOOT_DBG_PRINT( "ERROR: Flash read-back mismatch at 0x%08X!", addr );
+        }
+    #else
+        // Unused
+        (void) addr;
+        (void) p_data;
+    #endif
+
+    if ( eBOOT_MSG_OK == msg_status )
+    {
+        // Kept sectors following block count as flashed
+        #if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+            const uint32_t done = ( size + boot_flash_skip_size( addr + size ));
+        #else
+            const uint32_t done = size;
+        #endif
+
+        // Increment flashed bytes
+        g_boot_flashing.flashed_bytes += done;
+        BOOT_STATS_ADD( programmed, size );
+
+        // Complete FW image flashed
+        if ( g_boot_flashing.flashed_bytes == g_boot_flashing.fw_size )
+        {
+            // Image flashed completely -> enter EXIT state
+            // NOTE: Container enters EXIT state once all sub-images are received!
+            if ( false == g_boot_flashing.is_multi )
+            {
+                fsm_goto_state( g_boot_fsm, eBOOT_STATE_EXIT );
+            }
+        }
+
+        // Store progress checkpoint each "BOOT_CFG_RESUME_PERIOD" bytes
+        #if ( 1 == BOOT_CFG_RESUME_EN )
+            else if (( g_boot_flashing.flashed_bytes / BOOT_CFG_RESUME_PERIOD ) != (( g_boot_flashing.flashed_bytes - done ) / BOOT_CFG_RESUME_PERIOD ))
+            {
+                boot_resume_save();
+            }
+        #endif
+    }
+
+    return msg_status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Finish flashing and validate new image
+*
+* @note     Validation is based on running digest calculated while flashing,
+*           only image header is read back from flash.
+*
+* @note     Container manifest and each of its sub-images are validated
+*           while received, application sub-image is checked by its CRC.
+*
+* @return       status - Status of validation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_flash_finish(void)
+{
+            boot_status_t       status      = eBOOT_OK;
+    static  ver_image_header_t  app_header  = {0};
+
+    // Complete image must be flashed
+    if ( g_boot_flashing.flashed_bytes != g_boot_flashing.fw_size )
+    {
+        status = eBOOT_ERROR;
+    }
+
+    // Commit image to slot by writing its header
+    #if (( 1 == BOOT_CFG_AB_SLOT_EN ) || ( 1 == BOOT_CFG_RESUME_EN ))
+        else if ( eBOOT_OK != boot_if_flash_write( g_boot_slot[ g_boot_slot_target ].head_addr, sizeof( ver_image_header_t ), (const uint8_t*) &g_boot_flashing.head ))
+        {
+            status = eBOOT_ERROR;
+            BOOT_DBG_PRINT( "POST-VALIDATION ERROR: Application header write failed!" );
+        }
+    #endif
+
+    // Read back application header and compare with received one
+    else if (   ( eBOOT_OK != boot_app_head_read( g_boot_slot_target, (ver_image_header_t*) &app_header ))
+            ||  ( 0 != memcmp( &app_header, &g_boot_flashing.head, sizeof( ver_image_header_t ))))
+    {
+        status = eBOOT_ERROR;
+        BOOT_DBG_PRINT( "POST-VALIDATION ERROR: Application header corrupted!" );
+    }
+
+    // Application of container covered by container signature
+    #if ( 1 == BOOT_CFG_MULTI_EN )
+        else if ( true == g_boot_flashing.is_multi )
+        {
+            status = boot_fw_image_check_crc((const ver_image_header_t*) &app_header, &g_boot_flashing.digest );
+        }
+    #endif
+
+    // Check running digest
+    else
+    {
+        BOOT_STATS_START( verify_ts );
+        status = boot_fw_image_check_digest((ver_image_header_t*) &app_header, &g_boot_flashing.digest );
+        BOOT_STATS_STOP( verify_ts, verify_us );
+    }
+
+    // Image complete or corrupted, progress no longer needed
+    #if ( 1 == BOOT_CFG_RESUME_EN )
+        (void) boot_resume_invalidate();
+    #endif
+
+    if ( eBOOT_OK == status )
+    {
+        BOOT_DBG_PRINT( "Firmware image validated OK!" );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Flash received image data
+*
+* @note     Common part of flash data and sequenced flash data commands.
+*           Any error aborts upgrade process!
+*
+* @note     With asynchronous flash writes data is only queued into write
+*           pipeline and response is sent once it is written to flash.
+*           When pipeline is full, function waits for the oldest write.
+*
+* @param[in]    p_data      - Received (encrypted) image data
+* @param[in]    size        - Size of data in bytes
+* @param[in]    is_seq      - Sequenced flash data frame
+* @param[in]    seq         - Sequence number of frame
+* @return       msg_status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_msg_status_t boot_flash_data(const uint8_t * const p_data, const uint16_t size, const bool is_seq, const uint16_t seq)
+{
+    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+    BOOT_ASSERT( size <= BOOT_CFG_DATA_PAYLOAD_SIZE );
+
+    // In FLASHING state
+    if  (   ( eBOOT_STATE_FLASH == boot_get_state())
+        &&  ( size <= g_boot_payload_size ))
+    {
+        // All data has been received
+        if ( false == boot_flash_is_received())
+        {
+            // Plain image
+            if ( true == boot_flash_is_plain())
+            {
+            #if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+
+                // Pipeline full -> wait for the oldest write
+                while (( BOOT_CFG_FLASH_PIPE_DEPTH == g_boot_flash_pipe.num_of ) && ( eBOOT_STATE_FLASH == boot_get_state()))
+                {
+                    boot_flash_pipe_hndl();
+                    boot_if_kick_wdt();
+                }
+
+                // Write failed while waiting -> session already aborted
+                if ( eBOOT_STATE_FLASH != boot_get_state())
+                {
+                    msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+                }
+                else
+                {
+                    // Free slot
+                    boot_flash_slot_t * p_slot = &g_boot_flash_pipe.slot[(( g_boot_flash_pipe.head + g_boot_flash_pipe.num_of ) % BOOT_CFG_FLASH_PIPE_DEPTH )];
+
+                    #if ( 1 == BOOT_CFG_CRYPTION_EN )
+                        // Decrypt data directly to pipeline slot
+                        BOOT_STATS_START( decrypt_ts );
+                        boot_if_decrypt_data( p_data, (uint8_t*) &p_slot->data, size );
+                        BOOT_STATS_STOP( decrypt_ts, decrypt_us );
+                    #else
+                        memcpy( &p_slot->data, p_data, size );
+                    #endif
+
+                    msg_status = boot_flash_accept((const uint8_t*) &p_slot->data, size );
+
+                    // Queue write
+                    if ( eBOOT_MSG_OK == msg_status )
+                    {
+                        p_slot->addr    = g_boot_flashing.working_addr;
+                        p_slot->size    = size;
+                        p_slot->seq     = seq;
+                        p_slot->is_seq  = is_seq;
+
+                        g_boot_flashing.working_addr += size;
+                        g_boot_flash_pipe.num_of++;
+
+                        // Skip kept sectors
+                        #if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+                            g_boot_flashing.working_addr += boot_flash_skip_size( g_boot_flashing.working_addr );
+                        #endif
+
+                        // Start programming right away if flash is idle
+                        boot_flash_pipe_hndl();
+                    }
+                }
+
+            #else
+
+                // Unused
+                (void) is_seq;
+                (void) seq;
+
+                // Decrypt and write to flash
+                msg_status = boot_flash_write_plain( boot_flash_decrypt( p_data, size ), size );
+
+            #endif
+            }
+
+            // Decompress and/or apply patch
+            #if ( 1 == BOOT_FLASH_STAGE_EN )
+                else
+                {
+                    msg_status = boot_flash_staged( p_data, size );
+                }
+            #endif
+        }
+
+        // Shall not ended up here as compete firmware are flashed
+        else
+        {
+            msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+        }
+    }
+
+    // Not in FLASH state
+    else
+    {
+        msg_status = eBOOT_MSG_ERROR_INVALID_REQ;
+    }
+
+    if ( eBOOT_MSG_OK != msg_status )
+    {
+        boot_flash_abort();
+    }
+
+    return msg_status;
+}
+
+#if (( 0 == BOOT_CFG_FLASH_ASYNC_EN ) || ( 1 == BOOT_FLASH_STAGE_EN ) || ( 1 == BOOT_CFG_EXT_FLASH_EN ))
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Decrypt received flash data
+    *
+    * @note     Returned data is valid until next call or until next frame is
+    *           parsed (in-place decryption).
+    *
+    * @param[in]    p_data      - Received flash data
+    * @param[in]    size        - Size of data in bytes
+    * @return       p_plain     - Decrypted (plain) data
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static const uint8_t * boot_flash_decrypt(const uint8_t * const p_data, const uint16_t size)
+    {
+        #if (( 1 == BOOT_CFG_CRYPTION_EN ) && ( 1 == BOOT_CFG_DECRYPT_IN_PLACE_EN ))
+
+            // Decrypt data in place
+            // NOTE: Data are located in reception buffer, which is not used until next frame is parsed!
+            uint8_t * const p_plain = (uint8_t*) p_data;
+
+            BOOT_STATS_START( decrypt_ts );
+            boot_if_decrypt_data( p_plain, p_plain, size );
+            BOOT_STATS_STOP( decrypt_ts, decrypt_us );
+
+        #elif ( 1 == BOOT_CFG_CRYPTION_EN )
+            static uint8_t decrypted_data[BOOT_CFG_DATA_PAYLOAD_SIZE] = {0};
+
+            // Decrypt data
+            BOOT_STATS_START( decrypt_ts );
+            boot_if_decrypt_data( p_data, (uint8_t*) &decrypted_data, size );
+            BOOT_STATS_STOP( decrypt_ts, decrypt_us );
+
+            const uint8_t * const p_plain = (const uint8_t*) &decrypted_data;
+        #else
+            const uint8_t * const p_plain = p_data;
+
+            // Unused
+            (void) size;
+        #endif
+
+        return p_plain;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Write block of plain image to flash
+    *
+    * @param[in]    p_plain     - Plain image data
+    * @param[in]    size        - Size of data in bytes
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_flash_write_block(const uint8_t * const p_plain, const uint32_t size)
+    {
+        boot_msg_status_t msg_status = boot_flash_accept( p_plain, size );
+
+        // Make sure space is erased
+        #if (( 1 == BOOT_CFG_FLASH_ERASE_AHEAD_EN ) || ( 1 == BOOT_CFG_MULTI_EN ))
+            if ( eBOOT_MSG_OK == msg_status )
+            {
+                msg_status = boot_flash_erase_to( g_boot_flashing.working_addr + size );
+            }
+        #endif
+
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            // Flash data
+            BOOT_STATS_START( program_ts );
+            const boot_status_t write_status = boot_if_flash_write( g_boot_flashing.working_addr, size, p_plain );
+            BOOT_STATS_STOP( program_ts, program_us );
+
+            if ( eBOOT_OK == write_status )
+            {
+                msg_status = boot_flash_commit( g_boot_flashing.working_addr, p_plain, size );
+
+                // Increment working address
+                g_boot_flashing.working_addr += size;
+
+                // Skip kept sectors
+                #if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+                    g_boot_flashing.working_addr += boot_flash_skip_size( g_boot_flashing.working_addr );
+                #endif
+            }
+            else
+            {
+                msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+            }
+        }
+
+        return msg_status;
+    }
+
+#endif
+
+#if (( 0 == BOOT_CFG_FLASH_ASYNC_EN ) || ( 1 == BOOT_CFG_EXT_FLASH_EN ))
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Write received part of plain image to flash
+    *
+    * @note     With write coalescing data is collected in stage buffer and
+    *           complete program units are written at once, in single write.
+    *           Incomplete program unit waits in stage buffer for next frame,
+    *           thus it is written after response to its frame is sent. Last
+    *           block is written as soon as complete image is received.
+    *
+    * @param[in]    p_plain     - Plain image data
+    * @param[in]    size        - Size of data in bytes
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_flash_write_plain(const uint8_t * const p_plain, const uint32_t size)
+    {
+        boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+        #if ( 1 == BOOT_CFG_FLASH_COALESCE_EN )
+
+            // Collect data, full blocks are written right away
+            (void) boot_flash_stage_out_cb( p_plain, size, (void*) &msg_status );
+
+            // Write complete program units, keep incomplete one
+            const uint32_t tail = (( g_boot_flashing.working_addr + g_boot_flash_stage.size ) % BOOT_CFG_FLASH_PROGRAM_SIZE );
+
+            if  (   ( eBOOT_MSG_OK == msg_status )
+                &&  ( g_boot_flash_stage.size > tail ))
+            {
+                const uint32_t aligned_size = ( g_boot_flash_stage.size - tail );
+
+                msg_status = boot_flash_write_block((const uint8_t*) &g_boot_flash_stage.data, aligned_size );
+
+                memmove( &g_boot_flash_stage.data, &g_boot_flash_stage.data[ aligned_size ], tail );
+                g_boot_flash_stage.size = tail;
+            }
+
+        #else
+            msg_status = boot_flash_write_block( p_plain, size );
+        #endif
+
+        return msg_status;
+    }
+
+#endif
+
+#if ((( 1 == BOOT_CFG_DELTA_EN ) && ( 0 == BOOT_CFG_AB_SLOT_EN )) || ( 1 == BOOT_CFG_MULTI_EN ))
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Erase flash sectors covering address range
+    *
+    * @param[in]    addr        - Start address
+    * @param[in]    size        - Size of range in bytes
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_flash_erase_range(const uint32_t addr, const uint32_t size)
+    {
+        boot_msg_status_t   msg_status      = eBOOT_MSG_OK;
+        uint32_t            addr_work       = addr;
+        uint32_t            sector_start    = 0U;
+        uint32_t            sector_size     = 0U;
+
+        BOOT_STATS_START( erase_ts );
+
+        while ( addr_work < ( addr + size ))
+        {
+            if  (   ( eBOOT_OK != boot_flash_sector_get( addr_work, &sector_start, &sector_size ))
+                ||  ( eBOOT_OK != boot_if_flash_erase( sector_start, sector_size )))
+            {
+                msg_status = eBOOT_MSG_ERROR_FLASH_ERASE;
+                break;
+            }
+
+            addr_work = ( sector_start + sector_size );
+
+            // Process WDT in between
+            boot_if_kick_wdt();
+        }
+
+        BOOT_STATS_STOP( erase_ts, erase_us );
+
+        return msg_status;
+    }
+
+#endif
+
+#if (( 1 == BOOT_CFG_DELTA_EN ) && ( 0 == BOOT_CFG_AB_SLOT_EN ))
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Base image copy read block callback
+    *
+    * @param[in]    p_data  - Read block of installed image
+    * @param[in]    size    - Size of block in bytes
+    * @param[in]    p_ctx   - Copy context
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_delta_base_copy_cb(const uint8_t * const p_data, const uint32_t size, void * const p_ctx)
+    {
+        boot_delta_base_copy_t * const p_copy = (boot_delta_base_copy_t*) p_ctx;
+
+        // NOTE: Block can be complete image when flash is memory mapped!
+        for ( uint32_t ofs = 0U; ( ofs < size ) && ( eBOOT_OK == p_copy->status ); ofs += BOOT_CFG_VALIDATE_CHUNK_SIZE )
+        {
+            const uint32_t block_size = ((( size - ofs ) > BOOT_CFG_VALIDATE_CHUNK_SIZE ) ? BOOT_CFG_VALIDATE_CHUNK_SIZE : ( size - ofs ));
+
+            p_copy->status  = boot_if_flash_write( p_copy->addr, block_size, &p_data[ofs] );
+            p_copy->addr   += block_size;
+
+            // Process WDT in between
+            boot_if_kick_wdt();
+        }
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_DELTA_EN )
+
+#if ( 1 == BOOT_CFG_AB_SLOT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Prepare base image for delta patching
+    *
+    * @note     With A/B slots installed application stays intact in active
+    *           slot while other slot is written, thus it is used as base
+    *           directly.
+    *
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_delta_base_prepare(void)
+    {
+                boot_msg_status_t   msg_status                  = eBOOT_MSG_OK;
+        static  ver_image_header_t  base_head                   = {0};
+                cf_sha256_context   sha_ctx                     = {0};
+                uint8_t             base_hash[CF_SHA256_HASHSZ] = {0};
+
+        // No image to patch
+        if  (   ( g_boot_slot_active == g_boot_slot_target )
+            ||  ( eBOOT_OK != boot_app_head_read( g_boot_slot_active, &base_head )))
+        {
+            msg_status = eBOOT_MSG_ERROR_VALIDATION;
+            BOOT_DBG_PRINT( "DELTA ERROR: No base image!" );
+        }
+        else
+        {
+            // Base is identified by hash of its header
+            cf_sha256_init( &sha_ctx );
+            cf_sha256_update( &sha_ctx, (const uint8_t*) &base_head, sizeof( ver_image_header_t ));
+            cf_sha256_digest_final( &sha_ctx, base_hash );
+
+            boot_delta_init( BOOT_APP_ADDR_START( g_boot_slot_active ), base_head.data.image_size, (const uint8_t*) &base_hash );
+        }
+
+        return msg_status;
+    }
+
+#else
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Prepare base image for delta patching
+    *
+    * @note     Installed application is copied to "BOOT_CFG_DELTA_BASE_ADDR",
+    *           as application region gets overwritten while patching. Copy is
+    *           skipped when base region already holds installed application,
+    *           or when application was already erased by previous (aborted)
+    *           delta upgrade. Header is copied last, thus interrupted copy is
+    *           never used as base.
+    *
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_delta_base_prepare(void)
+    {
+                boot_msg_status_t       msg_status                  = eBOOT_MSG_OK;
+        static  ver_image_header_t      app_head                    = {0};
+        static  ver_image_header_t      base_head                   = {0};
+                boot_delta_base_copy_t  copy                        = { .addr = ( BOOT_CFG_DELTA_BASE_ADDR + sizeof( ver_image_header_t )), .status = eBOOT_OK };
+                cf_sha256_context       sha_ctx                     = {0};
+                uint8_t                 base_hash[CF_SHA256_HASHSZ] = {0};
+
+        const bool app_valid    = ( eBOOT_OK == boot_app_head_read( BOOT_SLOT_A, &app_head ));
+        const bool base_valid   = (     ( eBOOT_OK == boot_if_flash_read( BOOT_CFG_DELTA_BASE_ADDR, sizeof( ver_image_header_t ), (uint8_t*) &base_head ))
+                                    &&  ( eBOOT_OK == boot_app_header_check( &base_head )));
+
+        // Installed application not yet in base region
+        if  (   ( true == app_valid )
+            &&  (   ( false == base_valid )
+                ||  ( 0 != memcmp( &app_head, &base_head, sizeof( ver_image_header_t )))))
+        {
+            msg_status = boot_flash_erase_range( BOOT_CFG_DELTA_BASE_ADDR, ( sizeof( ver_image_header_t ) + app_head.data.image_size ));
+
+            if ( eBOOT_MSG_OK == msg_status )
+            {
+                // Copy image, header at the end
+                if  (   ( eBOOT_OK != boot_image_read( BOOT_APP_ADDR_START( BOOT_SLOT_A ), app_head.data.image_size, boot_delta_base_copy_cb, (void*) &copy ))
+                    ||  ( eBOOT_OK != copy.status )
+                    ||  ( eBOOT_OK != boot_if_flash_write( BOOT_CFG_DELTA_BASE_ADDR, sizeof( ver_image_header_t ), (const uint8_t*) &app_head )))
+                {
+                    msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+                }
+                else
+                {
+                    memcpy( &base_head, &app_head, sizeof( ver_image_header_t ));
+                }
+            }
+        }
+
+        // No image to patch
+        else if ( false == base_valid )
+        {
+            msg_status = eBOOT_MSG_ERROR_VALIDATION;
+            BOOT_DBG_PRINT( "DELTA ERROR: No base image!" );
+        }
+
+        else
+        {
+            // Base ready...
+        }
+
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            // Base is identified by hash of its header
+            cf_sha256_init( &sha_ctx );
+            cf_sha256_update( &sha_ctx, (const uint8_t*) &base_head, sizeof( ver_image_header_t ));
+            cf_sha256_digest_final( &sha_ctx, base_hash );
+
+            boot_delta_init(( BOOT_CFG_DELTA_BASE_ADDR + sizeof( ver_image_header_t )), base_head.data.image_size, (const uint8_t*) &base_hash );
+        }
+
+        return msg_status;
+    }
+
+#endif
+
+#endif
+
+#if ( 1 == BOOT_FLASH_STAGE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get capacity of stage buffer block starting at address
+    *
+    * @note     Block ends at program unit boundary, thus only first block
+    *           of unaligned start address is shorter than stage buffer.
+    *
+    * @param[in]    addr        - Flash address of block
+    * @return       capacity    - Size of block in bytes
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t boot_flash_stage_capacity(const uint32_t addr)
+    {
+        return ( BOOT_CFG_DATA_PAYLOAD_SIZE - ( addr % BOOT_CFG_FLASH_PROGRAM_SIZE ));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check if staged image block shall be written to flash
+    *
+    * @note     Block is written when full, when complete image is decoded
+    *           or when it ends at kept sectors.
+    *
+    * @return       is_full - True if block shall be written
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool boot_flash_stage_is_full(void)
+    {
+        bool is_full = false;
+
+        if  (   ( boot_flash_stage_capacity( g_boot_flashing.working_addr ) == g_boot_flash_stage.size )
+            ||  (( g_boot_flashing.received_bytes + g_boot_flash_stage.size ) == g_boot_flashing.fw_size ))
+        {
+            is_full = true;
+        }
+
+        // Kept sectors start at program unit boundary
+        #if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+            else if (   ( 0U == (( g_boot_flashing.working_addr + g_boot_flash_stage.size ) % BOOT_CFG_FLASH_PROGRAM_SIZE ))
+                    &&  ( boot_flash_skip_size( g_boot_flashing.working_addr + g_boot_flash_stage.size ) > 0U ))
+            {
+                is_full = true;
+            }
+        #endif
+
+        else
+        {
+            // No actions...
+        }
+
+        return is_full;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Decoded image output callback
+    *
+    * @note     Decoded (or coalesced plain) data is collected into staging
+    *           buffer and written to flash in program unit aligned blocks
+    *           of up to flash data payload size.
+    *
+    * @param[in]    p_data  - Decoded (plain image) data
+    * @param[in]    size    - Size of data in bytes
+    * @param[in]    p_ctx   - Message status of flashing
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_flash_stage_out_cb(const uint8_t * const p_data, const uint32_t size, void * const p_ctx)
+    {
+        boot_status_t               status          = eBOOT_OK;
+        boot_msg_status_t * const   p_msg_status    = (boot_msg_status_t*) p_ctx;
+        uint32_t                    i               = 0U;
+
+        // More data than announced
+        if (( g_boot_flashing.received_bytes + g_boot_flash_stage.size + size ) > g_boot_flashing.fw_size )
+        {
+            *p_msg_status   = eBOOT_MSG_ERROR_FLASH_WRITE;
+            status          = eBOOT_ERROR;
+        }
+
+        while (( i < size ) && ( eBOOT_OK == status ))
+        {
+            const uint32_t space        = ( boot_flash_stage_capacity( g_boot_flashing.working_addr ) - g_boot_flash_stage.size );
+            const uint32_t block_size   = ((( size - i ) > space ) ? space : ( size - i ));
+
+            memcpy( &g_boot_flash_stage.data[ g_boot_flash_stage.size ], &p_data[i], block_size );
+
+            g_boot_flash_stage.size += block_size;
+            i                       += block_size;
+
+            if ( true == boot_flash_stage_is_full())
+            {
+                *p_msg_status = boot_flash_write_block((const uint8_t*) &g_boot_flash_stage.data, g_boot_flash_stage.size );
+
+                g_boot_flash_stage.size = 0U;
+
+                if ( eBOOT_MSG_OK != *p_msg_status )
+                {
+                    status = eBOOT_ERROR;
+                }
+
+                // Process WDT in between
+                boot_if_kick_wdt();
+            }
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Decompressed data output callback
+    *
+    * @note     Decompressed data is either patch or plain image.
+    *
+    * @param[in]    p_data  - Decompressed data
+    * @param[in]    size    - Size of data in bytes
+    * @param[in]    p_ctx   - Message status of flashing
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_flash_plain_out_cb(const uint8_t * const p_data, const uint32_t size, void * const p_ctx)
+    {
+        boot_status_t status = eBOOT_OK;
+
+        #if ( 1 == BOOT_CFG_DELTA_EN )
+            if ( true == g_boot_flashing.is_delta )
+            {
+                status = boot_delta_apply( p_data, size, boot_flash_stage_out_cb, p_ctx );
+            }
+            else
+        #endif
+            {
+                status = boot_flash_stage_out_cb( p_data, size, p_ctx );
+            }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Decode received part of compressed image, patch or container
+    *
+    * @note     Pipeline: decrypt -> decompress -> apply patch -> flash.
+    *           Container is split into sub-images right after decryption.
+    *
+    * @param[in]    p_data      - Received (crypted) data
+    * @param[in]    size        - Size of data in bytes
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_flash_staged(const uint8_t * const p_data, const uint16_t size)
+    {
+        boot_msg_status_t   msg_status  = eBOOT_MSG_OK;
+        boot_status_t       status      = eBOOT_OK;
+        const uint8_t *     p_plain     = boot_flash_decrypt( p_data, size );
+
+        #if ( 1 == BOOT_CFG_MULTI_EN )
+            if ( true == g_boot_flashing.is_multi )
+            {
+                msg_status = boot_multi_data( p_plain, size );
+            }
+            else
+        #endif
+        #if ( 1 == BOOT_CFG_COMP_EN )
+            if ( true == g_boot_flashing.is_comp )
+            {
+                status = boot_comp_apply( p_plain, size, boot_flash_plain_out_cb, (void*) &msg_status );
+            }
+            else
+        #endif
+            {
+                status = boot_flash_plain_out_cb( p_plain, size, (void*) &msg_status );
+            }
+
+        // Malformed stream or patch for other image
+        if  (   ( eBOOT_OK != status )
+            &&  ( eBOOT_MSG_OK == msg_status ))
+        {
+            msg_status = eBOOT_MSG_ERROR_VALIDATION;
+        }
+
+        return msg_status;
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_MULTI_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Pre-validate multi-image container
+    *
+    * @note     Container header shall already be checked, signature is
+    *           checked by caller. Application sub-image is pre-validated
+    *           once its header is received.
+    *
+    * @param[in]    p_head      - Container header
+    * @return       msg_status  - Status of validation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_multi_pre_validate(const ver_image_header_t * const p_head)
+    {
+        boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+        // Check for HW version compatibility
+        msg_status |= boot_hw_ver_check( p_head->data.hw_ver );
+
+        // Container holds at least manifest, it is never compressed
+        if  (   ( p_head->data.image_size <= sizeof( boot_multi_manifest_t ))
+            ||  ( BOOT_COMP_TYPE_NONE != BOOT_IMAGE_COMP_TYPE( p_head )))
+        {
+            msg_status = eBOOT_MSG_ERROR_VALIDATION;
+        }
+
+        // Select slot application sub-image is written to
+        #if ( 1 == BOOT_CFG_AB_SLOT_EN )
+            (void) boot_slot_select();
+        #endif
+
+        return msg_status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Begin reception of multi-image container
+    *
+    * @note     Only sector(s) holding application header are erased, as size
+    *           of application sub-image is not known until its header is
+    *           received. Rest of application space is erased while flashing.
+    *
+    * @param[in]    p_head      - Container header, shall be pre-validated
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_multi_begin(const ver_image_header_t * const p_head)
+    {
+                boot_msg_status_t   msg_status  = eBOOT_MSG_OK;
+        const   uint32_t            head_addr   = g_boot_slot[ g_boot_slot_target ].head_addr;
+
+        memset( &g_boot_multi, 0U, sizeof( g_boot_multi ));
+        memcpy( &g_boot_multi.head, p_head, sizeof( ver_image_header_t ));
+
+        g_boot_flashing.is_multi    = true;
+        g_boot_flashing.is_delta    = false;
+        g_boot_flashing.is_comp     = false;
+        g_boot_flash_stage.size     = 0U;
+
+        // Invalidate installed application
+        g_boot_flashing.erased_addr = head_addr;
+        g_boot_flashing.erase_end   = ( head_addr + sizeof( ver_image_header_t ));
+
+        msg_status = boot_flash_erase_to( g_boot_flashing.erase_end );
+
+        // Old validation verdict no longer applies
+        #if ( 1 == BOOT_CFG_VALID_CACHE_EN )
+            if  (   ( eBOOT_MSG_OK == msg_status )
+                &&  ( eBOOT_OK != boot_valid_cache_invalidate()))
+            {
+                msg_status = eBOOT_MSG_ERROR_FLASH_ERASE;
+            }
+        #endif
+
+        // Progress of previous upgrade no longer applies
+        #if ( 1 == BOOT_CFG_RESUME_EN )
+            if  (   ( eBOOT_MSG_OK == msg_status )
+                &&  ( eBOOT_OK != boot_resume_invalidate()))
+            {
+                msg_status = eBOOT_MSG_ERROR_FLASH_ERASE;
+            }
+        #endif
+
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            // Nothing of application received yet
+            g_boot_flashing.fw_size         = 0U;
+            g_boot_flashing.working_addr    = ( head_addr + sizeof( ver_image_header_t ));
+            g_boot_flashing.received_bytes  = 0U;
+            g_boot_flashing.flashed_bytes   = 0U;
+            g_boot_flashing.seq_next        = 0U;
+            g_boot_flashing.seq_ack         = 0U;
+
+            // Prepare running digest of manifest
+            g_boot_multi.digest.type        = (( eVER_SIG_TYPE_ECSDA == p_head->data.sig_type ) ? BOOT_DIGEST_SHA256 : BOOT_DIGEST_CRC32 );
+            g_boot_multi.digest.crc32       = boot_crc32_init();
+            cf_sha256_init( &g_boot_multi.digest.sha_ctx );
+        }
+
+        return msg_status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check received manifest of container
+    *
+    * @note     Manifest is authenticated against container header, so that
+    *           sub-image hashes can be trusted. Sub-images shall add up to
+    *           container size and exactly one of them shall be application.
+    *
+    * @return       msg_status  - Status of validation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_multi_manifest_check(void)
+    {
+                boot_msg_status_t               msg_status  = eBOOT_MSG_OK;
+        const   boot_multi_manifest_t * const   p_manifest  = &g_boot_multi.manifest;
+                uint32_t                        size        = sizeof( boot_multi_manifest_t );
+                uint32_t                        app_num_of  = 0U;
+
+        // Signature of manifest hash already verified at pre-validation
+        if ( eBOOT_OK != boot_fw_image_check_digest((const ver_image_header_t*) &g_boot_multi.head, &g_boot_multi.digest ))
+        {
+            msg_status = eBOOT_MSG_ERROR_SIGNATURE;
+        }
+        else if (   ( BOOT_MULTI_MAGIC != p_manifest->magic )
+                ||  ( 0U == p_manifest->num_of )
+                ||  ( p_manifest->num_of > BOOT_MULTI_ENTRY_MAX ))
+        {
+            msg_status = eBOOT_MSG_ERROR_VALIDATION;
+        }
+        else
+        {
+            // No actions...
+        }
+
+        for ( uint32_t i = 0U; ( i < p_manifest->num_of ) && ( eBOOT_MSG_OK == msg_status ); i++ )
+        {
+            const boot_multi_entry_t * const p_entry = &p_manifest->entry[i];
+
+            // Sub-image shall fit into container
+            if  (   ( 0U == p_entry->size )
+                ||  ( p_entry->size > ( g_boot_multi.head.data.image_size - size )))
+            {
+                msg_status = eBOOT_MSG_ERROR_VALIDATION;
+            }
+
+            // Application size is checked against its header
+            else if ( BOOT_MULTI_TYPE_APP == p_entry->type )
+            {
+                app_num_of++;
+            }
+
+            else if (   ( BOOT_MULTI_TYPE_DATA == p_entry->type )
+                    &&  ( false == boot_multi_region_is_valid( p_entry )))
+            {
+                msg_status = eBOOT_MSG_ERROR_VALIDATION;
+
+                BOOT_DBG_PRINT( "ERROR: Sub-image %d outside of data regions!", i );
+            }
+
+            else if (   ( BOOT_MULTI_TYPE_DATA != p_entry->type )
+                    &&  ( BOOT_MULTI_TYPE_FORWARD != p_entry->type ))
+            {
+                msg_status = eBOOT_MSG_ERROR_VALIDATION;
+            }
+
+            else
+            {
+                // No actions...
+            }
+
+            size += p_entry->size;
+        }
+
+        if  (   ( eBOOT_MSG_OK == msg_status )
+            &&  (   ( size != g_boot_multi.head.data.image_size )
+                ||  ( 1U != app_num_of )))
+        {
+            msg_status = eBOOT_MSG_ERROR_VALIDATION;
+        }
+
+        return msg_status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check if data sub-image lies within one of data regions
+    *
+    * @param[in]    p_entry     - Manifest entry of data sub-image
+    * @return       is_valid    - True if sub-image can be written
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool boot_multi_region_is_valid(const boot_multi_entry_t * const p_entry)
+    {
+        bool is_valid = false;
+
+        for ( uint32_t i = 0U; i < BOOT_MULTI_REGION_NUM_OF; i++ )
+        {
+            const boot_data_region_t * const p_region = &g_boot_multi_region[i];
+
+            if  (   ( p_entry->addr >= p_region->addr )
+                &&  (( p_entry->addr - p_region->addr ) < p_region->size )
+                &&  ( p_entry->size <= ( p_region->size - ( p_entry->addr - p_region->addr ))))
+            {
+                is_valid = true;
+                break;
+            }
+        }
+
+        // Written in flash write units
+        if ( 0U != ( p_entry->addr % BOOT_CFG_FLASH_WRITE_SIZE ))
+        {
+            is_valid = false;
+        }
+
+        return is_valid;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Select current sub-image of container
+    *
+    * @param[in]    idx     - Index of sub-image within manifest
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_multi_entry_select(const uint8_t idx)
+    {
+        g_boot_multi.idx    = idx;
+        g_boot_multi.ofs    = 0U;
+
+        cf_sha256_init( &g_boot_multi.sha_ctx );
+
+        if ( idx < g_boot_multi.manifest.num_of )
+        {
+            g_boot_multi.write_addr     = g_boot_multi.manifest.entry[idx].addr;
+            g_boot_multi.erased_addr    = g_boot_multi.manifest.entry[idx].addr;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Begin flashing of application sub-image
+    *
+    * @note     Application is validated as ordinary image, except for its
+    *           signature, as it is covered by container. Running digest of
+    *           application is its CRC only.
+    *
+    * @param[in]    p_entry     - Manifest entry of application
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_multi_app_begin(const boot_multi_entry_t * const p_entry)
+    {
+                boot_msg_status_t           msg_status  = eBOOT_MSG_OK;
+        const   ver_image_header_t * const  p_head      = (const ver_image_header_t*) &g_boot_multi.app_head;
+        const   uint16_t                    seq_next    = g_boot_flashing.seq_next;
+        const   uint16_t                    seq_ack     = g_boot_flashing.seq_ack;
+
+        // Only complete plain application
+        if  (   ( eBOOT_OK != boot_app_header_check( p_head ))
+            ||  ( eVER_IMAGE_TYPE_APP != p_head->ctrl.image_type )
+            ||  ( BOOT_COMP_TYPE_NONE != BOOT_IMAGE_COMP_TYPE( p_head ))
+            ||  ( 0U == p_head->data.image_size )
+            ||  ( p_entry->size != ( sizeof( ver_image_header_t ) + p_head->data.image_size )))
+        {
+            msg_status = eBOOT_MSG_ERROR_VALIDATION;
+        }
+        else
+        {
+            msg_status = boot_pre_validate_app( p_head );
+        }
+
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            msg_status = boot_flash_begin( p_head );
+
+            g_boot_flashing.digest.type = BOOT_DIGEST_CRC32;
+
+            // Sequence numbers continue over complete container
+            g_boot_flashing.seq_next    = seq_next;
+            g_boot_flashing.seq_ack     = seq_ack;
+        }
+
+        return msg_status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Write staged block of data sub-image
+    *
+    * @note     Sectors are erased just in front of written block. Last block
+    *           is padded with 0xFF to flash write size.
+    *
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_multi_data_flush(void)
+    {
+        boot_msg_status_t   msg_status      = eBOOT_MSG_OK;
+        uint32_t            size            = g_boot_flash_stage.size;
+        uint32_t            sector_start    = 0U;
+        uint32_t            sector_size     = 0U;
+
+        // Pad to flash write size
+        // NOTE: Staging buffer size is multiple of flash write size!
+        for ( ; 0U != ( size % BOOT_CFG_FLASH_WRITE_SIZE ); size++ )
+        {
+            g_boot_flash_stage.data[ size ] = 0xFFU;
+        }
+
+        // Make sure space is erased
+        if (( g_boot_multi.write_addr + size ) > g_boot_multi.erased_addr )
+        {
+            if  (   ( eBOOT_MSG_OK != boot_flash_erase_range( g_boot_multi.erased_addr, (( g_boot_multi.write_addr + size ) - g_boot_multi.erased_addr )))
+                ||  ( eBOOT_OK != boot_flash_sector_get(( g_boot_multi.write_addr + size - 1U ), &sector_start, &sector_size )))
+            {
+                msg_status = eBOOT_MSG_ERROR_FLASH_ERASE;
+            }
+            else
+            {
+                g_boot_multi.erased_addr = ( sector_start + sector_size );
+            }
+        }
+
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            // Flash data
+            BOOT_STATS_START( program_ts );
+            const boot_status_t write_status = boot_if_flash_write( g_boot_multi.write_addr, size, (const uint8_t*) &g_boot_flash_stage.data );
+            BOOT_STATS_STOP( program_ts, program_us );
+
+            if ( eBOOT_OK != write_status )
+            {
+                msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+            }
+
+            // Read back and compare written data
+            #if ( 1 == BOOT_CFG_FLASH_READBACK_EN )
+                else
+                {
+                    boot_readback_t readback = { .p_expected = (const uint8_t*) &g_boot_flash_stage.data, .ofs = 0U, .match = true };
+
+                    if  (   ( eBOOT_OK != boot_image_read( g_boot_multi.write_addr, size, boot_flash_readback_cb, (void*) &readback ))
+                        ||  ( false == readback.match ))
+                    {
+                        msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+                        BOOT_DBG_PRINT( "ERROR: Flash read-back mismatch at 0x%08X!", g_boot_multi.write_addr );
+                    }
+                }
+            #endif
+
+            BOOT_STATS_ADD( programmed, size );
+            g_boot_multi.write_addr += size;
+        }
+
+        g_boot_flash_stage.size = 0U;
+
+        return msg_status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Dispatch block of sub-image to its target
+    *
+    * @param[in]    p_entry     - Manifest entry of sub-image
+    * @param[in]    p_data      - Block of sub-image at current offset
+    * @param[in]    size        - Size of block in bytes
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_multi_entry_data(const boot_multi_entry_t * const p_entry, const uint8_t * const p_data, const uint32_t size)
+    {
+        boot_msg_status_t   msg_status  = eBOOT_MSG_OK;
+        uint32_t            i           = 0U;
+
+        switch ( p_entry->type )
+        {
+            case BOOT_MULTI_TYPE_APP:
+
+                // Collect application header
+                if ( g_boot_multi.ofs < sizeof( ver_image_header_t ))
+                {
+                    i = ((( sizeof( ver_image_header_t ) - g_boot_multi.ofs ) < size ) ? ( sizeof( ver_image_header_t ) - g_boot_multi.ofs ) : size );
+
+                    memcpy( &((uint8_t*) &g_boot_multi.app_head )[ g_boot_multi.ofs ], p_data, i );
+
+                    if (( g_boot_multi.ofs + i ) == sizeof( ver_image_header_t ))
+                    {
+                        msg_status = boot_multi_app_begin( p_entry );
+                    }
+                }
+
+                // Application data
+                if  (   ( eBOOT_MSG_OK == msg_status )
+                    &&  ( i < size ))
+                {
+                    (void) boot_flash_stage_out_cb( &p_data[i], ( size - i ), (void*) &msg_status );
+                }
+                break;
+
+            case BOOT_MULTI_TYPE_DATA:
+
+                while (( i < size ) && ( eBOOT_MSG_OK == msg_status ))
+                {
+                    const uint32_t capacity     = boot_flash_stage_capacity( g_boot_multi.write_addr );
+                    const uint32_t space        = ( capacity - g_boot_flash_stage.size );
+                    const uint32_t block_size   = ((( size - i ) > space ) ? space : ( size - i ));
+
+                    memcpy( &g_boot_flash_stage.data[ g_boot_flash_stage.size ], &p_data[i], block_size );
+
+                    g_boot_flash_stage.size += block_size;
+                    i                       += block_size;
+
+                    // Block full
+                    if ( capacity == g_boot_flash_stage.size )
+                    {
+                        msg_status = boot_multi_data_flush();
+                    }
+                }
+                break;
+
+            case BOOT_MULTI_TYPE_FORWARD:
+
+                if ( eBOOT_OK != boot_if_forward( p_entry, g_boot_multi.ofs, p_data, size ))
+                {
+                    msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+                }
+                break;
+
+            default:
+                msg_status = eBOOT_MSG_ERROR_VALIDATION;
+                break;
+        }
+
+        return msg_status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       End of sub-image
+    *
+    * @note     Rest of data sub-image is written, then hash of sub-image is
+    *           checked against (authenticated) manifest.
+    *
+    * @param[in]    p_entry     - Manifest entry of sub-image
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_multi_entry_end(const boot_multi_entry_t * const p_entry)
+    {
+        boot_msg_status_t   msg_status                  = eBOOT_MSG_OK;
+        uint8_t             hash[CF_SHA256_HASHSZ]      = {0};
+
+        if  (   ( BOOT_MULTI_TYPE_DATA == p_entry->type )
+            &&  ( g_boot_flash_stage.size > 0U ))
+        {
+            msg_status = boot_multi_data_flush();
+        }
+
+        cf_sha256_digest_final( &g_boot_multi.sha_ctx, hash );
+
+        if  (   ( eBOOT_MSG_OK == msg_status )
+            &&  ( false == boot_hash_is_equal( hash, p_entry->hash )))
+        {
+            msg_status = eBOOT_MSG_ERROR_VALIDATION;
+
+            BOOT_DBG_PRINT( "ERROR: Sub-image %d hash invalid!", g_boot_multi.idx );
+        }
+
+        return msg_status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Split received (plain) part of container into sub-images
+    *
+    * @note     Enters EXIT state once complete container is received.
+    *
+    * @param[in]    p_data      - Plain container data
+    * @param[in]    size        - Size of data in bytes
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_multi_data(const uint8_t * const p_data, const uint32_t size)
+    {
+        boot_msg_status_t   msg_status  = eBOOT_MSG_OK;
+        uint32_t            i           = 0U;
+
+        // More data than announced
+        if (( g_boot_multi.received + size ) > g_boot_multi.head.data.image_size )
+        {
+            msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+        }
+        else
+        {
+            g_boot_multi.received += size;
+        }
+
+        while (( i < size ) && ( eBOOT_MSG_OK == msg_status ))
+        {
+            // Collect manifest
+            if ( false == g_boot_multi.is_manifest )
+            {
+                const uint32_t part = ((( sizeof( boot_multi_manifest_t ) - g_boot_multi.ofs ) < ( size - i )) ? ( sizeof( boot_multi_manifest_t ) - g_boot_multi.ofs ) : ( size - i ));
+
+                memcpy( &((uint8_t*) &g_boot_multi.manifest )[ g_boot_multi.ofs ], &p_data[i], part );
+
+                BOOT_STATS_START( hash_ts );
+                boot_image_digest_cb( &p_data[i], part, (void*) &g_boot_multi.digest );
+                BOOT_STATS_STOP( hash_ts, hash_us );
+
+                g_boot_multi.ofs    += part;
+                i                   += part;
+
+                if ( sizeof( boot_multi_manifest_t ) == g_boot_multi.ofs )
+                {
+                    g_boot_multi.is_manifest = true;
+
+                    msg_status = boot_multi_manifest_check();
+
+                    boot_multi_entry_select( 0U );
+                }
+            }
+
+            // Pass to current sub-image
+            else
+            {
+                const boot_multi_entry_t * const    p_entry = &g_boot_multi.manifest.entry[ g_boot_multi.idx ];
+                const uint32_t                      part    = ((( p_entry->size - g_boot_multi.ofs ) < ( size - i )) ? ( p_entry->size - g_boot_multi.ofs ) : ( size - i ));
+
+                BOOT_STATS_START( hash_ts );
+                cf_sha256_update( &g_boot_multi.sha_ctx, &p_data[i], part );
+                BOOT_STATS_STOP( hash_ts, hash_us );
+
+                msg_status = boot_multi_entry_data( p_entry, &p_data[i], part );
+
+                g_boot_multi.ofs    += part;
+                i                   += part;
+
+                // Sub-image complete
+                if  (   ( eBOOT_MSG_OK == msg_status )
+                    &&  ( p_entry->size == g_boot_multi.ofs ))
+                {
+                    msg_status = boot_multi_entry_end( p_entry );
+
+                    boot_multi_entry_select( g_boot_multi.idx + 1U );
+                }
+            }
+        }
+
+        // Complete container received -> enter EXIT state
+        if  (   ( eBOOT_MSG_OK == msg_status )
+            &&  ( g_boot_multi.received == g_boot_multi.head.data.image_size ))
+        {
+            fsm_goto_state( g_boot_fsm, eBOOT_STATE_EXIT );
+        }
+
+        return msg_status;
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_EXT_FLASH_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Handle install of staged image from external flash
+    *
+    * @note     Runs once when boot reason is "eBOOT_REASON_FLASH" and
+    *           bootloader is idle. On success new application is started,
+    *           otherwise bootloader stays waiting for Boot Manager and leaves
+    *           to (still valid) application on jump to app timeout.
+    *
+    * @return       status - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_nvm_hndl(void)
+    {
+        boot_status_t status = eBOOT_OK;
+
+        // Staged image install requested
+        if  (   ( eBOOT_REASON_FLASH == g_boot_shared_mem.data.boot_reason )
+            &&  ( eBOOT_STATE_IDLE == boot_get_state()))
+        {
+            BOOT_DBG_PRINT( "Installing image from external flash..." );
+
+            status = boot_nvm_install();
+
+            if ( eBOOT_OK == status )
+            {
+                boot_flash_activate();
+
+                // Clear boot reason & counter
+                boot_shared_mem_set_boot_reason( eBOOT_REASON_NONE );
+                boot_shared_mem_set_boot_cnt( 0U );
+
+                // Jump to application
+                boot_start_application();
+
+                // This line is not reached as cpu starts executing application code...
+            }
+            else
+            {
+                // Stay in bootloader
+                boot_shared_mem_set_boot_reason( eBOOT_REASON_COM );
+
+                BOOT_DBG_PRINT( "ERROR: External flash image install failed!" );
+            }
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Install staged image from external flash
+    *
+    * @note     Staged image is pre-validated and completely verified (digest
+    *           and signature, for container manifest and hashes of all
+    *           sub-images) in external flash before internal flash is
+    *           touched. Then it is copied through the same decrypt, decompress
+    *           and patch path as image received over communication.
+    *
+    * @return       status - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_nvm_install(void)
+    {
+                boot_status_t           status  = eBOOT_OK;
+                boot_ext_image_desc_t   desc    = {0};
+        static  ver_image_header_t      head    = {0};
+
+        // Staged image descriptor
+        if  (   ( eBOOT_OK != boot_if_ext_flash_read( BOOT_CFG_EXT_FLASH_IMAGE_ADDR, sizeof( boot_ext_image_desc_t ), (uint8_t*) &desc ))
+            ||  ( BOOT_EXT_IMAGE_MAGIC != desc.magic )
+            ||  ( desc.size <= sizeof( ver_image_header_t )))
+        {
+            status = eBOOT_ERROR;
+            BOOT_DBG_PRINT( "ERROR: No staged image in external flash!" );
+        }
+
+        // Staged image header
+        else if (   ( eBOOT_OK != boot_if_ext_flash_read( BOOT_EXT_IMAGE_HEAD_ADDR, sizeof( ver_image_header_t ), (uint8_t*) &head ))
+                ||  ( eBOOT_MSG_OK != boot_pre_validate_image( &head )))
+        {
+            status = eBOOT_ERROR;
+            BOOT_DBG_PRINT( "ERROR: Staged image header invalid!" );
+        }
+
+        // Complete image in place
+        else
+        {
+            status = boot_nvm_verify( &head, ( desc.size - sizeof( ver_image_header_t )));
+        }
+
+        if ( eBOOT_OK == status )
+        {
+            if  (   ( eBOOT_MSG_OK != boot_nvm_copy( &head, ( desc.size - sizeof( ver_image_header_t ))))
+                ||  ( eBOOT_OK != boot_flash_finish()))
+            {
+                status = eBOOT_ERROR;
+
+                boot_flash_abort();
+            }
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Verify staged image in external flash
+    *
+    * @note     Staged data is decoded exactly as when installed, but only
+    *           digest of resulting plain image is calculated. Digest of
+    *           container covers its manifest only, therefore sub-images are
+    *           checked against authenticated manifest as well.
+    *
+    * @param[in]    p_head  - Staged image header, shall be pre-validated
+    * @param[in]    size    - Size of staged payload in bytes
+    * @return       status  - Status of verification
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_nvm_verify(const ver_image_header_t * const p_head, const uint32_t size)
+    {
+                boot_status_t       status      = eBOOT_OK;
+        static  boot_nvm_verify_t   verify      = {0};
+
+        verify.digest.type  = (( eVER_SIG_TYPE_ECSDA == p_head->data.sig_type ) ? BOOT_DIGEST_SHA256 : BOOT_DIGEST_CRC32 );
+        verify.digest.crc32 = boot_crc32_init();
+        verify.size         = 0U;
+        verify.size_max     = p_head->data.image_size;
+        verify.is_delta     = ( BOOT_IMAGE_TYPE_DELTA == p_head->ctrl.image_type );
+        verify.is_multi     = false;
+        cf_sha256_init( &verify.digest.sha_ctx );
+
+        // Container is checked in reception context, it is reset again once copy begins
+        #if ( 1 == BOOT_CFG_MULTI_EN )
+            if ( BOOT_IMAGE_TYPE_MULTI == p_head->ctrl.image_type )
+            {
+                verify.is_multi = true;
+
+                memset( &g_boot_multi, 0U, sizeof( g_boot_multi ));
+                memcpy( &g_boot_multi.head, p_head, sizeof( ver_image_header_t ));
+
+                g_boot_multi.digest.type    = verify.digest.type;
+                g_boot_multi.digest.crc32   = boot_crc32_init();
+                cf_sha256_init( &g_boot_multi.digest.sha_ctx );
+            }
+        #endif
+
+        #if ( 1 == BOOT_CFG_COMP_EN )
+            boot_comp_init( BOOT_IMAGE_COMP_PARAM( p_head ));
+        #endif
+
+        #if ( 1 == BOOT_CFG_DELTA_EN )
+            if  (   ( true == verify.is_delta )
+                &&  ( eBOOT_MSG_OK != boot_delta_base_prepare()))
+            {
+                status = eBOOT_ERROR;
+            }
+        #endif
+
+        #if ( 1 == BOOT_CFG_CRYPTION_EN )
+            boot_if_decrypt_reset();
+        #endif
+
+        for ( uint32_t ofs = 0U; ( ofs < size ) && ( eBOOT_OK == status ); ofs += BOOT_CFG_DATA_PAYLOAD_SIZE )
+        {
+            const uint16_t block_size = (uint16_t)((( size - ofs ) > BOOT_CFG_DATA_PAYLOAD_SIZE ) ? BOOT_CFG_DATA_PAYLOAD_SIZE : ( size - ofs ));
+
+            status = boot_if_ext_flash_read(( BOOT_EXT_IMAGE_DATA_ADDR + ofs ), block_size, (uint8_t*) &g_boot_nvm_buf );
+
+            if ( eBOOT_OK == status )
+            {
+                const uint8_t * p_plain = boot_flash_decrypt((const uint8_t*) &g_boot_nvm_buf, block_size );
+
+                #if ( 1 == BOOT_CFG_COMP_EN )
+                    if ( BOOT_COMP_TYPE_NONE != BOOT_IMAGE_COMP_TYPE( p_head ))
+                    {
+                        status = boot_comp_apply( p_plain, block_size, boot_nvm_verify_plain_cb, (void*) &verify );
+                    }
+                    else
+                #endif
+                    {
+                        status = boot_nvm_verify_plain_cb( p_plain, block_size, (void*) &verify );
+                    }
+            }
+
+            // Process WDT in between
+            boot_if_kick_wdt();
+        }
+
+        // Complete image must be decoded
+        if  (   ( eBOOT_OK == status )
+            &&  ( verify.size != verify.size_max ))
+        {
+            status = eBOOT_ERROR;
+        }
+
+        // Manifest is authenticated once complete, all sub-images shall be checked
+        #if ( 1 == BOOT_CFG_MULTI_EN )
+            else if ( true == verify.is_multi )
+            {
+                if  (   ( false == g_boot_multi.is_manifest )
+                    ||  ( g_boot_multi.idx != g_boot_multi.manifest.num_of ))
+                {
+                    status = eBOOT_ERROR;
+                }
+            }
+        #endif
+
+        else if ( eBOOT_OK == status )
+        {
+            status = boot_fw_image_check_digest( p_head, &verify.digest );
+        }
+
+        else
+        {
+            // No actions...
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Staged image verification plain data output callback
+    *
+    * @param[in]    p_data  - Plain image data
+    * @param[in]    size    - Size of data in bytes
+    * @param[in]    p_ctx   - Verification context
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_nvm_verify_out_cb(const uint8_t * const p_data, const uint32_t size, void * const p_ctx)
+    {
+        boot_status_t       status      = eBOOT_OK;
+        boot_nvm_verify_t * p_verify    = (boot_nvm_verify_t*) p_ctx;
+
+        // More data than announced
+        if (( p_verify->size + size ) > p_verify->size_max )
+        {
+            status = eBOOT_ERROR;
+        }
+        else
+        {
+            #if ( 1 == BOOT_CFG_MULTI_EN )
+                if ( true == p_verify->is_multi )
+                {
+                    status = boot_nvm_verify_multi( p_data, size );
+                }
+                else
+            #endif
+                {
+                    boot_image_digest_cb( p_data, size, (void*) &p_verify->digest );
+                }
+
+            p_verify->size += size;
+        }
+
+        return status;
+    }
+
+    #if ( 1 == BOOT_CFG_MULTI_EN )
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Verify part of staged multi-image container
+        *
+        * @note     Manifest is collected and authenticated as on reception,
+        *           then hash of each sub-image is checked against it. Nothing
+        *           is written.
+        *
+        * @param[in]    p_data  - Plain container data
+        * @param[in]    size    - Size of data in bytes
+        * @return       status  - Status of operation
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static boot_status_t boot_nvm_verify_multi(const uint8_t * const p_data, const uint32_t size)
+        {
+            boot_status_t   status                  = eBOOT_OK;
+            uint8_t         hash[CF_SHA256_HASHSZ]  = {0};
+            uint32_t        i                       = 0U;
+
+            while (( i < size ) && ( eBOOT_OK == status ))
+            {
+                // Collect manifest
+                if ( false == g_boot_multi.is_manifest )
+                {
+                    const uint32_t part = ((( sizeof( boot_multi_manifest_t ) - g_boot_multi.ofs ) < ( size - i )) ? ( sizeof( boot_multi_manifest_t ) - g_boot_multi.ofs ) : ( size - i ));
+
+                    memcpy( &((uint8_t*) &g_boot_multi.manifest )[ g_boot_multi.ofs ], &p_data[i], part );
+                    boot_image_digest_cb( &p_data[i], part, (void*) &g_boot_multi.digest );
+
+                    g_boot_multi.ofs    += part;
+                    i                   += part;
+
+                    if ( sizeof( boot_multi_manifest_t ) == g_boot_multi.ofs )
+                    {
+                        g_boot_multi.is_manifest = true;
+
+                        if ( eBOOT_MSG_OK != boot_multi_manifest_check())
+                        {
+                            status = eBOOT_ERROR;
+                        }
+
+                        boot_multi_entry_select( 0U );
+                    }
+                }
+
+                // Hash current sub-image
+                else
+                {
+                    const boot_multi_entry_t * const    p_entry = &g_boot_multi.manifest.entry[ g_boot_multi.idx ];
+                    const uint32_t                      part    = ((( p_entry->size - g_boot_multi.ofs ) < ( size - i )) ? ( p_entry->size - g_boot_multi.ofs ) : ( size - i ));
+
+                    cf_sha256_update( &g_boot_multi.sha_ctx, &p_data[i], part );
+
+                    g_boot_multi.ofs    += part;
+                    i                   += part;
+
+                    // Sub-image complete
+                    if ( p_entry->size == g_boot_multi.ofs )
+                    {
+                        cf_sha256_digest_final( &g_boot_multi.sha_ctx, hash );
+
+                        if ( false == boot_hash_is_equal( hash, p_entry->hash ))
+                        {
+                            status = eBOOT_ERROR;
+
+                            BOOT_DBG_PRINT( "ERROR: Staged sub-image %d hash invalid!", g_boot_multi.idx );
+                        }
+
+                        boot_multi_entry_select( g_boot_multi.idx + 1U );
+                    }
+                }
+            }
+
+            return status;
+        }
+
+    #endif
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Staged image verification decompressed data output callback
+    *
+    * @param[in]    p_data  - Decompressed (patch or image) data
+    * @param[in]    size    - Size of data in bytes
+    * @param[in]    p_ctx   - Verification context
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_nvm_verify_plain_cb(const uint8_t * const p_data, const uint32_t size, void * const p_ctx)
+    {
+        boot_status_t status = eBOOT_OK;
+
+        #if ( 1 == BOOT_CFG_DELTA_EN )
+            if ( true == ((boot_nvm_verify_t*) p_ctx )->is_delta )
+            {
+                status = boot_delta_apply( p_data, size, boot_nvm_verify_out_cb, p_ctx );
+            }
+            else
+        #endif
+            {
+                status = boot_nvm_verify_out_cb( p_data, size, p_ctx );
+            }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Copy staged image from external flash
+    *
+    * @note     Staged data is always written synchronously.
+    *
+    * @param[in]    p_head      - Staged image header, shall be pre-validated
+    * @param[in]    size        - Size of staged payload in bytes
+    * @return       msg_status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_msg_status_t boot_nvm_copy(const ver_image_header_t * const p_head, const uint32_t size)
+    {
+        boot_msg_status_t msg_status = boot_flash_start( p_head );
+
+        #if ( 1 == BOOT_CFG_CRYPTION_EN )
+            boot_if_decrypt_reset();
+        #endif
+
+        for ( uint32_t ofs = 0U; ( ofs < size ) && ( eBOOT_MSG_OK == msg_status ); ofs += BOOT_CFG_DATA_PAYLOAD_SIZE )
+        {
+            const uint16_t block_size = (uint16_t)((( size - ofs ) > BOOT_CFG_DATA_PAYLOAD_SIZE ) ? BOOT_CFG_DATA_PAYLOAD_SIZE : ( size - ofs ));
+
+            if ( eBOOT_OK != boot_if_ext_flash_read(( BOOT_EXT_IMAGE_DATA_ADDR + ofs ), block_size, (uint8_t*) &g_boot_nvm_buf ))
+            {
+                msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+            }
+
+            // Plain image
+            else if ( true == boot_flash_is_plain())
+            {
+                msg_status = boot_flash_write_plain( boot_flash_decrypt((const uint8_t*) &g_boot_nvm_buf, block_size ), block_size );
+            }
+
+            // Decompress and/or apply patch
+            #if ( 1 == BOOT_FLASH_STAGE_EN )
+                else
+                {
+                    msg_status = boot_flash_staged((const uint8_t*) &g_boot_nvm_buf, block_size );
+                }
+            #endif
+
+            // Process WDT in between
+            boot_if_kick_wdt();
+        }
+
+        return msg_status;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if flash data response is deferred
+*
+* @note     With asynchronous flash writes response is sent once data is
+*           written to flash. Delta, compressed and container images are
+*           always written synchronously.
+*
+* @return       deferred - Response is sent by flash write pipeline
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_flash_rsp_is_deferred(void)
+{
+    bool deferred = false;
+
+    #if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+        deferred = boot_flash_is_plain();
+    #endif
+
+    return deferred;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if received data is plain image
 *
-* @return       void
+* @note     Plain image is written to flash as received (after decryption),
+*           delta, compressed and container images pass staging buffer.
+*
+* @return       is_plain - True if image is plain
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_init_boot_counter(void)
+static bool boot_flash_is_plain(void)
 {
-    #if ( 1 == BOOT_CFG_APP_BOOT_CNT_CHECK_EN )
+    return  (   ( false == g_boot_flashing.is_delta )
+            &&  ( false == g_boot_flashing.is_comp )
+            &&  ( false == g_boot_flashing.is_multi ));
+}
 
-        uint8_t cnt = 0U;
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if complete image has been received
+*
+* @note     Container is complete once its last sub-image is received.
+*
+* @return       is_received - True if all image data has been received
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_flash_is_received(void)
+{
+    bool is_received = false;
 
-        // Get boot counter
-        if ( eBOOT_OK == boot_shared_mem_get_boot_cnt( &cnt ))
+    #if ( 1 == BOOT_CFG_MULTI_EN )
+        if ( true == g_boot_flashing.is_multi )
         {
-            // Limit reached
-            if ( cnt >= BOOT_CFG_BOOT_CNT_LIMIT )
-            {
-                // Stay in bootloader
-                boot_shared_mem_set_boot_reason( eBOOT_REASON_COM );
+            is_received = ( g_boot_multi.received >= g_boot_multi.head.data.image_size );
+        }
+        else
+    #endif
+        {
+            is_received = ( g_boot_flashing.received_bytes >= g_boot_flashing.fw_size );
+        }
 
-                // Corrupt app header in order to prevent entering app
-                boot_app_head_erase();
+    return is_received;
+}
 
-                BOOT_DBG_PRINT( "Boot counts limit reached! Declaring invalid application!" );
-            }
-        }
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Activate newly flashed and validated image
+*
+* @note     New image is booted from now on and its validation verdict is
+*           stored for next boots.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_flash_activate(void)
+{
+    #if ( 1 == BOOT_CFG_AB_SLOT_EN )
+        boot_slot_activate_target();
+    #endif
 
-        // Store boot counter
-        (void) boot_shared_mem_set_boot_cnt( cnt );
+    // Store validated verdict for next boots
+    #if ( 1 == BOOT_CFG_VALID_CACHE_EN )
+        (void) boot_valid_cache_write((const ver_image_header_t*) &g_boot_flashing.head );
 
+        g_boot_shared_mem.data.valid_cnt = 0U;
+        boot_shared_mem_update();
     #endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Prepare internal uC flash for new image
+*       Abort flashing
 *
-* @param[in]    image_addr  - Start of new image address
-* @param[in]    image_size  - Size of new image in bytes (note: without image header)
-* @return       status      - Status of operation
+* @note     Drops queued flash writes, enters IDLE state and erases
+*           application header. With resume enabled progress checkpoint
+*           of flashed image is stored instead.
+*
+* @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-static boot_msg_status_t boot_prepare_flash(const uint32_t image_addr, const uint32_t image_size)
+static void boot_flash_abort(void)
 {
-    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+    #if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+        boot_flash_pipe_reset();
+    #endif
 
-    // Get end image address
-    // NOTE: -1 as it starts counting from address index 0! Image header is not counted into image size!
-    const uint32_t addr_end  = ( image_addr + (( image_size + sizeof( ver_image_header_t )) - 1U ));
+    // Remember how far upgrade got
+    #if ( 1 == BOOT_CFG_RESUME_EN )
+        if ( eBOOT_STATE_FLASH == boot_get_state())
+        {
+            boot_resume_save();
+        }
+    #endif
 
-    uint32_t addr_work = image_addr;
+    // Something not OK, enter IDLE state
+    fsm_goto_state( g_boot_fsm, eBOOT_STATE_IDLE );
 
-    // Do until all space is erased
-    while ( addr_work < addr_end )
+    // Erase application header
+    (void) boot_app_head_erase( g_boot_slot_target );
+}
+
+#if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Reset flash write pipeline
+    *
+    * @note     Waits for ongoing flash write to complete!
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_flash_pipe_reset(void)
     {
-        // Erase page by page
-        if ( eBOOT_OK != boot_if_flash_erase( addr_work, FLASH_PAGE_SIZE ))
+        // Wait for ongoing write
+        while (( true == g_boot_flash_pipe.busy ) && ( eBOOT_WAR_BUSY == boot_if_flash_write_poll()))
         {
-            msg_status = eBOOT_MSG_ERROR_FLASH_ERASE;
-            break;
+            boot_if_kick_wdt();
         }
 
-        // Increment working address
-        addr_work += FLASH_PAGE_SIZE;
-
-        // Process WDT in between
-        boot_if_kick_wdt();
+        g_boot_flash_pipe.head      = 0U;
+        g_boot_flash_pipe.num_of    = 0U;
+        g_boot_flash_pipe.busy      = false;
     }
 
-    return msg_status;
-}
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Handle flash write pipeline
+    *
+    * @note     Starts programming of the oldest queued slot and polls for its
+    *           completion. Response to flash data command is sent once slot
+    *           is written to flash.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_flash_pipe_hndl(void)
+    {
+        boot_msg_status_t msg_status = eBOOT_MSG_OK;
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Pre-validate new image
-*
-* @param[in]    p_head      - Image (app) header
-* @return       msg_status  - Status of validation
-*/
-////////////////////////////////////////////////////////////////////////////////
-static boot_msg_status_t boot_pre_validate_image(const ver_image_header_t * const p_head)
-{
-    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+        if ( g_boot_flash_pipe.num_of > 0U )
+        {
+            const boot_flash_slot_t * const p_slot = &g_boot_flash_pipe.slot[ g_boot_flash_pipe.head ];
 
-    // Validate image header
-    if ( eBOOT_OK == boot_app_header_check( p_head ))
-    {
-        // Check for FW size
-        msg_status |= boot_fw_size_check( p_head->data.image_size );
+            // Start programming
+            if ( false == g_boot_flash_pipe.busy )
+            {
+                // Make sure space is erased
+                #if ( 1 == BOOT_CFG_FLASH_ERASE_AHEAD_EN )
+                    msg_status = boot_flash_erase_to( p_slot->addr + p_slot->size );
+                #endif
 
-        // Check for FW version compatibility
-        msg_status |= boot_fw_ver_check( p_head->data.sw_ver );
+                if ( eBOOT_MSG_OK != msg_status )
+                {
+                    // No actions...
+                }
+                else if ( eBOOT_OK == boot_if_flash_write_start( p_slot->addr, p_slot->size, (const uint8_t*) &p_slot->data ))
+                {
+                    g_boot_flash_pipe.busy = true;
 
-        // Check for HW version compatibility
-        msg_status |= boot_hw_ver_check( p_head->data.hw_ver );
+                    #if ( 1 == BOOT_CFG_STATS_EN )
+                        g_boot_flash_pipe.write_ts = BOOT_CFG_STATS_TIMER();
+                    #endif
+                }
+                else
+                {
+                    msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+                }
+            }
 
-        // Check for authentic image
-        msg_status |= boot_signature_check((const uint8_t*) &p_head->data.signature, (const uint8_t*) &p_head->data.hash );
+            // Check for completion
+            if ( true == g_boot_flash_pipe.busy )
+            {
+                const boot_status_t status = boot_if_flash_write_poll();
+
+                // Slot written
+                if ( eBOOT_OK == status )
+                {
+                    g_boot_flash_pipe.busy = false;
+
+                    BOOT_STATS_STOP( g_boot_flash_pipe.write_ts, program_us );
+
+                    msg_status = boot_flash_commit( p_slot->addr, (const uint8_t*) &p_slot->data, p_slot->size );
+
+                    if ( eBOOT_MSG_OK == msg_status )
+                    {
+                        if ( true == p_slot->is_seq )
+                        {
+                            g_boot_flashing.seq_ack = (uint16_t)( p_slot->seq + 1U );
+                        }
+
+                        // Release slot
+                        g_boot_flash_pipe.head = (( g_boot_flash_pipe.head + 1U ) % BOOT_CFG_FLASH_PIPE_DEPTH );
+                        g_boot_flash_pipe.num_of--;
+
+                        boot_flash_pipe_send_rsp( p_slot, eBOOT_MSG_OK );
+                    }
+                }
+
+                // Write failed
+                else if ( eBOOT_WAR_BUSY != status )
+                {
+                    g_boot_flash_pipe.busy = false;
+                    msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+                }
+
+                // Still programming
+                else
+                {
+                    // No actions...
+                }
+            }
 
-        // NOTE: For now only application image is supported
-        // TODO: To support other type of images change that logic!
-        if ( eVER_IMAGE_TYPE_APP != p_head->ctrl.image_type )
+            if ( eBOOT_MSG_OK != msg_status )
+            {
+                boot_flash_pipe_send_rsp( p_slot, msg_status );
+                boot_flash_abort();
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Send response for written pipeline slot
+    *
+    * @param[in]    p_slot      - Pipeline slot
+    * @param[in]    msg_status  - Response status
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_flash_pipe_send_rsp(const boot_flash_slot_t * const p_slot, const boot_msg_status_t msg_status)
+    {
+        if ( true == p_slot->is_seq )
         {
-            msg_status = eBOOT_MSG_ERROR_VALIDATION;
+            boot_com_send_flash_seq_rsp( g_boot_flashing.seq_ack, msg_status );
+        }
+        else
+        {
+            boot_com_send_flash_rsp( msg_status );
         }
     }
 
-    // Image (app) header invalid
-    else
+#endif
+
+#if ( 1 == BOOT_CFG_FLASH_READBACK_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Flash read-back compare callback
+    *
+    * @param[in]    p_data  - Read block from flash
+    * @param[in]    size    - Size of block in bytes
+    * @param[in]    p_ctx   - Read-back context
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_flash_readback_cb(const uint8_t * const p_data, const uint32_t size, void * const p_ctx)
     {
-        msg_status = eBOOT_MSG_ERROR_VALIDATION;
+        boot_readback_t * p_readback = (boot_readback_t*) p_ctx;
+
+        if ( 0 != memcmp( p_data, &p_readback->p_expected[ p_readback->ofs ], size ))
+        {
+            p_readback->match = false;
+        }
+
+        p_readback->ofs += size;
     }
 
-    return msg_status;
-}
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -897,11 +5567,18 @@ static void boot_fsm_idle_hndl(const p_fsm_t fsm_inst)
         // Clear flashing data informations
         memset( &g_boot_flashing, 0U, sizeof( g_boot_flashing ));
 
+        #if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+            boot_flash_pipe_reset();
+        #endif
+
         // Reset decryption engine
         #if ( 1 == BOOT_CFG_CRYPTION_EN )
             boot_if_decrypt_reset();
         #endif
 
+        // Aborted session -> new Boot Manager session starts with CRC-8
+        boot_com_set_crc_type( BOOT_COM_CRC_TYPE_CRC8 );
+
         // Clear flag
         try_to_leave = false;
     }
@@ -918,7 +5595,7 @@ static void boot_fsm_idle_hndl(const p_fsm_t fsm_inst)
         BOOT_DBG_PRINT( "Nothing to do... Exiting bootloader..." );
 
         // Application image validated OK
-        if ( eBOOT_OK == boot_fw_image_validate())
+        if ( eBOOT_OK == boot_fw_image_validate_slots())
         {
             // Clear reason to stay in bootloader
             (void) boot_shared_mem_set_boot_reason( eBOOT_REASON_NONE );
@@ -947,8 +5624,12 @@ static void boot_fsm_prepare_hndl(const p_fsm_t fsm_inst)
     {
         fsm_goto_state( g_boot_fsm, eBOOT_STATE_IDLE );
 
-        // Erase application header
-        (void) boot_app_head_erase();
+        // Erase application header only if flashing already started
+        // NOTE: With A/B slots untouched target holds rollback image!
+        if ( true == g_boot_flashing.is_erased )
+        {
+            (void) boot_app_head_erase( g_boot_slot_target );
+        }
 
         BOOT_DBG_PRINT( "ERROR: Prepare state timeouted!" );
     }
@@ -976,14 +5657,32 @@ static void boot_fsm_flash_hndl(const p_fsm_t fsm_inst)
         // Check for communication timeout
         if ( time_from_last_rx >= BOOT_CFG_FLASH_IDLE_TIMEOUT_MS )
         {
-            fsm_goto_state( g_boot_fsm, eBOOT_STATE_IDLE );
-
-            // Erase application header
-            (void) boot_app_head_erase();
+            boot_flash_abort();
 
             BOOT_DBG_PRINT( "ERROR: Communication timeouted!" );
         }
     }
+
+    // Program queued data
+    #if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+        if ( eBOOT_STATE_FLASH == boot_get_state())
+        {
+            boot_flash_pipe_hndl();
+        }
+    #endif
+
+    // Erase in front of incoming data
+    // NOTE: Flash can not be erased while being programmed!
+    #if ( 1 == BOOT_CFG_FLASH_ERASE_AHEAD_EN )
+        if  (   ( eBOOT_STATE_FLASH == boot_get_state())
+        #if ( 1 == BOOT_CFG_FLASH_ASYNC_EN )
+            &&  ( false == g_boot_flash_pipe.busy )
+        #endif
+            )
+        {
+            boot_flash_erase_ahead();
+        }
+    #endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1004,8 +5703,12 @@ static void boot_fsm_exit_hndl(const p_fsm_t fsm_inst)
     {
         fsm_goto_state( g_boot_fsm, eBOOT_STATE_IDLE );
 
-        // Erase application header
-        (void) boot_app_head_erase();
+        // Erase application header only if flashing already started
+        // NOTE: With A/B slots untouched target holds rollback image!
+        if ( true == g_boot_flashing.is_erased )
+        {
+            (void) boot_app_head_erase( g_boot_slot_target );
+        }
 
         BOOT_DBG_PRINT( "ERROR: Exit state timeouted!" );
     }
@@ -1015,20 +5718,53 @@ static void boot_fsm_exit_hndl(const p_fsm_t fsm_inst)
 /**
 *       Connect Bootloader Message Reception Callback
 *
-* @param[in]    fsm_inst - FMS instance
+* @note     Requested flash data payload size is limited to
+*           "BOOT_CFG_DATA_PAYLOAD_SIZE" and aligned down to flash
+*           write size. Zero requests maximum supported size. Unsupported
+*           frame check type falls back to CRC-8.
+*
+* @param[in]    payload_size    - Requested flash data payload size in bytes
+* @param[in]    crc_type        - Requested frame check type
 * @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-void boot_com_connect_msg_rcv_cb(void)
+void boot_com_connect_msg_rcv_cb(const uint16_t payload_size, const uint8_t crc_type)
 {
-    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+    boot_msg_status_t   msg_status  = eBOOT_MSG_OK;
+    uint8_t             crc_neg     = BOOT_COM_CRC_TYPE_CRC8;
 
     // In IDLE state
     if ( eBOOT_STATE_IDLE == boot_get_state())
     {
+        // Negotiate flash data payload size
+        if  (   ( 0U == payload_size )
+            ||  ( payload_size > BOOT_CFG_DATA_PAYLOAD_SIZE ))
+        {
+            g_boot_payload_size = BOOT_CFG_DATA_PAYLOAD_SIZE;
+        }
+        else if ( payload_size < BOOT_CFG_FLASH_WRITE_SIZE )
+        {
+            g_boot_payload_size = BOOT_CFG_FLASH_WRITE_SIZE;
+        }
+        else
+        {
+            g_boot_payload_size = (uint16_t)( payload_size - ( payload_size % BOOT_CFG_FLASH_WRITE_SIZE ));
+        }
+
+        // Negotiate frame check type
+        if ( true == boot_com_crc_type_is_supported( crc_type ))
+        {
+            crc_neg = crc_type;
+        }
+
         // Stay in bootloader -> reason communication
         boot_shared_mem_set_boot_reason( eBOOT_REASON_COM );
 
+        // New session statistics
+        #if ( 1 == BOOT_CFG_STATS_EN )
+            boot_stats_clear();
+        #endif
+
         // Enter PREPARE state
         fsm_goto_state( g_boot_fsm, eBOOT_STATE_PREPARE );
     }
@@ -1044,39 +5780,81 @@ void boot_com_connect_msg_rcv_cb(void)
     }
 
     // Send connect msg response
-    boot_com_send_connect_rsp( msg_status );
+    boot_com_send_connect_rsp( g_boot_payload_size, crc_neg, msg_status );
+
+    // Following frames are checked with negotiated type
+    boot_com_set_crc_type( crc_neg );
 
     BOOT_DBG_PRINT( "Connect msg received...");
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Connect Response Bootloader Message Reception Callback
+*       Prepare Bootloader Message Reception Callback
 *
-* @param[in]    msg_status - Status of connect command
+* @param[in]    p_head - Image (app) header
 * @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-void boot_com_connect_rsp_msg_rcv_cb(const boot_msg_status_t msg_status)
+void boot_com_prepare_msg_rcv_cb(const ver_image_header_t * const p_head)
 {
-    // Unused
-    (void) msg_status;
+    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+
+    // In PREPARE state
+    if ( eBOOT_STATE_PREPARE == boot_get_state())
+    {
+        // Pre-validate image
+        msg_status = boot_pre_validate_image( p_head );
+
+        // Image validation OK
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            // Erase flash and store image header
+            msg_status = boot_flash_start( p_head );
+        }
+    }
+
+    // Not in PREPARE state
+    else
+    {
+        msg_status = eBOOT_MSG_ERROR_INVALID_REQ;
+    }
+
+    // Enter FLASH state if every operation is OK
+    if ( eBOOT_MSG_OK == msg_status )
+    {
+        fsm_goto_state( g_boot_fsm, eBOOT_STATE_FLASH );
+    }
+
+    // Some problems during prepare operation -> enter IDLE state and wait for next command from Boot Manager
+    else
+    {
+        fsm_goto_state( g_boot_fsm, eBOOT_STATE_IDLE );
+    }
+
+    // Send prepare msg response
+    boot_com_send_prepare_rsp( msg_status );
 
-    // No actions...
-    // TODO: Boot Manager implementation here...
+    BOOT_DBG_PRINT( "Prepare msg received...");
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Prepare Bootloader Message Reception Callback
+*       Prepare or Resume Bootloader Message Reception Callback
+*
+* @note     Same as prepare command, but upgrade interrupted in the middle
+*           continues from stored checkpoint. Response carries image offset
+*           Boot Manager shall continue streaming from (0 for fresh start).
+*           Sequence numbers of sequenced flash data restart at 0.
 *
 * @param[in]    p_head - Image (app) header
 * @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-void boot_com_prepare_msg_rcv_cb(const ver_image_header_t * const p_head)
+void boot_com_prepare_resume_msg_rcv_cb(const ver_image_header_t * const p_head)
 {
-    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+    boot_msg_status_t   msg_status  = eBOOT_MSG_OK;
+    uint32_t            ofs         = 0U;
 
     // In PREPARE state
     if ( eBOOT_STATE_PREPARE == boot_get_state())
@@ -1087,8 +5865,8 @@ void boot_com_prepare_msg_rcv_cb(const ver_image_header_t * const p_head)
         // Image validation OK
         if ( eBOOT_MSG_OK == msg_status )
         {
-            // Prepare flash memory for new image
-            msg_status = boot_prepare_flash( BOOT_CFG_APP_HEAD_ADDR, p_head->data.image_size );
+            // Erase flash or continue from checkpoint
+            msg_status = boot_flash_prepare_resume( p_head, &ofs );
         }
     }
 
@@ -1101,149 +5879,178 @@ void boot_com_prepare_msg_rcv_cb(const ver_image_header_t * const p_head)
     // Enter FLASH state if every operation is OK
     if ( eBOOT_MSG_OK == msg_status )
     {
-        // Flash application header
-        if ( eBOOT_OK == boot_if_flash_write( p_head->data.image_addr, sizeof( ver_image_header_t ), (const uint8_t*) p_head ))
+        fsm_goto_state( g_boot_fsm, eBOOT_STATE_FLASH );
+    }
+
+    // Some problems during prepare operation -> enter IDLE state and wait for next command from Boot Manager
+    else
+    {
+        ofs = 0U;
+
+        fsm_goto_state( g_boot_fsm, eBOOT_STATE_IDLE );
+    }
+
+    // Send prepare or resume msg response
+    boot_com_send_prepare_resume_rsp( ofs, msg_status );
+
+    BOOT_DBG_PRINT( "Prepare or resume msg received...");
+}
+
+#if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Prepare Skip Bootloader Message Reception Callback
+    *
+    * @note     Same as prepare command, but sectors cleared in map are kept
+    *           unchanged and their data is not sent by Boot Manager. Response
+    *           carries applied map. Only plain images are supported.
+    *
+    * @param[in]    p_head  - Image (app) header
+    * @param[in]    p_map   - Sector map, set bit - program sector
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void boot_com_prepare_skip_msg_rcv_cb(const ver_image_header_t * const p_head, const uint8_t * const p_map)
+    {
+                boot_msg_status_t   msg_status                  = eBOOT_MSG_OK;
+        static  uint8_t             applied[BOOT_SKIP_MAP_SIZE] = {0};
+
+        // In PREPARE state
+        if ( eBOOT_STATE_PREPARE == boot_get_state())
         {
-            fsm_goto_state( g_boot_fsm, eBOOT_STATE_FLASH );
+            // Pre-validate image
+            msg_status = boot_pre_validate_image( p_head );
 
-            // Prepare flashing data
-            g_boot_flashing.fw_size      = ( p_head->data.image_size );
-            g_boot_flashing.working_addr = ( p_head->data.image_addr + sizeof( ver_image_header_t ));
+            // Kept sectors must hold image data as is
+            if  (   ( eVER_IMAGE_TYPE_APP != p_head->ctrl.image_type )
+                ||  ( BOOT_COMP_TYPE_NONE != BOOT_IMAGE_COMP_TYPE( p_head )))
+            {
+                msg_status = eBOOT_MSG_ERROR_VALIDATION;
+            }
+
+            // Image validation OK
+            if ( eBOOT_MSG_OK == msg_status )
+            {
+                // Erase changed sectors and store image header
+                boot_flash_skip_set( p_map, applied );
+                msg_status = boot_flash_begin( p_head );
+            }
         }
 
-        // Flashing application header error
+        // Not in PREPARE state
         else
         {
-            msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+            msg_status = eBOOT_MSG_ERROR_INVALID_REQ;
         }
-    }
 
-    // Some problems during prepare operation -> enter IDLE state and wait for next command from Boot Manager
-    else
-    {
-        fsm_goto_state( g_boot_fsm, eBOOT_STATE_IDLE );
-    }
+        // Enter FLASH state if every operation is OK
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            fsm_goto_state( g_boot_fsm, eBOOT_STATE_FLASH );
+        }
+
+        // Some problems during prepare operation -> enter IDLE state and wait for next command from Boot Manager
+        else
+        {
+            fsm_goto_state( g_boot_fsm, eBOOT_STATE_IDLE );
+        }
 
-    // Send prepare msg response
-    boot_com_send_prepare_rsp( msg_status );
+        // Send prepare skip msg response
+        boot_com_send_prepare_skip_rsp( applied, msg_status );
 
-    BOOT_DBG_PRINT( "Prepare msg received...");
-}
+        BOOT_DBG_PRINT( "Prepare skip msg received...");
+    }
+
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Prepare Response Bootloader Message Reception Callback
+*       Flash Bootloader Message Reception Callback
 *
-* @param[in]    msg_status - Status of prepare command
+* @param[in]    p_data  - Flash binary data
+* @param[in]    size    - Size of flash data in bytes
 * @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-void boot_com_prepare_rsp_msg_rcv_cb(const boot_msg_status_t msg_status)
+void boot_com_flash_msg_rcv_cb(const uint8_t * const p_data, const uint16_t size)
 {
-    // Unused
-    (void) msg_status;
+    // Flash data
+    const boot_msg_status_t msg_status = boot_flash_data( p_data, size, false, 0U );
 
-    // No actions...
-    // TODO: Boot Manager implementation here...
+    // Send flash msg response
+    // NOTE: With asynchronous flash writes response is sent once data is written!
+    if  (   ( false == boot_flash_rsp_is_deferred())
+        ||  ( eBOOT_MSG_OK != msg_status ))
+    {
+        boot_com_send_flash_rsp( msg_status );
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Flash Bootloader Message Reception Callback
+*       Sequenced Flash Bootloader Message Reception Callback
+*
+* @note     Only frame with next expected sequence number is flashed. Response
+*           is cumulative acknowledge with next expected sequence number:
 *
+*               - Expected frame:   Flashed, acknowledged with OK
+*               - Repeated frame:   Already flashed, acknowledged again with OK
+*               - Frame after gap:  Dropped, not acknowledged (NACK) with
+*                                   "eBOOT_MSG_ERROR_INVALID_REQ"
+*
+*           Boot Manager shall retransmit all frames starting from next
+*           expected sequence number on NACK or on acknowledge timeout.
+*
+* @param[in]    seq     - Sequence number of frame
 * @param[in]    p_data  - Flash binary data
 * @param[in]    size    - Size of flash data in bytes
 * @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-void boot_com_flash_msg_rcv_cb(const uint8_t * const p_data, const uint16_t size)
+void boot_com_flash_seq_msg_rcv_cb(const uint16_t seq, const uint8_t * const p_data, const uint16_t size)
 {
-    boot_msg_status_t msg_status = eBOOT_MSG_OK;
+    boot_msg_status_t   msg_status  = eBOOT_MSG_OK;
+    bool                send_rsp    = true;
 
-    // In FLASHING state
-    if ( eBOOT_STATE_FLASH == boot_get_state())
+    // Expected frame
+    if ( seq == g_boot_flashing.seq_next )
     {
-        // All data has been flashed
-        if ( g_boot_flashing.flashed_bytes < g_boot_flashing.fw_size )
-        {
-         #if ( 1 == BOOT_CFG_CRYPTION_EN )
-
-            static uint8_t decrypted_data[BOOT_CFG_DATA_PAYLOAD_SIZE] = {0};
-
-            BOOT_ASSERT( size < BOOT_CFG_DATA_PAYLOAD_SIZE );
+        msg_status = boot_flash_data( p_data, size, true, seq );
 
-            // Decrypt data
-            boot_if_decrypt_data( p_data, (uint8_t*) &decrypted_data, size );
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            g_boot_flashing.seq_next++;
 
-            // Flash decrypted data
-            if ( eBOOT_OK == boot_if_flash_write( g_boot_flashing.working_addr, size, (uint8_t*) &decrypted_data ))
-          #else
-            // Flash data
-            if ( eBOOT_OK == boot_if_flash_write( g_boot_flashing.working_addr, size, p_data ))
-         #endif
+            // Acknowledge is sent once data is written
+            if ( true == boot_flash_rsp_is_deferred())
             {
-                // Increment working address
-                g_boot_flashing.working_addr += size;
-
-                // Increment flashed bytes
-                g_boot_flashing.flashed_bytes += size;
-
-                // Complete FW image flashed
-                if ( g_boot_flashing.flashed_bytes == g_boot_flashing.fw_size )
-                {
-                    // Image flashed completely -> enter EXIT state
-                    fsm_goto_state( g_boot_fsm, eBOOT_STATE_EXIT );
-                }
+                send_rsp = false;
             }
-
-            // Flashing error
             else
             {
-                msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
+                g_boot_flashing.seq_ack = g_boot_flashing.seq_next;
             }
         }
+    }
 
-        // Shall not ended up here as compete firmware are flashed
-        else
-        {
-            msg_status = eBOOT_MSG_ERROR_FLASH_WRITE;
-        }
+    // Repeated frame (acknowledge lost) -> acknowledge again
+    else if (((uint16_t)( g_boot_flashing.seq_next - seq )) <= BOOT_CFG_FLASH_WINDOW_SIZE )
+    {
+        // No actions...
     }
 
-    // Not in FLASH state
+    // Frame(s) in between missing -> request retransmission
     else
     {
         msg_status = eBOOT_MSG_ERROR_INVALID_REQ;
     }
 
-    if ( eBOOT_MSG_OK != msg_status )
+    // Send (cumulative) acknowledge
+    if ( true == send_rsp )
     {
-        // Something not OK, enter IDLE state
-        fsm_goto_state( g_boot_fsm, eBOOT_STATE_IDLE );
-
-        // Erase application header
-        (void) boot_app_head_erase();
+        boot_com_send_flash_seq_rsp((( eBOOT_MSG_OK == msg_status ) ? g_boot_flashing.seq_ack : g_boot_flashing.seq_next ), msg_status );
     }
-
-    // Send flash msg response
-    boot_com_send_flash_rsp( msg_status );
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Flash Response Bootloader Message Reception Callback
-*
-* @param[in]    msg_status - Status of flash command
-* @return       void
-*/
-////////////////////////////////////////////////////////////////////////////////
-void boot_com_flash_rsp_msg_rcv_cb(const boot_msg_status_t msg_status)
-{
-    // Unused
-    (void) msg_status;
-
-    // No actions...
-    // TODO: Boot Manager implementation here...
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1261,8 +6068,11 @@ void boot_com_exit_msg_rcv_cb(void)
     if ( eBOOT_STATE_EXIT == boot_get_state())
     {
         // Application image validated OK
-        if ( eBOOT_OK == boot_fw_image_validate())
+        if ( eBOOT_OK == boot_flash_finish())
         {
+            // Boot new image from now on
+            boot_flash_activate();
+
             // Send exit msg response
             boot_com_send_exit_rsp( eBOOT_MSG_OK );
 
@@ -1285,7 +6095,7 @@ void boot_com_exit_msg_rcv_cb(void)
             msg_status = eBOOT_MSG_ERROR_VALIDATION;
 
             // Erase application header
-            (void) boot_app_head_erase();
+            (void) boot_app_head_erase( g_boot_slot_target );
 
             // Something not OK, enter IDLE state
             fsm_goto_state( g_boot_fsm, eBOOT_STATE_IDLE );
@@ -1305,23 +6115,6 @@ void boot_com_exit_msg_rcv_cb(void)
     boot_com_send_exit_rsp( msg_status );
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Exit Response Bootloader Message Reception Callback
-*
-* @param[in]    msg_status - Status of exit command
-* @return       void
-*/
-////////////////////////////////////////////////////////////////////////////////
-void boot_com_exit_rsp_msg_rcv_cb(const boot_msg_status_t msg_status)
-{
-    // Unused
-    (void) msg_status;
-
-    // No actions...
-    // TODO: Boot Manager implementation here...
-}
-
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *       Info Bootloader Message Reception Callback
@@ -1332,12 +6125,30 @@ void boot_com_exit_rsp_msg_rcv_cb(const boot_msg_status_t msg_status)
 void boot_com_info_msg_rcv_cb(void)
 {
     boot_msg_status_t   msg_status  = eBOOT_MSG_OK;
-    uint32_t            boot_ver    = 0U;
+    boot_info_t         info        = {0};
 
     // In IDLE state
     if ( eBOOT_STATE_IDLE == boot_get_state())
     {
-        boot_ver = version_get_sw().U;
+        info.boot_ver       = version_get_sw().U;
+        info.proto_ver      = BOOT_COM_PROTO_VER;
+        info.flash_window   = BOOT_CFG_FLASH_WINDOW_SIZE;
+        info.payload_size   = BOOT_CFG_DATA_PAYLOAD_SIZE;
+        info.write_size     = BOOT_CFG_FLASH_WRITE_SIZE;
+
+        #if ( 1 == BOOT_CFG_VERIFY_EN )
+            info.features  |= BOOT_INFO_FEATURE_VERIFY;
+        #endif
+
+        #if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+            info.features  |= BOOT_INFO_FEATURE_SKIP;
+        #endif
+
+        #if (( 1 == BOOT_CFG_AB_SLOT_EN ) && ( 0 == BOOT_CFG_BANK_SWAP_EN ))
+            info.flash_slot = g_boot_slot_target;
+        #else
+            info.flash_slot = BOOT_SLOT_A;
+        #endif
     }
 
     // Not in IDLE state
@@ -1347,27 +6158,167 @@ void boot_com_info_msg_rcv_cb(void)
     }
 
     // Send info msg response
-    boot_com_send_info_rsp( boot_ver, msg_status );
+    boot_com_send_info_rsp( &info, msg_status );
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Info Response Bootloader Message Reception Callback
-*
-* @param[in]    msg_status  - Bootloader version
-* @param[in]    status      - Status of info command
-* @return       void
-*/
-////////////////////////////////////////////////////////////////////////////////
-void boot_com_info_rsp_msg_rcv_cb(const uint32_t boot_ver, const boot_msg_status_t msg_status)
-{
-    // Unused
-    (void) boot_ver;
-    (void) msg_status;
+#if ( 1 == BOOT_CFG_STATS_EN )
 
-    // No actions...
-    // TODO: Boot Manager implementation here...
-}
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Statistics Bootloader Message Reception Callback
+    *
+    * @note     Statistics are reported in any state.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void boot_com_stats_msg_rcv_cb(void)
+    {
+        boot_stats_t stats = {0};
+
+        memcpy( &stats, &g_boot_stats, sizeof( boot_stats_t ));
+
+        stats.session_us = (( BOOT_GET_SYSTICK() - gu32_stats_session_ms ) * 1000U );
+        boot_com_get_stats( &stats.com );
+
+        // Send stats msg response
+        boot_com_send_stats_rsp( &stats, eBOOT_MSG_OK );
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_VERIFY_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Verify Bootloader Message Reception Callback
+    *
+    * @note     Verify is served after connect only, it just reads flash.
+    *           Response range tells size rounded to whole sectors.
+    *
+    * @param[in]    p_range - Range to calculate digest of
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void boot_com_verify_msg_rcv_cb(const boot_verify_t * const p_range)
+    {
+        boot_verify_rsp_t rsp        = {0};
+        uint32_t          size       = 0U;
+        boot_msg_status_t msg_status = boot_verify_check( p_range, &size );
+
+        memcpy( &rsp.range, p_range, sizeof( boot_verify_t ));
+        rsp.range.size = size;
+
+        // Calculate digest of range
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            if ( eBOOT_OK != boot_verify_digest( p_range->addr, size, p_range->type, (uint8_t*) &rsp.digest ))
+            {
+                msg_status = eBOOT_MSG_ERROR_VALIDATION;
+            }
+        }
+
+        // Send verify msg response
+        boot_com_send_verify_rsp( &rsp, msg_status );
+
+        BOOT_DBG_PRINT( "Verify msg received...");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Verify Sectors Bootloader Message Reception Callback
+    *
+    * @note     Range is split by flash sector map, last sector is taken
+    *           as whole. At most "BOOT_VERIFY_SECTORS_MAX" sectors are
+    *           reported, response range tells covered part.
+    *
+    * @param[in]    p_range - Range to calculate sector digests of
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void boot_com_verify_sectors_msg_rcv_cb(const boot_verify_t * const p_range)
+    {
+        static  boot_verify_sectors_rsp_t   rsp             = {0};
+                uint32_t                    range_end       = 0U;
+                boot_msg_status_t           msg_status      = boot_verify_check( p_range, &range_end );
+        const   uint32_t                    entry_size      = ( sizeof( uint32_t ) + BOOT_VERIFY_DIGEST_SIZE( p_range->type ));
+                uint32_t                    addr            = p_range->addr;
+                uint32_t                    sector_start    = 0U;
+                uint32_t                    sector_size     = 0U;
+
+        memset( &rsp, 0U, sizeof( boot_verify_sectors_rsp_t ));
+        memcpy( &rsp.range, p_range, sizeof( boot_verify_t ));
+
+        range_end += p_range->addr;
+
+        // Digest sector by sector
+        while   (   ( eBOOT_MSG_OK == msg_status )
+                &&  ( addr < range_end )
+                &&  ( rsp.num_of < BOOT_VERIFY_SECTORS_MAX ))
+        {
+            uint8_t * const p_entry = &rsp.entry[ rsp.num_of * entry_size ];
+
+            // Range outside of sector map
+            if ( eBOOT_OK != boot_flash_sector_get( addr, &sector_start, &sector_size ))
+            {
+                msg_status = eBOOT_MSG_ERROR_INVALID_REQ;
+            }
+            else
+            {
+                const uint32_t size = ((( sector_start + sector_size ) < range_end ) ? ( sector_start + sector_size ) : range_end ) - addr;
+
+                memcpy( p_entry, &size, sizeof( uint32_t ));
+
+                if ( eBOOT_OK != boot_verify_digest( addr, size, p_range->type, &p_entry[ sizeof( uint32_t ) ]))
+                {
+                    msg_status = eBOOT_MSG_ERROR_VALIDATION;
+                }
+
+                addr += size;
+                rsp.num_of++;
+            }
+        }
+
+        // Report covered part of range
+        rsp.range.size = ( addr - p_range->addr );
+
+        if ( eBOOT_MSG_OK != msg_status )
+        {
+            rsp.num_of = 0U;
+        }
+
+        // Send verify sectors msg response
+        boot_com_send_verify_sectors_rsp( &rsp, msg_status );
+
+        BOOT_DBG_PRINT( "Verify sectors msg received...");
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_BRIDGE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Frame Relayed To Downstream Node Callback
+    *
+    * @note     Bridge stays in bootloader while Boot Manager upgrades
+    *           downstream nodes, even if it is not upgraded itself.
+    *
+    * @param[in]    node - Addressed downstream node
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void boot_com_bridge_msg_rcv_cb(const uint8_t node)
+    {
+        (void) node;
+
+        if ( eBOOT_REASON_NONE == g_boot_shared_mem.data.boot_reason )
+        {
+            boot_shared_mem_set_boot_reason( eBOOT_REASON_COM );
+        }
+    }
+
+#endif
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1402,6 +6353,10 @@ boot_status_t boot_init(void)
 {
     boot_status_t status = eBOOT_OK;
 
+    #if ( BOOT_CFG_SHARED_MEM_EXT_SIZE > 0U )
+        gu32_boot_start_ms = BOOT_GET_SYSTICK();
+    #endif
+
     // Set shared memory version
     boot_init_shared_mem();
 
@@ -1414,17 +6369,82 @@ boot_status_t boot_init(void)
     // Initialize bootloader interfaces
     status |= boot_if_init();
 
+    // Application slots shall be erasable, without data in front of them
+    if ( eBOOT_OK != boot_slot_map_check())
+    {
+        BOOT_ASSERT( 0 );
+        status = eBOOT_ERROR;
+    }
+
+    // Select application image slots
+    (void) boot_slot_select();
+
     // Iniatilize (handle) boot counter
     boot_init_boot_counter();
 
+    #if (( BOOT_CFG_SHARED_MEM_EXT_SIZE > 0U ) && ( 1 == BOOT_CFG_RESUME_EN ))
+
+        // Report interrupted upgrade to application
+        static boot_resume_rec_t resume_rec = {0};
+
+        if ( eBOOT_OK == boot_resume_read( &resume_rec ))
+        {
+            boot_shared_mem_resume_t resume = {0};
+
+            resume.ofs = resume_rec.ofs;
+            memcpy( &resume.head_id, resume_rec.head_hash, sizeof( resume.head_id ));
+
+            (void) boot_shared_mem_ext_publish( eBOOT_SHARED_MEM_EXT_RESUME, &resume, sizeof( resume ));
+            boot_shared_mem_update();
+        }
+
+    #endif
+
+    #if ( 1 == BOOT_CFG_FAST_BOOT_EN )
+
+        // Back-door window runs from here, thus it overlaps image validation
+        const uint32_t  backdoor_ts = BOOT_GET_SYSTICK();
+        const bool      backdoor    = boot_backdoor_requested();
+
+    #endif
+
     // No reason to stay in bootloader
     if ( eBOOT_REASON_NONE == g_boot_shared_mem.data.boot_reason )
     {
+        // Validate application image
+        BOOT_STATS_START( valid_ts );
+        const boot_status_t valid_status = boot_fw_image_validate_slots();
+
+        // Report validation time to application
+        // NOTE: Statistics are not cleared by init, time of this boot only!
+        #if ( 1 == BOOT_CFG_STATS_EN )
+            g_boot_stats.boot_valid_us = 0U;
+            BOOT_STATS_STOP( valid_ts, boot_valid_us );
+
+            g_boot_shared_mem.data.valid_us = g_boot_stats.boot_valid_us;
+            boot_shared_mem_update();
+        #endif
+
         // Application image validated OK
-        if ( eBOOT_OK == boot_fw_image_validate())
+        if ( eBOOT_OK == valid_status )
         {
-            // Back door entry for bootloader
-            boot_wait( BOOT_CFG_WAIT_AT_STARTUP_MS );
+            #if ( 1 == BOOT_CFG_FAST_BOOT_EN )
+
+                // Back door entry only on request
+                if ( true == backdoor )
+                {
+                    const uint32_t elapsed = (uint32_t)( BOOT_GET_SYSTICK() - backdoor_ts );
+
+                    // Rest of window, but at least handle frames received during validation
+                    boot_wait((( elapsed < BOOT_CFG_WAIT_AT_STARTUP_MS ) ? ( BOOT_CFG_WAIT_AT_STARTUP_MS - elapsed ) : 1U ));
+                }
+
+            #else
+
+                // Back door entry for bootloader
+                boot_wait( BOOT_CFG_WAIT_AT_STARTUP_MS );
+
+            #endif
 
             // Check if reason has change from the back door
             if ( eBOOT_REASON_NONE == g_boot_shared_mem.data.boot_reason )
@@ -1435,6 +6455,14 @@ boot_status_t boot_init(void)
 
             // This line is not reached as CPU starts executing application code...
         }
+
+        // Application corrupted -> try to install staged image
+        #if ( 1 == BOOT_CFG_EXT_FLASH_EN )
+            else
+            {
+                boot_shared_mem_set_boot_reason( eBOOT_REASON_FLASH );
+            }
+        #endif
     }
     else
     {
@@ -1462,13 +6490,13 @@ boot_status_t boot_hndl(void)
 {
     boot_status_t status = eBOOT_OK;
 
-    // TODO: Based on boot reason handle either communication or memory
-
     // Handle bootloader communication
     status |= boot_com_hndl();
 
     // Handle memory boot procedure
-    // status |= boot_nvm_hndl();
+    #if ( 1 == BOOT_CFG_EXT_FLASH_EN )
+        status |= boot_nvm_hndl();
+    #endif
 
     // Handle FSM
     (void) fsm_hndl( g_boot_fsm );
@@ -1513,7 +6541,7 @@ boot_status_t boot_shared_mem_get_version(uint8_t * const p_version)
     if ( NULL != p_version )
     {
         // Validate shared memory
-        if ( g_boot_shared_mem.ctrl.crc == boot_shared_mem_calc_crc((const boot_shared_mem_t *) &g_boot_shared_mem ))
+        if ( true == boot_shared_mem_is_valid())
         {
             *p_version = g_boot_shared_mem.ctrl.ver;
         }
@@ -1546,7 +6574,7 @@ boot_status_t boot_shared_mem_set_boot_reason(const boot_reason_t reason)
     g_boot_shared_mem.data.boot_reason = reason;
 
     // Calculate CRC
-    g_boot_shared_mem.ctrl.crc = boot_shared_mem_calc_crc((const boot_shared_mem_t *) &g_boot_shared_mem );
+    boot_shared_mem_update();
 
     return status;
 }
@@ -1571,7 +6599,7 @@ boot_status_t boot_shared_mem_get_boot_reason(boot_reason_t * const p_reason)
     if ( NULL != p_reason )
     {
         // Validate shared memory
-        if ( g_boot_shared_mem.ctrl.crc == boot_shared_mem_calc_crc((const boot_shared_mem_t *) &g_boot_shared_mem ))
+        if ( true == boot_shared_mem_is_valid())
         {
             *p_reason = g_boot_shared_mem.data.boot_reason;
         }
@@ -1604,7 +6632,7 @@ boot_status_t boot_shared_mem_set_boot_cnt(const uint8_t cnt)
     g_boot_shared_mem.data.boot_cnt = cnt;
 
     // Calculate CRC
-    g_boot_shared_mem.ctrl.crc = boot_shared_mem_calc_crc((const boot_shared_mem_t *) &g_boot_shared_mem );
+    boot_shared_mem_update();
 
     return status;
 }
@@ -1632,7 +6660,7 @@ boot_status_t boot_shared_mem_get_boot_cnt(uint8_t * const p_cnt)
     if ( NULL != p_cnt )
     {
         // Validate shared memory
-        if ( g_boot_shared_mem.ctrl.crc == boot_shared_mem_calc_crc((const boot_shared_mem_t *) &g_boot_shared_mem ))
+        if ( true == boot_shared_mem_is_valid())
         {
             *p_cnt = g_boot_shared_mem.data.boot_cnt;
         }
@@ -1669,7 +6697,7 @@ boot_status_t boot_shared_mem_get_boot_ver(uint32_t * const p_boot_ver)
     if ( NULL != p_boot_ver )
     {
         // Validate shared memory
-        if ( g_boot_shared_mem.ctrl.crc == boot_shared_mem_calc_crc((const boot_shared_mem_t *) &g_boot_shared_mem ))
+        if ( true == boot_shared_mem_is_valid())
         {
             *p_boot_ver = g_boot_shared_mem.data.boot_ver;
         }
@@ -1686,6 +6714,144 @@ boot_status_t boot_shared_mem_get_boot_ver(uint32_t * const p_boot_ver)
     return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get last boot image validation time
+*
+* @note     Function return "eBOOT_ERROR_CRC" in case of shared memory
+*           data corruption! Time is zero if statistics are disabled or
+*           image was not validated at last boot.
+*
+* @param[out]   p_valid_us  - Image validation time in microseconds
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_shared_mem_get_valid_time(uint32_t * const p_valid_us)
+{
+    boot_status_t status = eBOOT_OK;
+
+    BOOT_ASSERT( NULL != p_valid_us );
+
+    if ( NULL != p_valid_us )
+    {
+        // Validate shared memory
+        if ( true == boot_shared_mem_is_valid())
+        {
+            *p_valid_us = g_boot_shared_mem.data.valid_us;
+        }
+        else
+        {
+            status = eBOOT_ERROR_CRC;
+        }
+    }
+    else
+    {
+        status = eBOOT_ERROR;
+    }
+
+    return status;
+}
+
+#if ( BOOT_CFG_SHARED_MEM_EXT_SIZE > 0U )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set shared memory extension record
+    *
+    * @note     Existing record of same type is replaced. Record types from
+    *           "eBOOT_SHARED_MEM_EXT_APP" up are free for application use.
+    *
+    * @note     Function return "eBOOT_ERROR_CRC" in case of shared memory
+    *           data corruption!
+    *
+    * @param[in]    type    - Record type, shall be value of @boot_shared_mem_ext_t
+    * @param[in]    p_value - Record value, NULL removes record
+    * @param[in]    size    - Record value size
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    boot_status_t boot_shared_mem_set_ext(const uint8_t type, const void * const p_value, const uint8_t size)
+    {
+        boot_status_t status = eBOOT_OK;
+
+        BOOT_ASSERT( eBOOT_SHARED_MEM_EXT_END != type );
+
+        if ( eBOOT_SHARED_MEM_EXT_END != type )
+        {
+            if ( true == boot_shared_mem_is_valid())
+            {
+                status = boot_shared_mem_ext_publish( type, p_value, size );
+
+                // Calculate CRC
+                boot_shared_mem_update();
+            }
+            else
+            {
+                status = eBOOT_ERROR_CRC;
+            }
+        }
+        else
+        {
+            status = eBOOT_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get shared memory extension record
+    *
+    * @note     Function return "eBOOT_ERROR_CRC" in case of shared memory
+    *           data corruption and "eBOOT_ERROR" if record is missing or of
+    *           other size!
+    *
+    * @param[in]    type    - Record type, shall be value of @boot_shared_mem_ext_t
+    * @param[out]   p_value - Record value
+    * @param[in]    size    - Record value size
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    boot_status_t boot_shared_mem_get_ext(const uint8_t type, void * const p_value, const uint8_t size)
+    {
+        boot_status_t   status  = eBOOT_OK;
+        uint32_t        end     = 0U;
+
+        BOOT_ASSERT( NULL != p_value );
+
+        if ( NULL != p_value )
+        {
+            // Validate shared memory
+            if ( true == boot_shared_mem_is_valid())
+            {
+                const uint32_t found = boot_shared_mem_ext_find( type, &end );
+
+                if  (   ( BOOT_SHARED_MEM_EXT_NONE != found )
+                    &&  ( eBOOT_SHARED_MEM_EXT_END != type )
+                    &&  ( size == g_boot_shared_mem.ext.tlv[ found + 1U ] ))
+                {
+                    memcpy( p_value, (const uint8_t*) &g_boot_shared_mem.ext.tlv[ found + BOOT_SHARED_MEM_EXT_HEAD_SIZE ], size );
+                }
+                else
+                {
+                    status = eBOOT_ERROR;
+                }
+            }
+            else
+            {
+                status = eBOOT_ERROR_CRC;
+            }
+        }
+        else
+        {
+            status = eBOOT_ERROR;
+        }
+
+        return status;
+    }
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
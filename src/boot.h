@@ -39,7 +39,7 @@
  *  Module version
  */
 #define BOOT_VER_MAJOR          ( 1 )
-#define BOOT_VER_MINOR          ( 0 )
+#define BOOT_VER_MINOR          ( 1 )
 #define BOOT_VER_DEVELOP        ( 0 )
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -55,6 +55,12 @@ boot_status_t   boot_shared_mem_get_boot_reason     (boot_reason_t * const p_rea
 boot_status_t   boot_shared_mem_set_boot_cnt        (const uint8_t cnt);
 boot_status_t   boot_shared_mem_get_boot_cnt        (uint8_t * const p_cnt);
 boot_status_t   boot_shared_mem_get_boot_ver        (uint32_t * const p_boot_ver);
+boot_status_t   boot_shared_mem_get_valid_time      (uint32_t * const p_valid_us);
+
+#if ( BOOT_CFG_SHARED_MEM_EXT_SIZE > 0U )
+    boot_status_t   boot_shared_mem_set_ext         (const uint8_t type, const void * const p_value, const uint8_t size);
+    boot_status_t   boot_shared_mem_get_ext         (const uint8_t type, void * const p_value, const uint8_t size);
+#endif
 
 #endif // __BOOT_H
 
@@ -26,6 +26,7 @@
 #include <string.h>
 
 #include "boot_com.h"
+#include "boot_crc.h"
 #include "../../boot_cfg.h"
 #include "../../boot_if.h"
 
@@ -56,12 +57,24 @@ typedef enum
     eBOOT_MSG_CMD_CONNECT_RSP   = (uint8_t)( 0x11U ),       /**<Connect response command*/
     eBOOT_MSG_CMD_PREPARE       = (uint8_t)( 0x20U ),       /**<Prepare command */
     eBOOT_MSG_CMD_PREPARE_RSP   = (uint8_t)( 0x21U ),       /**<Prepare response command*/
+    eBOOT_MSG_CMD_PREPARE_RESUME        = (uint8_t)( 0x22U ),   /**<Prepare or resume command */
+    eBOOT_MSG_CMD_PREPARE_RESUME_RSP    = (uint8_t)( 0x23U ),   /**<Prepare or resume response command*/
     eBOOT_MSG_CMD_FLASH         = (uint8_t)( 0x30U ),       /**<Flash data command */
     eBOOT_MSG_CMD_FLASH_RSP     = (uint8_t)( 0x31U ),       /**<Flash data response command*/
+    eBOOT_MSG_CMD_FLASH_SEQ     = (uint8_t)( 0x32U ),       /**<Sequenced flash data command */
+    eBOOT_MSG_CMD_FLASH_SEQ_RSP = (uint8_t)( 0x33U ),       /**<Sequenced flash data response (acknowledge) command*/
     eBOOT_MSG_CMD_EXIT          = (uint8_t)( 0x40U ),       /**<Exit command */
     eBOOT_MSG_CMD_EXIT_RSP      = (uint8_t)( 0x41U ),       /**<Exit response command*/
+    eBOOT_MSG_CMD_VERIFY        = (uint8_t)( 0x50U ),       /**<Verify (range digest) command */
+    eBOOT_MSG_CMD_VERIFY_RSP    = (uint8_t)( 0x51U ),       /**<Verify response command */
+    eBOOT_MSG_CMD_VERIFY_SECTORS        = (uint8_t)( 0x52U ),   /**<Verify sectors (per sector digests) command */
+    eBOOT_MSG_CMD_VERIFY_SECTORS_RSP    = (uint8_t)( 0x53U ),   /**<Verify sectors response command */
+    eBOOT_MSG_CMD_PREPARE_SKIP          = (uint8_t)( 0x60U ),   /**<Prepare with skip sector map command */
+    eBOOT_MSG_CMD_PREPARE_SKIP_RSP      = (uint8_t)( 0x61U ),   /**<Prepare with skip sector map response command */
     eBOOT_MSG_CMD_INFO          = (uint8_t)( 0xA0U ),       /**<Information command */
     eBOOT_MSG_CMD_INFO_RSP      = (uint8_t)( 0xA1U ),       /**<Information response command*/
+    eBOOT_MSG_CMD_STATS         = (uint8_t)( 0xA2U ),       /**<Statistics command */
+    eBOOT_MSG_CMD_STATS_RSP     = (uint8_t)( 0xA3U ),       /**<Statistics response command */
 } boot_cmd_opt_t;
 
 /**
@@ -71,8 +84,29 @@ typedef enum
 {
     eCOM_MSG_SRC_BOOT_MANAGER   = (uint8_t)( 0x2BU ),     /**<Message from Boot Manager (pc app) */
     eCOM_MSG_SRC_BOOTLOADER     = (uint8_t)( 0xB2U ),     /**<Message from Bootloader (embedded) */
+    eCOM_MSG_SRC_BOOT_MANAGER_NODE  = (uint8_t)( 0x50U ), /**<Message from Boot Manager to node 1..15 (low nibble) */
+    eCOM_MSG_SRC_BOOTLOADER_NODE    = (uint8_t)( 0xD0U ), /**<Message from Bootloader of node 1..15 (low nibble) */
 } boot_msg_src_t;
 
+/**
+ *  Message source of node
+ *
+ *  @note   Node 0 keeps original sources, thus bootloaders and Boot
+ *          Managers without node addressing stay compatible.
+ */
+#define BOOT_COM_SRC_MNGR(node)             ((uint8_t)(( 0U == (node)) ? eCOM_MSG_SRC_BOOT_MANAGER : ( eCOM_MSG_SRC_BOOT_MANAGER_NODE | (node))))
+#define BOOT_COM_SRC_BOOT(node)             ((uint8_t)(( 0U == (node)) ? eCOM_MSG_SRC_BOOTLOADER   : ( eCOM_MSG_SRC_BOOTLOADER_NODE   | (node))))
+
+/**
+ *  Invalid node, message source is not of any node
+ */
+#define BOOT_COM_NODE_NONE                  ( 0xFFU )
+
+/**
+ *  Node address shall fit into low nibble of message source
+ */
+BOOT_CFG_STATIC_ASSERT( BOOT_CFG_COM_NODE_ID < BOOT_COM_NODE_NUM_OF );
+
 /**
  *  Bootloader header fields
  */
@@ -101,15 +135,39 @@ typedef union
 BOOT_CFG_STATIC_ASSERT( sizeof(boot_header_t) == 8U );
 
 /**
- *  Prepare command payload
+ *  Sequence number size in sequenced flash data command payload
  */
-typedef struct
-{
-    uint32_t fw_size;   /**<Size of firmware in bytes */
-    uint32_t fw_ver;    /**<Firmware version */
-    uint32_t hw_ver;    /**<Hardware version */
-} boot_prepare_payload_t;
+#define BOOT_COM_FLASH_SEQ_SIZE             ( sizeof( uint16_t ))
+
+/**
+ *  Resume offset size in prepare or resume response payload
+ */
+#define BOOT_COM_RESUME_OFS_SIZE            ( sizeof( uint32_t ))
+
+/**
+ *  Prepare skip command payload size (image header followed by sector map)
+ */
+#define BOOT_COM_PREPARE_SKIP_SIZE          ( sizeof( ver_image_header_t ) + BOOT_SKIP_MAP_SIZE )
+
+/**
+ *  Connect command and response payload
+ *
+ *  @note   Flash data payload size (uint16), followed by optional frame
+ *          check type (uint8).
+ */
+#define BOOT_COM_CONNECT_SIZE               ( sizeof( uint16_t ))
+#define BOOT_COM_CONNECT_CRC_SIZE           ( BOOT_COM_CONNECT_SIZE + sizeof( uint8_t ))
+
+/**
+ *  Maximum size of frame check trailer
+ */
+#define BOOT_COM_CRC_TRAILER_SIZE_MAX       ( sizeof( uint32_t ))
 
+/**
+ *  Largest flash data frame shall fit into 16-bit length field and reception buffer
+ */
+BOOT_CFG_STATIC_ASSERT(( BOOT_CFG_DATA_PAYLOAD_SIZE + BOOT_COM_FLASH_SEQ_SIZE ) <= 0xFFFFU );
+BOOT_CFG_STATIC_ASSERT(( sizeof(boot_header_t) + BOOT_COM_FLASH_SEQ_SIZE + BOOT_CFG_DATA_PAYLOAD_SIZE + BOOT_COM_CRC_TRAILER_SIZE_MAX ) < BOOT_CFG_RX_BUF_SIZE );
 
 /**
  *  Bootloader Parser Mode
@@ -138,73 +196,225 @@ typedef struct
     boot_parser_mode_t  mode;   /**<Parser mode */
 } boot_parser_t;
 
+/**
+ *  Communication channel
+ *
+ *  @note   Boot Manager drives one channel per device, all state of frame
+ *          reception and negotiated frame check is kept per channel.
+ */
+typedef struct
+{
+    boot_parser_t       parser;     /**<Frame parser */
+    boot_header_t *     p_header;   /**<Header of frame under reception */
+    uint8_t *           p_payload;  /**<Payload of frame under reception */
+    uint8_t             crc_type;   /**<Frame check type negotiated at connect */
+
+    #if ( 1 == BOOT_CFG_COM_MANAGER_EN )
+        uint8_t         node;       /**<Addressed node */
+    #endif
+
+    #if ( 1 == BOOT_CFG_STATS_EN )
+        boot_com_stats_t    stats;  /**<Communication statistics */
+    #endif
+} boot_com_ch_t;
+
 /**
  *  Function pointer for Bootloader parsing
  */
 typedef void(*pf_canm_parse_t)(const boot_header_t * const p_header, const uint8_t * const p_data);
 
 /**
- *  Parsing table
+ *  Parsing table index of command
+ *
+ *  @note   High nibble of command selects group (connect, prepare, flash,
+ *          exit, info), low nibble selects command inside group. Requests
+ *          have even and responses odd low nibble.
  */
-typedef struct
-{
-    pf_canm_parse_t pf_parse;   /**<Pointer to parsing function */
-    boot_cmd_opt_t  cmd;        /**<Message command */
-} boot_parse_table_t;
+#define BOOT_COM_CMD_GROUP(cmd)             ((uint8_t)((cmd) >> 4U ))
+#define BOOT_COM_CMD_INDEX(cmd)             ((uint8_t)((cmd) & 0x0FU ))
+
+/**
+ *  Parsing table size
+ */
+#define BOOT_COM_CMD_GROUP_NUM_OF           ( 16U )
+#define BOOT_COM_CMD_INDEX_NUM_OF           ( 4U )
+
+/**
+ *  Source of received messages
+ *
+ *  @note   Bootloader parses only requests from Boot Manager and Boot
+ *          Manager only responses from Bootloader, thus own (echoed)
+ *          messages are never parsed.
+ */
+#if ( 0 == BOOT_CFG_COM_MANAGER_EN )
+    #define BOOT_COM_RX_SRC                 ( BOOT_COM_SRC_MNGR( BOOT_COM_NODE ))
+#else
+    #define BOOT_COM_RX_SRC                 ( BOOT_COM_SRC_BOOT( BOOT_COM_NODE ))
+#endif
+
+/**
+ *  Own node (Bootloader) or addressed node of selected channel (Boot Manager)
+ */
+#if ( 0 == BOOT_CFG_COM_MANAGER_EN )
+    #define BOOT_COM_NODE                   ( BOOT_CFG_COM_NODE_ID )
+#else
+    #define BOOT_COM_NODE                   ( gp_ch->node )
+#endif
+
+/**
+ *  Bridge is never part of Boot Manager build and shall receive frames of
+ *  downstream nodes with any frame check type
+ */
+BOOT_CFG_STATIC_ASSERT(( 0 == BOOT_CFG_BRIDGE_EN ) || ( 0 == BOOT_CFG_COM_MANAGER_EN ));
+BOOT_CFG_STATIC_ASSERT(( 0 == BOOT_CFG_BRIDGE_EN ) || ( 1 == BOOT_CFG_COM_FRAME_CRC_EN ));
+
+/**
+ *  Parsing table entry of command
+ */
+#define BOOT_COM_PARSE_ENTRY(cmd)           [BOOT_COM_CMD_GROUP(cmd)][BOOT_COM_CMD_INDEX(cmd)]
 
 ////////////////////////////////////////////////////////////////////////////////
 // Function prototypes
 ////////////////////////////////////////////////////////////////////////////////
-static uint8_t          boot_com_calc_crc       (const uint8_t * const p_data, const uint16_t size);
+static uint8_t          boot_com_calc_crc_packet(const boot_header_t * const p_header, const uint8_t * const p_payload);
+static uint16_t         boot_com_crc_size       (const boot_header_t * const p_header);
+static uint8_t          boot_com_crc_type       (const boot_header_t * const p_header);
+static boot_status_t    boot_com_send_frame     (boot_header_t * const p_header, const uint8_t * const p_payload);
+
+#if ( 1 == BOOT_CFG_COM_FRAME_CRC_EN )
+    static uint32_t     boot_com_calc_crc_frame (const boot_header_t * const p_header, const uint8_t * const p_payload);
+#endif
+
 static boot_status_t    boot_parse_idle         (boot_parser_t * const p_parser);
 static boot_status_t    boot_parse_rcv_header   (boot_parser_t * const p_parser, boot_header_t ** pp_header);
 static boot_status_t    boot_parse_rcv_payload  (boot_parser_t * const p_parser, const boot_header_t * const p_header, uint8_t ** pp_payload);
 static bool             boot_timeout_check      (boot_parser_t * const p_parser);
 static boot_status_t    boot_parse_hndl         (boot_header_t ** pp_header, uint8_t ** pp_payload);
-static boot_status_t    boot_buf_idx_increment  (void);
+
+#if ( 1 == BOOT_CFG_RX_BLOCK_EN )
+    static uint16_t         boot_parse_bytes_needed (const boot_parser_t * const p_parser);
+    static boot_status_t    boot_parse_rcv_block    (boot_header_t ** pp_header, uint8_t ** pp_payload);
+#endif
+
+#if ( 0 == BOOT_CFG_RX_BLOCK_EN )
+    static boot_status_t    boot_buf_idx_increment  (void);
+#endif
+
 static boot_status_t    boot_parse              (boot_parser_t * const p_parser, boot_header_t ** pp_header, uint8_t ** pp_payload);
 
-static void 			boot_parse_connect      (const boot_header_t * const p_header, const uint8_t * const p_data);
-static void 			boot_parse_connect_rsp  (const boot_header_t * const p_header, const uint8_t * const p_data);
-static void 			boot_parse_prepare      (const boot_header_t * const p_header, const uint8_t * const p_data);
-static void 			boot_parse_prepare_rsp  (const boot_header_t * const p_header, const uint8_t * const p_data);
-static void 			boot_parse_flash        (const boot_header_t * const p_header, const uint8_t * const p_data);
-static void 			boot_parse_flash_rsp    (const boot_header_t * const p_header, const uint8_t * const p_data);
-static void 			boot_parse_exit         (const boot_header_t * const p_header, const uint8_t * const p_data);
-static void 			boot_parse_exit_rsp     (const boot_header_t * const p_header, const uint8_t * const p_data);
-static void 			boot_parse_info         (const boot_header_t * const p_header, const uint8_t * const p_data);
-static void 			boot_parse_info_rsp     (const boot_header_t * const p_header, const uint8_t * const p_data);
+#if ( 1 == BOOT_CFG_BRIDGE_EN )
+    static uint8_t          boot_bridge_src_node    (const uint8_t source);
+    static boot_status_t    boot_bridge_forward     (const uint8_t ch, const boot_header_t * const p_header);
+    static bool             boot_bridge_upstream_hndl   (const boot_header_t * const p_header);
+    static void             boot_bridge_downstream_hndl (void);
+#endif
+
+#if ( 0 == BOOT_CFG_COM_MANAGER_EN )
+    static void 		boot_parse_connect      (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_prepare      (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_prepare_resume       (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_flash        (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_flash_seq    (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_exit         (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_info         (const boot_header_t * const p_header, const uint8_t * const p_data);
+
+    #if ( 1 == BOOT_CFG_STATS_EN )
+        static void 	boot_parse_stats        (const boot_header_t * const p_header, const uint8_t * const p_data);
+    #endif
+
+    #if ( 1 == BOOT_CFG_VERIFY_EN )
+        static void 	boot_parse_verify       (const boot_header_t * const p_header, const uint8_t * const p_data);
+        static void 	boot_parse_verify_sectors       (const boot_header_t * const p_header, const uint8_t * const p_data);
+    #endif
+
+    #if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+        static void 	boot_parse_prepare_skip (const boot_header_t * const p_header, const uint8_t * const p_data);
+    #endif
+#else
+    static void 		boot_parse_connect_rsp  (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_prepare_rsp  (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_prepare_resume_rsp   (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_flash_rsp    (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_flash_seq_rsp(const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_exit_rsp     (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_info_rsp     (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_stats_rsp    (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_verify_rsp   (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_verify_sectors_rsp   (const boot_header_t * const p_header, const uint8_t * const p_data);
+    static void 		boot_parse_prepare_skip_rsp     (const boot_header_t * const p_header, const uint8_t * const p_data);
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
- *  Bootloader parser
+ *  Communication channels
  */
-static boot_parser_t g_parser = {0};
+static boot_com_ch_t g_com_ch[BOOT_COM_CH_NUM_OF] = {0};
 
 /**
- *      Bootloader Parsing Table
+ *  Selected communication channel
  */
-static const boot_parse_table_t g_parse_table[] =
-{
-    { .cmd = eBOOT_MSG_CMD_CONNECT,         .pf_parse = boot_parse_connect      },
-    { .cmd = eBOOT_MSG_CMD_CONNECT_RSP,     .pf_parse = boot_parse_connect_rsp  },
-    { .cmd = eBOOT_MSG_CMD_PREPARE,         .pf_parse = boot_parse_prepare      },
-    { .cmd = eBOOT_MSG_CMD_PREPARE_RSP,     .pf_parse = boot_parse_prepare_rsp  },
-    { .cmd = eBOOT_MSG_CMD_FLASH,           .pf_parse = boot_parse_flash        },
-    { .cmd = eBOOT_MSG_CMD_FLASH_RSP,       .pf_parse = boot_parse_flash_rsp    },
-    { .cmd = eBOOT_MSG_CMD_EXIT,            .pf_parse = boot_parse_exit         },
-    { .cmd = eBOOT_MSG_CMD_EXIT_RSP,        .pf_parse = boot_parse_exit_rsp     },
-    { .cmd = eBOOT_MSG_CMD_INFO,            .pf_parse = boot_parse_info         },
-    { .cmd = eBOOT_MSG_CMD_INFO_RSP,        .pf_parse = boot_parse_info_rsp     },
-};
+static boot_com_ch_t * gp_ch = &g_com_ch[0];
+
+#if ( 1 == BOOT_CFG_BRIDGE_EN )
+
+    /**
+     *  Frame check type negotiated by downstream nodes
+     *
+     *  @note   Learned from relayed connect responses, needed to find end
+     *          of relayed frames.
+     */
+    static uint8_t g_bridge_crc_type[BOOT_COM_NODE_NUM_OF] = {0};
+
+#endif
 
 /**
- *  Number of entries in Bootloader Parsing Table
+ *      Bootloader Parsing Table
+ *
+ *  @note   Indexed directly by command nibbles, empty entries are
+ *          unsupported commands.
+ *
+ *  Sizeof: 16 x 4 function pointers
  */
-static const uint32_t gu32_parse_table_size = (uint32_t) ( sizeof( g_parse_table ) / sizeof( boot_parse_table_t ));
+static const pf_canm_parse_t g_parse_table[BOOT_COM_CMD_GROUP_NUM_OF][BOOT_COM_CMD_INDEX_NUM_OF] =
+{
+#if ( 0 == BOOT_CFG_COM_MANAGER_EN )
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_CONNECT )           = boot_parse_connect,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_PREPARE )           = boot_parse_prepare,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_PREPARE_RESUME )    = boot_parse_prepare_resume,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_FLASH )             = boot_parse_flash,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_FLASH_SEQ )         = boot_parse_flash_seq,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_EXIT )              = boot_parse_exit,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_INFO )              = boot_parse_info,
+
+    #if ( 1 == BOOT_CFG_STATS_EN )
+        BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_STATS )         = boot_parse_stats,
+    #endif
+
+    #if ( 1 == BOOT_CFG_VERIFY_EN )
+        BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_VERIFY )        = boot_parse_verify,
+        BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_VERIFY_SECTORS )= boot_parse_verify_sectors,
+    #endif
+
+    #if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+        BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_PREPARE_SKIP )  = boot_parse_prepare_skip,
+    #endif
+#else
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_CONNECT_RSP )       = boot_parse_connect_rsp,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_PREPARE_RSP )       = boot_parse_prepare_rsp,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_PREPARE_RESUME_RSP )= boot_parse_prepare_resume_rsp,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_FLASH_RSP )         = boot_parse_flash_rsp,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_FLASH_SEQ_RSP )     = boot_parse_flash_seq_rsp,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_EXIT_RSP )          = boot_parse_exit_rsp,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_INFO_RSP )          = boot_parse_info_rsp,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_STATS_RSP )         = boot_parse_stats_rsp,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_VERIFY_RSP )        = boot_parse_verify_rsp,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_VERIFY_SECTORS_RSP )= boot_parse_verify_sectors_rsp,
+    BOOT_COM_PARSE_ENTRY( eBOOT_MSG_CMD_PREPARE_SKIP_RSP )  = boot_parse_prepare_skip_rsp,
+#endif
+};
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -213,67 +423,182 @@ static const uint32_t gu32_parse_table_size = (uint32_t) ( sizeof( g_parse_table
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Calculate CRC-8
+*       Calculate CRC-8 of Bootloader packet
 *
-* @param[in]    p_data  - Pointer to data
-* @param[in]    size    - Size of data to calc crc
+* @note     Entry "NULL" to "p_payload" for packets without payload!
+*
+* @param[in]    p_header    - Packet header
+* @param[in]    p_payload   - Packet payload
 * @return       crc8    - Calculated CRC
 */
 ////////////////////////////////////////////////////////////////////////////////
-static uint8_t boot_com_calc_crc(const uint8_t * const p_data, const uint16_t size)
+static uint8_t boot_com_calc_crc_packet(const boot_header_t * const p_header, const uint8_t * const p_payload)
 {
-    const   uint8_t poly    = 0x07U;    // CRC-8-CCITT
-    const   uint8_t seed    = 0xB6U;    // Custom seed
-            uint8_t crc8    = seed;
+    uint8_t crc8 = 0U;
+
+    // Calculate CRC of header
+    crc8 ^= boot_crc8_calc( (uint8_t*) &( p_header->field.length ),  sizeof( p_header->field.length ));
+    crc8 ^= boot_crc8_calc( (uint8_t*) &( p_header->field.source ),  sizeof( p_header->field.source ));
+    crc8 ^= boot_crc8_calc( (uint8_t*) &( p_header->field.command ), sizeof( p_header->field.command ));
+    crc8 ^= boot_crc8_calc( (uint8_t*) &( p_header->field.status ),  sizeof( p_header->field.status ));
 
-    for (uint16_t i = 0; i < size; i++)
+    // Include also payload to CRC if needed
+    if ( NULL != p_payload )
+    {
+        crc8 ^= boot_crc8_calc( p_payload, p_header->field.length );
+    }
+
+    return crc8;
+}
+
+#if ( 1 == BOOT_CFG_COM_FRAME_CRC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Calculate CRC-16 or CRC-32 frame check of Bootloader packet
+    *
+    * @note     Covers header fields from length to status and complete
+    *           payload. CRC-16 is returned in lower half.
+    *
+    * @param[in]    p_header    - Packet header
+    * @param[in]    p_payload   - Packet payload, "NULL" for packets without payload
+    * @return       crc         - Calculated CRC
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t boot_com_calc_crc_frame(const boot_header_t * const p_header, const uint8_t * const p_payload)
     {
-        crc8 = ( crc8 ^ p_data[i] );
+                uint32_t    crc     = 0U;
+        const   uint8_t *   p_head  = (const uint8_t*) &( p_header->field.length );
+        const   uint32_t    size    = ( NULL != p_payload ) ? p_header->field.length : 0U;
 
-        for (uint16_t j = 0U; j < 8U; j++)
+        // Length, source, command and status fields
+        const   uint32_t    head_size = (uint32_t)( sizeof( p_header->field.length ) + sizeof( p_header->field.source ) + sizeof( p_header->field.command ) + sizeof( p_header->field.status ));
+
+        if ( BOOT_COM_CRC_TYPE_CRC16 == boot_com_crc_type( p_header ))
         {
-            if ( crc8 & 0x80U )
-            {
-                crc8 = (( crc8 << 1U ) ^ poly );
-            }
-            else
-            {
-                crc8 = ( crc8 << 1U );
-            }
+            uint16_t crc16 = boot_crc16_init();
+            crc16 = boot_crc16_update( crc16, p_head, head_size );
+            crc16 = boot_crc16_update( crc16, p_payload, size );
+            crc = crc16;
         }
+        else
+        {
+            crc = boot_crc32_init();
+            crc = boot_crc32_update( crc, p_head, head_size );
+            crc = boot_crc32_update( crc, p_payload, size );
+        }
+
+        return crc;
     }
 
-    return crc8;
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get size of frame check trailer
+*
+* @note     Connect command and response are always sent with CRC-8 only,
+*           as frame check type is negotiated with them.
+*
+* @param[in]    p_header    - Packet header
+* @return       size        - Size of trailer in bytes, 0 for CRC-8 only
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t boot_com_crc_size(const boot_header_t * const p_header)
+{
+    uint16_t        size        = 0U;
+    const uint8_t   crc_type    = boot_com_crc_type( p_header );
+
+    if  (   ( eBOOT_MSG_CMD_CONNECT     != p_header->field.command )
+        &&  ( eBOOT_MSG_CMD_CONNECT_RSP != p_header->field.command ))
+    {
+        if ( BOOT_COM_CRC_TYPE_CRC16 == crc_type )
+        {
+            size = sizeof( uint16_t );
+        }
+        else if ( BOOT_COM_CRC_TYPE_CRC32 == crc_type )
+        {
+            size = sizeof( uint32_t );
+        }
+        else
+        {
+            // CRC-8 only...
+        }
+    }
+
+    return size;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Calculate CRC-8 of Bootloader packet
+*       Get frame check type of packet
 *
-* @note     Entry "NULL" to "p_payload" for packets without payload!
+* @note     Relayed frames of downstream nodes use frame check type that
+*           node negotiated with Boot Manager.
 *
 * @param[in]    p_header    - Packet header
-* @param[in]    p_payload   - Packet payload
-* @return       crc8    - Calculated CRC
+* @return       crc_type    - Frame check type
 */
 ////////////////////////////////////////////////////////////////////////////////
-static uint8_t boot_com_calc_crc_packet(const boot_header_t * const p_header, const uint8_t * const p_payload)
+static uint8_t boot_com_crc_type(const boot_header_t * const p_header)
 {
-    uint8_t crc8 = 0U;
+    uint8_t crc_type = gp_ch->crc_type;
 
-    // Calculate CRC of header
-    crc8 ^= boot_com_calc_crc( (uint8_t*) &( p_header->field.length ),  sizeof( p_header->field.length ));
-    crc8 ^= boot_com_calc_crc( (uint8_t*) &( p_header->field.source ),  sizeof( p_header->field.source ));
-    crc8 ^= boot_com_calc_crc( (uint8_t*) &( p_header->field.command ), sizeof( p_header->field.command ));
-    crc8 ^= boot_com_calc_crc( (uint8_t*) &( p_header->field.status ),  sizeof( p_header->field.status ));
+    #if ( 1 == BOOT_CFG_BRIDGE_EN )
+        const uint8_t node = boot_bridge_src_node( p_header->field.source );
+
+        // Frame of other node
+        if  (   ( BOOT_COM_NODE_NONE != node )
+            &&  ( BOOT_CFG_COM_NODE_ID != node ))
+        {
+            crc_type = g_bridge_crc_type[node];
+        }
+    #else
+        (void) p_header;
+    #endif
+
+    return crc_type;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Send Bootloader packet
+*
+* @note     Calculates header CRC-8 and appends frame check trailer when
+*           CRC-16 or CRC-32 frame check is negotiated.
+*
+* @param[in]    p_header    - Packet header, CRC is filled in
+* @param[in]    p_payload   - Packet payload, "NULL" for packets without payload
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_com_send_frame(boot_header_t * const p_header, const uint8_t * const p_payload)
+{
+            boot_status_t   status      = eBOOT_OK;
+    const   uint16_t        crc_size    = boot_com_crc_size( p_header );
+
+    // Header CRC-8, with trailer it covers header only
+    p_header->field.crc = boot_com_calc_crc_packet( p_header, (( 0U == crc_size ) ? p_payload : NULL ));
+
+    // Send header and payload
+    status = boot_if_transmit( &p_header->U, sizeof( boot_header_t ));
 
-    // Include also payload to CRC if needed
     if ( NULL != p_payload )
     {
-        crc8 ^= boot_com_calc_crc( p_payload, p_header->field.length );
+        status |= boot_if_transmit( p_payload, p_header->field.length );
     }
 
-    return crc8;
+    // Send trailer
+    #if ( 1 == BOOT_CFG_COM_FRAME_CRC_EN )
+        if ( crc_size > 0U )
+        {
+            const uint32_t crc = boot_com_calc_crc_frame( p_header, p_payload );
+
+            status |= boot_if_transmit((const uint8_t*) &crc, crc_size );
+        }
+    #endif
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -317,8 +642,25 @@ static boot_status_t boot_parse_rcv_header(boot_parser_t * const p_parser, boot_
         // Preamble OK
         if ( BOOT_COM_MSG_PREAMBLE_VAL == (*p_header)->field.preamble )
         {
+            // Frame check trailer follows -> header CRC-8 covers header only
+            if ( boot_com_crc_size( *p_header ) > 0U )
+            {
+                // Header OK
+                if ( boot_com_calc_crc_packet( (*p_header), NULL ) == (*p_header)->field.crc )
+                {
+                    p_parser->mode = eBOOT_PARSER_RCV_PAYLOAD;
+                }
+
+                // Header corrupted -> do not trust length
+                else
+                {
+                    status = eBOOT_ERROR_CRC;
+                    BOOT_DBG_PRINT( "ERROR Message CRC invalid!" );
+                }
+            }
+
             // No payload
-            if ( 0U == (*p_header)->field.length )
+            else if ( 0U == (*p_header)->field.length )
             {
                 // Calculate CRC
                 crc_calc = boot_com_calc_crc_packet( (*p_header), NULL );
@@ -374,21 +716,34 @@ static boot_status_t boot_parse_rcv_header(boot_parser_t * const p_parser, boot_
 ////////////////////////////////////////////////////////////////////////////////
 static boot_status_t boot_parse_rcv_payload(boot_parser_t * const p_parser, const boot_header_t * const p_header, uint8_t ** pp_payload)
 {
-    boot_status_t   status      = eBOOT_WAR_EMPTY;
-    uint8_t         crc_calc    = 0;
-    uint8_t         crc_msg     = 0;
+            boot_status_t   status      = eBOOT_WAR_EMPTY;
+            uint32_t        crc_calc    = 0;
+            uint32_t        crc_msg     = 0;
+    const   uint16_t        crc_size    = boot_com_crc_size( p_header );
 
-    // Complete message payload received
-    if ( p_parser->buf.idx == ( p_header->field.length + sizeof( boot_header_t )))
+    // Complete message payload (and trailer) received
+    if ( p_parser->buf.idx == ( p_header->field.length + sizeof( boot_header_t ) + crc_size ))
     {
         // Get payload
         *pp_payload = &p_parser->buf.mem[sizeof(boot_header_t)];
 
         // Calculate CRC
-        crc_calc = boot_com_calc_crc_packet( p_header, *pp_payload );
+        #if ( 1 == BOOT_CFG_COM_FRAME_CRC_EN )
+            if ( crc_size > 0U )
+            {
+                crc_calc = boot_com_calc_crc_frame( p_header, *pp_payload );
+
+                // Trailer CRC
+                memcpy( &crc_msg, &p_parser->buf.mem[ sizeof( boot_header_t ) + p_header->field.length ], crc_size );
+            }
+            else
+        #endif
+            {
+                crc_calc = boot_com_calc_crc_packet( p_header, *pp_payload );
 
-        // Message CRC
-        crc_msg = p_header->field.crc;
+                // Message CRC
+                crc_msg = p_header->field.crc;
+            }
 
         // CRC OK
         if ( crc_calc == crc_msg )
@@ -463,11 +818,18 @@ static boot_status_t boot_parse_hndl(boot_header_t ** pp_header, uint8_t ** pp_p
 {
     boot_status_t status = eBOOT_WAR_EMPTY;
 
+#if ( 1 == BOOT_CFG_RX_BLOCK_EN )
+
+    // Get data from rx buffers in blocks
+    status = boot_parse_rcv_block( pp_header, pp_payload );
+
+#else
+
     // Get all data from rx buffers
-    while ( eBOOT_OK == boot_if_receive( &g_parser.buf.mem[ g_parser.buf.idx ]))
+    while ( eBOOT_OK == boot_if_receive( &gp_ch->parser.buf.mem[ gp_ch->parser.buf.idx ]))
     {
         // Store timestamp
-        g_parser.last_timestamp = BOOT_GET_SYSTICK();
+        gp_ch->parser.last_timestamp = BOOT_GET_SYSTICK();
 
         // Increment buffer index
         status = boot_buf_idx_increment();
@@ -476,15 +838,15 @@ static boot_status_t boot_parse_hndl(boot_header_t ** pp_header, uint8_t ** pp_p
         if ( eBOOT_OK == status )
         {
             // Parse message
-            status = boot_parse( &g_parser, pp_header, pp_payload );
+            status = boot_parse( &gp_ch->parser, pp_header, pp_payload );
 
             // Message completely received
             if  (   ( eBOOT_OK == status )
                 ||  ( eBOOT_ERROR_CRC == status ))
             {
                 // Reset parser
-                g_parser.buf.idx = 0;
-                g_parser.mode = eBOOT_PARSER_IDLE;
+                gp_ch->parser.buf.idx = 0;
+                gp_ch->parser.mode = eBOOT_PARSER_IDLE;
 
                 // Exit reading data from rx buffer
                 break;
@@ -498,16 +860,18 @@ static boot_status_t boot_parse_hndl(boot_header_t ** pp_header, uint8_t ** pp_p
             boot_if_clear_rx_buf();
 
             // Reset parser
-            g_parser.buf.idx = 0;
-            g_parser.mode = eBOOT_PARSER_IDLE;
+            gp_ch->parser.buf.idx = 0;
+            gp_ch->parser.mode = eBOOT_PARSER_IDLE;
 
             // Exit reading data from rx buffer
             break;
         }
     }
 
+#endif
+
     // Check for timeout
-    if ( true == boot_timeout_check( &g_parser ))
+    if ( true == boot_timeout_check( &gp_ch->parser ))
     {
         status = eBOOT_ERROR_TIMEOUT;
 
@@ -517,35 +881,152 @@ static boot_status_t boot_parse_hndl(boot_header_t ** pp_header, uint8_t ** pp_p
     return status;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Increment parser buffer index
-*
-* @note In case of buffer full it returns "eBOOT_WAR_FULL"!
-*
-* @return       status      - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-static boot_status_t boot_buf_idx_increment(void)
-{
-    boot_status_t status = eBOOT_OK;
+#if ( 1 == BOOT_CFG_RX_BLOCK_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get number of bytes till end of currently parsed frame section
+    *
+    * @note     Returns 0 when header is complete but invalid (preamble), so
+    *           that parser waits for timeout to reset buffer.
+    *
+    * @param[in]    p_parser    - Pointer to parser data
+    * @return       needed      - Number of bytes to receive
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint16_t boot_parse_bytes_needed(const boot_parser_t * const p_parser)
+    {
+        uint16_t needed = 0U;
+
+        // Receiving header
+        if ( p_parser->buf.idx < sizeof( boot_header_t ))
+        {
+            needed = (uint16_t)( sizeof( boot_header_t ) - p_parser->buf.idx );
+        }
+
+        // Receiving payload
+        else if ( eBOOT_PARSER_RCV_PAYLOAD == p_parser->mode )
+        {
+            const boot_header_t * const p_header = (const boot_header_t*) &p_parser->buf.mem[0];
+
+            needed = (uint16_t)(( p_header->field.length + sizeof( boot_header_t ) + boot_com_crc_size( p_header )) - p_parser->buf.idx );
+        }
+
+        else
+        {
+            // No actions...
+        }
+
+        return needed;
+    }
 
-    // Increment received byte counter
-    if ( g_parser.buf.idx < ( BOOT_CFG_RX_BUF_SIZE - 1U ))
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Receive and parse data in blocks
+    *
+    * @note     Only data up to end of currently parsed header or payload is
+    *           requested from interface, thus next frame stays in interface
+    *           reception buffer. Timestamp is updated once per block.
+    *
+    * @param[out]   pp_header   - Pointer-pointer to header, return location of rx buffer starting at header
+    * @param[out]   pp_payload  - Pointer-pointer to payload, return location of rx buffer starting at payload
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_parse_rcv_block(boot_header_t ** pp_header, uint8_t ** pp_payload)
     {
-        g_parser.buf.idx++;
+        boot_status_t       status  = eBOOT_WAR_EMPTY;
+        boot_parser_mode_t  mode    = eBOOT_PARSER_IDLE;
+        uint16_t            needed  = boot_parse_bytes_needed( &gp_ch->parser );
+        uint16_t            got     = 0U;
+
+        while   (   ( needed > 0U )
+                &&  ( eBOOT_OK == boot_if_receive_block( &gp_ch->parser.buf.mem[ gp_ch->parser.buf.idx ], needed, &got ))
+                &&  ( got > 0U ))
+        {
+            // Store timestamp
+            gp_ch->parser.last_timestamp = BOOT_GET_SYSTICK();
+
+            gp_ch->parser.buf.idx += got;
+
+            // Parse message
+            // NOTE: Repeat as long as parser moves to next section
+            do
+            {
+                mode    = gp_ch->parser.mode;
+                status  = boot_parse( &gp_ch->parser, pp_header, pp_payload );
+            }
+            while (( eBOOT_WAR_EMPTY == status ) && ( mode != gp_ch->parser.mode ));
+
+            // Message completely received
+            if  (   ( eBOOT_OK == status )
+                ||  ( eBOOT_ERROR_CRC == status ))
+            {
+                // Reset parser
+                gp_ch->parser.buf.idx = 0;
+                gp_ch->parser.mode = eBOOT_PARSER_IDLE;
+
+                // Exit reading data from rx buffer
+                break;
+            }
+
+            needed = boot_parse_bytes_needed( &gp_ch->parser );
+
+            // Frame does not fit into buffer
+            if (( gp_ch->parser.buf.idx + needed ) >= BOOT_CFG_RX_BUF_SIZE )
+            {
+                status = eBOOT_WAR_FULL;
+
+                // Reset interface reception buffer
+                boot_if_clear_rx_buf();
+
+                // Reset parser
+                gp_ch->parser.buf.idx = 0;
+                gp_ch->parser.mode = eBOOT_PARSER_IDLE;
+
+                // Exit reading data from rx buffer
+                break;
+            }
+        }
+
+        return status;
     }
-    else
+
+#endif
+
+#if ( 0 == BOOT_CFG_RX_BLOCK_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Increment parser buffer index
+    *
+    * @note In case of buffer full it returns "eBOOT_WAR_FULL"!
+    *
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_buf_idx_increment(void)
     {
-        // Reset buffer index
-        g_parser.buf.idx = 0U;
+        boot_status_t status = eBOOT_OK;
+
+        // Increment received byte counter
+        if ( gp_ch->parser.buf.idx < ( BOOT_CFG_RX_BUF_SIZE - 1U ))
+        {
+            gp_ch->parser.buf.idx++;
+        }
+        else
+        {
+            // Reset buffer index
+            gp_ch->parser.buf.idx = 0U;
 
-        // Buffer full
-        status = eBOOT_WAR_FULL;
+            // Buffer full
+            status = eBOOT_WAR_FULL;
+        }
+
+        return status;
     }
 
-    return status;
-}
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -584,236 +1065,1193 @@ static boot_status_t boot_parse(boot_parser_t * const p_parser, boot_header_t **
     return status;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Bootloader Connect message parser
-*
-* @param[in]    p_header    - Pointer to message header
-* @param[in]    p_payload   - Pointer to message payload
-* @return       void
-*/
-////////////////////////////////////////////////////////////////////////////////
-static void boot_parse_connect(const boot_header_t * const p_header, const uint8_t * const p_payload)
-{
-    // Unused
-    (void) p_header;
-    (void) p_payload;
+#if ( 1 == BOOT_CFG_BRIDGE_EN )
 
-    // Raise callback
-    boot_com_connect_msg_rcv_cb();
-}
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get node of message source
+    *
+    * @param[in]    source  - Message source
+    * @return       node    - Node address, BOOT_COM_NODE_NONE if source is not of any node
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint8_t boot_bridge_src_node(const uint8_t source)
+    {
+        uint8_t         node    = BOOT_COM_NODE_NONE;
+        const uint8_t   tag     = (uint8_t)( source & 0xF0U );
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Bootloader Connect Response message parser
+        if  (   ( eCOM_MSG_SRC_BOOT_MANAGER == source )
+            ||  ( eCOM_MSG_SRC_BOOTLOADER == source ))
+        {
+            node = 0U;
+        }
+        else if (   (( eCOM_MSG_SRC_BOOT_MANAGER_NODE == tag ) || ( eCOM_MSG_SRC_BOOTLOADER_NODE == tag ))
+                &&  ( 0U != ( source & 0x0FU )))
+        {
+            node = (uint8_t)( source & 0x0FU );
+        }
+        else
+        {
+            // No actions...
+        }
+
+        return node;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Forward received frame to other channel
+    *
+    * @note     Frame is sent as received (header, payload and frame check
+    *           trailer) directly from parser buffer of receiving channel.
+    *
+    * @param[in]    ch          - Destination channel
+    * @param[in]    p_header    - Header of received frame
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static boot_status_t boot_bridge_forward(const uint8_t ch, const boot_header_t * const p_header)
+    {
+                boot_status_t   status  = eBOOT_OK;
+                boot_com_ch_t * const p_rx_ch = gp_ch;
+        const   uint16_t        size    = (uint16_t)( sizeof( boot_header_t ) + p_header->field.length + boot_com_crc_size( p_header ));
+
+        // Interface routes transmission by selected channel
+        gp_ch = &g_com_ch[ch];
+
+        status = boot_if_transmit( &p_header->U, size );
+
+        gp_ch = p_rx_ch;
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Forward frame received from Boot Manager to downstream nodes
+    *
+    * @param[in]    p_header    - Header of received frame
+    * @return       relayed     - True if frame is addressed to other node and was forwarded
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool boot_bridge_upstream_hndl(const boot_header_t * const p_header)
+    {
+        bool            relayed = false;
+        const uint8_t   node    = boot_bridge_src_node( p_header->field.source );
+
+        // Request for other node
+        if  (   ( BOOT_COM_NODE_NONE != node )
+            &&  ( BOOT_CFG_COM_NODE_ID != node )
+            &&  ( BOOT_COM_SRC_MNGR( node ) == p_header->field.source ))
+        {
+            (void) boot_bridge_forward( BOOT_COM_CH_DOWNSTREAM, p_header );
+
+            // Raise callback
+            boot_com_bridge_msg_rcv_cb( node );
+
+            relayed = true;
+        }
+
+        return relayed;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Forward frames received from downstream nodes to Boot Manager
+    *
+    * @note     Negotiated frame check type of node is taken from its connect
+    *           response, so that its following frames can be received.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_bridge_downstream_hndl(void)
+    {
+        boot_com_ch_t * const p_ch = &g_com_ch[BOOT_COM_CH_DOWNSTREAM];
+
+        gp_ch = p_ch;
+
+        // Frame received OK
+        if ( eBOOT_OK == boot_parse_hndl( &p_ch->p_header, &p_ch->p_payload ))
+        {
+            const uint8_t node = boot_bridge_src_node( p_ch->p_header->field.source );
+
+            // Response of other node
+            if  (   ( BOOT_COM_NODE_NONE != node )
+                &&  ( BOOT_CFG_COM_NODE_ID != node )
+                &&  ( BOOT_COM_SRC_BOOT( node ) == p_ch->p_header->field.source ))
+            {
+                if ( eBOOT_MSG_CMD_CONNECT_RSP == p_ch->p_header->field.command )
+                {
+                    g_bridge_crc_type[node] = BOOT_COM_CRC_TYPE_CRC8;
+
+                    // Negotiated frame check type (missing with older bootloaders)
+                    if  (   ( p_ch->p_header->field.length >= BOOT_COM_CONNECT_CRC_SIZE )
+                        &&  ( true == boot_com_crc_type_is_supported( p_ch->p_payload[BOOT_COM_CONNECT_SIZE] )))
+                    {
+                        g_bridge_crc_type[node] = p_ch->p_payload[BOOT_COM_CONNECT_SIZE];
+                    }
+                }
+
+                (void) boot_bridge_forward( BOOT_COM_CH_UPSTREAM, p_ch->p_header );
+            }
+        }
+
+        gp_ch = &g_com_ch[BOOT_COM_CH_UPSTREAM];
+    }
+
+#endif
+
+#if ( 0 == BOOT_CFG_COM_MANAGER_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Connect message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_connect(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        uint16_t    payload_size    = 0U;
+        uint8_t     crc_type        = BOOT_COM_CRC_TYPE_CRC8;
+
+        // Requested flash data payload size (optional)
+        if ( p_header->field.length >= BOOT_COM_CONNECT_SIZE )
+        {
+            memcpy( &payload_size, p_payload, BOOT_COM_CONNECT_SIZE );
+        }
+
+        // Requested frame check type (optional)
+        if ( p_header->field.length >= BOOT_COM_CONNECT_CRC_SIZE )
+        {
+            crc_type = p_payload[BOOT_COM_CONNECT_SIZE];
+        }
+
+        // Raise callback
+        boot_com_connect_msg_rcv_cb( payload_size, crc_type );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Prepare message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_prepare(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        // Unused
+        (void) p_header;
+
+        // Check for correct lenght
+        if ( p_header->field.length == sizeof( ver_image_header_t ))
+        {
+            // Raise callback
+            boot_com_prepare_msg_rcv_cb((const ver_image_header_t *) p_payload );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Prepare or Resume message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_prepare_resume(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        // Check for correct lenght
+        if ( p_header->field.length == sizeof( ver_image_header_t ))
+        {
+            // Raise callback
+            boot_com_prepare_resume_msg_rcv_cb((const ver_image_header_t *) p_payload );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Flash Data message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_flash(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        // Raise callback
+        boot_com_flash_msg_rcv_cb( p_payload, p_header->field.length );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Sequenced Flash Data message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_flash_seq(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        uint16_t seq = 0U;
+
+        // Check for correct lenght
+        if ( p_header->field.length > BOOT_COM_FLASH_SEQ_SIZE )
+        {
+            // Parse sequence number
+            memcpy( &seq, p_payload, BOOT_COM_FLASH_SEQ_SIZE );
+
+            // Raise callback
+            boot_com_flash_seq_msg_rcv_cb( seq, &p_payload[BOOT_COM_FLASH_SEQ_SIZE], ( p_header->field.length - BOOT_COM_FLASH_SEQ_SIZE ));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Exit message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_exit(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        // Unused
+        (void) p_header;
+        (void) p_payload;
+
+        // Raise callback
+        boot_com_exit_msg_rcv_cb();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Info message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_info(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        // Unused
+        (void) p_header;
+        (void) p_payload;
+
+        // Raise callback
+        boot_com_info_msg_rcv_cb();
+    }
+
+    #if ( 1 == BOOT_CFG_STATS_EN )
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Bootloader Statistics message parser
+        *
+        * @param[in]    p_header    - Pointer to message header
+        * @param[in]    p_payload   - Pointer to message payload
+        * @return       void
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static void boot_parse_stats(const boot_header_t * const p_header, const uint8_t * const p_payload)
+        {
+            // Unused
+            (void) p_header;
+            (void) p_payload;
+
+            // Raise callback
+            boot_com_stats_msg_rcv_cb();
+        }
+
+    #endif
+
+    #if ( 1 == BOOT_CFG_VERIFY_EN )
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Bootloader Verify message parser
+        *
+        * @param[in]    p_header    - Pointer to message header
+        * @param[in]    p_payload   - Pointer to message payload
+        * @return       void
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static void boot_parse_verify(const boot_header_t * const p_header, const uint8_t * const p_payload)
+        {
+            boot_verify_t range = {0};
+
+            // Check for correct lenght
+            if ( p_header->field.length == sizeof( boot_verify_t ))
+            {
+                // Parse range
+                memcpy( &range, p_payload, sizeof( boot_verify_t ));
+
+                // Raise callback
+                boot_com_verify_msg_rcv_cb( &range );
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Bootloader Verify Sectors message parser
+        *
+        * @param[in]    p_header    - Pointer to message header
+        * @param[in]    p_payload   - Pointer to message payload
+        * @return       void
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static void boot_parse_verify_sectors(const boot_header_t * const p_header, const uint8_t * const p_payload)
+        {
+            boot_verify_t range = {0};
+
+            // Check for correct lenght
+            if ( p_header->field.length == sizeof( boot_verify_t ))
+            {
+                // Parse range
+                memcpy( &range, p_payload, sizeof( boot_verify_t ));
+
+                // Raise callback
+                boot_com_verify_sectors_msg_rcv_cb( &range );
+            }
+        }
+
+    #endif
+
+    #if ( 1 == BOOT_CFG_FLASH_SKIP_EN )
+
+        ////////////////////////////////////////////////////////////////////////////////
+        /**
+        *       Bootloader Prepare Skip message parser
+        *
+        * @param[in]    p_header    - Pointer to message header
+        * @param[in]    p_payload   - Pointer to message payload
+        * @return       void
+        */
+        ////////////////////////////////////////////////////////////////////////////////
+        static void boot_parse_prepare_skip(const boot_header_t * const p_header, const uint8_t * const p_payload)
+        {
+            // Check for correct lenght
+            if ( p_header->field.length == BOOT_COM_PREPARE_SKIP_SIZE )
+            {
+                // Raise callback
+                boot_com_prepare_skip_msg_rcv_cb((const ver_image_header_t *) p_payload, &p_payload[ sizeof( ver_image_header_t ) ] );
+            }
+        }
+
+    #endif
+
+#else
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Connect Response message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_connect_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        uint16_t    payload_size    = 0U;
+        uint8_t     crc_type        = BOOT_COM_CRC_TYPE_CRC8;
+
+        // Negotiated flash data payload size (missing with older bootloaders)
+        if ( p_header->field.length >= BOOT_COM_CONNECT_SIZE )
+        {
+            memcpy( &payload_size, p_payload, BOOT_COM_CONNECT_SIZE );
+        }
+
+        // Negotiated frame check type (missing with older bootloaders)
+        if ( p_header->field.length >= BOOT_COM_CONNECT_CRC_SIZE )
+        {
+            crc_type = p_payload[BOOT_COM_CONNECT_SIZE];
+        }
+
+        // Raise callback
+        boot_com_connect_rsp_msg_rcv_cb( payload_size, crc_type, p_header->field.status );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Prepare Response message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_prepare_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        // Unused
+        (void) p_payload;
+
+        // Raise callback
+        boot_com_prepare_rsp_msg_rcv_cb( p_header->field.status );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Prepare or Resume Response message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_prepare_resume_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        uint32_t ofs = 0U;
+
+        // Check for correct lenght
+        if ( p_header->field.length == BOOT_COM_RESUME_OFS_SIZE )
+        {
+            // Parse resume offset
+            memcpy( &ofs, p_payload, BOOT_COM_RESUME_OFS_SIZE );
+
+            // Raise callback
+            boot_com_prepare_resume_rsp_msg_rcv_cb( ofs, p_header->field.status );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Flash Data Response message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_flash_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        // Unused
+        (void) p_payload;
+
+        // Raise callback
+        boot_com_flash_rsp_msg_rcv_cb( p_header->field.status );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Sequenced Flash Data Response message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_flash_seq_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        uint16_t seq_next = 0U;
+
+        // Check for correct lenght
+        if ( p_header->field.length == BOOT_COM_FLASH_SEQ_SIZE )
+        {
+            // Parse next expected sequence number
+            memcpy( &seq_next, p_payload, BOOT_COM_FLASH_SEQ_SIZE );
+
+            // Raise callback
+            boot_com_flash_seq_rsp_msg_rcv_cb( seq_next, p_header->field.status );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Exit Response message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_exit_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        // Unused
+        (void) p_payload;
+
+        // Raise callback
+        boot_com_exit_rsp_msg_rcv_cb( p_header->field.status );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Info Response message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_info_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        boot_info_t info = {0};
+
+        // Parse bootloader info
+        // NOTE: Older bootloaders send only version, missing capabilities stay zero (stop-and-wait)!
+        memcpy( &info, p_payload, (( p_header->field.length < sizeof( boot_info_t )) ? p_header->field.length : sizeof( boot_info_t )));
+
+        // Raise callback
+        boot_com_info_rsp_msg_rcv_cb( &info, p_header->field.status );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Statistics Response message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_stats_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        boot_stats_t stats = {0};
+
+        // Parse bootloader statistics
+        memcpy( &stats, p_payload, (( p_header->field.length < sizeof( boot_stats_t )) ? p_header->field.length : sizeof( boot_stats_t )));
+
+        // Raise callback
+        boot_com_stats_rsp_msg_rcv_cb( &stats, p_header->field.status );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Verify Response message parser
+    *
+    * @note     Rejected request carries only range, digest stays zero.
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_verify_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        boot_verify_rsp_t rsp = {0};
+
+        // Check for minimum lenght
+        if ( p_header->field.length >= sizeof( boot_verify_t ))
+        {
+            // Parse range and digest
+            memcpy( &rsp, p_payload, (( p_header->field.length < sizeof( boot_verify_rsp_t )) ? p_header->field.length : sizeof( boot_verify_rsp_t )));
+
+            // Raise callback
+            boot_com_verify_rsp_msg_rcv_cb( &rsp, p_header->field.status );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Verify Sectors Response message parser
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_verify_sectors_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        static boot_verify_sectors_rsp_t rsp = {0};
+
+        // Check for minimum lenght
+        if ( p_header->field.length >= ( sizeof( boot_verify_t ) + sizeof( uint8_t )))
+        {
+            memset( &rsp, 0U, sizeof( boot_verify_sectors_rsp_t ));
+
+            // Parse range and sector entries
+            memcpy( &rsp, p_payload, (( p_header->field.length < sizeof( boot_verify_sectors_rsp_t )) ? p_header->field.length : sizeof( boot_verify_sectors_rsp_t )));
+
+            // Entries shall be complete
+            if ( p_header->field.length >= ( sizeof( boot_verify_t ) + sizeof( uint8_t ) + ( rsp.num_of * ( sizeof( uint32_t ) + BOOT_VERIFY_DIGEST_SIZE( rsp.range.type )))))
+            {
+                // Raise callback
+                boot_com_verify_sectors_rsp_msg_rcv_cb( &rsp, p_header->field.status );
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Bootloader Prepare Skip Response message parser
+    *
+    * @note     Sector map is sent only with OK status.
+    *
+    * @param[in]    p_header    - Pointer to message header
+    * @param[in]    p_payload   - Pointer to message payload
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_parse_prepare_skip_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+    {
+        static const uint8_t no_map[BOOT_SKIP_MAP_SIZE] = {0};
+
+        // Check for correct lenght
+        if ( p_header->field.length == BOOT_SKIP_MAP_SIZE )
+        {
+            // Raise callback
+            boot_com_prepare_skip_rsp_msg_rcv_cb( p_payload, p_header->field.status );
+        }
+        else if (( 0U == p_header->field.length ) && ( eBOOT_MSG_OK != p_header->field.status ))
+        {
+            // Raise callback
+            boot_com_prepare_skip_rsp_msg_rcv_cb((const uint8_t*) &no_map, p_header->field.status );
+        }
+        else
+        {
+            // No actions...
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_COM_API
+* @{ <!-- BEGIN GROUP -->
 *
-* @param[in]    p_header    - Pointer to message header
-* @param[in]    p_payload   - Pointer to message payload
-* @return       void
+* 	Following function are part of Bootloader Communication API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle Bootloader communication
+*
+* @return       status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_com_hndl(void)
+{
+    boot_status_t   status      = eBOOT_OK;
+    boot_com_ch_t * const p_ch  = gp_ch;
+
+    // Parse received messages
+    status = boot_parse_hndl( &p_ch->p_header, &p_ch->p_payload );
+
+    // Count reception events
+    #if ( 1 == BOOT_CFG_STATS_EN )
+        switch( status )
+        {
+            case eBOOT_OK:
+                p_ch->stats.frames++;
+                break;
+
+            case eBOOT_ERROR_CRC:
+                p_ch->stats.crc_err++;
+                break;
+
+            case eBOOT_ERROR_TIMEOUT:
+                p_ch->stats.timeouts++;
+                break;
+
+            case eBOOT_WAR_FULL:
+                p_ch->stats.rx_overflows++;
+                break;
+
+            default:
+                // No actions...
+                break;
+        }
+    #endif
+
+    // Msg received OK
+    if ( eBOOT_OK == status )
+    {
+        const uint8_t group = BOOT_COM_CMD_GROUP( p_ch->p_header->field.command );
+        const uint8_t index = BOOT_COM_CMD_INDEX( p_ch->p_header->field.command );
+
+        // Request for downstream node
+        #if ( 1 == BOOT_CFG_BRIDGE_EN )
+            if ( true == boot_bridge_upstream_hndl( p_ch->p_header ))
+            {
+                // Relayed...
+            }
+            else
+        #endif
+
+        // Known command from expected source
+        if  (   ( BOOT_COM_RX_SRC == p_ch->p_header->field.source )
+            &&  ( index < BOOT_COM_CMD_INDEX_NUM_OF )
+            &&  ( NULL != g_parse_table[group][index] ))
+        {
+            // Raise parsing command
+            g_parse_table[group][index]( p_ch->p_header, p_ch->p_payload );
+        }
+    }
+
+    // Relay responses of downstream nodes
+    #if ( 1 == BOOT_CFG_BRIDGE_EN )
+        boot_bridge_downstream_hndl();
+    #endif
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get timestamp of last received byte
+*
+* @return       last_timestamp - Timestamp of last rx byte in ms
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_parse_connect_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+uint32_t boot_com_get_last_rx_timestamp(void)
 {
-    // Unused
-    (void) p_payload;
+    return gp_ch->parser.last_timestamp;
+}
+
+#if ( 1 == BOOT_CFG_COM_MANAGER_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Select communication channel
+    *
+    * @note     All following handling, sending and settings apply to selected
+    *           channel. Interface (boot_if) shall route transmission and
+    *           reception to port of selected channel (boot_com_get_ch()).
+    *
+    * @param[in]    ch - Channel (device) index
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void boot_com_select_ch(const uint8_t ch)
+    {
+        BOOT_ASSERT( ch < BOOT_COM_CH_NUM_OF );
+
+        gp_ch = &g_com_ch[ch];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Reset selected communication channel
+    *
+    * @note     Drops partially received frame and falls back to CRC-8 frame
+    *           check, used when new session starts on channel.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void boot_com_reset_ch(void)
+    {
+        gp_ch->parser.buf.idx   = 0U;
+        gp_ch->parser.mode      = eBOOT_PARSER_IDLE;
+        gp_ch->crc_type         = BOOT_COM_CRC_TYPE_CRC8;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Set addressed node of selected channel
+    *
+    * @note     Node 0 is device connected directly to port (or bridge
+    *           itself), nodes 1..15 are reached through bridge.
+    *
+    * @param[in]    node - Node address
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void boot_com_set_node(const uint8_t node)
+    {
+        BOOT_ASSERT( node < BOOT_COM_NODE_NUM_OF );
 
-    // Raise callback
-    boot_com_connect_rsp_msg_rcv_cb( p_header->field.status );
-}
+        gp_ch->node = node;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get addressed node of selected channel
+    *
+    * @return       node - Node address
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    uint8_t boot_com_get_node(void)
+    {
+        return gp_ch->node;
+    }
+
+#endif
+
+#if (( 1 == BOOT_CFG_COM_MANAGER_EN ) || ( 1 == BOOT_CFG_BRIDGE_EN ))
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get selected communication channel
+    *
+    * @note     Bridge selects downstream channel (BOOT_COM_CH_DOWNSTREAM)
+    *           while it receives from or forwards to downstream nodes.
+    *
+    * @return       ch - Channel (device) index
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    uint8_t boot_com_get_ch(void)
+    {
+        return (uint8_t)( gp_ch - &g_com_ch[0] );
+    }
+
+#endif
+
+#if ( 1 == BOOT_CFG_STATS_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get communication statistics
+    *
+    * @param[out]   p_stats - Communication statistics
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void boot_com_get_stats(boot_com_stats_t * const p_stats)
+    {
+        BOOT_ASSERT( NULL != p_stats );
+
+        memcpy( p_stats, &gp_ch->stats, sizeof( boot_com_stats_t ));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Clear communication statistics
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    void boot_com_clear_stats(void)
+    {
+        memset( &gp_ch->stats, 0U, sizeof( boot_com_stats_t ));
+    }
+
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Bootloader Prepare message parser
+*       Set frame check type
+*
+* @note     Shall be called after connect command is acknowledged, on both
+*           Bootloader and Boot Manager side. Unsupported types fall back to
+*           CRC-8.
 *
-* @param[in]    p_header    - Pointer to message header
-* @param[in]    p_payload   - Pointer to message payload
+* @param[in]    crc_type - Frame check type
 * @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_parse_prepare(const boot_header_t * const p_header, const uint8_t * const p_payload)
+void boot_com_set_crc_type(const uint8_t crc_type)
 {
-    // Unused
-    (void) p_header;
-
-    // Check for correct lenght
-    if ( p_header->field.length == sizeof( ver_image_header_t ))
+    if ( true == boot_com_crc_type_is_supported( crc_type ))
     {
-        // Raise callback
-        boot_com_prepare_msg_rcv_cb((const ver_image_header_t *) p_payload );
+        gp_ch->crc_type = crc_type;
+    }
+    else
+    {
+        gp_ch->crc_type = BOOT_COM_CRC_TYPE_CRC8;
     }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Bootloader Prepare Response message parser
+*       Check if frame check type is supported
 *
-* @param[in]    p_header    - Pointer to message header
-* @param[in]    p_payload   - Pointer to message payload
-* @return       void
+* @param[in]    crc_type    - Frame check type
+* @return       supported   - True if supported
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_parse_prepare_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+bool boot_com_crc_type_is_supported(const uint8_t crc_type)
 {
-    // Unused
-    (void) p_payload;
+    bool supported = ( BOOT_COM_CRC_TYPE_CRC8 == crc_type );
 
-    // Raise callback
-    boot_com_prepare_rsp_msg_rcv_cb( p_header->field.status );
+    #if ( 1 == BOOT_CFG_COM_FRAME_CRC_EN )
+        supported = ( supported || ( BOOT_COM_CRC_TYPE_CRC16 == crc_type ) || ( BOOT_COM_CRC_TYPE_CRC32 == crc_type ));
+    #endif
+
+    return supported;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Bootloader Flash Data message parser
+*       Send Connect Message
 *
-* @param[in]    p_header    - Pointer to message header
-* @param[in]    p_payload   - Pointer to message payload
-* @return       void
+* @note     Shall only be used by Boot Manager!
+*
+* @param[in]    payload_size    - Requested flash data payload size in bytes, 0 for maximum supported
+* @param[in]    crc_type        - Requested frame check type
+* @return       status          - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_parse_flash(const boot_header_t * const p_header, const uint8_t * const p_payload)
+boot_status_t boot_com_send_connect(const uint16_t payload_size, const uint8_t crc_type)
 {
-    // Raise callback
-    boot_com_flash_msg_rcv_cb( p_payload, p_header->field.length );
+    boot_status_t status                                = eBOOT_OK;
+    boot_header_t header                                = { .U = 0U };
+    uint8_t       payload[BOOT_COM_CONNECT_CRC_SIZE]    = {0};
+
+    // Assemble command
+    header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
+    header.field.length     = BOOT_COM_CONNECT_CRC_SIZE;
+    header.field.source     = BOOT_COM_SRC_MNGR( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_CONNECT;
+
+    // Assemble payload
+    memcpy( &payload[0], &payload_size, BOOT_COM_CONNECT_SIZE );
+    payload[BOOT_COM_CONNECT_SIZE] = crc_type;
+
+    // Send command
+    status = boot_com_send_frame( &header, (const uint8_t*) &payload );
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Bootloader Flash Data Response message parser
+*       Send Connect Response Message
 *
-* @param[in]    p_header    - Pointer to message header
-* @param[in]    p_payload   - Pointer to message payload
-* @return       void
+* @note     Shall only be used by Bootloader!
+*
+* @param[in]    payload_size    - Negotiated flash data payload size in bytes
+* @param[in]    crc_type        - Negotiated frame check type
+* @param[in]    msg_status      - Response message status
+* @return       status          - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_parse_flash_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+boot_status_t boot_com_send_connect_rsp(const uint16_t payload_size, const uint8_t crc_type, const boot_msg_status_t msg_status)
 {
-    // Unused
-    (void) p_payload;
+    boot_status_t status                                = eBOOT_OK;
+    boot_header_t header                                = { .U = 0U };
+    uint8_t       payload[BOOT_COM_CONNECT_CRC_SIZE]    = {0};
+
+    // Assemble command
+    header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
+    header.field.length     = BOOT_COM_CONNECT_CRC_SIZE;
+    header.field.source     = BOOT_COM_SRC_BOOT( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_CONNECT_RSP;
+    header.field.status     = msg_status;
 
-    // Raise callback
-    boot_com_flash_rsp_msg_rcv_cb( p_header->field.status );
+    // Assemble payload
+    memcpy( &payload[0], &payload_size, BOOT_COM_CONNECT_SIZE );
+    payload[BOOT_COM_CONNECT_SIZE] = crc_type;
+
+    // Send command
+    status = boot_com_send_frame( &header, (const uint8_t*) &payload );
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Bootloader Exit message parser
+*       Send Prepare Message
 *
-* @param[in]    p_header    - Pointer to message header
-* @param[in]    p_payload   - Pointer to message payload
-* @return       void
+* @note     Shall only be used by Boot Manager!
+*
+* @param[in]    p_head  - Image header
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_parse_exit(const boot_header_t * const p_header, const uint8_t * const p_payload)
+boot_status_t boot_com_send_prepare(const ver_image_header_t * const p_head)
 {
-    // Unused
-    (void) p_header;
-    (void) p_payload;
+    boot_status_t status = eBOOT_OK;
+    boot_header_t header = { .U = 0U };
+
+    // Assemble command
+    header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
+    header.field.length     = sizeof( ver_image_header_t );
+    header.field.source     = BOOT_COM_SRC_MNGR( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_PREPARE;
 
-    // Raise callback
-    boot_com_exit_msg_rcv_cb();
+    // Send command
+    status = boot_com_send_frame( &header, (const uint8_t*) p_head );
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Bootloader Exit Response message parser
+*       Send Prepare Response Message
 *
-* @param[in]    p_header    - Pointer to message header
-* @param[in]    p_payload   - Pointer to message payload
-* @return       void
+* @note     Shall only be used by Bootloader!
+*
+* @param[in]    msg_status  - Response message status
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_parse_exit_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+boot_status_t boot_com_send_prepare_rsp(const boot_msg_status_t msg_status)
 {
-    // Unused
-    (void) p_payload;
+    boot_status_t status = eBOOT_OK;
+    boot_header_t header = { .U = 0U };
+
+    // Assemble command
+    header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
+    header.field.length     = 0U;
+    header.field.source     = BOOT_COM_SRC_BOOT( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_PREPARE_RSP;
+    header.field.status     = msg_status;
+
+    // Send command
+    status = boot_com_send_frame( &header, NULL );
 
-    // Raise callback
-    boot_com_exit_rsp_msg_rcv_cb( p_header->field.status );
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Bootloader Info message parser
+*       Send Prepare or Resume Message
 *
-* @param[in]    p_header    - Pointer to message header
-* @param[in]    p_payload   - Pointer to message payload
-* @return       void
+* @note     Shall only be used by Boot Manager!
+*
+* @param[in]    p_head  - Image header
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_parse_info(const boot_header_t * const p_header, const uint8_t * const p_payload)
+boot_status_t boot_com_send_prepare_resume(const ver_image_header_t * const p_head)
 {
-    // Unused
-    (void) p_header;
-    (void) p_payload;
+    boot_status_t status = eBOOT_OK;
+    boot_header_t header = { .U = 0U };
+
+    // Assemble command
+    header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
+    header.field.length     = sizeof( ver_image_header_t );
+    header.field.source     = BOOT_COM_SRC_MNGR( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_PREPARE_RESUME;
+
+    // Send command
+    status = boot_com_send_frame( &header, (const uint8_t*) p_head );
 
-    // Raise callback
-    boot_com_info_msg_rcv_cb();
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Bootloader Info Response message parser
+*       Send Prepare or Resume Response Message
 *
-* @param[in]    p_header    - Pointer to message header
-* @param[in]    p_payload   - Pointer to message payload
-* @return       void
+* @note     Shall only be used by Bootloader!
+*
+* @param[in]    ofs         - Image offset to continue streaming from, 0 for fresh start
+* @param[in]    msg_status  - Response message status
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void boot_parse_info_rsp(const boot_header_t * const p_header, const uint8_t * const p_payload)
+boot_status_t boot_com_send_prepare_resume_rsp(const uint32_t ofs, const boot_msg_status_t msg_status)
 {
-    uint32_t boot_ver = 0U;
+    boot_status_t status = eBOOT_OK;
+    boot_header_t header = { .U = 0U };
 
-    // Parse bootloader version
-    memcpy( &boot_ver, p_payload, sizeof( boot_ver ));
+    // Assemble command
+    header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
+    header.field.length     = BOOT_COM_RESUME_OFS_SIZE;
+    header.field.source     = BOOT_COM_SRC_BOOT( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_PREPARE_RESUME_RSP;
+    header.field.status     = msg_status;
+
+    // Send command
+    status = boot_com_send_frame( &header, (const uint8_t*) &ofs );
 
-    // Raise callback
-    boot_com_info_rsp_msg_rcv_cb( boot_ver, p_header->field.status );
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-* @} <!-- END GROUP -->
+*       Send Flash Data Message
+*
+* @note     Shall only be used by Boot Manager!
+*
+* @param[in]    p_data  - Flash binary data
+* @param[in]    size    - Size of flash binary data in bytes
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_com_send_flash(const uint8_t * const p_data, const uint16_t size)
+{
+    boot_status_t status  = eBOOT_OK;
+    boot_header_t header  = { .U = 0U };
+
+    // Assemble command
+    header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
+    header.field.length     = size;
+    header.field.source     = BOOT_COM_SRC_MNGR( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_FLASH;
+
+    // Send command
+    status = boot_com_send_frame( &header, p_data );
+
+    return status;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*@addtogroup BOOT_COM_API
-* @{ <!-- BEGIN GROUP -->
+*       Send Flash Data Response Message
 *
-* 	Following function are part of Bootloader Communication API.
+* @note     Shall only be used by Bootloader!
+*
+* @param[in]    msg_status  - Response message status
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_com_send_flash_rsp(const boot_msg_status_t msg_status)
+{
+    boot_status_t status = eBOOT_OK;
+    boot_header_t header = { .U = 0U };
+
+    // Assemble command
+    header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
+    header.field.length     = 0U;
+    header.field.source     = BOOT_COM_SRC_BOOT( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_FLASH_RSP;
+    header.field.status     = msg_status;
+
+    // Send command
+    status = boot_com_send_frame( &header, NULL );
+
+    return status;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Handle Bootloader communication
+*       Send Sequenced Flash Data Message
 *
-* @return       status - Status of operation
+* @note     Shall only be used by Boot Manager!
+*
+* @param[in]    seq     - Sequence number of frame
+* @param[in]    p_data  - Flash binary data
+* @param[in]    size    - Size of flash binary data in bytes
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-boot_status_t boot_com_hndl(void)
+boot_status_t boot_com_send_flash_seq(const uint16_t seq, const uint8_t * const p_data, const uint16_t size)
 {
-    boot_status_t   status      = eBOOT_OK;
-    static boot_header_t * p_header    = NULL;
-    static uint8_t *       p_payload   = NULL;
+            boot_status_t   status                                                      = eBOOT_OK;
+            boot_header_t   header                                                      = { .U = 0U };
+    static  uint8_t         payload[BOOT_COM_FLASH_SEQ_SIZE + BOOT_CFG_DATA_PAYLOAD_SIZE]  = {0};
 
-    // Parse received messages
-    status = boot_parse_hndl((boot_header_t **) &p_header, (uint8_t**) &p_payload );
+    BOOT_ASSERT( size <= BOOT_CFG_DATA_PAYLOAD_SIZE );
 
-    // Msg received OK
-    if ( eBOOT_OK == status )
+    if ( size <= BOOT_CFG_DATA_PAYLOAD_SIZE )
     {
-        // Parse received message
-        for ( uint32_t cmd = 0; cmd < gu32_parse_table_size; cmd++ )
-        {
-            if (p_header->field.command == g_parse_table[cmd].cmd )
-            {
-                // Raise parsing command
-                g_parse_table[cmd].pf_parse( p_header, p_payload );
-                break;
-            }
-        }
+        // Assemble command
+        header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
+        header.field.length     = ( size + BOOT_COM_FLASH_SEQ_SIZE );
+        header.field.source     = BOOT_COM_SRC_MNGR( BOOT_COM_NODE );
+        header.field.command    = eBOOT_MSG_CMD_FLASH_SEQ;
+
+        // Assemble payload
+        memcpy( &payload[0], &seq, BOOT_COM_FLASH_SEQ_SIZE );
+        memcpy( &payload[BOOT_COM_FLASH_SEQ_SIZE], p_data, size );
+
+        // Send command
+        status = boot_com_send_frame( &header, (const uint8_t*) &payload );
+    }
+    else
+    {
+        status = eBOOT_ERROR;
     }
 
     return status;
@@ -821,26 +2259,45 @@ boot_status_t boot_com_hndl(void)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get timestamp of last received byte
+*       Send Sequenced Flash Data Response (Acknowledge) Message
 *
-* @return       last_timestamp - Timestamp of last rx byte in ms
+* @note     Shall only be used by Bootloader!
+*
+* @note     Acknowledge is cumulative: all frames before "seq_next" are flashed.
+*
+* @param[in]    seq_next    - Next expected sequence number
+* @param[in]    msg_status  - Response message status
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-uint32_t boot_com_get_last_rx_timestamp(void)
+boot_status_t boot_com_send_flash_seq_rsp(const uint16_t seq_next, const boot_msg_status_t msg_status)
 {
-    return g_parser.last_timestamp;
+    boot_status_t status = eBOOT_OK;
+    boot_header_t header = { .U = 0U };
+
+    // Assemble command
+    header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
+    header.field.length     = BOOT_COM_FLASH_SEQ_SIZE;
+    header.field.source     = BOOT_COM_SRC_BOOT( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_FLASH_SEQ_RSP;
+    header.field.status     = msg_status;
+
+    // Send command
+    status = boot_com_send_frame( &header, (const uint8_t*) &seq_next );
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Send Connect Message
+*       Send Exit Message
 *
 * @note     Shall only be used by Boot Manager!
 *
 * @return       status - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-boot_status_t boot_com_send_connect(void)
+boot_status_t boot_com_send_exit(void)
 {
     boot_status_t status = eBOOT_OK;
     boot_header_t header = { .U = 0U };
@@ -848,21 +2305,18 @@ boot_status_t boot_com_send_connect(void)
     // Assemble command
     header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
     header.field.length     = 0U;
-    header.field.source     = eCOM_MSG_SRC_BOOT_MANAGER;
-    header.field.command    = eBOOT_MSG_CMD_CONNECT;
-
-    // Calculate CRC
-    header.field.crc = boot_com_calc_crc_packet( &header, NULL );
+    header.field.source     = BOOT_COM_SRC_MNGR( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_EXIT;
 
     // Send command
-    status = boot_if_transmit( &header.U, sizeof( boot_header_t ));
+    status = boot_com_send_frame( &header, NULL );
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Send Connect Response Message
+*       Send Exit Response Message
 *
 * @note     Shall only be used by Bootloader!
 *
@@ -870,278 +2324,305 @@ boot_status_t boot_com_send_connect(void)
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-boot_status_t boot_com_send_connect_rsp(const boot_msg_status_t msg_status)
+boot_status_t boot_com_send_exit_rsp(const boot_msg_status_t msg_status)
+{
+    boot_status_t status = eBOOT_OK;
+    boot_header_t header = { .U = 0U };
+
+    // Assemble command
+    header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
+    header.field.length     = 0U;
+    header.field.source     = BOOT_COM_SRC_BOOT( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_EXIT_RSP;
+    header.field.status     = msg_status;
+
+    // Send command
+    status = boot_com_send_frame( &header, NULL );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Send Info Message
+*
+* @note     Shall only be used by Boot Manager!
+*
+* @return       status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_com_send_info(void)
 {
     boot_status_t status = eBOOT_OK;
     boot_header_t header = { .U = 0U };
 
     // Assemble command
     header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
-    header.field.length     = 0U;
-    header.field.source     = eCOM_MSG_SRC_BOOTLOADER;
-    header.field.command    = eBOOT_MSG_CMD_CONNECT_RSP;
+    header.field.length     = 0U;
+    header.field.source     = BOOT_COM_SRC_MNGR( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_INFO;
+
+    // Send command
+    status = boot_com_send_frame( &header, NULL );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Send Information Response Message
+*
+* @note     Shall only be used by Bootloader!
+*
+* @param[in]    p_info      - Bootloader version and capabilities
+* @param[in]    msg_status  - Response message status
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_com_send_info_rsp(const boot_info_t * const p_info, const boot_msg_status_t msg_status)
+{
+    boot_status_t status  = eBOOT_OK;
+    boot_header_t header  = { .U = 0U };
+
+    // Assemble command
+    header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
+    header.field.length     = sizeof( boot_info_t );
+    header.field.source     = BOOT_COM_SRC_BOOT( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_INFO_RSP;
     header.field.status     = msg_status;
 
-    // Calculate CRC
-    header.field.crc = boot_com_calc_crc_packet( &header, NULL );
-
     // Send command
-    status = boot_if_transmit( &header.U, sizeof( boot_header_t ));
+    status = boot_com_send_frame( &header, (const uint8_t*) p_info );
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Send Prepare Message
+*       Send Statistics Message
 *
 * @note     Shall only be used by Boot Manager!
 *
-* @param[in]    fw_size - Size of firmware in bytes
-* @param[in]    fw_ver  - Firmware version
-* @param[in]    hw_ver  - Hardware version
-* @return       status  - Status of operation
+* @return       status - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-boot_status_t boot_com_send_prepare(const uint32_t fw_size, const uint32_t fw_ver, const uint32_t hw_ver)
+boot_status_t boot_com_send_stats(void)
 {
-    boot_status_t           status  = eBOOT_OK;
-    boot_header_t           header  = { .U = 0U };
-    boot_prepare_payload_t  payload = {0};
+    boot_status_t status = eBOOT_OK;
+    boot_header_t header = { .U = 0U };
 
     // Assemble command
     header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
     header.field.length     = 0U;
-    header.field.source     = eCOM_MSG_SRC_BOOT_MANAGER;
-    header.field.command    = eBOOT_MSG_CMD_PREPARE;
-
-    // Assemble payload
-    payload.fw_size = fw_size;
-    payload.fw_ver  = fw_ver;
-    payload.hw_ver  = hw_ver;
-
-    // Calculate CRC
-    header.field.crc = boot_com_calc_crc_packet( &header, (uint8_t*) &payload );
+    header.field.source     = BOOT_COM_SRC_MNGR( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_STATS;
 
     // Send command
-    status  = boot_if_transmit( &header.U, sizeof( boot_header_t ));
-    status |= boot_if_transmit((uint8_t*) &payload, sizeof( boot_prepare_payload_t ));
+    status = boot_com_send_frame( &header, NULL );
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Send Prepare Response Message
+*       Send Statistics Response Message
 *
 * @note     Shall only be used by Bootloader!
 *
+* @param[in]    p_stats     - Bootloader statistics
 * @param[in]    msg_status  - Response message status
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-boot_status_t boot_com_send_prepare_rsp(const boot_msg_status_t msg_status)
+boot_status_t boot_com_send_stats_rsp(const boot_stats_t * const p_stats, const boot_msg_status_t msg_status)
 {
-    boot_status_t status = eBOOT_OK;
-    boot_header_t header = { .U = 0U };
+    boot_status_t status  = eBOOT_OK;
+    boot_header_t header  = { .U = 0U };
 
     // Assemble command
     header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
-    header.field.length     = 0U;
-    header.field.source     = eCOM_MSG_SRC_BOOTLOADER;
-    header.field.command    = eBOOT_MSG_CMD_PREPARE_RSP;
+    header.field.length     = sizeof( boot_stats_t );
+    header.field.source     = BOOT_COM_SRC_BOOT( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_STATS_RSP;
     header.field.status     = msg_status;
 
-    // Calculate CRC
-    header.field.crc = boot_com_calc_crc_packet( &header, NULL );
-
     // Send command
-    status = boot_if_transmit( &header.U, sizeof( boot_header_t ));
+    status = boot_com_send_frame( &header, (const uint8_t*) p_stats );
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Send Flash Data Message
+*       Send Verify Message
 *
 * @note     Shall only be used by Boot Manager!
 *
-* @param[in]    p_data  - Flash binary data
-* @param[in]    size    - Size of flash binary data in bytes
+* @param[in]    p_range - Range to calculate digest of
 * @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-boot_status_t boot_com_send_flash(const uint8_t * const p_data, const uint16_t size)
+boot_status_t boot_com_send_verify(const boot_verify_t * const p_range)
 {
-    boot_status_t status  = eBOOT_OK;
-    boot_header_t header  = { .U = 0U };
+    boot_status_t status = eBOOT_OK;
+    boot_header_t header = { .U = 0U };
 
     // Assemble command
     header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
-    header.field.length     = size;
-    header.field.source     = eCOM_MSG_SRC_BOOT_MANAGER;
-    header.field.command    = eBOOT_MSG_CMD_FLASH;
-
-    // Calculate CRC
-    header.field.crc = boot_com_calc_crc_packet( &header, p_data );
+    header.field.length     = sizeof( boot_verify_t );
+    header.field.source     = BOOT_COM_SRC_MNGR( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_VERIFY;
 
     // Send command
-    status  = boot_if_transmit( &header.U, sizeof( boot_header_t ));
-    status |= boot_if_transmit( p_data, size );
+    status = boot_com_send_frame( &header, (const uint8_t*) p_range );
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Send Flash Data Response Message
+*       Send Verify Response Message
 *
-* @note     Shall only be used by Bootloader!
+* @note     Shall only be used by Bootloader! Digest is sent only with
+*           "eBOOT_MSG_OK" status.
 *
+* @param[in]    p_rsp       - Verified range and its digest
 * @param[in]    msg_status  - Response message status
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-boot_status_t boot_com_send_flash_rsp(const boot_msg_status_t msg_status)
+boot_status_t boot_com_send_verify_rsp(const boot_verify_rsp_t * const p_rsp, const boot_msg_status_t msg_status)
 {
-    boot_status_t status = eBOOT_OK;
-    boot_header_t header = { .U = 0U };
+    boot_status_t status  = eBOOT_OK;
+    boot_header_t header  = { .U = 0U };
 
     // Assemble command
     header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
-    header.field.length     = 0U;
-    header.field.source     = eCOM_MSG_SRC_BOOTLOADER;
-    header.field.command    = eBOOT_MSG_CMD_FLASH_RSP;
+    header.field.length     = (uint16_t)( sizeof( boot_verify_t ) + (( eBOOT_MSG_OK == msg_status ) ? BOOT_VERIFY_DIGEST_SIZE( p_rsp->range.type ) : 0U ));
+    header.field.source     = BOOT_COM_SRC_BOOT( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_VERIFY_RSP;
     header.field.status     = msg_status;
 
-    // Calculate CRC
-    header.field.crc = boot_com_calc_crc_packet( &header, NULL );
-
     // Send command
-    status = boot_if_transmit( &header.U, sizeof( boot_header_t ));
+    status = boot_com_send_frame( &header, (const uint8_t*) p_rsp );
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Send Exit Message
+*       Send Verify Sectors Message
 *
 * @note     Shall only be used by Boot Manager!
 *
-* @return       status - Status of operation
+* @param[in]    p_range - Range to calculate sector digests of
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-boot_status_t boot_com_send_exit(void)
+boot_status_t boot_com_send_verify_sectors(const boot_verify_t * const p_range)
 {
     boot_status_t status = eBOOT_OK;
     boot_header_t header = { .U = 0U };
 
     // Assemble command
     header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
-    header.field.length     = 0U;
-    header.field.source     = eCOM_MSG_SRC_BOOT_MANAGER;
-    header.field.command    = eBOOT_MSG_CMD_EXIT;
-
-    // Calculate CRC
-    header.field.crc = boot_com_calc_crc_packet( &header, NULL );
+    header.field.length     = sizeof( boot_verify_t );
+    header.field.source     = BOOT_COM_SRC_MNGR( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_VERIFY_SECTORS;
 
     // Send command
-    status = boot_if_transmit( &header.U, sizeof( boot_header_t ));
+    status = boot_com_send_frame( &header, (const uint8_t*) p_range );
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Send Exit Response Message
+*       Send Verify Sectors Response Message
 *
 * @note     Shall only be used by Bootloader!
 *
+* @param[in]    p_rsp       - Covered range and sector entries
 * @param[in]    msg_status  - Response message status
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-boot_status_t boot_com_send_exit_rsp(const boot_msg_status_t msg_status)
+boot_status_t boot_com_send_verify_sectors_rsp(const boot_verify_sectors_rsp_t * const p_rsp, const boot_msg_status_t msg_status)
 {
-    boot_status_t status = eBOOT_OK;
-    boot_header_t header = { .U = 0U };
+    boot_status_t status  = eBOOT_OK;
+    boot_header_t header  = { .U = 0U };
 
     // Assemble command
     header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
-    header.field.length     = 0U;
-    header.field.source     = eCOM_MSG_SRC_BOOTLOADER;
-    header.field.command    = eBOOT_MSG_CMD_EXIT_RSP;
+    header.field.length     = (uint16_t)( sizeof( boot_verify_t ) + sizeof( uint8_t ) + ( p_rsp->num_of * ( sizeof( uint32_t ) + BOOT_VERIFY_DIGEST_SIZE( p_rsp->range.type ))));
+    header.field.source     = BOOT_COM_SRC_BOOT( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_VERIFY_SECTORS_RSP;
     header.field.status     = msg_status;
 
-    // Calculate CRC
-    header.field.crc = boot_com_calc_crc_packet( &header, NULL );
-
     // Send command
-    status = boot_if_transmit( &header.U, sizeof( boot_header_t ));
+    status = boot_com_send_frame( &header, (const uint8_t*) p_rsp );
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Send Info Message
+*       Send Prepare Skip Message
 *
 * @note     Shall only be used by Boot Manager!
 *
-* @return       status - Status of operation
+* @param[in]    p_head      - Image header
+* @param[in]    p_map       - Sector map of "BOOT_SKIP_MAP_SIZE" bytes, set bit for sector to program
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-boot_status_t boot_com_send_info(void)
+boot_status_t boot_com_send_prepare_skip(const ver_image_header_t * const p_head, const uint8_t * const p_map)
 {
-    boot_status_t status = eBOOT_OK;
-    boot_header_t header = { .U = 0U };
+            boot_status_t   status  = eBOOT_OK;
+            boot_header_t   header  = { .U = 0U };
+    static  uint8_t         payload[BOOT_COM_PREPARE_SKIP_SIZE] = {0};
+
+    // Header followed by sector map
+    memcpy( &payload[0], p_head, sizeof( ver_image_header_t ));
+    memcpy( &payload[ sizeof( ver_image_header_t ) ], p_map, BOOT_SKIP_MAP_SIZE );
 
     // Assemble command
     header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
-    header.field.length     = 0U;
-    header.field.source     = eCOM_MSG_SRC_BOOT_MANAGER;
-    header.field.command    = eBOOT_MSG_CMD_INFO;
-
-    // Calculate CRC
-    header.field.crc = boot_com_calc_crc_packet( &header, NULL );
+    header.field.length     = BOOT_COM_PREPARE_SKIP_SIZE;
+    header.field.source     = BOOT_COM_SRC_MNGR( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_PREPARE_SKIP;
 
     // Send command
-    status = boot_if_transmit( &header.U, sizeof( boot_header_t ));
+    status = boot_com_send_frame( &header, (const uint8_t*) &payload );
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Send Information Response Message
+*       Send Prepare Skip Response Message
 *
 * @note     Shall only be used by Bootloader!
 *
-* @param[in]    boot_ver    - Bootloader version
+* @param[in]    p_map       - Applied sector map of "BOOT_SKIP_MAP_SIZE" bytes, set bit for sector to program
 * @param[in]    msg_status  - Response message status
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-boot_status_t boot_com_send_info_rsp(const uint32_t boot_ver, const boot_msg_status_t msg_status)
+boot_status_t boot_com_send_prepare_skip_rsp(const uint8_t * const p_map, const boot_msg_status_t msg_status)
 {
     boot_status_t status  = eBOOT_OK;
     boot_header_t header  = { .U = 0U };
 
     // Assemble command
     header.field.preamble   = BOOT_COM_MSG_PREAMBLE_VAL;
-    header.field.length     = sizeof(boot_ver);
-    header.field.source     = eCOM_MSG_SRC_BOOTLOADER;
-    header.field.command    = eBOOT_MSG_CMD_INFO_RSP;
+    header.field.length     = (( eBOOT_MSG_OK == msg_status ) ? BOOT_SKIP_MAP_SIZE : 0U );
+    header.field.source     = BOOT_COM_SRC_BOOT( BOOT_COM_NODE );
+    header.field.command    = eBOOT_MSG_CMD_PREPARE_SKIP_RSP;
     header.field.status     = msg_status;
 
-    // Calculate CRC
-    header.field.crc = boot_com_calc_crc_packet( &header, (uint8_t*) &boot_ver );
-
     // Send command
-    status  = boot_if_transmit( &header.U, sizeof( boot_header_t ));
-    status |= boot_if_transmit((uint8_t*) &boot_ver, sizeof(uint32_t) );
+    status = boot_com_send_frame( &header, (( eBOOT_MSG_OK == msg_status ) ? p_map : NULL ));
 
     return status;
 }
@@ -1150,11 +2631,17 @@ boot_status_t boot_com_send_info_rsp(const uint32_t boot_ver, const boot_msg_sta
 /**
 *       Connect Bootloader Message Reception Callback
 *
+* @param[in]    payload_size    - Requested flash data payload size in bytes, 0 for maximum supported
+* @param[in]    crc_type        - Requested frame check type
 * @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-__BOOT_CFG_WEAK__ void boot_com_connect_msg_rcv_cb(void)
+__BOOT_CFG_WEAK__ void boot_com_connect_msg_rcv_cb(const uint16_t payload_size, const uint8_t crc_type)
 {
+    // Unused params
+    (void) payload_size;
+    (void) crc_type;
+
     /**
      *  Leave empty for user application purposes...
      */
@@ -1164,13 +2651,17 @@ __BOOT_CFG_WEAK__ void boot_com_connect_msg_rcv_cb(void)
 /**
 *       Connect Response Bootloader Message Reception Callback
 *
-* @param[in]    msg_status - Status of connect command
+* @param[in]    payload_size    - Negotiated flash data payload size in bytes, 0 for older bootloaders
+* @param[in]    crc_type        - Negotiated frame check type
+* @param[in]    msg_status      - Status of connect command
 * @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-__BOOT_CFG_WEAK__ void boot_com_connect_rsp_msg_rcv_cb(const boot_msg_status_t msg_status)
+__BOOT_CFG_WEAK__ void boot_com_connect_rsp_msg_rcv_cb(const uint16_t payload_size, const uint8_t crc_type, const boot_msg_status_t msg_status)
 {
     // Unused params
+    (void) payload_size;
+    (void) crc_type;
     (void) msg_status;
 
     /**
@@ -1214,6 +2705,44 @@ __BOOT_CFG_WEAK__ void boot_com_prepare_rsp_msg_rcv_cb(const boot_msg_status_t m
      */
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Prepare or Resume Bootloader Message Reception Callback
+*
+* @param[in]    p_head - Image header
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__BOOT_CFG_WEAK__ void boot_com_prepare_resume_msg_rcv_cb(const ver_image_header_t * const p_head)
+{
+    // Unused params
+    (void) p_head;
+
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Prepare or Resume Response Bootloader Message Reception Callback
+*
+* @param[in]    ofs         - Image offset to continue streaming from
+* @param[in]    msg_status  - Status of prepare or resume command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__BOOT_CFG_WEAK__ void boot_com_prepare_resume_rsp_msg_rcv_cb(const uint32_t ofs, const boot_msg_status_t msg_status)
+{
+    // Unused params
+    (void) ofs;
+    (void) msg_status;
+
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *       Flash Bootloader Message Reception Callback
@@ -1252,6 +2781,48 @@ __BOOT_CFG_WEAK__ void boot_com_flash_rsp_msg_rcv_cb(const boot_msg_status_t msg
      */
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Sequenced Flash Bootloader Message Reception Callback
+*
+* @param[in]    seq     - Sequence number of frame
+* @param[in]    p_data  - Flash binary data
+* @param[in]    size    - Size of flash data in bytes
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__BOOT_CFG_WEAK__ void boot_com_flash_seq_msg_rcv_cb(const uint16_t seq, const uint8_t * const p_data, const uint16_t size)
+{
+    // Unused params
+    (void) seq;
+    (void) p_data;
+    (void) size;
+
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Sequenced Flash Response Bootloader Message Reception Callback
+*
+* @param[in]    seq_next    - Next expected sequence number
+* @param[in]    msg_status  - Status of flash command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__BOOT_CFG_WEAK__ void boot_com_flash_seq_rsp_msg_rcv_cb(const uint16_t seq_next, const boot_msg_status_t msg_status)
+{
+    // Unused params
+    (void) seq_next;
+    (void) msg_status;
+
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *       Exit Bootloader Message Reception Callback
@@ -1302,15 +2873,165 @@ __BOOT_CFG_WEAK__ void boot_com_info_msg_rcv_cb(void)
 /**
 *       Info Response Bootloader Message Reception Callback
 *
-* @param[in]    msg_status  - Bootloader version
-* @param[in]    status      - Status of info command
+* @param[in]    p_info      - Bootloader version and capabilities
+* @param[in]    msg_status  - Status of info command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__BOOT_CFG_WEAK__ void boot_com_info_rsp_msg_rcv_cb(const boot_info_t * const p_info, const boot_msg_status_t msg_status)
+{
+    // Unused params
+    (void) p_info;
+    (void) msg_status;
+
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Statistics Bootloader Message Reception Callback
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__BOOT_CFG_WEAK__ void boot_com_stats_msg_rcv_cb(void)
+{
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Statistics Response Bootloader Message Reception Callback
+*
+* @param[in]    p_stats     - Bootloader statistics
+* @param[in]    msg_status  - Status of statistics command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__BOOT_CFG_WEAK__ void boot_com_stats_rsp_msg_rcv_cb(const boot_stats_t * const p_stats, const boot_msg_status_t msg_status)
+{
+    // Unused params
+    (void) p_stats;
+    (void) msg_status;
+
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Verify Bootloader Message Reception Callback
+*
+* @param[in]    p_range - Range to calculate digest of
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__BOOT_CFG_WEAK__ void boot_com_verify_msg_rcv_cb(const boot_verify_t * const p_range)
+{
+    // Unused params
+    (void) p_range;
+
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Verify Response Bootloader Message Reception Callback
+*
+* @param[in]    p_rsp       - Verified range and its digest
+* @param[in]    msg_status  - Status of verify command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__BOOT_CFG_WEAK__ void boot_com_verify_rsp_msg_rcv_cb(const boot_verify_rsp_t * const p_rsp, const boot_msg_status_t msg_status)
+{
+    // Unused params
+    (void) p_rsp;
+    (void) msg_status;
+
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Verify Sectors Bootloader Message Reception Callback
+*
+* @param[in]    p_range - Range to calculate sector digests of
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__BOOT_CFG_WEAK__ void boot_com_verify_sectors_msg_rcv_cb(const boot_verify_t * const p_range)
+{
+    // Unused params
+    (void) p_range;
+
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Verify Sectors Response Bootloader Message Reception Callback
+*
+* @param[in]    p_rsp       - Covered range and sector entries
+* @param[in]    msg_status  - Status of verify sectors command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__BOOT_CFG_WEAK__ void boot_com_verify_sectors_rsp_msg_rcv_cb(const boot_verify_sectors_rsp_t * const p_rsp, const boot_msg_status_t msg_status)
+{
+    // Unused params
+    (void) p_rsp;
+    (void) msg_status;
+
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Prepare Skip Bootloader Message Reception Callback
+*
+* @param[in]    p_head  - Image header
+* @param[in]    p_map   - Sector map of "BOOT_SKIP_MAP_SIZE" bytes
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__BOOT_CFG_WEAK__ void boot_com_prepare_skip_msg_rcv_cb(const ver_image_header_t * const p_head, const uint8_t * const p_map)
+{
+    // Unused params
+    (void) p_head;
+    (void) p_map;
+
+    /**
+     *  Leave empty for user application purposes...
+     */
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Prepare Skip Response Bootloader Message Reception Callback
+*
+* @param[in]    p_map       - Applied sector map of "BOOT_SKIP_MAP_SIZE" bytes, all zero on error
+* @param[in]    msg_status  - Status of prepare skip command
 * @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-__BOOT_CFG_WEAK__ void boot_com_info_rsp_msg_rcv_cb(const uint32_t boot_ver, const boot_msg_status_t msg_status)
+__BOOT_CFG_WEAK__ void boot_com_prepare_skip_rsp_msg_rcv_cb(const uint8_t * const p_map, const boot_msg_status_t msg_status)
 {
     // Unused params
-    (void) boot_ver;
+    (void) p_map;
     (void) msg_status;
 
     /**
@@ -35,35 +35,134 @@
 // Definitions
 ////////////////////////////////////////////////////////////////////////////////
 
+/**
+ *  Bootloader communication protocol version
+ *
+ *  @note   Reported in info response message.
+ *
+ *          1 - Stop-and-wait flash data command only
+ *          2 - Sequenced (windowed) flash data command
+ *          3 - Prepare or resume command
+ *          4 - Flash data payload size negotiated at connect command
+ *          5 - Frame check type (CRC-16/CRC-32 trailer) negotiated at connect command
+ *          6 - Statistics command
+ *          7 - Verify and verify sectors commands
+ *          8 - Prepare skip command (unchanged sectors are kept)
+ *          9 - Node address in message source (pass-through bridge)
+ *         10 - Verify commands optional (info feature), whole sectors only
+ */
+#define BOOT_COM_PROTO_VER                  ( 10 )
+
+/**
+ *  Frame check types
+ *
+ *  @note   Negotiated at connect command. With CRC-16 or CRC-32 header CRC-8
+ *          covers header only and frame check trailer follows payload.
+ */
+#define BOOT_COM_CRC_TYPE_CRC8              ( 0U )  /**<CRC-8 inside header only */
+#define BOOT_COM_CRC_TYPE_CRC16             ( 1U )  /**<CRC-16-CCITT frame trailer */
+#define BOOT_COM_CRC_TYPE_CRC32             ( 2U )  /**<CRC-32 frame trailer, same as image CRC-32 */
+
+/**
+ *  Number of communication channels
+ *
+ *  @note   Boot Manager drives one channel (port) per device, Bootloader
+ *          has single channel, bridge has additional downstream channel.
+ */
+#if ( 1 == BOOT_CFG_COM_MANAGER_EN )
+    #define BOOT_COM_CH_NUM_OF              ( BOOT_CFG_MNGR_DEV_NUM_OF )
+#elif ( 1 == BOOT_CFG_BRIDGE_EN )
+    #define BOOT_COM_CH_NUM_OF              ( 2U )
+#else
+    #define BOOT_COM_CH_NUM_OF              ( 1U )
+#endif
+
+/**
+ *  Bridge channels
+ */
+#define BOOT_COM_CH_UPSTREAM                ( 0U )  /**<Towards Boot Manager */
+#define BOOT_COM_CH_DOWNSTREAM              ( 1U )  /**<Towards downstream nodes */
+
+/**
+ *  Number of node addresses
+ */
+#define BOOT_COM_NODE_NUM_OF                ( 16U )
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
 boot_status_t   boot_com_hndl                   (void);
 uint32_t        boot_com_get_last_rx_timestamp  (void);
+void            boot_com_set_crc_type           (const uint8_t crc_type);
+bool            boot_com_crc_type_is_supported  (const uint8_t crc_type);
+
+#if ( 1 == BOOT_CFG_COM_MANAGER_EN )
+    void        boot_com_select_ch              (const uint8_t ch);
+    void        boot_com_reset_ch               (void);
+    void        boot_com_set_node               (const uint8_t node);
+    uint8_t     boot_com_get_node               (void);
+#endif
+
+#if (( 1 == BOOT_CFG_COM_MANAGER_EN ) || ( 1 == BOOT_CFG_BRIDGE_EN ))
+    uint8_t     boot_com_get_ch                 (void);
+#endif
+
+#if ( 1 == BOOT_CFG_STATS_EN )
+    void        boot_com_get_stats              (boot_com_stats_t * const p_stats);
+    void        boot_com_clear_stats            (void);
+#endif
 
 // Message send functions
-boot_status_t boot_com_send_connect     (void);
-boot_status_t boot_com_send_connect_rsp (const boot_msg_status_t msg_status);
-boot_status_t boot_com_send_prepare     (const uint32_t fw_size, const uint32_t fw_ver, const uint32_t hw_ver);
+boot_status_t boot_com_send_connect     (const uint16_t payload_size, const uint8_t crc_type);
+boot_status_t boot_com_send_connect_rsp (const uint16_t payload_size, const uint8_t crc_type, const boot_msg_status_t msg_status);
+boot_status_t boot_com_send_prepare     (const ver_image_header_t * const p_head);
 boot_status_t boot_com_send_prepare_rsp (const boot_msg_status_t msg_status);
+boot_status_t boot_com_send_prepare_resume      (const ver_image_header_t * const p_head);
+boot_status_t boot_com_send_prepare_resume_rsp  (const uint32_t ofs, const boot_msg_status_t msg_status);
 boot_status_t boot_com_send_flash     	(const uint8_t * const p_data, const uint16_t size);
 boot_status_t boot_com_send_flash_rsp 	(const boot_msg_status_t msg_status);
+boot_status_t boot_com_send_flash_seq       (const uint16_t seq, const uint8_t * const p_data, const uint16_t size);
+boot_status_t boot_com_send_flash_seq_rsp   (const uint16_t seq_next, const boot_msg_status_t msg_status);
 boot_status_t boot_com_send_exit     	(void);
 boot_status_t boot_com_send_exit_rsp 	(const boot_msg_status_t msg_status);
 boot_status_t boot_com_send_info        (void);
-boot_status_t boot_com_send_info_rsp    (const uint32_t boot_ver, const boot_msg_status_t msg_status);
+boot_status_t boot_com_send_info_rsp    (const boot_info_t * const p_info, const boot_msg_status_t msg_status);
+boot_status_t boot_com_send_stats       (void);
+boot_status_t boot_com_send_stats_rsp   (const boot_stats_t * const p_stats, const boot_msg_status_t msg_status);
+boot_status_t boot_com_send_verify      (const boot_verify_t * const p_range);
+boot_status_t boot_com_send_verify_rsp  (const boot_verify_rsp_t * const p_rsp, const boot_msg_status_t msg_status);
+boot_status_t boot_com_send_verify_sectors      (const boot_verify_t * const p_range);
+boot_status_t boot_com_send_verify_sectors_rsp  (const boot_verify_sectors_rsp_t * const p_rsp, const boot_msg_status_t msg_status);
+boot_status_t boot_com_send_prepare_skip        (const ver_image_header_t * const p_head, const uint8_t * const p_map);
+boot_status_t boot_com_send_prepare_skip_rsp    (const uint8_t * const p_map, const boot_msg_status_t msg_status);
 
 // Message receive callback functions
-void boot_com_connect_msg_rcv_cb        (void);
-void boot_com_connect_rsp_msg_rcv_cb    (const boot_msg_status_t msg_status);
+void boot_com_connect_msg_rcv_cb        (const uint16_t payload_size, const uint8_t crc_type);
+void boot_com_connect_rsp_msg_rcv_cb    (const uint16_t payload_size, const uint8_t crc_type, const boot_msg_status_t msg_status);
 void boot_com_prepare_msg_rcv_cb        (const ver_image_header_t * const p_head);
 void boot_com_prepare_rsp_msg_rcv_cb    (const boot_msg_status_t msg_status);
+void boot_com_prepare_resume_msg_rcv_cb     (const ver_image_header_t * const p_head);
+void boot_com_prepare_resume_rsp_msg_rcv_cb (const uint32_t ofs, const boot_msg_status_t msg_status);
 void boot_com_flash_msg_rcv_cb          (const uint8_t * const p_data, const uint16_t size);
 void boot_com_flash_rsp_msg_rcv_cb      (const boot_msg_status_t msg_status);
+void boot_com_flash_seq_msg_rcv_cb      (const uint16_t seq, const uint8_t * const p_data, const uint16_t size);
+void boot_com_flash_seq_rsp_msg_rcv_cb  (const uint16_t seq_next, const boot_msg_status_t msg_status);
 void boot_com_exit_msg_rcv_cb           (void);
 void boot_com_exit_rsp_msg_rcv_cb       (const boot_msg_status_t msg_status);
 void boot_com_info_msg_rcv_cb           (void);
-void boot_com_info_rsp_msg_rcv_cb       (const uint32_t boot_ver, const boot_msg_status_t msg_status);
+void boot_com_info_rsp_msg_rcv_cb       (const boot_info_t * const p_info, const boot_msg_status_t msg_status);
+void boot_com_stats_msg_rcv_cb          (void);
+void boot_com_stats_rsp_msg_rcv_cb      (const boot_stats_t * const p_stats, const boot_msg_status_t msg_status);
+void boot_com_verify_msg_rcv_cb         (const boot_verify_t * const p_range);
+void boot_com_verify_rsp_msg_rcv_cb     (const boot_verify_rsp_t * const p_rsp, const boot_msg_status_t msg_status);
+void boot_com_verify_sectors_msg_rcv_cb     (const boot_verify_t * const p_range);
+void boot_com_verify_sectors_rsp_msg_rcv_cb (const boot_verify_sectors_rsp_t * const p_rsp, const boot_msg_status_t msg_status);
+void boot_com_prepare_skip_msg_rcv_cb       (const ver_image_header_t * const p_head, const uint8_t * const p_map);
+void boot_com_prepare_skip_rsp_msg_rcv_cb   (const uint8_t * const p_map, const boot_msg_status_t msg_status);
+
+#if ( 1 == BOOT_CFG_BRIDGE_EN )
+    void boot_com_bridge_msg_rcv_cb         (const uint8_t node);
+#endif
 
 #endif // __BOOT_COM_H
 
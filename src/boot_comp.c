@@ -0,0 +1,357 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_comp.c
+*@brief     Bootloader compressed image decompression
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup Bootloader compressed image decompression
+* @{ <!-- BEGIN GROUP -->
+*
+*   Compressed stream (shared with "app_sign_tool.py") is heatshrink
+*   compatible LZSS bit stream, MSB first:
+*
+*       Literal:        1, byte (8 bits)
+*       Back-reference: 0, offset - 1 (window bits), length - 1 (lookahead bits)
+*
+*   Stream is decoded in a streaming fashion: data can be split at any point
+*   between calls. Only history window of last decoded bytes is kept in RAM,
+*   its size is bounded by "BOOT_CFG_COMP_WINDOW_BITS". Unused bits at the
+*   end of stream (padding to byte) never form a complete token.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "boot_comp.h"
+#include "../../boot_cfg.h"
+#include "../../boot_if.h"
+
+#if ( 1 == BOOT_CFG_COMP_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Supported window size bits
+ *
+ *  @note   Upper limit keeps longest token plus one byte inside 32-bit accumulator.
+ */
+#define BOOT_COMP_WINDOW_BITS_MIN               ( 4U )
+#define BOOT_COMP_WINDOW_BITS_MAX               ( 12U )
+
+/**
+ *  Minimum lookahead bits
+ */
+#define BOOT_COMP_LOOKAHEAD_BITS_MIN            ( 3U )
+
+/**
+ *  Size of literal token incl. tag bit
+ */
+#define BOOT_COMP_LITERAL_BITS                  ( 9U )
+
+/**
+ *  History window size
+ */
+#define BOOT_COMP_WINDOW_SIZE                   ( 1UL << BOOT_CFG_COMP_WINDOW_BITS )
+
+BOOT_CFG_STATIC_ASSERT(( BOOT_CFG_COMP_WINDOW_BITS >= BOOT_COMP_WINDOW_BITS_MIN ) && ( BOOT_CFG_COMP_WINDOW_BITS <= BOOT_COMP_WINDOW_BITS_MAX ));
+
+/**
+ *  Decompressor
+ */
+typedef struct
+{
+    uint8_t     win[BOOT_COMP_WINDOW_SIZE];     /**<History window */
+    uint32_t    acc;                            /**<Bit accumulator */
+    uint32_t    mask;                           /**<Window index mask of stream */
+    uint32_t    head;                           /**<Window write index */
+    uint32_t    flush;                          /**<Window index of first not yet output byte */
+    uint32_t    fill;                           /**<Number of valid bytes in window */
+    uint8_t     acc_cnt;                        /**<Number of bits in accumulator */
+    uint8_t     window_bits;                    /**<Window size bits of stream */
+    uint8_t     lookahead_bits;                 /**<Lookahead bits of stream */
+    bool        is_error;                       /**<Malformed stream or output error */
+} boot_comp_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Decompressor
+ */
+static boot_comp_t g_boot_comp = {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t         boot_comp_bits_get      (const uint8_t num_of);
+static boot_status_t    boot_comp_flush         (pf_boot_data_out_t pf_out, void * const p_ctx);
+static boot_status_t    boot_comp_put           (const uint8_t byte, pf_boot_data_out_t pf_out, void * const p_ctx);
+static boot_status_t    boot_comp_backref       (const uint32_t offset, const uint32_t size, pf_boot_data_out_t pf_out, void * const p_ctx);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Take bits from accumulator
+*
+* @param[in]    num_of  - Number of bits, shall be available
+* @return       bits    - Value of bits
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t boot_comp_bits_get(const uint8_t num_of)
+{
+    g_boot_comp.acc_cnt -= num_of;
+
+    return (( g_boot_comp.acc >> g_boot_comp.acc_cnt ) & (( 1UL << num_of ) - 1UL ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Output decoded data not yet handed to output
+*
+* @param[in]    pf_out  - Output callback
+* @param[in]    p_ctx   - Output callback context
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_comp_flush(pf_boot_data_out_t pf_out, void * const p_ctx)
+{
+    boot_status_t status = eBOOT_OK;
+
+    if ( g_boot_comp.head > g_boot_comp.flush )
+    {
+        status = pf_out((const uint8_t*) &g_boot_comp.win[ g_boot_comp.flush ], ( g_boot_comp.head - g_boot_comp.flush ), p_ctx );
+    }
+
+    g_boot_comp.flush = g_boot_comp.head;
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Put decoded byte into history window
+*
+* @note     Window is output before it wraps, so decoded data is never
+*           overwritten before handed to output.
+*
+* @param[in]    byte    - Decoded byte
+* @param[in]    pf_out  - Output callback
+* @param[in]    p_ctx   - Output callback context
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_comp_put(const uint8_t byte, pf_boot_data_out_t pf_out, void * const p_ctx)
+{
+    boot_status_t status = eBOOT_OK;
+
+    g_boot_comp.win[ g_boot_comp.head ] = byte;
+    g_boot_comp.head++;
+
+    if ( g_boot_comp.fill <= g_boot_comp.mask )
+    {
+        g_boot_comp.fill++;
+    }
+
+    // End of window -> output and wrap
+    if ( g_boot_comp.head > g_boot_comp.mask )
+    {
+        status = boot_comp_flush( pf_out, p_ctx );
+
+        g_boot_comp.head    = 0U;
+        g_boot_comp.flush   = 0U;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Repeat previously decoded data
+*
+* @param[in]    offset  - Distance back from current position
+* @param[in]    size    - Number of bytes to repeat
+* @param[in]    pf_out  - Output callback
+* @param[in]    p_ctx   - Output callback context
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_comp_backref(const uint32_t offset, const uint32_t size, pf_boot_data_out_t pf_out, void * const p_ctx)
+{
+    boot_status_t status = eBOOT_OK;
+
+    // Reference before start of stream
+    if ( offset > g_boot_comp.fill )
+    {
+        status = eBOOT_ERROR;
+        BOOT_DBG_PRINT( "COMP ERROR: Back-reference outside of window!" );
+    }
+
+    for ( uint32_t i = 0U; ( i < size ) && ( eBOOT_OK == status ); i++ )
+    {
+        status = boot_comp_put( g_boot_comp.win[(( g_boot_comp.head - offset ) & g_boot_comp.mask )], pf_out, p_ctx );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_COMP_API
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of Bootloader compressed image decompression API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if compression type and parameters are supported
+*
+* @param[in]    type    - Compression type
+* @param[in]    param   - Compression parameters
+* @return       true if image can be decompressed
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool boot_comp_is_supported(const uint8_t type, const uint8_t param)
+{
+    const uint8_t window_bits       = BOOT_COMP_PARAM_WINDOW( param );
+    const uint8_t lookahead_bits    = BOOT_COMP_PARAM_LOOKAHEAD( param );
+
+    return  (   ( BOOT_COMP_TYPE_HEATSHRINK == type )
+            &&  ( window_bits >= BOOT_COMP_WINDOW_BITS_MIN )
+            &&  ( window_bits <= BOOT_CFG_COMP_WINDOW_BITS )
+            &&  ( lookahead_bits >= BOOT_COMP_LOOKAHEAD_BITS_MIN )
+            &&  ( lookahead_bits < window_bits ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize decompression
+*
+* @param[in]    param   - Compression parameters, shall be supported
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_comp_init(const uint8_t param)
+{
+    memset( &g_boot_comp, 0U, sizeof( g_boot_comp ));
+
+    g_boot_comp.window_bits     = BOOT_COMP_PARAM_WINDOW( param );
+    g_boot_comp.lookahead_bits  = BOOT_COMP_PARAM_LOOKAHEAD( param );
+    g_boot_comp.mask            = (( 1UL << g_boot_comp.window_bits ) - 1UL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Decompress next part of stream
+*
+* @note     Stream can be split at any point. Decoded data is handed to output
+*           callback in order, in blocks of arbitrary size.
+*
+* @param[in]    p_data  - Compressed data
+* @param[in]    size    - Size of compressed data in bytes
+* @param[in]    pf_out  - Output callback
+* @param[in]    p_ctx   - Output callback context
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_comp_apply(const uint8_t * const p_data, const uint32_t size, pf_boot_data_out_t pf_out, void * const p_ctx)
+{
+    boot_status_t   status          = eBOOT_OK;
+    const uint8_t   backref_bits    = ( 1U + g_boot_comp.window_bits + g_boot_comp.lookahead_bits );
+    uint32_t        i               = 0U;
+
+    BOOT_ASSERT( NULL != pf_out );
+
+    if ( true == g_boot_comp.is_error )
+    {
+        status = eBOOT_ERROR;
+    }
+
+    while ( eBOOT_OK == status )
+    {
+        // Size of next token known from tag bit
+        const bool      is_literal  = (( g_boot_comp.acc_cnt > 0U ) && ( 0U != (( g_boot_comp.acc >> ( g_boot_comp.acc_cnt - 1U )) & 1U )));
+        const uint8_t   needed      = (( 0U == g_boot_comp.acc_cnt ) ? 1U : (( true == is_literal ) ? BOOT_COMP_LITERAL_BITS : backref_bits ));
+
+        // Collect bits of token
+        if ( g_boot_comp.acc_cnt < needed )
+        {
+            if ( i < size )
+            {
+                g_boot_comp.acc = (( g_boot_comp.acc << 8U ) | p_data[i] );
+                g_boot_comp.acc_cnt += 8U;
+                i++;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        // Literal
+        else if ( true == is_literal )
+        {
+            (void) boot_comp_bits_get( 1U );
+            status = boot_comp_put((uint8_t) boot_comp_bits_get( 8U ), pf_out, p_ctx );
+        }
+
+        // Back-reference
+        else
+        {
+            (void) boot_comp_bits_get( 1U );
+
+            const uint32_t offset   = ( boot_comp_bits_get( g_boot_comp.window_bits ) + 1U );
+            const uint32_t len      = ( boot_comp_bits_get( g_boot_comp.lookahead_bits ) + 1U );
+
+            status = boot_comp_backref( offset, len, pf_out, p_ctx );
+        }
+    }
+
+    // Output rest of decoded data
+    if ( eBOOT_OK == status )
+    {
+        status = boot_comp_flush( pf_out, p_ctx );
+    }
+
+    if ( eBOOT_OK != status )
+    {
+        g_boot_comp.is_error = true;
+    }
+
+    return status;
+}
+
+#endif // ( 1 == BOOT_CFG_COMP_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
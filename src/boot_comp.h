@@ -0,0 +1,65 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_comp.h
+*@brief     Bootloader compressed image decompression
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_COMP_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __BOOT_COMP_H
+#define __BOOT_COMP_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../../boot_cfg.h"
+#include "boot_types.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Compression types
+ */
+#define BOOT_COMP_TYPE_NONE                     ( 0U )  /**<Plain image */
+#define BOOT_COMP_TYPE_HEATSHRINK               ( 1U )  /**<Heatshrink (LZSS) compressed image */
+
+/**
+ *  Compression parameters: window size bits (high nibble), lookahead bits (low nibble)
+ */
+#define BOOT_COMP_PARAM_WINDOW(param)           (((param) >> 4U ) & 0x0FU )
+#define BOOT_COMP_PARAM_LOOKAHEAD(param)        ((param) & 0x0FU )
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+#if ( 1 == BOOT_CFG_COMP_EN )
+    bool            boot_comp_is_supported  (const uint8_t type, const uint8_t param);
+    void            boot_comp_init          (const uint8_t param);
+    boot_status_t   boot_comp_apply         (const uint8_t * const p_data, const uint32_t size, pf_boot_data_out_t pf_out, void * const p_ctx);
+#endif
+
+#endif // __BOOT_COMP_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
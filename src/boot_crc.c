@@ -0,0 +1,1075 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_crc.c
+*@brief     Bootloader CRC engine
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup Bootloader CRC engine
+* @{ <!-- BEGIN GROUP -->
+*
+*   Image CRC-32 definition (shared with "app_sign_tool.py"):
+*
+*       crc = seed
+*       for each byte:
+*           crc = crc ^ byte
+*           32x shift left with poly 0x04C11DB7
+*
+*   Each byte is thus XOR-ed into the low end of the register and followed
+*   by 32 shifts, which is a multiplication of register by x^32 modulo poly.
+*   Because operation is linear, table "x^n" below holds value of (i * x^n)
+*   modulo poly for every byte value i. Engines combine those tables to
+*   process one (nibble), four (slice-by-4) or eight (slice-by-8) input bytes
+*   per step. All engines produce identical result.
+*
+*   Header, shared memory and frame CRC-8 (poly 0x07, seed 0xB6) and frame
+*   CRC-16-CCITT (poly 0x1021, seed 0xFFFF) are calculated byte-wise with
+*   256 entry lookup tables.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "boot_crc.h"
+#include "../../boot_cfg.h"
+#include "../../boot_if.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Image CRC-32 polynomial and seed
+ *
+ *  @note   Shall not be changed, otherwise already signed images will not validate!
+ */
+#define BOOT_CRC32_POLY                         ( 0x04C11DB7U )
+#define BOOT_CRC32_SEED                         ( 0x10101010U )
+
+/**
+ *  CRC-8 polynomial and seed
+ *
+ *  @note   Shall not be changed, used for image header, shared memory and
+ *          communication frames!
+ */
+#define BOOT_CRC8_POLY                          ( 0x07U )
+#define BOOT_CRC8_SEED                          ( 0xB6U )
+
+/**
+ *  Frame CRC-16-CCITT polynomial and seed
+ */
+#define BOOT_CRC16_POLY                         ( 0x1021U )
+#define BOOT_CRC16_SEED                         ( 0xFFFFU )
+
+/**
+ *  Check for valid CRC-32 engine selection
+ */
+#if     ( BOOT_CRC32_ENGINE_BITWISE != BOOT_CFG_CRC32_ENGINE ) \
+    &&  ( BOOT_CRC32_ENGINE_NIBBLE  != BOOT_CFG_CRC32_ENGINE ) \
+    &&  ( BOOT_CRC32_ENGINE_SLICE4  != BOOT_CFG_CRC32_ENGINE ) \
+    &&  ( BOOT_CRC32_ENGINE_SLICE8  != BOOT_CFG_CRC32_ENGINE ) \
+    &&  ( BOOT_CRC32_ENGINE_HW      != BOOT_CFG_CRC32_ENGINE )
+    #error "Invalid BOOT_CFG_CRC32_ENGINE selection!"
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  CRC-8 table: (i * x^8) mod poly, for i = 0..255
+ *
+ *  Sizeof: 256 bytes
+ */
+static const uint8_t gu8_crc8_table[256] =
+{
+        0x00U, 0x07U, 0x0EU, 0x09U, 0x1CU, 0x1BU, 0x12U, 0x15U, 0x38U, 0x3FU, 0x36U, 0x31U, 0x24U, 0x23U, 0x2AU, 0x2DU,
+        0x70U, 0x77U, 0x7EU, 0x79U, 0x6CU, 0x6BU, 0x62U, 0x65U, 0x48U, 0x4FU, 0x46U, 0x41U, 0x54U, 0x53U, 0x5AU, 0x5DU,
+        0xE0U, 0xE7U, 0xEEU, 0xE9U, 0xFCU, 0xFBU, 0xF2U, 0xF5U, 0xD8U, 0xDFU, 0xD6U, 0xD1U, 0xC4U, 0xC3U, 0xCAU, 0xCDU,
+        0x90U, 0x97U, 0x9EU, 0x99U, 0x8CU, 0x8BU, 0x82U, 0x85U, 0xA8U, 0xAFU, 0xA6U, 0xA1U, 0xB4U, 0xB3U, 0xBAU, 0xBDU,
+        0xC7U, 0xC0U, 0xC9U, 0xCEU, 0xDBU, 0xDCU, 0xD5U, 0xD2U, 0xFFU, 0xF8U, 0xF1U, 0xF6U, 0xE3U, 0xE4U, 0xEDU, 0xEAU,
+        0xB7U, 0xB0U, 0xB9U, 0xBEU, 0xABU, 0xACU, 0xA5U, 0xA2U, 0x8FU, 0x88U, 0x81U, 0x86U, 0x93U, 0x94U, 0x9DU, 0x9AU,
+        0x27U, 0x20U, 0x29U, 0x2EU, 0x3BU, 0x3CU, 0x35U, 0x32U, 0x1FU, 0x18U, 0x11U, 0x16U, 0x03U, 0x04U, 0x0DU, 0x0AU,
+        0x57U, 0x50U, 0x59U, 0x5EU, 0x4BU, 0x4CU, 0x45U, 0x42U, 0x6FU, 0x68U, 0x61U, 0x66U, 0x73U, 0x74U, 0x7DU, 0x7AU,
+        0x89U, 0x8EU, 0x87U, 0x80U, 0x95U, 0x92U, 0x9BU, 0x9CU, 0xB1U, 0xB6U, 0xBFU, 0xB8U, 0xADU, 0xAAU, 0xA3U, 0xA4U,
+        0xF9U, 0xFEU, 0xF7U, 0xF0U, 0xE5U, 0xE2U, 0xEBU, 0xECU, 0xC1U, 0xC6U, 0xCFU, 0xC8U, 0xDDU, 0xDAU, 0xD3U, 0xD4U,
+        0x69U, 0x6EU, 0x67U, 0x60U, 0x75U, 0x72U, 0x7BU, 0x7CU, 0x51U, 0x56U, 0x5FU, 0x58U, 0x4DU, 0x4AU, 0x43U, 0x44U,
+        0x19U, 0x1EU, 0x17U, 0x10U, 0x05U, 0x02U, 0x0BU, 0x0CU, 0x21U, 0x26U, 0x2FU, 0x28U, 0x3DU, 0x3AU, 0x33U, 0x34U,
+        0x4EU, 0x49U, 0x40U, 0x47U, 0x52U, 0x55U, 0x5CU, 0x5BU, 0x76U, 0x71U, 0x78U, 0x7FU, 0x6AU, 0x6DU, 0x64U, 0x63U,
+        0x3EU, 0x39U, 0x30U, 0x37U, 0x22U, 0x25U, 0x2CU, 0x2BU, 0x06U, 0x01U, 0x08U, 0x0FU, 0x1AU, 0x1DU, 0x14U, 0x13U,
+        0xAEU, 0xA9U, 0xA0U, 0xA7U, 0xB2U, 0xB5U, 0xBCU, 0xBBU, 0x96U, 0x91U, 0x98U, 0x9FU, 0x8AU, 0x8DU, 0x84U, 0x83U,
+        0xDEU, 0xD9U, 0xD0U, 0xD7U, 0xC2U, 0xC5U, 0xCCU, 0xCBU, 0xE6U, 0xE1U, 0xE8U, 0xEFU, 0xFAU, 0xFDU, 0xF4U, 0xF3U,
+};
+
+#if ( 1 == BOOT_CFG_COM_FRAME_CRC_EN )
+
+    /**
+     *  CRC-16 table: (i * x^16) mod poly, for i = 0..255
+     *
+     *  Sizeof: 512 bytes
+     */
+    static const uint16_t gu16_crc16_table[256] =
+    {
+            0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+            0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+            0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+            0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+            0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+            0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+            0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+            0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+            0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+            0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+            0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+            0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+            0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+            0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+            0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+            0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+            0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+            0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+            0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+            0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+            0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+            0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+            0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+            0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+            0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+            0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+            0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+            0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+            0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+            0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+            0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+            0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U,
+    };
+
+#endif
+
+#if ( BOOT_CRC32_ENGINE_NIBBLE == BOOT_CFG_CRC32_ENGINE )
+
+    /**
+     *  Nibble table: (i * x^32) mod poly, for i = 0..15
+     *
+     *  Sizeof: 64 bytes
+     */
+    static const uint32_t gu32_crc32_table[16] =
+    {
+        0x00000000U, 0x04C11DB7U, 0x09823B6EU, 0x0D4326D9U, 0x130476DCU, 0x17C56B6BU, 0x1A864DB2U, 0x1E475005U,
+        0x2608EDB8U, 0x22C9F00FU, 0x2F8AD6D6U, 0x2B4BCB61U, 0x350C9B64U, 0x31CD86D3U, 0x3C8EA00AU, 0x384FBDBDU,
+    };
+
+#elif ( BOOT_CRC32_ENGINE_SLICE4 == BOOT_CFG_CRC32_ENGINE )
+
+    /**
+     *  Slice-by-4 tables: (i * x^n) mod poly, for i = 0..255
+     *
+     *  Sizeof: 7 kB
+     */
+    static const uint32_t gu32_crc32_table[7][256] =
+    {
+    // x^32
+    {
+        0x00000000U, 0x04C11DB7U, 0x09823B6EU, 0x0D4326D9U, 0x130476DCU, 0x17C56B6BU, 0x1A864DB2U, 0x1E475005U,
+        0x2608EDB8U, 0x22C9F00FU, 0x2F8AD6D6U, 0x2B4BCB61U, 0x350C9B64U, 0x31CD86D3U, 0x3C8EA00AU, 0x384FBDBDU,
+        0x4C11DB70U, 0x48D0C6C7U, 0x4593E01EU, 0x4152FDA9U, 0x5F15ADACU, 0x5BD4B01BU, 0x569796C2U, 0x52568B75U,
+        0x6A1936C8U, 0x6ED82B7FU, 0x639B0DA6U, 0x675A1011U, 0x791D4014U, 0x7DDC5DA3U, 0x709F7B7AU, 0x745E66CDU,
+        0x9823B6E0U, 0x9CE2AB57U, 0x91A18D8EU, 0x95609039U, 0x8B27C03CU, 0x8FE6DD8BU, 0x82A5FB52U, 0x8664E6E5U,
+        0xBE2B5B58U, 0xBAEA46EFU, 0xB7A96036U, 0xB3687D81U, 0xAD2F2D84U, 0xA9EE3033U, 0xA4AD16EAU, 0xA06C0B5DU,
+        0xD4326D90U, 0xD0F37027U, 0xDDB056FEU, 0xD9714B49U, 0xC7361B4CU, 0xC3F706FBU, 0xCEB42022U, 0xCA753D95U,
+        0xF23A8028U, 0xF6FB9D9FU, 0xFBB8BB46U, 0xFF79A6F1U, 0xE13EF6F4U, 0xE5FFEB43U, 0xE8BCCD9AU, 0xEC7DD02DU,
+        0x34867077U, 0x30476DC0U, 0x3D044B19U, 0x39C556AEU, 0x278206ABU, 0x23431B1CU, 0x2E003DC5U, 0x2AC12072U,
+        0x128E9DCFU, 0x164F8078U, 0x1B0CA6A1U, 0x1FCDBB16U, 0x018AEB13U, 0x054BF6A4U, 0x0808D07DU, 0x0CC9CDCAU,
+        0x7897AB07U, 0x7C56B6B0U, 0x71159069U, 0x75D48DDEU, 0x6B93DDDBU, 0x6F52C06CU, 0x6211E6B5U, 0x66D0FB02U,
+        0x5E9F46BFU, 0x5A5E5B08U, 0x571D7DD1U, 0x53DC6066U, 0x4D9B3063U, 0x495A2DD4U, 0x44190B0DU, 0x40D816BAU,
+        0xACA5C697U, 0xA864DB20U, 0xA527FDF9U, 0xA1E6E04EU, 0xBFA1B04BU, 0xBB60ADFCU, 0xB6238B25U, 0xB2E29692U,
+        0x8AAD2B2FU, 0x8E6C3698U, 0x832F1041U, 0x87EE0DF6U, 0x99A95DF3U, 0x9D684044U, 0x902B669DU, 0x94EA7B2AU,
+        0xE0B41DE7U, 0xE4750050U, 0xE9362689U, 0xEDF73B3EU, 0xF3B06B3BU, 0xF771768CU, 0xFA325055U, 0xFEF34DE2U,
+        0xC6BCF05FU, 0xC27DEDE8U, 0xCF3ECB31U, 0xCBFFD686U, 0xD5B88683U, 0xD1799B34U, 0xDC3ABDEDU, 0xD8FBA05AU,
+        0x690CE0EEU, 0x6DCDFD59U, 0x608EDB80U, 0x644FC637U, 0x7A089632U, 0x7EC98B85U, 0x738AAD5CU, 0x774BB0EBU,
+        0x4F040D56U, 0x4BC510E1U, 0x46863638U, 0x42472B8FU, 0x5C007B8AU, 0x58C1663DU, 0x558240E4U, 0x51435D53U,
+        0x251D3B9EU, 0x21DC2629U, 0x2C9F00F0U, 0x285E1D47U, 0x36194D42U, 0x32D850F5U, 0x3F9B762CU, 0x3B5A6B9BU,
+        0x0315D626U, 0x07D4CB91U, 0x0A97ED48U, 0x0E56F0FFU, 0x1011A0FAU, 0x14D0BD4DU, 0x19939B94U, 0x1D528623U,
+        0xF12F560EU, 0xF5EE4BB9U, 0xF8AD6D60U, 0xFC6C70D7U, 0xE22B20D2U, 0xE6EA3D65U, 0xEBA91BBCU, 0xEF68060BU,
+        0xD727BBB6U, 0xD3E6A601U, 0xDEA580D8U, 0xDA649D6FU, 0xC423CD6AU, 0xC0E2D0DDU, 0xCDA1F604U, 0xC960EBB3U,
+        0xBD3E8D7EU, 0xB9FF90C9U, 0xB4BCB610U, 0xB07DABA7U, 0xAE3AFBA2U, 0xAAFBE615U, 0xA7B8C0CCU, 0xA379DD7BU,
+        0x9B3660C6U, 0x9FF77D71U, 0x92B45BA8U, 0x9675461FU, 0x8832161AU, 0x8CF30BADU, 0x81B02D74U, 0x857130C3U,
+        0x5D8A9099U, 0x594B8D2EU, 0x5408ABF7U, 0x50C9B640U, 0x4E8EE645U, 0x4A4FFBF2U, 0x470CDD2BU, 0x43CDC09CU,
+        0x7B827D21U, 0x7F436096U, 0x7200464FU, 0x76C15BF8U, 0x68860BFDU, 0x6C47164AU, 0x61043093U, 0x65C52D24U,
+        0x119B4BE9U, 0x155A565EU, 0x18197087U, 0x1CD86D30U, 0x029F3D35U, 0x065E2082U, 0x0B1D065BU, 0x0FDC1BECU,
+        0x3793A651U, 0x3352BBE6U, 0x3E119D3FU, 0x3AD08088U, 0x2497D08DU, 0x2056CD3AU, 0x2D15EBE3U, 0x29D4F654U,
+        0xC5A92679U, 0xC1683BCEU, 0xCC2B1D17U, 0xC8EA00A0U, 0xD6AD50A5U, 0xD26C4D12U, 0xDF2F6BCBU, 0xDBEE767CU,
+        0xE3A1CBC1U, 0xE760D676U, 0xEA23F0AFU, 0xEEE2ED18U, 0xF0A5BD1DU, 0xF464A0AAU, 0xF9278673U, 0xFDE69BC4U,
+        0x89B8FD09U, 0x8D79E0BEU, 0x803AC667U, 0x84FBDBD0U, 0x9ABC8BD5U, 0x9E7D9662U, 0x933EB0BBU, 0x97FFAD0CU,
+        0xAFB010B1U, 0xAB710D06U, 0xA6322BDFU, 0xA2F33668U, 0xBCB4666DU, 0xB8757BDAU, 0xB5365D03U, 0xB1F740B4U,
+    },
+    // x^64
+    {
+        0x00000000U, 0x490D678DU, 0x921ACF1AU, 0xDB17A897U, 0x20F48383U, 0x69F9E40EU, 0xB2EE4C99U, 0xFBE32B14U,
+        0x41E90706U, 0x08E4608BU, 0xD3F3C81CU, 0x9AFEAF91U, 0x611D8485U, 0x2810E308U, 0xF3074B9FU, 0xBA0A2C12U,
+        0x83D20E0CU, 0xCADF6981U, 0x11C8C116U, 0x58C5A69BU, 0xA3268D8FU, 0xEA2BEA02U, 0x313C4295U, 0x78312518U,
+        0xC23B090AU, 0x8B366E87U, 0x5021C610U, 0x192CA19DU, 0xE2CF8A89U, 0xABC2ED04U, 0x70D54593U, 0x39D8221EU,
+        0x036501AFU, 0x4A686622U, 0x917FCEB5U, 0xD872A938U, 0x2391822CU, 0x6A9CE5A1U, 0xB18B4D36U, 0xF8862ABBU,
+        0x428C06A9U, 0x0B816124U, 0xD096C9B3U, 0x999BAE3EU, 0x6278852AU, 0x2B75E2A7U, 0xF0624A30U, 0xB96F2DBDU,
+        0x80B70FA3U, 0xC9BA682EU, 0x12ADC0B9U, 0x5BA0A734U, 0xA0438C20U, 0xE94EEBADU, 0x3259433AU, 0x7B5424B7U,
+        0xC15E08A5U, 0x88536F28U, 0x5344C7BFU, 0x1A49A032U, 0xE1AA8B26U, 0xA8A7ECABU, 0x73B0443CU, 0x3ABD23B1U,
+        0x06CA035EU, 0x4FC764D3U, 0x94D0CC44U, 0xDDDDABC9U, 0x263E80DDU, 0x6F33E750U, 0xB4244FC7U, 0xFD29284AU,
+        0x47230458U, 0x0E2E63D5U, 0xD539CB42U, 0x9C34ACCFU, 0x67D787DBU, 0x2EDAE056U, 0xF5CD48C1U, 0xBCC02F4CU,
+        0x85180D52U, 0xCC156ADFU, 0x1702C248U, 0x5E0FA5C5U, 0xA5EC8ED1U, 0xECE1E95CU, 0x37F641CBU, 0x7EFB2646U,
+        0xC4F10A54U, 0x8DFC6DD9U, 0x56EBC54EU, 0x1FE6A2C3U, 0xE40589D7U, 0xAD08EE5AU, 0x761F46CDU, 0x3F122140U,
+        0x05AF02F1U, 0x4CA2657CU, 0x97B5CDEBU, 0xDEB8AA66U, 0x255B8172U, 0x6C56E6FFU, 0xB7414E68U, 0xFE4C29E5U,
+        0x444605F7U, 0x0D4B627AU, 0xD65CCAEDU, 0x9F51AD60U, 0x64B28674U, 0x2DBFE1F9U, 0xF6A8496EU, 0xBFA52EE3U,
+        0x867D0CFDU, 0xCF706B70U, 0x1467C3E7U, 0x5D6AA46AU, 0xA6898F7EU, 0xEF84E8F3U, 0x34934064U, 0x7D9E27E9U,
+        0xC7940BFBU, 0x8E996C76U, 0x558EC4E1U, 0x1C83A36CU, 0xE7608878U, 0xAE6DEFF5U, 0x757A4762U, 0x3C7720EFU,
+        0x0D9406BCU, 0x44996131U, 0x9F8EC9A6U, 0xD683AE2BU, 0x2D60853FU, 0x646DE2B2U, 0xBF7A4A25U, 0xF6772DA8U,
+        0x4C7D01BAU, 0x05706637U, 0xDE67CEA0U, 0x976AA92DU, 0x6C898239U, 0x2584E5B4U, 0xFE934D23U, 0xB79E2AAEU,
+        0x8E4608B0U, 0xC74B6F3DU, 0x1C5CC7AAU, 0x5551A027U, 0xAEB28B33U, 0xE7BFECBEU, 0x3CA84429U, 0x75A523A4U,
+        0xCFAF0FB6U, 0x86A2683BU, 0x5DB5C0ACU, 0x14B8A721U, 0xEF5B8C35U, 0xA656EBB8U, 0x7D41432FU, 0x344C24A2U,
+        0x0EF10713U, 0x47FC609EU, 0x9CEBC809U, 0xD5E6AF84U, 0x2E058490U, 0x6708E31DU, 0xBC1F4B8AU, 0xF5122C07U,
+        0x4F180015U, 0x06156798U, 0xDD02CF0FU, 0x940FA882U, 0x6FEC8396U, 0x26E1E41BU, 0xFDF64C8CU, 0xB4FB2B01U,
+        0x8D23091FU, 0xC42E6E92U, 0x1F39C605U, 0x5634A188U, 0xADD78A9CU, 0xE4DAED11U, 0x3FCD4586U, 0x76C0220BU,
+        0xCCCA0E19U, 0x85C76994U, 0x5ED0C103U, 0x17DDA68EU, 0xEC3E8D9AU, 0xA533EA17U, 0x7E244280U, 0x3729250DU,
+        0x0B5E05E2U, 0x4253626FU, 0x9944CAF8U, 0xD049AD75U, 0x2BAA8661U, 0x62A7E1ECU, 0xB9B0497BU, 0xF0BD2EF6U,
+        0x4AB702E4U, 0x03BA6569U, 0xD8ADCDFEU, 0x91A0AA73U, 0x6A438167U, 0x234EE6EAU, 0xF8594E7DU, 0xB15429F0U,
+        0x888C0BEEU, 0xC1816C63U, 0x1A96C4F4U, 0x539BA379U, 0xA878886DU, 0xE175EFE0U, 0x3A624777U, 0x736F20FAU,
+        0xC9650CE8U, 0x80686B65U, 0x5B7FC3F2U, 0x1272A47FU, 0xE9918F6BU, 0xA09CE8E6U, 0x7B8B4071U, 0x328627FCU,
+        0x083B044DU, 0x413663C0U, 0x9A21CB57U, 0xD32CACDAU, 0x28CF87CEU, 0x61C2E043U, 0xBAD548D4U, 0xF3D82F59U,
+        0x49D2034BU, 0x00DF64C6U, 0xDBC8CC51U, 0x92C5ABDCU, 0x692680C8U, 0x202BE745U, 0xFB3C4FD2U, 0xB231285FU,
+        0x8BE90A41U, 0xC2E46DCCU, 0x19F3C55BU, 0x50FEA2D6U, 0xAB1D89C2U, 0xE210EE4FU, 0x390746D8U, 0x700A2155U,
+        0xCA000D47U, 0x830D6ACAU, 0x581AC25DU, 0x1117A5D0U, 0xEAF48EC4U, 0xA3F9E949U, 0x78EE41DEU, 0x31E32653U,
+    },
+    // x^96
+    {
+        0x00000000U, 0xF200AA66U, 0xE0C0497BU, 0x12C0E31DU, 0xC5418F41U, 0x37412527U, 0x2581C63AU, 0xD7816C5CU,
+        0x8E420335U, 0x7C42A953U, 0x6E824A4EU, 0x9C82E028U, 0x4B038C74U, 0xB9032612U, 0xABC3C50FU, 0x59C36F69U,
+        0x18451BDDU, 0xEA45B1BBU, 0xF88552A6U, 0x0A85F8C0U, 0xDD04949CU, 0x2F043EFAU, 0x3DC4DDE7U, 0xCFC47781U,
+        0x960718E8U, 0x6407B28EU, 0x76C75193U, 0x84C7FBF5U, 0x534697A9U, 0xA1463DCFU, 0xB386DED2U, 0x418674B4U,
+        0x308A37BAU, 0xC28A9DDCU, 0xD04A7EC1U, 0x224AD4A7U, 0xF5CBB8FBU, 0x07CB129DU, 0x150BF180U, 0xE70B5BE6U,
+        0xBEC8348FU, 0x4CC89EE9U, 0x5E087DF4U, 0xAC08D792U, 0x7B89BBCEU, 0x898911A8U, 0x9B49F2B5U, 0x694958D3U,
+        0x28CF2C67U, 0xDACF8601U, 0xC80F651CU, 0x3A0FCF7AU, 0xED8EA326U, 0x1F8E0940U, 0x0D4EEA5DU, 0xFF4E403BU,
+        0xA68D2F52U, 0x548D8534U, 0x464D6629U, 0xB44DCC4FU, 0x63CCA013U, 0x91CC0A75U, 0x830CE968U, 0x710C430EU,
+        0x61146F74U, 0x9314C512U, 0x81D4260FU, 0x73D48C69U, 0xA455E035U, 0x56554A53U, 0x4495A94EU, 0xB6950328U,
+        0xEF566C41U, 0x1D56C627U, 0x0F96253AU, 0xFD968F5CU, 0x2A17E300U, 0xD8174966U, 0xCAD7AA7BU, 0x38D7001DU,
+        0x795174A9U, 0x8B51DECFU, 0x99913DD2U, 0x6B9197B4U, 0xBC10FBE8U, 0x4E10518EU, 0x5CD0B293U, 0xAED018F5U,
+        0xF713779CU, 0x0513DDFAU, 0x17D33EE7U, 0xE5D39481U, 0x3252F8DDU, 0xC05252BBU, 0xD292B1A6U, 0x20921BC0U,
+        0x519E58CEU, 0xA39EF2A8U, 0xB15E11B5U, 0x435EBBD3U, 0x94DFD78FU, 0x66DF7DE9U, 0x741F9EF4U, 0x861F3492U,
+        0xDFDC5BFBU, 0x2DDCF19DU, 0x3F1C1280U, 0xCD1CB8E6U, 0x1A9DD4BAU, 0xE89D7EDCU, 0xFA5D9DC1U, 0x085D37A7U,
+        0x49DB4313U, 0xBBDBE975U, 0xA91B0A68U, 0x5B1BA00EU, 0x8C9ACC52U, 0x7E9A6634U, 0x6C5A8529U, 0x9E5A2F4FU,
+        0xC7994026U, 0x3599EA40U, 0x2759095DU, 0xD559A33BU, 0x02D8CF67U, 0xF0D86501U, 0xE218861CU, 0x10182C7AU,
+        0xC228DEE8U, 0x3028748EU, 0x22E89793U, 0xD0E83DF5U, 0x076951A9U, 0xF569FBCFU, 0xE7A918D2U, 0x15A9B2B4U,
+        0x4C6ADDDDU, 0xBE6A77BBU, 0xACAA94A6U, 0x5EAA3EC0U, 0x892B529CU, 0x7B2BF8FAU, 0x69EB1BE7U, 0x9BEBB181U,
+        0xDA6DC535U, 0x286D6F53U, 0x3AAD8C4EU, 0xC8AD2628U, 0x1F2C4A74U, 0xED2CE012U, 0xFFEC030FU, 0x0DECA969U,
+        0x542FC600U, 0xA62F6C66U, 0xB4EF8F7BU, 0x46EF251DU, 0x916E4941U, 0x636EE327U, 0x71AE003AU, 0x83AEAA5CU,
+        0xF2A2E952U, 0x00A24334U, 0x1262A029U, 0xE0620A4FU, 0x37E36613U, 0xC5E3CC75U, 0xD7232F68U, 0x2523850EU,
+        0x7CE0EA67U, 0x8EE04001U, 0x9C20A31CU, 0x6E20097AU, 0xB9A16526U, 0x4BA1CF40U, 0x59612C5DU, 0xAB61863BU,
+        0xEAE7F28FU, 0x18E758E9U, 0x0A27BBF4U, 0xF8271192U, 0x2FA67DCEU, 0xDDA6D7A8U, 0xCF6634B5U, 0x3D669ED3U,
+        0x64A5F1BAU, 0x96A55BDCU, 0x8465B8C1U, 0x766512A7U, 0xA1E47EFBU, 0x53E4D49DU, 0x41243780U, 0xB3249DE6U,
+        0xA33CB19CU, 0x513C1BFAU, 0x43FCF8E7U, 0xB1FC5281U, 0x667D3EDDU, 0x947D94BBU, 0x86BD77A6U, 0x74BDDDC0U,
+        0x2D7EB2A9U, 0xDF7E18CFU, 0xCDBEFBD2U, 0x3FBE51B4U, 0xE83F3DE8U, 0x1A3F978EU, 0x08FF7493U, 0xFAFFDEF5U,
+        0xBB79AA41U, 0x49790027U, 0x5BB9E33AU, 0xA9B9495CU, 0x7E382500U, 0x8C388F66U, 0x9EF86C7BU, 0x6CF8C61DU,
+        0x353BA974U, 0xC73B0312U, 0xD5FBE00FU, 0x27FB4A69U, 0xF07A2635U, 0x027A8C53U, 0x10BA6F4EU, 0xE2BAC528U,
+        0x93B68626U, 0x61B62C40U, 0x7376CF5DU, 0x8176653BU, 0x56F70967U, 0xA4F7A301U, 0xB637401CU, 0x4437EA7AU,
+        0x1DF48513U, 0xEFF42F75U, 0xFD34CC68U, 0x0F34660EU, 0xD8B50A52U, 0x2AB5A034U, 0x38754329U, 0xCA75E94FU,
+        0x8BF39DFBU, 0x79F3379DU, 0x6B33D480U, 0x99337EE6U, 0x4EB212BAU, 0xBCB2B8DCU, 0xAE725BC1U, 0x5C72F1A7U,
+        0x05B19ECEU, 0xF7B134A8U, 0xE571D7B5U, 0x17717DD3U, 0xC0F0118FU, 0x32F0BBE9U, 0x203058F4U, 0xD230F292U,
+    },
+    // x^128
+    {
+        0x00000000U, 0xE8A45605U, 0xD589B1BDU, 0x3D2DE7B8U, 0xAFD27ECDU, 0x477628C8U, 0x7A5BCF70U, 0x92FF9975U,
+        0x5B65E02DU, 0xB3C1B628U, 0x8EEC5190U, 0x66480795U, 0xF4B79EE0U, 0x1C13C8E5U, 0x213E2F5DU, 0xC99A7958U,
+        0xB6CBC05AU, 0x5E6F965FU, 0x634271E7U, 0x8BE627E2U, 0x1919BE97U, 0xF1BDE892U, 0xCC900F2AU, 0x2434592FU,
+        0xEDAE2077U, 0x050A7672U, 0x382791CAU, 0xD083C7CFU, 0x427C5EBAU, 0xAAD808BFU, 0x97F5EF07U, 0x7F51B902U,
+        0x69569D03U, 0x81F2CB06U, 0xBCDF2CBEU, 0x547B7ABBU, 0xC684E3CEU, 0x2E20B5CBU, 0x130D5273U, 0xFBA90476U,
+        0x32337D2EU, 0xDA972B2BU, 0xE7BACC93U, 0x0F1E9A96U, 0x9DE103E3U, 0x754555E6U, 0x4868B25EU, 0xA0CCE45BU,
+        0xDF9D5D59U, 0x37390B5CU, 0x0A14ECE4U, 0xE2B0BAE1U, 0x704F2394U, 0x98EB7591U, 0xA5C69229U, 0x4D62C42CU,
+        0x84F8BD74U, 0x6C5CEB71U, 0x51710CC9U, 0xB9D55ACCU, 0x2B2AC3B9U, 0xC38E95BCU, 0xFEA37204U, 0x16072401U,
+        0xD2AD3A06U, 0x3A096C03U, 0x07248BBBU, 0xEF80DDBEU, 0x7D7F44CBU, 0x95DB12CEU, 0xA8F6F576U, 0x4052A373U,
+        0x89C8DA2BU, 0x616C8C2EU, 0x5C416B96U, 0xB4E53D93U, 0x261AA4E6U, 0xCEBEF2E3U, 0xF393155BU, 0x1B37435EU,
+        0x6466FA5CU, 0x8CC2AC59U, 0xB1EF4BE1U, 0x594B1DE4U, 0xCBB48491U, 0x2310D294U, 0x1E3D352CU, 0xF6996329U,
+        0x3F031A71U, 0xD7A74C74U, 0xEA8AABCCU, 0x022EFDC9U, 0x90D164BCU, 0x787532B9U, 0x4558D501U, 0xADFC8304U,
+        0xBBFBA705U, 0x535FF100U, 0x6E7216B8U, 0x86D640BDU, 0x1429D9C8U, 0xFC8D8FCDU, 0xC1A06875U, 0x29043E70U,
+        0xE09E4728U, 0x083A112DU, 0x3517F695U, 0xDDB3A090U, 0x4F4C39E5U, 0xA7E86FE0U, 0x9AC58858U, 0x7261DE5DU,
+        0x0D30675FU, 0xE594315AU, 0xD8B9D6E2U, 0x301D80E7U, 0xA2E21992U, 0x4A464F97U, 0x776BA82FU, 0x9FCFFE2AU,
+        0x56558772U, 0xBEF1D177U, 0x83DC36CFU, 0x6B7860CAU, 0xF987F9BFU, 0x1123AFBAU, 0x2C0E4802U, 0xC4AA1E07U,
+        0xA19B69BBU, 0x493F3FBEU, 0x7412D806U, 0x9CB68E03U, 0x0E491776U, 0xE6ED4173U, 0xDBC0A6CBU, 0x3364F0CEU,
+        0xFAFE8996U, 0x125ADF93U, 0x2F77382BU, 0xC7D36E2EU, 0x552CF75BU, 0xBD88A15EU, 0x80A546E6U, 0x680110E3U,
+        0x1750A9E1U, 0xFFF4FFE4U, 0xC2D9185CU, 0x2A7D4E59U, 0xB882D72CU, 0x50268129U, 0x6D0B6691U, 0x85AF3094U,
+        0x4C3549CCU, 0xA4911FC9U, 0x99BCF871U, 0x7118AE74U, 0xE3E73701U, 0x0B436104U, 0x366E86BCU, 0xDECAD0B9U,
+        0xC8CDF4B8U, 0x2069A2BDU, 0x1D444505U, 0xF5E01300U, 0x671F8A75U, 0x8FBBDC70U, 0xB2963BC8U, 0x5A326DCDU,
+        0x93A81495U, 0x7B0C4290U, 0x4621A528U, 0xAE85F32DU, 0x3C7A6A58U, 0xD4DE3C5DU, 0xE9F3DBE5U, 0x01578DE0U,
+        0x7E0634E2U, 0x96A262E7U, 0xAB8F855FU, 0x432BD35AU, 0xD1D44A2FU, 0x39701C2AU, 0x045DFB92U, 0xECF9AD97U,
+        0x2563D4CFU, 0xCDC782CAU, 0xF0EA6572U, 0x184E3377U, 0x8AB1AA02U, 0x6215FC07U, 0x5F381BBFU, 0xB79C4DBAU,
+        0x733653BDU, 0x9B9205B8U, 0xA6BFE200U, 0x4E1BB405U, 0xDCE42D70U, 0x34407B75U, 0x096D9CCDU, 0xE1C9CAC8U,
+        0x2853B390U, 0xC0F7E595U, 0xFDDA022DU, 0x157E5428U, 0x8781CD5DU, 0x6F259B58U, 0x52087CE0U, 0xBAAC2AE5U,
+        0xC5FD93E7U, 0x2D59C5E2U, 0x1074225AU, 0xF8D0745FU, 0x6A2FED2AU, 0x828BBB2FU, 0xBFA65C97U, 0x57020A92U,
+        0x9E9873CAU, 0x763C25CFU, 0x4B11C277U, 0xA3B59472U, 0x314A0D07U, 0xD9EE5B02U, 0xE4C3BCBAU, 0x0C67EABFU,
+        0x1A60CEBEU, 0xF2C498BBU, 0xCFE97F03U, 0x274D2906U, 0xB5B2B073U, 0x5D16E676U, 0x603B01CEU, 0x889F57CBU,
+        0x41052E93U, 0xA9A17896U, 0x948C9F2EU, 0x7C28C92BU, 0xEED7505EU, 0x0673065BU, 0x3B5EE1E3U, 0xD3FAB7E6U,
+        0xACAB0EE4U, 0x440F58E1U, 0x7922BF59U, 0x9186E95CU, 0x03797029U, 0xEBDD262CU, 0xD6F0C194U, 0x3E549791U,
+        0xF7CEEEC9U, 0x1F6AB8CCU, 0x22475F74U, 0xCAE30971U, 0x581C9004U, 0xB0B8C601U, 0x8D9521B9U, 0x653177BCU,
+    },
+    // x^136
+    {
+        0x00000000U, 0x47F7CEC1U, 0x8FEF9D82U, 0xC8185343U, 0x1B1E26B3U, 0x5CE9E872U, 0x94F1BB31U, 0xD30675F0U,
+        0x363C4D66U, 0x71CB83A7U, 0xB9D3D0E4U, 0xFE241E25U, 0x2D226BD5U, 0x6AD5A514U, 0xA2CDF657U, 0xE53A3896U,
+        0x6C789ACCU, 0x2B8F540DU, 0xE397074EU, 0xA460C98FU, 0x7766BC7FU, 0x309172BEU, 0xF88921FDU, 0xBF7EEF3CU,
+        0x5A44D7AAU, 0x1DB3196BU, 0xD5AB4A28U, 0x925C84E9U, 0x415AF119U, 0x06AD3FD8U, 0xCEB56C9BU, 0x8942A25AU,
+        0xD8F13598U, 0x9F06FB59U, 0x571EA81AU, 0x10E966DBU, 0xC3EF132BU, 0x8418DDEAU, 0x4C008EA9U, 0x0BF74068U,
+        0xEECD78FEU, 0xA93AB63FU, 0x6122E57CU, 0x26D52BBDU, 0xF5D35E4DU, 0xB224908CU, 0x7A3CC3CFU, 0x3DCB0D0EU,
+        0xB489AF54U, 0xF37E6195U, 0x3B6632D6U, 0x7C91FC17U, 0xAF9789E7U, 0xE8604726U, 0x20781465U, 0x678FDAA4U,
+        0x82B5E232U, 0xC5422CF3U, 0x0D5A7FB0U, 0x4AADB171U, 0x99ABC481U, 0xDE5C0A40U, 0x16445903U, 0x51B397C2U,
+        0xB5237687U, 0xF2D4B846U, 0x3ACCEB05U, 0x7D3B25C4U, 0xAE3D5034U, 0xE9CA9EF5U, 0x21D2CDB6U, 0x66250377U,
+        0x831F3BE1U, 0xC4E8F520U, 0x0CF0A663U, 0x4B0768A2U, 0x98011D52U, 0xDFF6D393U, 0x17EE80D0U, 0x50194E11U,
+        0xD95BEC4BU, 0x9EAC228AU, 0x56B471C9U, 0x1143BF08U, 0xC245CAF8U, 0x85B20439U, 0x4DAA577AU, 0x0A5D99BBU,
+        0xEF67A12DU, 0xA8906FECU, 0x60883CAFU, 0x277FF26EU, 0xF479879EU, 0xB38E495FU, 0x7B961A1CU, 0x3C61D4DDU,
+        0x6DD2431FU, 0x2A258DDEU, 0xE23DDE9DU, 0xA5CA105CU, 0x76CC65ACU, 0x313BAB6DU, 0xF923F82EU, 0xBED436EFU,
+        0x5BEE0E79U, 0x1C19C0B8U, 0xD40193FBU, 0x93F65D3AU, 0x40F028CAU, 0x0707E60BU, 0xCF1FB548U, 0x88E87B89U,
+        0x01AAD9D3U, 0x465D1712U, 0x8E454451U, 0xC9B28A90U, 0x1AB4FF60U, 0x5D4331A1U, 0x955B62E2U, 0xD2ACAC23U,
+        0x379694B5U, 0x70615A74U, 0xB8790937U, 0xFF8EC7F6U, 0x2C88B206U, 0x6B7F7CC7U, 0xA3672F84U, 0xE490E145U,
+        0x6E87F0B9U, 0x29703E78U, 0xE1686D3BU, 0xA69FA3FAU, 0x7599D60AU, 0x326E18CBU, 0xFA764B88U, 0xBD818549U,
+        0x58BBBDDFU, 0x1F4C731EU, 0xD754205DU, 0x90A3EE9CU, 0x43A59B6CU, 0x045255ADU, 0xCC4A06EEU, 0x8BBDC82FU,
+        0x02FF6A75U, 0x4508A4B4U, 0x8D10F7F7U, 0xCAE73936U, 0x19E14CC6U, 0x5E168207U, 0x960ED144U, 0xD1F91F85U,
+        0x34C32713U, 0x7334E9D2U, 0xBB2CBA91U, 0xFCDB7450U, 0x2FDD01A0U, 0x682ACF61U, 0xA0329C22U, 0xE7C552E3U,
+        0xB676C521U, 0xF1810BE0U, 0x399958A3U, 0x7E6E9662U, 0xAD68E392U, 0xEA9F2D53U, 0x22877E10U, 0x6570B0D1U,
+        0x804A8847U, 0xC7BD4686U, 0x0FA515C5U, 0x4852DB04U, 0x9B54AEF4U, 0xDCA36035U, 0x14BB3376U, 0x534CFDB7U,
+        0xDA0E5FEDU, 0x9DF9912CU, 0x55E1C26FU, 0x12160CAEU, 0xC110795EU, 0x86E7B79FU, 0x4EFFE4DCU, 0x09082A1DU,
+        0xEC32128BU, 0xABC5DC4AU, 0x63DD8F09U, 0x242A41C8U, 0xF72C3438U, 0xB0DBFAF9U, 0x78C3A9BAU, 0x3F34677BU,
+        0xDBA4863EU, 0x9C5348FFU, 0x544B1BBCU, 0x13BCD57DU, 0xC0BAA08DU, 0x874D6E4CU, 0x4F553D0FU, 0x08A2F3CEU,
+        0xED98CB58U, 0xAA6F0599U, 0x627756DAU, 0x2580981BU, 0xF686EDEBU, 0xB171232AU, 0x79697069U, 0x3E9EBEA8U,
+        0xB7DC1CF2U, 0xF02BD233U, 0x38338170U, 0x7FC44FB1U, 0xACC23A41U, 0xEB35F480U, 0x232DA7C3U, 0x64DA6902U,
+        0x81E05194U, 0xC6179F55U, 0x0E0FCC16U, 0x49F802D7U, 0x9AFE7727U, 0xDD09B9E6U, 0x1511EAA5U, 0x52E62464U,
+        0x0355B3A6U, 0x44A27D67U, 0x8CBA2E24U, 0xCB4DE0E5U, 0x184B9515U, 0x5FBC5BD4U, 0x97A40897U, 0xD053C656U,
+        0x3569FEC0U, 0x729E3001U, 0xBA866342U, 0xFD71AD83U, 0x2E77D873U, 0x698016B2U, 0xA19845F1U, 0xE66F8B30U,
+        0x6F2D296AU, 0x28DAE7ABU, 0xE0C2B4E8U, 0xA7357A29U, 0x74330FD9U, 0x33C4C118U, 0xFBDC925BU, 0xBC2B5C9AU,
+        0x5911640CU, 0x1EE6AACDU, 0xD6FEF98EU, 0x9109374FU, 0x420F42BFU, 0x05F88C7EU, 0xCDE0DF3DU, 0x8A1711FCU,
+    },
+    // x^144
+    {
+        0x00000000U, 0xDD0FE172U, 0xBEDEDF53U, 0x63D13E21U, 0x797CA311U, 0xA4734263U, 0xC7A27C42U, 0x1AAD9D30U,
+        0xF2F94622U, 0x2FF6A750U, 0x4C279971U, 0x91287803U, 0x8B85E533U, 0x568A0441U, 0x355B3A60U, 0xE854DB12U,
+        0xE13391F3U, 0x3C3C7081U, 0x5FED4EA0U, 0x82E2AFD2U, 0x984F32E2U, 0x4540D390U, 0x2691EDB1U, 0xFB9E0CC3U,
+        0x13CAD7D1U, 0xCEC536A3U, 0xAD140882U, 0x701BE9F0U, 0x6AB674C0U, 0xB7B995B2U, 0xD468AB93U, 0x09674AE1U,
+        0xC6A63E51U, 0x1BA9DF23U, 0x7878E102U, 0xA5770070U, 0xBFDA9D40U, 0x62D57C32U, 0x01044213U, 0xDC0BA361U,
+        0x345F7873U, 0xE9509901U, 0x8A81A720U, 0x578E4652U, 0x4D23DB62U, 0x902C3A10U, 0xF3FD0431U, 0x2EF2E543U,
+        0x2795AFA2U, 0xFA9A4ED0U, 0x994B70F1U, 0x44449183U, 0x5EE90CB3U, 0x83E6EDC1U, 0xE037D3E0U, 0x3D383292U,
+        0xD56CE980U, 0x086308F2U, 0x6BB236D3U, 0xB6BDD7A1U, 0xAC104A91U, 0x711FABE3U, 0x12CE95C2U, 0xCFC174B0U,
+        0x898D6115U, 0x54828067U, 0x3753BE46U, 0xEA5C5F34U, 0xF0F1C204U, 0x2DFE2376U, 0x4E2F1D57U, 0x9320FC25U,
+        0x7B742737U, 0xA67BC645U, 0xC5AAF864U, 0x18A51916U, 0x02088426U, 0xDF076554U, 0xBCD65B75U, 0x61D9BA07U,
+        0x68BEF0E6U, 0xB5B11194U, 0xD6602FB5U, 0x0B6FCEC7U, 0x11C253F7U, 0xCCCDB285U, 0xAF1C8CA4U, 0x72136DD6U,
+        0x9A47B6C4U, 0x474857B6U, 0x24996997U, 0xF99688E5U, 0xE33B15D5U, 0x3E34F4A7U, 0x5DE5CA86U, 0x80EA2BF4U,
+        0x4F2B5F44U, 0x9224BE36U, 0xF1F58017U, 0x2CFA6165U, 0x3657FC55U, 0xEB581D27U, 0x88892306U, 0x5586C274U,
+        0xBDD21966U, 0x60DDF814U, 0x030CC635U, 0xDE032747U, 0xC4AEBA77U, 0x19A15B05U, 0x7A706524U, 0xA77F8456U,
+        0xAE18CEB7U, 0x73172FC5U, 0x10C611E4U, 0xCDC9F096U, 0xD7646DA6U, 0x0A6B8CD4U, 0x69BAB2F5U, 0xB4B55387U,
+        0x5CE18895U, 0x81EE69E7U, 0xE23F57C6U, 0x3F30B6B4U, 0x259D2B84U, 0xF892CAF6U, 0x9B43F4D7U, 0x464C15A5U,
+        0x17DBDF9DU, 0xCAD43EEFU, 0xA90500CEU, 0x740AE1BCU, 0x6EA77C8CU, 0xB3A89DFEU, 0xD079A3DFU, 0x0D7642ADU,
+        0xE52299BFU, 0x382D78CDU, 0x5BFC46ECU, 0x86F3A79EU, 0x9C5E3AAEU, 0x4151DBDCU, 0x2280E5FDU, 0xFF8F048FU,
+        0xF6E84E6EU, 0x2BE7AF1CU, 0x4836913DU, 0x9539704FU, 0x8F94ED7FU, 0x529B0C0DU, 0x314A322CU, 0xEC45D35EU,
+        0x0411084CU, 0xD91EE93EU, 0xBACFD71FU, 0x67C0366DU, 0x7D6DAB5DU, 0xA0624A2FU, 0xC3B3740EU, 0x1EBC957CU,
+        0xD17DE1CCU, 0x0C7200BEU, 0x6FA33E9FU, 0xB2ACDFEDU, 0xA80142DDU, 0x750EA3AFU, 0x16DF9D8EU, 0xCBD07CFCU,
+        0x2384A7EEU, 0xFE8B469CU, 0x9D5A78BDU, 0x405599CFU, 0x5AF804FFU, 0x87F7E58DU, 0xE426DBACU, 0x39293ADEU,
+        0x304E703FU, 0xED41914DU, 0x8E90AF6CU, 0x539F4E1EU, 0x4932D32EU, 0x943D325CU, 0xF7EC0C7DU, 0x2AE3ED0FU,
+        0xC2B7361DU, 0x1FB8D76FU, 0x7C69E94EU, 0xA166083CU, 0xBBCB950CU, 0x66C4747EU, 0x05154A5FU, 0xD81AAB2DU,
+        0x9E56BE88U, 0x43595FFAU, 0x208861DBU, 0xFD8780A9U, 0xE72A1D99U, 0x3A25FCEBU, 0x59F4C2CAU, 0x84FB23B8U,
+        0x6CAFF8AAU, 0xB1A019D8U, 0xD27127F9U, 0x0F7EC68BU, 0x15D35BBBU, 0xC8DCBAC9U, 0xAB0D84E8U, 0x7602659AU,
+        0x7F652F7BU, 0xA26ACE09U, 0xC1BBF028U, 0x1CB4115AU, 0x06198C6AU, 0xDB166D18U, 0xB8C75339U, 0x65C8B24BU,
+        0x8D9C6959U, 0x5093882BU, 0x3342B60AU, 0xEE4D5778U, 0xF4E0CA48U, 0x29EF2B3AU, 0x4A3E151BU, 0x9731F469U,
+        0x58F080D9U, 0x85FF61ABU, 0xE62E5F8AU, 0x3B21BEF8U, 0x218C23C8U, 0xFC83C2BAU, 0x9F52FC9BU, 0x425D1DE9U,
+        0xAA09C6FBU, 0x77062789U, 0x14D719A8U, 0xC9D8F8DAU, 0xD37565EAU, 0x0E7A8498U, 0x6DABBAB9U, 0xB0A45BCBU,
+        0xB9C3112AU, 0x64CCF058U, 0x071DCE79U, 0xDA122F0BU, 0xC0BFB23BU, 0x1DB05349U, 0x7E616D68U, 0xA36E8C1AU,
+        0x4B3A5708U, 0x9635B67AU, 0xF5E4885BU, 0x28EB6929U, 0x3246F419U, 0xEF49156BU, 0x8C982B4AU, 0x5197CA38U,
+    },
+    // x^152
+    {
+        0x00000000U, 0x2FB7BF3AU, 0x5F6F7E74U, 0x70D8C14EU, 0xBEDEFCE8U, 0x916943D2U, 0xE1B1829CU, 0xCE063DA6U,
+        0x797CE467U, 0x56CB5B5DU, 0x26139A13U, 0x09A42529U, 0xC7A2188FU, 0xE815A7B5U, 0x98CD66FBU, 0xB77AD9C1U,
+        0xF2F9C8CEU, 0xDD4E77F4U, 0xAD96B6BAU, 0x82210980U, 0x4C273426U, 0x63908B1CU, 0x13484A52U, 0x3CFFF568U,
+        0x8B852CA9U, 0xA4329393U, 0xD4EA52DDU, 0xFB5DEDE7U, 0x355BD041U, 0x1AEC6F7BU, 0x6A34AE35U, 0x4583110FU,
+        0xE1328C2BU, 0xCE853311U, 0xBE5DF25FU, 0x91EA4D65U, 0x5FEC70C3U, 0x705BCFF9U, 0x00830EB7U, 0x2F34B18DU,
+        0x984E684CU, 0xB7F9D776U, 0xC7211638U, 0xE896A902U, 0x269094A4U, 0x09272B9EU, 0x79FFEAD0U, 0x564855EAU,
+        0x13CB44E5U, 0x3C7CFBDFU, 0x4CA43A91U, 0x631385ABU, 0xAD15B80DU, 0x82A20737U, 0xF27AC679U, 0xDDCD7943U,
+        0x6AB7A082U, 0x45001FB8U, 0x35D8DEF6U, 0x1A6F61CCU, 0xD4695C6AU, 0xFBDEE350U, 0x8B06221EU, 0xA4B19D24U,
+        0xC6A405E1U, 0xE913BADBU, 0x99CB7B95U, 0xB67CC4AFU, 0x787AF909U, 0x57CD4633U, 0x2715877DU, 0x08A23847U,
+        0xBFD8E186U, 0x906F5EBCU, 0xE0B79FF2U, 0xCF0020C8U, 0x01061D6EU, 0x2EB1A254U, 0x5E69631AU, 0x71DEDC20U,
+        0x345DCD2FU, 0x1BEA7215U, 0x6B32B35BU, 0x44850C61U, 0x8A8331C7U, 0xA5348EFDU, 0xD5EC4FB3U, 0xFA5BF089U,
+        0x4D212948U, 0x62969672U, 0x124E573CU, 0x3DF9E806U, 0xF3FFD5A0U, 0xDC486A9AU, 0xAC90ABD4U, 0x832714EEU,
+        0x279689CAU, 0x082136F0U, 0x78F9F7BEU, 0x574E4884U, 0x99487522U, 0xB6FFCA18U, 0xC6270B56U, 0xE990B46CU,
+        0x5EEA6DADU, 0x715DD297U, 0x018513D9U, 0x2E32ACE3U, 0xE0349145U, 0xCF832E7FU, 0xBF5BEF31U, 0x90EC500BU,
+        0xD56F4104U, 0xFAD8FE3EU, 0x8A003F70U, 0xA5B7804AU, 0x6BB1BDECU, 0x440602D6U, 0x34DEC398U, 0x1B697CA2U,
+        0xAC13A563U, 0x83A41A59U, 0xF37CDB17U, 0xDCCB642DU, 0x12CD598BU, 0x3D7AE6B1U, 0x4DA227FFU, 0x621598C5U,
+        0x89891675U, 0xA63EA94FU, 0xD6E66801U, 0xF951D73BU, 0x3757EA9DU, 0x18E055A7U, 0x683894E9U, 0x478F2BD3U,
+        0xF0F5F212U, 0xDF424D28U, 0xAF9A8C66U, 0x802D335CU, 0x4E2B0EFAU, 0x619CB1C0U, 0x1144708EU, 0x3EF3CFB4U,
+        0x7B70DEBBU, 0x54C76181U, 0x241FA0CFU, 0x0BA81FF5U, 0xC5AE2253U, 0xEA199D69U, 0x9AC15C27U, 0xB576E31DU,
+        0x020C3ADCU, 0x2DBB85E6U, 0x5D6344A8U, 0x72D4FB92U, 0xBCD2C634U, 0x9365790EU, 0xE3BDB840U, 0xCC0A077AU,
+        0x68BB9A5EU, 0x470C2564U, 0x37D4E42AU, 0x18635B10U, 0xD66566B6U, 0xF9D2D98CU, 0x890A18C2U, 0xA6BDA7F8U,
+        0x11C77E39U, 0x3E70C103U, 0x4EA8004DU, 0x611FBF77U, 0xAF1982D1U, 0x80AE3DEBU, 0xF076FCA5U, 0xDFC1439FU,
+        0x9A425290U, 0xB5F5EDAAU, 0xC52D2CE4U, 0xEA9A93DEU, 0x249CAE78U, 0x0B2B1142U, 0x7BF3D00CU, 0x54446F36U,
+        0xE33EB6F7U, 0xCC8909CDU, 0xBC51C883U, 0x93E677B9U, 0x5DE04A1FU, 0x7257F525U, 0x028F346BU, 0x2D388B51U,
+        0x4F2D1394U, 0x609AACAEU, 0x10426DE0U, 0x3FF5D2DAU, 0xF1F3EF7CU, 0xDE445046U, 0xAE9C9108U, 0x812B2E32U,
+        0x3651F7F3U, 0x19E648C9U, 0x693E8987U, 0x468936BDU, 0x888F0B1BU, 0xA738B421U, 0xD7E0756FU, 0xF857CA55U,
+        0xBDD4DB5AU, 0x92636460U, 0xE2BBA52EU, 0xCD0C1A14U, 0x030A27B2U, 0x2CBD9888U, 0x5C6559C6U, 0x73D2E6FCU,
+        0xC4A83F3DU, 0xEB1F8007U, 0x9BC74149U, 0xB470FE73U, 0x7A76C3D5U, 0x55C17CEFU, 0x2519BDA1U, 0x0AAE029BU,
+        0xAE1F9FBFU, 0x81A82085U, 0xF170E1CBU, 0xDEC75EF1U, 0x10C16357U, 0x3F76DC6DU, 0x4FAE1D23U, 0x6019A219U,
+        0xD7637BD8U, 0xF8D4C4E2U, 0x880C05ACU, 0xA7BBBA96U, 0x69BD8730U, 0x460A380AU, 0x36D2F944U, 0x1965467EU,
+        0x5CE65771U, 0x7351E84BU, 0x03892905U, 0x2C3E963FU, 0xE238AB99U, 0xCD8F14A3U, 0xBD57D5EDU, 0x92E06AD7U,
+        0x259AB316U, 0x0A2D0C2CU, 0x7AF5CD62U, 0x55427258U, 0x9B444FFEU, 0xB4F3F0C4U, 0xC42B318AU, 0xEB9C8EB0U,
+    },
+    };
+
+#elif ( BOOT_CRC32_ENGINE_SLICE8 == BOOT_CFG_CRC32_ENGINE )
+
+    /**
+     *  Slice-by-8 tables: (i * x^n) mod poly, for i = 0..255
+     *
+     *  Sizeof: 11 kB
+     */
+    static const uint32_t gu32_crc32_table[11][256] =
+    {
+    // x^32
+    {
+        0x00000000U, 0x04C11DB7U, 0x09823B6EU, 0x0D4326D9U, 0x130476DCU, 0x17C56B6BU, 0x1A864DB2U, 0x1E475005U,
+        0x2608EDB8U, 0x22C9F00FU, 0x2F8AD6D6U, 0x2B4BCB61U, 0x350C9B64U, 0x31CD86D3U, 0x3C8EA00AU, 0x384FBDBDU,
+        0x4C11DB70U, 0x48D0C6C7U, 0x4593E01EU, 0x4152FDA9U, 0x5F15ADACU, 0x5BD4B01BU, 0x569796C2U, 0x52568B75U,
+        0x6A1936C8U, 0x6ED82B7FU, 0x639B0DA6U, 0x675A1011U, 0x791D4014U, 0x7DDC5DA3U, 0x709F7B7AU, 0x745E66CDU,
+        0x9823B6E0U, 0x9CE2AB57U, 0x91A18D8EU, 0x95609039U, 0x8B27C03CU, 0x8FE6DD8BU, 0x82A5FB52U, 0x8664E6E5U,
+        0xBE2B5B58U, 0xBAEA46EFU, 0xB7A96036U, 0xB3687D81U, 0xAD2F2D84U, 0xA9EE3033U, 0xA4AD16EAU, 0xA06C0B5DU,
+        0xD4326D90U, 0xD0F37027U, 0xDDB056FEU, 0xD9714B49U, 0xC7361B4CU, 0xC3F706FBU, 0xCEB42022U, 0xCA753D95U,
+        0xF23A8028U, 0xF6FB9D9FU, 0xFBB8BB46U, 0xFF79A6F1U, 0xE13EF6F4U, 0xE5FFEB43U, 0xE8BCCD9AU, 0xEC7DD02DU,
+        0x34867077U, 0x30476DC0U, 0x3D044B19U, 0x39C556AEU, 0x278206ABU, 0x23431B1CU, 0x2E003DC5U, 0x2AC12072U,
+        0x128E9DCFU, 0x164F8078U, 0x1B0CA6A1U, 0x1FCDBB16U, 0x018AEB13U, 0x054BF6A4U, 0x0808D07DU, 0x0CC9CDCAU,
+        0x7897AB07U, 0x7C56B6B0U, 0x71159069U, 0x75D48DDEU, 0x6B93DDDBU, 0x6F52C06CU, 0x6211E6B5U, 0x66D0FB02U,
+        0x5E9F46BFU, 0x5A5E5B08U, 0x571D7DD1U, 0x53DC6066U, 0x4D9B3063U, 0x495A2DD4U, 0x44190B0DU, 0x40D816BAU,
+        0xACA5C697U, 0xA864DB20U, 0xA527FDF9U, 0xA1E6E04EU, 0xBFA1B04BU, 0xBB60ADFCU, 0xB6238B25U, 0xB2E29692U,
+        0x8AAD2B2FU, 0x8E6C3698U, 0x832F1041U, 0x87EE0DF6U, 0x99A95DF3U, 0x9D684044U, 0x902B669DU, 0x94EA7B2AU,
+        0xE0B41DE7U, 0xE4750050U, 0xE9362689U, 0xEDF73B3EU, 0xF3B06B3BU, 0xF771768CU, 0xFA325055U, 0xFEF34DE2U,
+        0xC6BCF05FU, 0xC27DEDE8U, 0xCF3ECB31U, 0xCBFFD686U, 0xD5B88683U, 0xD1799B34U, 0xDC3ABDEDU, 0xD8FBA05AU,
+        0x690CE0EEU, 0x6DCDFD59U, 0x608EDB80U, 0x644FC637U, 0x7A089632U, 0x7EC98B85U, 0x738AAD5CU, 0x774BB0EBU,
+        0x4F040D56U, 0x4BC510E1U, 0x46863638U, 0x42472B8FU, 0x5C007B8AU, 0x58C1663DU, 0x558240E4U, 0x51435D53U,
+        0x251D3B9EU, 0x21DC2629U, 0x2C9F00F0U, 0x285E1D47U, 0x36194D42U, 0x32D850F5U, 0x3F9B762CU, 0x3B5A6B9BU,
+        0x0315D626U, 0x07D4CB91U, 0x0A97ED48U, 0x0E56F0FFU, 0x1011A0FAU, 0x14D0BD4DU, 0x19939B94U, 0x1D528623U,
+        0xF12F560EU, 0xF5EE4BB9U, 0xF8AD6D60U, 0xFC6C70D7U, 0xE22B20D2U, 0xE6EA3D65U, 0xEBA91BBCU, 0xEF68060BU,
+        0xD727BBB6U, 0xD3E6A601U, 0xDEA580D8U, 0xDA649D6FU, 0xC423CD6AU, 0xC0E2D0DDU, 0xCDA1F604U, 0xC960EBB3U,
+        0xBD3E8D7EU, 0xB9FF90C9U, 0xB4BCB610U, 0xB07DABA7U, 0xAE3AFBA2U, 0xAAFBE615U, 0xA7B8C0CCU, 0xA379DD7BU,
+        0x9B3660C6U, 0x9FF77D71U, 0x92B45BA8U, 0x9675461FU, 0x8832161AU, 0x8CF30BADU, 0x81B02D74U, 0x857130C3U,
+        0x5D8A9099U, 0x594B8D2EU, 0x5408ABF7U, 0x50C9B640U, 0x4E8EE645U, 0x4A4FFBF2U, 0x470CDD2BU, 0x43CDC09CU,
+        0x7B827D21U, 0x7F436096U, 0x7200464FU, 0x76C15BF8U, 0x68860BFDU, 0x6C47164AU, 0x61043093U, 0x65C52D24U,
+        0x119B4BE9U, 0x155A565EU, 0x18197087U, 0x1CD86D30U, 0x029F3D35U, 0x065E2082U, 0x0B1D065BU, 0x0FDC1BECU,
+        0x3793A651U, 0x3352BBE6U, 0x3E119D3FU, 0x3AD08088U, 0x2497D08DU, 0x2056CD3AU, 0x2D15EBE3U, 0x29D4F654U,
+        0xC5A92679U, 0xC1683BCEU, 0xCC2B1D17U, 0xC8EA00A0U, 0xD6AD50A5U, 0xD26C4D12U, 0xDF2F6BCBU, 0xDBEE767CU,
+        0xE3A1CBC1U, 0xE760D676U, 0xEA23F0AFU, 0xEEE2ED18U, 0xF0A5BD1DU, 0xF464A0AAU, 0xF9278673U, 0xFDE69BC4U,
+        0x89B8FD09U, 0x8D79E0BEU, 0x803AC667U, 0x84FBDBD0U, 0x9ABC8BD5U, 0x9E7D9662U, 0x933EB0BBU, 0x97FFAD0CU,
+        0xAFB010B1U, 0xAB710D06U, 0xA6322BDFU, 0xA2F33668U, 0xBCB4666DU, 0xB8757BDAU, 0xB5365D03U, 0xB1F740B4U,
+    },
+    // x^64
+    {
+        0x00000000U, 0x490D678DU, 0x921ACF1AU, 0xDB17A897U, 0x20F48383U, 0x69F9E40EU, 0xB2EE4C99U, 0xFBE32B14U,
+        0x41E90706U, 0x08E4608BU, 0xD3F3C81CU, 0x9AFEAF91U, 0x611D8485U, 0x2810E308U, 0xF3074B9FU, 0xBA0A2C12U,
+        0x83D20E0CU, 0xCADF6981U, 0x11C8C116U, 0x58C5A69BU, 0xA3268D8FU, 0xEA2BEA02U, 0x313C4295U, 0x78312518U,
+        0xC23B090AU, 0x8B366E87U, 0x5021C610U, 0x192CA19DU, 0xE2CF8A89U, 0xABC2ED04U, 0x70D54593U, 0x39D8221EU,
+        0x036501AFU, 0x4A686622U, 0x917FCEB5U, 0xD872A938U, 0x2391822CU, 0x6A9CE5A1U, 0xB18B4D36U, 0xF8862ABBU,
+        0x428C06A9U, 0x0B816124U, 0xD096C9B3U, 0x999BAE3EU, 0x6278852AU, 0x2B75E2A7U, 0xF0624A30U, 0xB96F2DBDU,
+        0x80B70FA3U, 0xC9BA682EU, 0x12ADC0B9U, 0x5BA0A734U, 0xA0438C20U, 0xE94EEBADU, 0x3259433AU, 0x7B5424B7U,
+        0xC15E08A5U, 0x88536F28U, 0x5344C7BFU, 0x1A49A032U, 0xE1AA8B26U, 0xA8A7ECABU, 0x73B0443CU, 0x3ABD23B1U,
+        0x06CA035EU, 0x4FC764D3U, 0x94D0CC44U, 0xDDDDABC9U, 0x263E80DDU, 0x6F33E750U, 0xB4244FC7U, 0xFD29284AU,
+        0x47230458U, 0x0E2E63D5U, 0xD539CB42U, 0x9C34ACCFU, 0x67D787DBU, 0x2EDAE056U, 0xF5CD48C1U, 0xBCC02F4CU,
+        0x85180D52U, 0xCC156ADFU, 0x1702C248U, 0x5E0FA5C5U, 0xA5EC8ED1U, 0xECE1E95CU, 0x37F641CBU, 0x7EFB2646U,
+        0xC4F10A54U, 0x8DFC6DD9U, 0x56EBC54EU, 0x1FE6A2C3U, 0xE40589D7U, 0xAD08EE5AU, 0x761F46CDU, 0x3F122140U,
+        0x05AF02F1U, 0x4CA2657CU, 0x97B5CDEBU, 0xDEB8AA66U, 0x255B8172U, 0x6C56E6FFU, 0xB7414E68U, 0xFE4C29E5U,
+        0x444605F7U, 0x0D4B627AU, 0xD65CCAEDU, 0x9F51AD60U, 0x64B28674U, 0x2DBFE1F9U, 0xF6A8496EU, 0xBFA52EE3U,
+        0x867D0CFDU, 0xCF706B70U, 0x1467C3E7U, 0x5D6AA46AU, 0xA6898F7EU, 0xEF84E8F3U, 0x34934064U, 0x7D9E27E9U,
+        0xC7940BFBU, 0x8E996C76U, 0x558EC4E1U, 0x1C83A36CU, 0xE7608878U, 0xAE6DEFF5U, 0x757A4762U, 0x3C7720EFU,
+        0x0D9406BCU, 0x44996131U, 0x9F8EC9A6U, 0xD683AE2BU, 0x2D60853FU, 0x646DE2B2U, 0xBF7A4A25U, 0xF6772DA8U,
+        0x4C7D01BAU, 0x05706637U, 0xDE67CEA0U, 0x976AA92DU, 0x6C898239U, 0x2584E5B4U, 0xFE934D23U, 0xB79E2AAEU,
+        0x8E4608B0U, 0xC74B6F3DU, 0x1C5CC7AAU, 0x5551A027U, 0xAEB28B33U, 0xE7BFECBEU, 0x3CA84429U, 0x75A523A4U,
+        0xCFAF0FB6U, 0x86A2683BU, 0x5DB5C0ACU, 0x14B8A721U, 0xEF5B8C35U, 0xA656EBB8U, 0x7D41432FU, 0x344C24A2U,
+        0x0EF10713U, 0x47FC609EU, 0x9CEBC809U, 0xD5E6AF84U, 0x2E058490U, 0x6708E31DU, 0xBC1F4B8AU, 0xF5122C07U,
+        0x4F180015U, 0x06156798U, 0xDD02CF0FU, 0x940FA882U, 0x6FEC8396U, 0x26E1E41BU, 0xFDF64C8CU, 0xB4FB2B01U,
+        0x8D23091FU, 0xC42E6E92U, 0x1F39C605U, 0x5634A188U, 0xADD78A9CU, 0xE4DAED11U, 0x3FCD4586U, 0x76C0220BU,
+        0xCCCA0E19U, 0x85C76994U, 0x5ED0C103U, 0x17DDA68EU, 0xEC3E8D9AU, 0xA533EA17U, 0x7E244280U, 0x3729250DU,
+        0x0B5E05E2U, 0x4253626FU, 0x9944CAF8U, 0xD049AD75U, 0x2BAA8661U, 0x62A7E1ECU, 0xB9B0497BU, 0xF0BD2EF6U,
+        0x4AB702E4U, 0x03BA6569U, 0xD8ADCDFEU, 0x91A0AA73U, 0x6A438167U, 0x234EE6EAU, 0xF8594E7DU, 0xB15429F0U,
+        0x888C0BEEU, 0xC1816C63U, 0x1A96C4F4U, 0x539BA379U, 0xA878886DU, 0xE175EFE0U, 0x3A624777U, 0x736F20FAU,
+        0xC9650CE8U, 0x80686B65U, 0x5B7FC3F2U, 0x1272A47FU, 0xE9918F6BU, 0xA09CE8E6U, 0x7B8B4071U, 0x328627FCU,
+        0x083B044DU, 0x413663C0U, 0x9A21CB57U, 0xD32CACDAU, 0x28CF87CEU, 0x61C2E043U, 0xBAD548D4U, 0xF3D82F59U,
+        0x49D2034BU, 0x00DF64C6U, 0xDBC8CC51U, 0x92C5ABDCU, 0x692680C8U, 0x202BE745U, 0xFB3C4FD2U, 0xB231285FU,
+        0x8BE90A41U, 0xC2E46DCCU, 0x19F3C55BU, 0x50FEA2D6U, 0xAB1D89C2U, 0xE210EE4FU, 0x390746D8U, 0x700A2155U,
+        0xCA000D47U, 0x830D6ACAU, 0x581AC25DU, 0x1117A5D0U, 0xEAF48EC4U, 0xA3F9E949U, 0x78EE41DEU, 0x31E32653U,
+    },
+    // x^96
+    {
+        0x00000000U, 0xF200AA66U, 0xE0C0497BU, 0x12C0E31DU, 0xC5418F41U, 0x37412527U, 0x2581C63AU, 0xD7816C5CU,
+        0x8E420335U, 0x7C42A953U, 0x6E824A4EU, 0x9C82E028U, 0x4B038C74U, 0xB9032612U, 0xABC3C50FU, 0x59C36F69U,
+        0x18451BDDU, 0xEA45B1BBU, 0xF88552A6U, 0x0A85F8C0U, 0xDD04949CU, 0x2F043EFAU, 0x3DC4DDE7U, 0xCFC47781U,
+        0x960718E8U, 0x6407B28EU, 0x76C75193U, 0x84C7FBF5U, 0x534697A9U, 0xA1463DCFU, 0xB386DED2U, 0x418674B4U,
+        0x308A37BAU, 0xC28A9DDCU, 0xD04A7EC1U, 0x224AD4A7U, 0xF5CBB8FBU, 0x07CB129DU, 0x150BF180U, 0xE70B5BE6U,
+        0xBEC8348FU, 0x4CC89EE9U, 0x5E087DF4U, 0xAC08D792U, 0x7B89BBCEU, 0x898911A8U, 0x9B49F2B5U, 0x694958D3U,
+        0x28CF2C67U, 0xDACF8601U, 0xC80F651CU, 0x3A0FCF7AU, 0xED8EA326U, 0x1F8E0940U, 0x0D4EEA5DU, 0xFF4E403BU,
+        0xA68D2F52U, 0x548D8534U, 0x464D6629U, 0xB44DCC4FU, 0x63CCA013U, 0x91CC0A75U, 0x830CE968U, 0x710C430EU,
+        0x61146F74U, 0x9314C512U, 0x81D4260FU, 0x73D48C69U, 0xA455E035U, 0x56554A53U, 0x4495A94EU, 0xB6950328U,
+        0xEF566C41U, 0x1D56C627U, 0x0F96253AU, 0xFD968F5CU, 0x2A17E300U, 0xD8174966U, 0xCAD7AA7BU, 0x38D7001DU,
+        0x795174A9U, 0x8B51DECFU, 0x99913DD2U, 0x6B9197B4U, 0xBC10FBE8U, 0x4E10518EU, 0x5CD0B293U, 0xAED018F5U,
+        0xF713779CU, 0x0513DDFAU, 0x17D33EE7U, 0xE5D39481U, 0x3252F8DDU, 0xC05252BBU, 0xD292B1A6U, 0x20921BC0U,
+        0x519E58CEU, 0xA39EF2A8U, 0xB15E11B5U, 0x435EBBD3U, 0x94DFD78FU, 0x66DF7DE9U, 0x741F9EF4U, 0x861F3492U,
+        0xDFDC5BFBU, 0x2DDCF19DU, 0x3F1C1280U, 0xCD1CB8E6U, 0x1A9DD4BAU, 0xE89D7EDCU, 0xFA5D9DC1U, 0x085D37A7U,
+        0x49DB4313U, 0xBBDBE975U, 0xA91B0A68U, 0x5B1BA00EU, 0x8C9ACC52U, 0x7E9A6634U, 0x6C5A8529U, 0x9E5A2F4FU,
+        0xC7994026U, 0x3599EA40U, 0x2759095DU, 0xD559A33BU, 0x02D8CF67U, 0xF0D86501U, 0xE218861CU, 0x10182C7AU,
+        0xC228DEE8U, 0x3028748EU, 0x22E89793U, 0xD0E83DF5U, 0x076951A9U, 0xF569FBCFU, 0xE7A918D2U, 0x15A9B2B4U,
+        0x4C6ADDDDU, 0xBE6A77BBU, 0xACAA94A6U, 0x5EAA3EC0U, 0x892B529CU, 0x7B2BF8FAU, 0x69EB1BE7U, 0x9BEBB181U,
+        0xDA6DC535U, 0x286D6F53U, 0x3AAD8C4EU, 0xC8AD2628U, 0x1F2C4A74U, 0xED2CE012U, 0xFFEC030FU, 0x0DECA969U,
+        0x542FC600U, 0xA62F6C66U, 0xB4EF8F7BU, 0x46EF251DU, 0x916E4941U, 0x636EE327U, 0x71AE003AU, 0x83AEAA5CU,
+        0xF2A2E952U, 0x00A24334U, 0x1262A029U, 0xE0620A4FU, 0x37E36613U, 0xC5E3CC75U, 0xD7232F68U, 0x2523850EU,
+        0x7CE0EA67U, 0x8EE04001U, 0x9C20A31CU, 0x6E20097AU, 0xB9A16526U, 0x4BA1CF40U, 0x59612C5DU, 0xAB61863BU,
+        0xEAE7F28FU, 0x18E758E9U, 0x0A27BBF4U, 0xF8271192U, 0x2FA67DCEU, 0xDDA6D7A8U, 0xCF6634B5U, 0x3D669ED3U,
+        0x64A5F1BAU, 0x96A55BDCU, 0x8465B8C1U, 0x766512A7U, 0xA1E47EFBU, 0x53E4D49DU, 0x41243780U, 0xB3249DE6U,
+        0xA33CB19CU, 0x513C1BFAU, 0x43FCF8E7U, 0xB1FC5281U, 0x667D3EDDU, 0x947D94BBU, 0x86BD77A6U, 0x74BDDDC0U,
+        0x2D7EB2A9U, 0xDF7E18CFU, 0xCDBEFBD2U, 0x3FBE51B4U, 0xE83F3DE8U, 0x1A3F978EU, 0x08FF7493U, 0xFAFFDEF5U,
+        0xBB79AA41U, 0x49790027U, 0x5BB9E33AU, 0xA9B9495CU, 0x7E382500U, 0x8C388F66U, 0x9EF86C7BU, 0x6CF8C61DU,
+        0x353BA974U, 0xC73B0312U, 0xD5FBE00FU, 0x27FB4A69U, 0xF07A2635U, 0x027A8C53U, 0x10BA6F4EU, 0xE2BAC528U,
+        0x93B68626U, 0x61B62C40U, 0x7376CF5DU, 0x8176653BU, 0x56F70967U, 0xA4F7A301U, 0xB637401CU, 0x4437EA7AU,
+        0x1DF48513U, 0xEFF42F75U, 0xFD34CC68U, 0x0F34660EU, 0xD8B50A52U, 0x2AB5A034U, 0x38754329U, 0xCA75E94FU,
+        0x8BF39DFBU, 0x79F3379DU, 0x6B33D480U, 0x99337EE6U, 0x4EB212BAU, 0xBCB2B8DCU, 0xAE725BC1U, 0x5C72F1A7U,
+        0x05B19ECEU, 0xF7B134A8U, 0xE571D7B5U, 0x17717DD3U, 0xC0F0118FU, 0x32F0BBE9U, 0x203058F4U, 0xD230F292U,
+    },
+    // x^128
+    {
+        0x00000000U, 0xE8A45605U, 0xD589B1BDU, 0x3D2DE7B8U, 0xAFD27ECDU, 0x477628C8U, 0x7A5BCF70U, 0x92FF9975U,
+        0x5B65E02DU, 0xB3C1B628U, 0x8EEC5190U, 0x66480795U, 0xF4B79EE0U, 0x1C13C8E5U, 0x213E2F5DU, 0xC99A7958U,
+        0xB6CBC05AU, 0x5E6F965FU, 0x634271E7U, 0x8BE627E2U, 0x1919BE97U, 0xF1BDE892U, 0xCC900F2AU, 0x2434592FU,
+        0xEDAE2077U, 0x050A7672U, 0x382791CAU, 0xD083C7CFU, 0x427C5EBAU, 0xAAD808BFU, 0x97F5EF07U, 0x7F51B902U,
+        0x69569D03U, 0x81F2CB06U, 0xBCDF2CBEU, 0x547B7ABBU, 0xC684E3CEU, 0x2E20B5CBU, 0x130D5273U, 0xFBA90476U,
+        0x32337D2EU, 0xDA972B2BU, 0xE7BACC93U, 0x0F1E9A96U, 0x9DE103E3U, 0x754555E6U, 0x4868B25EU, 0xA0CCE45BU,
+        0xDF9D5D59U, 0x37390B5CU, 0x0A14ECE4U, 0xE2B0BAE1U, 0x704F2394U, 0x98EB7591U, 0xA5C69229U, 0x4D62C42CU,
+        0x84F8BD74U, 0x6C5CEB71U, 0x51710CC9U, 0xB9D55ACCU, 0x2B2AC3B9U, 0xC38E95BCU, 0xFEA37204U, 0x16072401U,
+        0xD2AD3A06U, 0x3A096C03U, 0x07248BBBU, 0xEF80DDBEU, 0x7D7F44CBU, 0x95DB12CEU, 0xA8F6F576U, 0x4052A373U,
+        0x89C8DA2BU, 0x616C8C2EU, 0x5C416B96U, 0xB4E53D93U, 0x261AA4E6U, 0xCEBEF2E3U, 0xF393155BU, 0x1B37435EU,
+        0x6466FA5CU, 0x8CC2AC59U, 0xB1EF4BE1U, 0x594B1DE4U, 0xCBB48491U, 0x2310D294U, 0x1E3D352CU, 0xF6996329U,
+        0x3F031A71U, 0xD7A74C74U, 0xEA8AABCCU, 0x022EFDC9U, 0x90D164BCU, 0x787532B9U, 0x4558D501U, 0xADFC8304U,
+        0xBBFBA705U, 0x535FF100U, 0x6E7216B8U, 0x86D640BDU, 0x1429D9C8U, 0xFC8D8FCDU, 0xC1A06875U, 0x29043E70U,
+        0xE09E4728U, 0x083A112DU, 0x3517F695U, 0xDDB3A090U, 0x4F4C39E5U, 0xA7E86FE0U, 0x9AC58858U, 0x7261DE5DU,
+        0x0D30675FU, 0xE594315AU, 0xD8B9D6E2U, 0x301D80E7U, 0xA2E21992U, 0x4A464F97U, 0x776BA82FU, 0x9FCFFE2AU,
+        0x56558772U, 0xBEF1D177U, 0x83DC36CFU, 0x6B7860CAU, 0xF987F9BFU, 0x1123AFBAU, 0x2C0E4802U, 0xC4AA1E07U,
+        0xA19B69BBU, 0x493F3FBEU, 0x7412D806U, 0x9CB68E03U, 0x0E491776U, 0xE6ED4173U, 0xDBC0A6CBU, 0x3364F0CEU,
+        0xFAFE8996U, 0x125ADF93U, 0x2F77382BU, 0xC7D36E2EU, 0x552CF75BU, 0xBD88A15EU, 0x80A546E6U, 0x680110E3U,
+        0x1750A9E1U, 0xFFF4FFE4U, 0xC2D9185CU, 0x2A7D4E59U, 0xB882D72CU, 0x50268129U, 0x6D0B6691U, 0x85AF3094U,
+        0x4C3549CCU, 0xA4911FC9U, 0x99BCF871U, 0x7118AE74U, 0xE3E73701U, 0x0B436104U, 0x366E86BCU, 0xDECAD0B9U,
+        0xC8CDF4B8U, 0x2069A2BDU, 0x1D444505U, 0xF5E01300U, 0x671F8A75U, 0x8FBBDC70U, 0xB2963BC8U, 0x5A326DCDU,
+        0x93A81495U, 0x7B0C4290U, 0x4621A528U, 0xAE85F32DU, 0x3C7A6A58U, 0xD4DE3C5DU, 0xE9F3DBE5U, 0x01578DE0U,
+        0x7E0634E2U, 0x96A262E7U, 0xAB8F855FU, 0x432BD35AU, 0xD1D44A2FU, 0x39701C2AU, 0x045DFB92U, 0xECF9AD97U,
+        0x2563D4CFU, 0xCDC782CAU, 0xF0EA6572U, 0x184E3377U, 0x8AB1AA02U, 0x6215FC07U, 0x5F381BBFU, 0xB79C4DBAU,
+        0x733653BDU, 0x9B9205B8U, 0xA6BFE200U, 0x4E1BB405U, 0xDCE42D70U, 0x34407B75U, 0x096D9CCDU, 0xE1C9CAC8U,
+        0x2853B390U, 0xC0F7E595U, 0xFDDA022DU, 0x157E5428U, 0x8781CD5DU, 0x6F259B58U, 0x52087CE0U, 0xBAAC2AE5U,
+        0xC5FD93E7U, 0x2D59C5E2U, 0x1074225AU, 0xF8D0745FU, 0x6A2FED2AU, 0x828BBB2FU, 0xBFA65C97U, 0x57020A92U,
+        0x9E9873CAU, 0x763C25CFU, 0x4B11C277U, 0xA3B59472U, 0x314A0D07U, 0xD9EE5B02U, 0xE4C3BCBAU, 0x0C67EABFU,
+        0x1A60CEBEU, 0xF2C498BBU, 0xCFE97F03U, 0x274D2906U, 0xB5B2B073U, 0x5D16E676U, 0x603B01CEU, 0x889F57CBU,
+        0x41052E93U, 0xA9A17896U, 0x948C9F2EU, 0x7C28C92BU, 0xEED7505EU, 0x0673065BU, 0x3B5EE1E3U, 0xD3FAB7E6U,
+        0xACAB0EE4U, 0x440F58E1U, 0x7922BF59U, 0x9186E95CU, 0x03797029U, 0xEBDD262CU, 0xD6F0C194U, 0x3E549791U,
+        0xF7CEEEC9U, 0x1F6AB8CCU, 0x22475F74U, 0xCAE30971U, 0x581C9004U, 0xB0B8C601U, 0x8D9521B9U, 0x653177BCU,
+    },
+    // x^160
+    {
+        0x00000000U, 0x17D3315DU, 0x2FA662BAU, 0x387553E7U, 0x5F4CC574U, 0x489FF429U, 0x70EAA7CEU, 0x67399693U,
+        0xBE998AE8U, 0xA94ABBB5U, 0x913FE852U, 0x86ECD90FU, 0xE1D54F9CU, 0xF6067EC1U, 0xCE732D26U, 0xD9A01C7BU,
+        0x79F20867U, 0x6E21393AU, 0x56546ADDU, 0x41875B80U, 0x26BECD13U, 0x316DFC4EU, 0x0918AFA9U, 0x1ECB9EF4U,
+        0xC76B828FU, 0xD0B8B3D2U, 0xE8CDE035U, 0xFF1ED168U, 0x982747FBU, 0x8FF476A6U, 0xB7812541U, 0xA052141CU,
+        0xF3E410CEU, 0xE4372193U, 0xDC427274U, 0xCB914329U, 0xACA8D5BAU, 0xBB7BE4E7U, 0x830EB700U, 0x94DD865DU,
+        0x4D7D9A26U, 0x5AAEAB7BU, 0x62DBF89CU, 0x7508C9C1U, 0x12315F52U, 0x05E26E0FU, 0x3D973DE8U, 0x2A440CB5U,
+        0x8A1618A9U, 0x9DC529F4U, 0xA5B07A13U, 0xB2634B4EU, 0xD55ADDDDU, 0xC289EC80U, 0xFAFCBF67U, 0xED2F8E3AU,
+        0x348F9241U, 0x235CA31CU, 0x1B29F0FBU, 0x0CFAC1A6U, 0x6BC35735U, 0x7C106668U, 0x4465358FU, 0x53B604D2U,
+        0xE3093C2BU, 0xF4DA0D76U, 0xCCAF5E91U, 0xDB7C6FCCU, 0xBC45F95FU, 0xAB96C802U, 0x93E39BE5U, 0x8430AAB8U,
+        0x5D90B6C3U, 0x4A43879EU, 0x7236D479U, 0x65E5E524U, 0x02DC73B7U, 0x150F42EAU, 0x2D7A110DU, 0x3AA92050U,
+        0x9AFB344CU, 0x8D280511U, 0xB55D56F6U, 0xA28E67ABU, 0xC5B7F138U, 0xD264C065U, 0xEA119382U, 0xFDC2A2DFU,
+        0x2462BEA4U, 0x33B18FF9U, 0x0BC4DC1EU, 0x1C17ED43U, 0x7B2E7BD0U, 0x6CFD4A8DU, 0x5488196AU, 0x435B2837U,
+        0x10ED2CE5U, 0x073E1DB8U, 0x3F4B4E5FU, 0x28987F02U, 0x4FA1E991U, 0x5872D8CCU, 0x60078B2BU, 0x77D4BA76U,
+        0xAE74A60DU, 0xB9A79750U, 0x81D2C4B7U, 0x9601F5EAU, 0xF1386379U, 0xE6EB5224U, 0xDE9E01C3U, 0xC94D309EU,
+        0x691F2482U, 0x7ECC15DFU, 0x46B94638U, 0x516A7765U, 0x3653E1F6U, 0x2180D0ABU, 0x19F5834CU, 0x0E26B211U,
+        0xD786AE6AU, 0xC0559F37U, 0xF820CCD0U, 0xEFF3FD8DU, 0x88CA6B1EU, 0x9F195A43U, 0xA76C09A4U, 0xB0BF38F9U,
+        0xC2D365E1U, 0xD50054BCU, 0xED75075BU, 0xFAA63606U, 0x9D9FA095U, 0x8A4C91C8U, 0xB239C22FU, 0xA5EAF372U,
+        0x7C4AEF09U, 0x6B99DE54U, 0x53EC8DB3U, 0x443FBCEEU, 0x23062A7DU, 0x34D51B20U, 0x0CA048C7U, 0x1B73799AU,
+        0xBB216D86U, 0xACF25CDBU, 0x94870F3CU, 0x83543E61U, 0xE46DA8F2U, 0xF3BE99AFU, 0xCBCBCA48U, 0xDC18FB15U,
+        0x05B8E76EU, 0x126BD633U, 0x2A1E85D4U, 0x3DCDB489U, 0x5AF4221AU, 0x4D271347U, 0x755240A0U, 0x628171FDU,
+        0x3137752FU, 0x26E44472U, 0x1E911795U, 0x094226C8U, 0x6E7BB05BU, 0x79A88106U, 0x41DDD2E1U, 0x560EE3BCU,
+        0x8FAEFFC7U, 0x987DCE9AU, 0xA0089D7DU, 0xB7DBAC20U, 0xD0E23AB3U, 0xC7310BEEU, 0xFF445809U, 0xE8976954U,
+        0x48C57D48U, 0x5F164C15U, 0x67631FF2U, 0x70B02EAFU, 0x1789B83CU, 0x005A8961U, 0x382FDA86U, 0x2FFCEBDBU,
+        0xF65CF7A0U, 0xE18FC6FDU, 0xD9FA951AU, 0xCE29A447U, 0xA91032D4U, 0xBEC30389U, 0x86B6506EU, 0x91656133U,
+        0x21DA59CAU, 0x36096897U, 0x0E7C3B70U, 0x19AF0A2DU, 0x7E969CBEU, 0x6945ADE3U, 0x5130FE04U, 0x46E3CF59U,
+        0x9F43D322U, 0x8890E27FU, 0xB0E5B198U, 0xA73680C5U, 0xC00F1656U, 0xD7DC270BU, 0xEFA974ECU, 0xF87A45B1U,
+        0x582851ADU, 0x4FFB60F0U, 0x778E3317U, 0x605D024AU, 0x076494D9U, 0x10B7A584U, 0x28C2F663U, 0x3F11C73EU,
+        0xE6B1DB45U, 0xF162EA18U, 0xC917B9FFU, 0xDEC488A2U, 0xB9FD1E31U, 0xAE2E2F6CU, 0x965B7C8BU, 0x81884DD6U,
+        0xD23E4904U, 0xC5ED7859U, 0xFD982BBEU, 0xEA4B1AE3U, 0x8D728C70U, 0x9AA1BD2DU, 0xA2D4EECAU, 0xB507DF97U,
+        0x6CA7C3ECU, 0x7B74F2B1U, 0x4301A156U, 0x54D2900BU, 0x33EB0698U, 0x243837C5U, 0x1C4D6422U, 0x0B9E557FU,
+        0xABCC4163U, 0xBC1F703EU, 0x846A23D9U, 0x93B91284U, 0xF4808417U, 0xE353B54AU, 0xDB26E6ADU, 0xCCF5D7F0U,
+        0x1555CB8BU, 0x0286FAD6U, 0x3AF3A931U, 0x2D20986CU, 0x4A190EFFU, 0x5DCA3FA2U, 0x65BF6C45U, 0x726C5D18U,
+    },
+    // x^192
+    {
+        0x00000000U, 0xC5B9CD4CU, 0x8FB2872FU, 0x4A0B4A63U, 0x1BA413E9U, 0xDE1DDEA5U, 0x941694C6U, 0x51AF598AU,
+        0x374827D2U, 0xF2F1EA9EU, 0xB8FAA0FDU, 0x7D436DB1U, 0x2CEC343BU, 0xE955F977U, 0xA35EB314U, 0x66E77E58U,
+        0x6E904FA4U, 0xAB2982E8U, 0xE122C88BU, 0x249B05C7U, 0x75345C4DU, 0xB08D9101U, 0xFA86DB62U, 0x3F3F162EU,
+        0x59D86876U, 0x9C61A53AU, 0xD66AEF59U, 0x13D32215U, 0x427C7B9FU, 0x87C5B6D3U, 0xCDCEFCB0U, 0x087731FCU,
+        0xDD209F48U, 0x18995204U, 0x52921867U, 0x972BD52BU, 0xC6848CA1U, 0x033D41EDU, 0x49360B8EU, 0x8C8FC6C2U,
+        0xEA68B89AU, 0x2FD175D6U, 0x65DA3FB5U, 0xA063F2F9U, 0xF1CCAB73U, 0x3475663FU, 0x7E7E2C5CU, 0xBBC7E110U,
+        0xB3B0D0ECU, 0x76091DA0U, 0x3C0257C3U, 0xF9BB9A8FU, 0xA814C305U, 0x6DAD0E49U, 0x27A6442AU, 0xE21F8966U,
+        0x84F8F73EU, 0x41413A72U, 0x0B4A7011U, 0xCEF3BD5DU, 0x9F5CE4D7U, 0x5AE5299BU, 0x10EE63F8U, 0xD557AEB4U,
+        0xBE802327U, 0x7B39EE6BU, 0x3132A408U, 0xF48B6944U, 0xA52430CEU, 0x609DFD82U, 0x2A96B7E1U, 0xEF2F7AADU,
+        0x89C804F5U, 0x4C71C9B9U, 0x067A83DAU, 0xC3C34E96U, 0x926C171CU, 0x57D5DA50U, 0x1DDE9033U, 0xD8675D7FU,
+        0xD0106C83U, 0x15A9A1CFU, 0x5FA2EBACU, 0x9A1B26E0U, 0xCBB47F6AU, 0x0E0DB226U, 0x4406F845U, 0x81BF3509U,
+        0xE7584B51U, 0x22E1861DU, 0x68EACC7EU, 0xAD530132U, 0xFCFC58B8U, 0x394595F4U, 0x734EDF97U, 0xB6F712DBU,
+        0x63A0BC6FU, 0xA6197123U, 0xEC123B40U, 0x29ABF60CU, 0x7804AF86U, 0xBDBD62CAU, 0xF7B628A9U, 0x320FE5E5U,
+        0x54E89BBDU, 0x915156F1U, 0xDB5A1C92U, 0x1EE3D1DEU, 0x4F4C8854U, 0x8AF54518U, 0xC0FE0F7BU, 0x0547C237U,
+        0x0D30F3CBU, 0xC8893E87U, 0x828274E4U, 0x473BB9A8U, 0x1694E022U, 0xD32D2D6EU, 0x9926670DU, 0x5C9FAA41U,
+        0x3A78D419U, 0xFFC11955U, 0xB5CA5336U, 0x70739E7AU, 0x21DCC7F0U, 0xE4650ABCU, 0xAE6E40DFU, 0x6BD78D93U,
+        0x79C15BF9U, 0xBC7896B5U, 0xF673DCD6U, 0x33CA119AU, 0x62654810U, 0xA7DC855CU, 0xEDD7CF3FU, 0x286E0273U,
+        0x4E897C2BU, 0x8B30B167U, 0xC13BFB04U, 0x04823648U, 0x552D6FC2U, 0x9094A28EU, 0xDA9FE8EDU, 0x1F2625A1U,
+        0x1751145DU, 0xD2E8D911U, 0x98E39372U, 0x5D5A5E3EU, 0x0CF507B4U, 0xC94CCAF8U, 0x8347809BU, 0x46FE4DD7U,
+        0x2019338FU, 0xE5A0FEC3U, 0xAFABB4A0U, 0x6A1279ECU, 0x3BBD2066U, 0xFE04ED2AU, 0xB40FA749U, 0x71B66A05U,
+        0xA4E1C4B1U, 0x615809FDU, 0x2B53439EU, 0xEEEA8ED2U, 0xBF45D758U, 0x7AFC1A14U, 0x30F75077U, 0xF54E9D3BU,
+        0x93A9E363U, 0x56102E2FU, 0x1C1B644CU, 0xD9A2A900U, 0x880DF08AU, 0x4DB43DC6U, 0x07BF77A5U, 0xC206BAE9U,
+        0xCA718B15U, 0x0FC84659U, 0x45C30C3AU, 0x807AC176U, 0xD1D598FCU, 0x146C55B0U, 0x5E671FD3U, 0x9BDED29FU,
+        0xFD39ACC7U, 0x3880618BU, 0x728B2BE8U, 0xB732E6A4U, 0xE69DBF2EU, 0x23247262U, 0x692F3801U, 0xAC96F54DU,
+        0xC74178DEU, 0x02F8B592U, 0x48F3FFF1U, 0x8D4A32BDU, 0xDCE56B37U, 0x195CA67BU, 0x5357EC18U, 0x96EE2154U,
+        0xF0095F0CU, 0x35B09240U, 0x7FBBD823U, 0xBA02156FU, 0xEBAD4CE5U, 0x2E1481A9U, 0x641FCBCAU, 0xA1A60686U,
+        0xA9D1377AU, 0x6C68FA36U, 0x2663B055U, 0xE3DA7D19U, 0xB2752493U, 0x77CCE9DFU, 0x3DC7A3BCU, 0xF87E6EF0U,
+        0x9E9910A8U, 0x5B20DDE4U, 0x112B9787U, 0xD4925ACBU, 0x853D0341U, 0x4084CE0DU, 0x0A8F846EU, 0xCF364922U,
+        0x1A61E796U, 0xDFD82ADAU, 0x95D360B9U, 0x506AADF5U, 0x01C5F47FU, 0xC47C3933U, 0x8E777350U, 0x4BCEBE1CU,
+        0x2D29C044U, 0xE8900D08U, 0xA29B476BU, 0x67228A27U, 0x368DD3ADU, 0xF3341EE1U, 0xB93F5482U, 0x7C8699CEU,
+        0x74F1A832U, 0xB148657EU, 0xFB432F1DU, 0x3EFAE251U, 0x6F55BBDBU, 0xAAEC7697U, 0xE0E73CF4U, 0x255EF1B8U,
+        0x43B98FE0U, 0x860042ACU, 0xCC0B08CFU, 0x09B2C583U, 0x581D9C09U, 0x9DA45145U, 0xD7AF1B26U, 0x1216D66AU,
+    },
+    // x^224
+    {
+        0x00000000U, 0xCD8C54B5U, 0x9FD9B4DDU, 0x5255E068U, 0x3B72740DU, 0xF6FE20B8U, 0xA4ABC0D0U, 0x69279465U,
+        0x76E4E81AU, 0xBB68BCAFU, 0xE93D5CC7U, 0x24B10872U, 0x4D969C17U, 0x801AC8A2U, 0xD24F28CAU, 0x1FC37C7FU,
+        0xEDC9D034U, 0x20458481U, 0x721064E9U, 0xBF9C305CU, 0xD6BBA439U, 0x1B37F08CU, 0x496210E4U, 0x84EE4451U,
+        0x9B2D382EU, 0x56A16C9BU, 0x04F48CF3U, 0xC978D846U, 0xA05F4C23U, 0x6DD31896U, 0x3F86F8FEU, 0xF20AAC4BU,
+        0xDF52BDDFU, 0x12DEE96AU, 0x408B0902U, 0x8D075DB7U, 0xE420C9D2U, 0x29AC9D67U, 0x7BF97D0FU, 0xB67529BAU,
+        0xA9B655C5U, 0x643A0170U, 0x366FE118U, 0xFBE3B5ADU, 0x92C421C8U, 0x5F48757DU, 0x0D1D9515U, 0xC091C1A0U,
+        0x329B6DEBU, 0xFF17395EU, 0xAD42D936U, 0x60CE8D83U, 0x09E919E6U, 0xC4654D53U, 0x9630AD3BU, 0x5BBCF98EU,
+        0x447F85F1U, 0x89F3D144U, 0xDBA6312CU, 0x162A6599U, 0x7F0DF1FCU, 0xB281A549U, 0xE0D44521U, 0x2D581194U,
+        0xBA646609U, 0x77E832BCU, 0x25BDD2D4U, 0xE8318661U, 0x81161204U, 0x4C9A46B1U, 0x1ECFA6D9U, 0xD343F26CU,
+        0xCC808E13U, 0x010CDAA6U, 0x53593ACEU, 0x9ED56E7BU, 0xF7F2FA1EU, 0x3A7EAEABU, 0x682B4EC3U, 0xA5A71A76U,
+        0x57ADB63DU, 0x9A21E288U, 0xC87402E0U, 0x05F85655U, 0x6CDFC230U, 0xA1539685U, 0xF30676EDU, 0x3E8A2258U,
+        0x21495E27U, 0xECC50A92U, 0xBE90EAFAU, 0x731CBE4FU, 0x1A3B2A2AU, 0xD7B77E9FU, 0x85E29EF7U, 0x486ECA42U,
+        0x6536DBD6U, 0xA8BA8F63U, 0xFAEF6F0BU, 0x37633BBEU, 0x5E44AFDBU, 0x93C8FB6EU, 0xC19D1B06U, 0x0C114FB3U,
+        0x13D233CCU, 0xDE5E6779U, 0x8C0B8711U, 0x4187D3A4U, 0x28A047C1U, 0xE52C1374U, 0xB779F31CU, 0x7AF5A7A9U,
+        0x88FF0BE2U, 0x45735F57U, 0x1726BF3FU, 0xDAAAEB8AU, 0xB38D7FEFU, 0x7E012B5AU, 0x2C54CB32U, 0xE1D89F87U,
+        0xFE1BE3F8U, 0x3397B74DU, 0x61C25725U, 0xAC4E0390U, 0xC56997F5U, 0x08E5C340U, 0x5AB02328U, 0x973C779DU,
+        0x7009D1A5U, 0xBD858510U, 0xEFD06578U, 0x225C31CDU, 0x4B7BA5A8U, 0x86F7F11DU, 0xD4A21175U, 0x192E45C0U,
+        0x06ED39BFU, 0xCB616D0AU, 0x99348D62U, 0x54B8D9D7U, 0x3D9F4DB2U, 0xF0131907U, 0xA246F96FU, 0x6FCAADDAU,
+        0x9DC00191U, 0x504C5524U, 0x0219B54CU, 0xCF95E1F9U, 0xA6B2759CU, 0x6B3E2129U, 0x396BC141U, 0xF4E795F4U,
+        0xEB24E98BU, 0x26A8BD3EU, 0x74FD5D56U, 0xB97109E3U, 0xD0569D86U, 0x1DDAC933U, 0x4F8F295BU, 0x82037DEEU,
+        0xAF5B6C7AU, 0x62D738CFU, 0x3082D8A7U, 0xFD0E8C12U, 0x94291877U, 0x59A54CC2U, 0x0BF0ACAAU, 0xC67CF81FU,
+        0xD9BF8460U, 0x1433D0D5U, 0x466630BDU, 0x8BEA6408U, 0xE2CDF06DU, 0x2F41A4D8U, 0x7D1444B0U, 0xB0981005U,
+        0x4292BC4EU, 0x8F1EE8FBU, 0xDD4B0893U, 0x10C75C26U, 0x79E0C843U, 0xB46C9CF6U, 0xE6397C9EU, 0x2BB5282BU,
+        0x34765454U, 0xF9FA00E1U, 0xABAFE089U, 0x6623B43CU, 0x0F042059U, 0xC28874ECU, 0x90DD9484U, 0x5D51C031U,
+        0xCA6DB7ACU, 0x07E1E319U, 0x55B40371U, 0x983857C4U, 0xF11FC3A1U, 0x3C939714U, 0x6EC6777CU, 0xA34A23C9U,
+        0xBC895FB6U, 0x71050B03U, 0x2350EB6BU, 0xEEDCBFDEU, 0x87FB2BBBU, 0x4A777F0EU, 0x18229F66U, 0xD5AECBD3U,
+        0x27A46798U, 0xEA28332DU, 0xB87DD345U, 0x75F187F0U, 0x1CD61395U, 0xD15A4720U, 0x830FA748U, 0x4E83F3FDU,
+        0x51408F82U, 0x9CCCDB37U, 0xCE993B5FU, 0x03156FEAU, 0x6A32FB8FU, 0xA7BEAF3AU, 0xF5EB4F52U, 0x38671BE7U,
+        0x153F0A73U, 0xD8B35EC6U, 0x8AE6BEAEU, 0x476AEA1BU, 0x2E4D7E7EU, 0xE3C12ACBU, 0xB194CAA3U, 0x7C189E16U,
+        0x63DBE269U, 0xAE57B6DCU, 0xFC0256B4U, 0x318E0201U, 0x58A99664U, 0x9525C2D1U, 0xC77022B9U, 0x0AFC760CU,
+        0xF8F6DA47U, 0x357A8EF2U, 0x672F6E9AU, 0xAAA33A2FU, 0xC384AE4AU, 0x0E08FAFFU, 0x5C5D1A97U, 0x91D14E22U,
+        0x8E12325DU, 0x439E66E8U, 0x11CB8680U, 0xDC47D235U, 0xB5604650U, 0x78EC12E5U, 0x2AB9F28DU, 0xE735A638U,
+    },
+    // x^256
+    {
+        0x00000000U, 0x75BE46B7U, 0xEB7C8D6EU, 0x9EC2CBD9U, 0xD238076BU, 0xA78641DCU, 0x39448A05U, 0x4CFACCB2U,
+        0xA0B11361U, 0xD50F55D6U, 0x4BCD9E0FU, 0x3E73D8B8U, 0x7289140AU, 0x073752BDU, 0x99F59964U, 0xEC4BDFD3U,
+        0x45A33B75U, 0x301D7DC2U, 0xAEDFB61BU, 0xDB61F0ACU, 0x979B3C1EU, 0xE2257AA9U, 0x7CE7B170U, 0x0959F7C7U,
+        0xE5122814U, 0x90AC6EA3U, 0x0E6EA57AU, 0x7BD0E3CDU, 0x372A2F7FU, 0x429469C8U, 0xDC56A211U, 0xA9E8E4A6U,
+        0x8B4676EAU, 0xFEF8305DU, 0x603AFB84U, 0x1584BD33U, 0x597E7181U, 0x2CC03736U, 0xB202FCEFU, 0xC7BCBA58U,
+        0x2BF7658BU, 0x5E49233CU, 0xC08BE8E5U, 0xB535AE52U, 0xF9CF62E0U, 0x8C712457U, 0x12B3EF8EU, 0x670DA939U,
+        0xCEE54D9FU, 0xBB5B0B28U, 0x2599C0F1U, 0x50278646U, 0x1CDD4AF4U, 0x69630C43U, 0xF7A1C79AU, 0x821F812DU,
+        0x6E545EFEU, 0x1BEA1849U, 0x8528D390U, 0xF0969527U, 0xBC6C5995U, 0xC9D21F22U, 0x5710D4FBU, 0x22AE924CU,
+        0x124DF063U, 0x67F3B6D4U, 0xF9317D0DU, 0x8C8F3BBAU, 0xC075F708U, 0xB5CBB1BFU, 0x2B097A66U, 0x5EB73CD1U,
+        0xB2FCE302U, 0xC742A5B5U, 0x59806E6CU, 0x2C3E28DBU, 0x60C4E469U, 0x157AA2DEU, 0x8BB86907U, 0xFE062FB0U,
+        0x57EECB16U, 0x22508DA1U, 0xBC924678U, 0xC92C00CFU, 0x85D6CC7DU, 0xF0688ACAU, 0x6EAA4113U, 0x1B1407A4U,
+        0xF75FD877U, 0x82E19EC0U, 0x1C235519U, 0x699D13AEU, 0x2567DF1CU, 0x50D999ABU, 0xCE1B5272U, 0xBBA514C5U,
+        0x990B8689U, 0xECB5C03EU, 0x72770BE7U, 0x07C94D50U, 0x4B3381E2U, 0x3E8DC755U, 0xA04F0C8CU, 0xD5F14A3BU,
+        0x39BA95E8U, 0x4C04D35FU, 0xD2C61886U, 0xA7785E31U, 0xEB829283U, 0x9E3CD434U, 0x00FE1FEDU, 0x7540595AU,
+        0xDCA8BDFCU, 0xA916FB4BU, 0x37D43092U, 0x426A7625U, 0x0E90BA97U, 0x7B2EFC20U, 0xE5EC37F9U, 0x9052714EU,
+        0x7C19AE9DU, 0x09A7E82AU, 0x976523F3U, 0xE2DB6544U, 0xAE21A9F6U, 0xDB9FEF41U, 0x455D2498U, 0x30E3622FU,
+        0x249BE0C6U, 0x5125A671U, 0xCFE76DA8U, 0xBA592B1FU, 0xF6A3E7ADU, 0x831DA11AU, 0x1DDF6AC3U, 0x68612C74U,
+        0x842AF3A7U, 0xF194B510U, 0x6F567EC9U, 0x1AE8387EU, 0x5612F4CCU, 0x23ACB27BU, 0xBD6E79A2U, 0xC8D03F15U,
+        0x6138DBB3U, 0x14869D04U, 0x8A4456DDU, 0xFFFA106AU, 0xB300DCD8U, 0xC6BE9A6FU, 0x587C51B6U, 0x2DC21701U,
+        0xC189C8D2U, 0xB4378E65U, 0x2AF545BCU, 0x5F4B030BU, 0x13B1CFB9U, 0x660F890EU, 0xF8CD42D7U, 0x8D730460U,
+        0xAFDD962CU, 0xDA63D09BU, 0x44A11B42U, 0x311F5DF5U, 0x7DE59147U, 0x085BD7F0U, 0x96991C29U, 0xE3275A9EU,
+        0x0F6C854DU, 0x7AD2C3FAU, 0xE4100823U, 0x91AE4E94U, 0xDD548226U, 0xA8EAC491U, 0x36280F48U, 0x439649FFU,
+        0xEA7EAD59U, 0x9FC0EBEEU, 0x01022037U, 0x74BC6680U, 0x3846AA32U, 0x4DF8EC85U, 0xD33A275CU, 0xA68461EBU,
+        0x4ACFBE38U, 0x3F71F88FU, 0xA1B33356U, 0xD40D75E1U, 0x98F7B953U, 0xED49FFE4U, 0x738B343DU, 0x0635728AU,
+        0x36D610A5U, 0x43685612U, 0xDDAA9DCBU, 0xA814DB7CU, 0xE4EE17CEU, 0x91505179U, 0x0F929AA0U, 0x7A2CDC17U,
+        0x966703C4U, 0xE3D94573U, 0x7D1B8EAAU, 0x08A5C81DU, 0x445F04AFU, 0x31E14218U, 0xAF2389C1U, 0xDA9DCF76U,
+        0x73752BD0U, 0x06CB6D67U, 0x9809A6BEU, 0xEDB7E009U, 0xA14D2CBBU, 0xD4F36A0CU, 0x4A31A1D5U, 0x3F8FE762U,
+        0xD3C438B1U, 0xA67A7E06U, 0x38B8B5DFU, 0x4D06F368U, 0x01FC3FDAU, 0x7442796DU, 0xEA80B2B4U, 0x9F3EF403U,
+        0xBD90664FU, 0xC82E20F8U, 0x56ECEB21U, 0x2352AD96U, 0x6FA86124U, 0x1A162793U, 0x84D4EC4AU, 0xF16AAAFDU,
+        0x1D21752EU, 0x689F3399U, 0xF65DF840U, 0x83E3BEF7U, 0xCF197245U, 0xBAA734F2U, 0x2465FF2BU, 0x51DBB99CU,
+        0xF8335D3AU, 0x8D8D1B8DU, 0x134FD054U, 0x66F196E3U, 0x2A0B5A51U, 0x5FB51CE6U, 0xC177D73FU, 0xB4C99188U,
+        0x58824E5BU, 0x2D3C08ECU, 0xB3FEC335U, 0xC6408582U, 0x8ABA4930U, 0xFF040F87U, 0x61C6C45EU, 0x147882E9U,
+    },
+    // x^264
+    {
+        0x00000000U, 0x4937C18CU, 0x926F8318U, 0xDB584294U, 0x201E1B87U, 0x6929DA0BU, 0xB271989FU, 0xFB465913U,
+        0x403C370EU, 0x090BF682U, 0xD253B416U, 0x9B64759AU, 0x60222C89U, 0x2915ED05U, 0xF24DAF91U, 0xBB7A6E1DU,
+        0x80786E1CU, 0xC94FAF90U, 0x1217ED04U, 0x5B202C88U, 0xA066759BU, 0xE951B417U, 0x3209F683U, 0x7B3E370FU,
+        0xC0445912U, 0x8973989EU, 0x522BDA0AU, 0x1B1C1B86U, 0xE05A4295U, 0xA96D8319U, 0x7235C18DU, 0x3B020001U,
+        0x0431C18FU, 0x4D060003U, 0x965E4297U, 0xDF69831BU, 0x242FDA08U, 0x6D181B84U, 0xB6405910U, 0xFF77989CU,
+        0x440DF681U, 0x0D3A370DU, 0xD6627599U, 0x9F55B415U, 0x6413ED06U, 0x2D242C8AU, 0xF67C6E1EU, 0xBF4BAF92U,
+        0x8449AF93U, 0xCD7E6E1FU, 0x16262C8BU, 0x5F11ED07U, 0xA457B414U, 0xED607598U, 0x3638370CU, 0x7F0FF680U,
+        0xC475989DU, 0x8D425911U, 0x561A1B85U, 0x1F2DDA09U, 0xE46B831AU, 0xAD5C4296U, 0x76040002U, 0x3F33C18EU,
+        0x0863831EU, 0x41544292U, 0x9A0C0006U, 0xD33BC18AU, 0x287D9899U, 0x614A5915U, 0xBA121B81U, 0xF325DA0DU,
+        0x485FB410U, 0x0168759CU, 0xDA303708U, 0x9307F684U, 0x6841AF97U, 0x21766E1BU, 0xFA2E2C8FU, 0xB319ED03U,
+        0x881BED02U, 0xC12C2C8EU, 0x1A746E1AU, 0x5343AF96U, 0xA805F685U, 0xE1323709U, 0x3A6A759DU, 0x735DB411U,
+        0xC827DA0CU, 0x81101B80U, 0x5A485914U, 0x137F9898U, 0xE839C18BU, 0xA10E0007U, 0x7A564293U, 0x3361831FU,
+        0x0C524291U, 0x4565831DU, 0x9E3DC189U, 0xD70A0005U, 0x2C4C5916U, 0x657B989AU, 0xBE23DA0EU, 0xF7141B82U,
+        0x4C6E759FU, 0x0559B413U, 0xDE01F687U, 0x9736370BU, 0x6C706E18U, 0x2547AF94U, 0xFE1FED00U, 0xB7282C8CU,
+        0x8C2A2C8DU, 0xC51DED01U, 0x1E45AF95U, 0x57726E19U, 0xAC34370AU, 0xE503F686U, 0x3E5BB412U, 0x776C759EU,
+        0xCC161B83U, 0x8521DA0FU, 0x5E79989BU, 0x174E5917U, 0xEC080004U, 0xA53FC188U, 0x7E67831CU, 0x37504290U,
+        0x10C7063CU, 0x59F0C7B0U, 0x82A88524U, 0xCB9F44A8U, 0x30D91DBBU, 0x79EEDC37U, 0xA2B69EA3U, 0xEB815F2FU,
+        0x50FB3132U, 0x19CCF0BEU, 0xC294B22AU, 0x8BA373A6U, 0x70E52AB5U, 0x39D2EB39U, 0xE28AA9ADU, 0xABBD6821U,
+        0x90BF6820U, 0xD988A9ACU, 0x02D0EB38U, 0x4BE72AB4U, 0xB0A173A7U, 0xF996B22BU, 0x22CEF0BFU, 0x6BF93133U,
+        0xD0835F2EU, 0x99B49EA2U, 0x42ECDC36U, 0x0BDB1DBAU, 0xF09D44A9U, 0xB9AA8525U, 0x62F2C7B1U, 0x2BC5063DU,
+        0x14F6C7B3U, 0x5DC1063FU, 0x869944ABU, 0xCFAE8527U, 0x34E8DC34U, 0x7DDF1DB8U, 0xA6875F2CU, 0xEFB09EA0U,
+        0x54CAF0BDU, 0x1DFD3131U, 0xC6A573A5U, 0x8F92B229U, 0x74D4EB3AU, 0x3DE32AB6U, 0xE6BB6822U, 0xAF8CA9AEU,
+        0x948EA9AFU, 0xDDB96823U, 0x06E12AB7U, 0x4FD6EB3BU, 0xB490B228U, 0xFDA773A4U, 0x26FF3130U, 0x6FC8F0BCU,
+        0xD4B29EA1U, 0x9D855F2DU, 0x46DD1DB9U, 0x0FEADC35U, 0xF4AC8526U, 0xBD9B44AAU, 0x66C3063EU, 0x2FF4C7B2U,
+        0x18A48522U, 0x519344AEU, 0x8ACB063AU, 0xC3FCC7B6U, 0x38BA9EA5U, 0x718D5F29U, 0xAAD51DBDU, 0xE3E2DC31U,
+        0x5898B22CU, 0x11AF73A0U, 0xCAF73134U, 0x83C0F0B8U, 0x7886A9ABU, 0x31B16827U, 0xEAE92AB3U, 0xA3DEEB3FU,
+        0x98DCEB3EU, 0xD1EB2AB2U, 0x0AB36826U, 0x4384A9AAU, 0xB8C2F0B9U, 0xF1F53135U, 0x2AAD73A1U, 0x639AB22DU,
+        0xD8E0DC30U, 0x91D71DBCU, 0x4A8F5F28U, 0x03B89EA4U, 0xF8FEC7B7U, 0xB1C9063BU, 0x6A9144AFU, 0x23A68523U,
+        0x1C9544ADU, 0x55A28521U, 0x8EFAC7B5U, 0xC7CD0639U, 0x3C8B5F2AU, 0x75BC9EA6U, 0xAEE4DC32U, 0xE7D31DBEU,
+        0x5CA973A3U, 0x159EB22FU, 0xCEC6F0BBU, 0x87F13137U, 0x7CB76824U, 0x3580A9A8U, 0xEED8EB3CU, 0xA7EF2AB0U,
+        0x9CED2AB1U, 0xD5DAEB3DU, 0x0E82A9A9U, 0x47B56825U, 0xBCF33136U, 0xF5C4F0BAU, 0x2E9CB22EU, 0x67AB73A2U,
+        0xDCD11DBFU, 0x95E6DC33U, 0x4EBE9EA7U, 0x07895F2BU, 0xFCCF0638U, 0xB5F8C7B4U, 0x6EA08520U, 0x279744ACU,
+    },
+    // x^272
+    {
+        0x00000000U, 0x218E0C78U, 0x431C18F0U, 0x62921488U, 0x863831E0U, 0xA7B63D98U, 0xC5242910U, 0xE4AA2568U,
+        0x08B17E77U, 0x293F720FU, 0x4BAD6687U, 0x6A236AFFU, 0x8E894F97U, 0xAF0743EFU, 0xCD955767U, 0xEC1B5B1FU,
+        0x1162FCEEU, 0x30ECF096U, 0x527EE41EU, 0x73F0E866U, 0x975ACD0EU, 0xB6D4C176U, 0xD446D5FEU, 0xF5C8D986U,
+        0x19D38299U, 0x385D8EE1U, 0x5ACF9A69U, 0x7B419611U, 0x9FEBB379U, 0xBE65BF01U, 0xDCF7AB89U, 0xFD79A7F1U,
+        0x22C5F9DCU, 0x034BF5A4U, 0x61D9E12CU, 0x4057ED54U, 0xA4FDC83CU, 0x8573C444U, 0xE7E1D0CCU, 0xC66FDCB4U,
+        0x2A7487ABU, 0x0BFA8BD3U, 0x69689F5BU, 0x48E69323U, 0xAC4CB64BU, 0x8DC2BA33U, 0xEF50AEBBU, 0xCEDEA2C3U,
+        0x33A70532U, 0x1229094AU, 0x70BB1DC2U, 0x513511BAU, 0xB59F34D2U, 0x941138AAU, 0xF6832C22U, 0xD70D205AU,
+        0x3B167B45U, 0x1A98773DU, 0x780A63B5U, 0x59846FCDU, 0xBD2E4AA5U, 0x9CA046DDU, 0xFE325255U, 0xDFBC5E2DU,
+        0x458BF3B8U, 0x6405FFC0U, 0x0697EB48U, 0x2719E730U, 0xC3B3C258U, 0xE23DCE20U, 0x80AFDAA8U, 0xA121D6D0U,
+        0x4D3A8DCFU, 0x6CB481B7U, 0x0E26953FU, 0x2FA89947U, 0xCB02BC2FU, 0xEA8CB057U, 0x881EA4DFU, 0xA990A8A7U,
+        0x54E90F56U, 0x7567032EU, 0x17F517A6U, 0x367B1BDEU, 0xD2D13EB6U, 0xF35F32CEU, 0x91CD2646U, 0xB0432A3EU,
+        0x5C587121U, 0x7DD67D59U, 0x1F4469D1U, 0x3ECA65A9U, 0xDA6040C1U, 0xFBEE4CB9U, 0x997C5831U, 0xB8F25449U,
+        0x674E0A64U, 0x46C0061CU, 0x24521294U, 0x05DC1EECU, 0xE1763B84U, 0xC0F837FCU, 0xA26A2374U, 0x83E42F0CU,
+        0x6FFF7413U, 0x4E71786BU, 0x2CE36CE3U, 0x0D6D609BU, 0xE9C745F3U, 0xC849498BU, 0xAADB5D03U, 0x8B55517BU,
+        0x762CF68AU, 0x57A2FAF2U, 0x3530EE7AU, 0x14BEE202U, 0xF014C76AU, 0xD19ACB12U, 0xB308DF9AU, 0x9286D3E2U,
+        0x7E9D88FDU, 0x5F138485U, 0x3D81900DU, 0x1C0F9C75U, 0xF8A5B91DU, 0xD92BB565U, 0xBBB9A1EDU, 0x9A37AD95U,
+        0x8B17E770U, 0xAA99EB08U, 0xC80BFF80U, 0xE985F3F8U, 0x0D2FD690U, 0x2CA1DAE8U, 0x4E33CE60U, 0x6FBDC218U,
+        0x83A69907U, 0xA228957FU, 0xC0BA81F7U, 0xE1348D8FU, 0x059EA8E7U, 0x2410A49FU, 0x4682B017U, 0x670CBC6FU,
+        0x9A751B9EU, 0xBBFB17E6U, 0xD969036EU, 0xF8E70F16U, 0x1C4D2A7EU, 0x3DC32606U, 0x5F51328EU, 0x7EDF3EF6U,
+        0x92C465E9U, 0xB34A6991U, 0xD1D87D19U, 0xF0567161U, 0x14FC5409U, 0x35725871U, 0x57E04CF9U, 0x766E4081U,
+        0xA9D21EACU, 0x885C12D4U, 0xEACE065CU, 0xCB400A24U, 0x2FEA2F4CU, 0x0E642334U, 0x6CF637BCU, 0x4D783BC4U,
+        0xA16360DBU, 0x80ED6CA3U, 0xE27F782BU, 0xC3F17453U, 0x275B513BU, 0x06D55D43U, 0x644749CBU, 0x45C945B3U,
+        0xB8B0E242U, 0x993EEE3AU, 0xFBACFAB2U, 0xDA22F6CAU, 0x3E88D3A2U, 0x1F06DFDAU, 0x7D94CB52U, 0x5C1AC72AU,
+        0xB0019C35U, 0x918F904DU, 0xF31D84C5U, 0xD29388BDU, 0x3639ADD5U, 0x17B7A1ADU, 0x7525B525U, 0x54ABB95DU,
+        0xCE9C14C8U, 0xEF1218B0U, 0x8D800C38U, 0xAC0E0040U, 0x48A42528U, 0x692A2950U, 0x0BB83DD8U, 0x2A3631A0U,
+        0xC62D6ABFU, 0xE7A366C7U, 0x8531724FU, 0xA4BF7E37U, 0x40155B5FU, 0x619B5727U, 0x030943AFU, 0x22874FD7U,
+        0xDFFEE826U, 0xFE70E45EU, 0x9CE2F0D6U, 0xBD6CFCAEU, 0x59C6D9C6U, 0x7848D5BEU, 0x1ADAC136U, 0x3B54CD4EU,
+        0xD74F9651U, 0xF6C19A29U, 0x94538EA1U, 0xB5DD82D9U, 0x5177A7B1U, 0x70F9ABC9U, 0x126BBF41U, 0x33E5B339U,
+        0xEC59ED14U, 0xCDD7E16CU, 0xAF45F5E4U, 0x8ECBF99CU, 0x6A61DCF4U, 0x4BEFD08CU, 0x297DC404U, 0x08F3C87CU,
+        0xE4E89363U, 0xC5669F1BU, 0xA7F48B93U, 0x867A87EBU, 0x62D0A283U, 0x435EAEFBU, 0x21CCBA73U, 0x0042B60BU,
+        0xFD3B11FAU, 0xDCB51D82U, 0xBE27090AU, 0x9FA90572U, 0x7B03201AU, 0x5A8D2C62U, 0x381F38EAU, 0x19913492U,
+        0xF58A6F8DU, 0xD40463F5U, 0xB696777DU, 0x97187B05U, 0x73B25E6DU, 0x523C5215U, 0x30AE469DU, 0x11204AE5U,
+    },
+    // x^280
+    {
+        0x00000000U, 0x12EED357U, 0x25DDA6AEU, 0x373375F9U, 0x4BBB4D5CU, 0x59559E0BU, 0x6E66EBF2U, 0x7C8838A5U,
+        0x97769AB8U, 0x859849EFU, 0xB2AB3C16U, 0xA045EF41U, 0xDCCDD7E4U, 0xCE2304B3U, 0xF910714AU, 0xEBFEA21DU,
+        0x2A2C28C7U, 0x38C2FB90U, 0x0FF18E69U, 0x1D1F5D3EU, 0x6197659BU, 0x7379B6CCU, 0x444AC335U, 0x56A41062U,
+        0xBD5AB27FU, 0xAFB46128U, 0x988714D1U, 0x8A69C786U, 0xF6E1FF23U, 0xE40F2C74U, 0xD33C598DU, 0xC1D28ADAU,
+        0x5458518EU, 0x46B682D9U, 0x7185F720U, 0x636B2477U, 0x1FE31CD2U, 0x0D0DCF85U, 0x3A3EBA7CU, 0x28D0692BU,
+        0xC32ECB36U, 0xD1C01861U, 0xE6F36D98U, 0xF41DBECFU, 0x8895866AU, 0x9A7B553DU, 0xAD4820C4U, 0xBFA6F393U,
+        0x7E747949U, 0x6C9AAA1EU, 0x5BA9DFE7U, 0x49470CB0U, 0x35CF3415U, 0x2721E742U, 0x101292BBU, 0x02FC41ECU,
+        0xE902E3F1U, 0xFBEC30A6U, 0xCCDF455FU, 0xDE319608U, 0xA2B9AEADU, 0xB0577DFAU, 0x87640803U, 0x958ADB54U,
+        0xA8B0A31CU, 0xBA5E704BU, 0x8D6D05B2U, 0x9F83D6E5U, 0xE30BEE40U, 0xF1E53D17U, 0xC6D648EEU, 0xD4389BB9U,
+        0x3FC639A4U, 0x2D28EAF3U, 0x1A1B9F0AU, 0x08F54C5DU, 0x747D74F8U, 0x6693A7AFU, 0x51A0D256U, 0x434E0101U,
+        0x829C8BDBU, 0x9072588CU, 0xA7412D75U, 0xB5AFFE22U, 0xC927C687U, 0xDBC915D0U, 0xECFA6029U, 0xFE14B37EU,
+        0x15EA1163U, 0x0704C234U, 0x3037B7CDU, 0x22D9649AU, 0x5E515C3FU, 0x4CBF8F68U, 0x7B8CFA91U, 0x696229C6U,
+        0xFCE8F292U, 0xEE0621C5U, 0xD935543CU, 0xCBDB876BU, 0xB753BFCEU, 0xA5BD6C99U, 0x928E1960U, 0x8060CA37U,
+        0x6B9E682AU, 0x7970BB7DU, 0x4E43CE84U, 0x5CAD1DD3U, 0x20252576U, 0x32CBF621U, 0x05F883D8U, 0x1716508FU,
+        0xD6C4DA55U, 0xC42A0902U, 0xF3197CFBU, 0xE1F7AFACU, 0x9D7F9709U, 0x8F91445EU, 0xB8A231A7U, 0xAA4CE2F0U,
+        0x41B240EDU, 0x535C93BAU, 0x646FE643U, 0x76813514U, 0x0A090DB1U, 0x18E7DEE6U, 0x2FD4AB1FU, 0x3D3A7848U,
+        0x55A05B8FU, 0x474E88D8U, 0x707DFD21U, 0x62932E76U, 0x1E1B16D3U, 0x0CF5C584U, 0x3BC6B07DU, 0x2928632AU,
+        0xC2D6C137U, 0xD0381260U, 0xE70B6799U, 0xF5E5B4CEU, 0x896D8C6BU, 0x9B835F3CU, 0xACB02AC5U, 0xBE5EF992U,
+        0x7F8C7348U, 0x6D62A01FU, 0x5A51D5E6U, 0x48BF06B1U, 0x34373E14U, 0x26D9ED43U, 0x11EA98BAU, 0x03044BEDU,
+        0xE8FAE9F0U, 0xFA143AA7U, 0xCD274F5EU, 0xDFC99C09U, 0xA341A4ACU, 0xB1AF77FBU, 0x869C0202U, 0x9472D155U,
+        0x01F80A01U, 0x1316D956U, 0x2425ACAFU, 0x36CB7FF8U, 0x4A43475DU, 0x58AD940AU, 0x6F9EE1F3U, 0x7D7032A4U,
+        0x968E90B9U, 0x846043EEU, 0xB3533617U, 0xA1BDE540U, 0xDD35DDE5U, 0xCFDB0EB2U, 0xF8E87B4BU, 0xEA06A81CU,
+        0x2BD422C6U, 0x393AF191U, 0x0E098468U, 0x1CE7573FU, 0x606F6F9AU, 0x7281BCCDU, 0x45B2C934U, 0x575C1A63U,
+        0xBCA2B87EU, 0xAE4C6B29U, 0x997F1ED0U, 0x8B91CD87U, 0xF719F522U, 0xE5F72675U, 0xD2C4538CU, 0xC02A80DBU,
+        0xFD10F893U, 0xEFFE2BC4U, 0xD8CD5E3DU, 0xCA238D6AU, 0xB6ABB5CFU, 0xA4456698U, 0x93761361U, 0x8198C036U,
+        0x6A66622BU, 0x7888B17CU, 0x4FBBC485U, 0x5D5517D2U, 0x21DD2F77U, 0x3333FC20U, 0x040089D9U, 0x16EE5A8EU,
+        0xD73CD054U, 0xC5D20303U, 0xF2E176FAU, 0xE00FA5ADU, 0x9C879D08U, 0x8E694E5FU, 0xB95A3BA6U, 0xABB4E8F1U,
+        0x404A4AECU, 0x52A499BBU, 0x6597EC42U, 0x77793F15U, 0x0BF107B0U, 0x191FD4E7U, 0x2E2CA11EU, 0x3CC27249U,
+        0xA948A91DU, 0xBBA67A4AU, 0x8C950FB3U, 0x9E7BDCE4U, 0xE2F3E441U, 0xF01D3716U, 0xC72E42EFU, 0xD5C091B8U,
+        0x3E3E33A5U, 0x2CD0E0F2U, 0x1BE3950BU, 0x090D465CU, 0x75857EF9U, 0x676BADAEU, 0x5058D857U, 0x42B60B00U,
+        0x836481DAU, 0x918A528DU, 0xA6B92774U, 0xB457F423U, 0xC8DFCC86U, 0xDA311FD1U, 0xED026A28U, 0xFFECB97FU,
+        0x14121B62U, 0x06FCC835U, 0x31CFBDCCU, 0x23216E9BU, 0x5FA9563EU, 0x4D478569U, 0x7A74F090U, 0x689A23C7U,
+    },
+    };
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+#if     ( BOOT_CRC32_ENGINE_SLICE4 == BOOT_CFG_CRC32_ENGINE ) \
+    ||  ( BOOT_CRC32_ENGINE_SLICE8 == BOOT_CFG_CRC32_ENGINE )
+    static inline uint32_t boot_crc32_byte(const uint32_t crc, const uint8_t data);
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+#if     ( BOOT_CRC32_ENGINE_SLICE4 == BOOT_CFG_CRC32_ENGINE ) \
+    ||  ( BOOT_CRC32_ENGINE_SLICE8 == BOOT_CFG_CRC32_ENGINE )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Calculate CRC-32 of single byte using "x^32" table
+    *
+    * @note     Used for tail bytes that do not fill up complete slice.
+    *
+    * @param[in]    crc     - Current CRC value
+    * @param[in]    data    - Input byte
+    * @return       crc     - Updated CRC value
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static inline uint32_t boot_crc32_byte(const uint32_t crc, const uint8_t data)
+    {
+        uint32_t crc32 = ( crc ^ data );
+
+        crc32 = (( crc32 << 8U ) ^ gu32_crc32_table[0][ crc32 >> 24U ]);
+        crc32 = (( crc32 << 8U ) ^ gu32_crc32_table[0][ crc32 >> 24U ]);
+        crc32 = (( crc32 << 8U ) ^ gu32_crc32_table[0][ crc32 >> 24U ]);
+        crc32 = (( crc32 << 8U ) ^ gu32_crc32_table[0][ crc32 >> 24U ]);
+
+        return crc32;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_CRC_API
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of Bootloader CRC engine API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Calculate CRC-8
+*
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of data in bytes
+* @return       crc8    - Calculated CRC
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint8_t boot_crc8_calc(const uint8_t * const p_data, const uint32_t size)
+{
+    uint8_t crc8 = BOOT_CRC8_SEED;
+
+    BOOT_ASSERT(( NULL != p_data ) || ( 0U == size ));
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        crc8 = gu8_crc8_table[ crc8 ^ p_data[i] ];
+    }
+
+    return crc8;
+}
+
+#if ( 1 == BOOT_CFG_COM_FRAME_CRC_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get starting value of frame CRC-16
+    *
+    * @return       crc - Initial CRC value (seed)
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    uint16_t boot_crc16_init(void)
+    {
+        return BOOT_CRC16_SEED;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Update frame CRC-16 with new data
+    *
+    * @param[in]    crc     - Current CRC value
+    * @param[in]    p_data  - Pointer to data
+    * @param[in]    size    - Size of data in bytes
+    * @return       crc     - Updated CRC value
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    uint16_t boot_crc16_update(const uint16_t crc, const uint8_t * const p_data, const uint32_t size)
+    {
+        uint16_t crc16 = crc;
+
+        BOOT_ASSERT(( NULL != p_data ) || ( 0U == size ));
+
+        for (uint32_t i = 0; i < size; i++)
+        {
+            crc16 = (uint16_t)(( crc16 << 8U ) ^ gu16_crc16_table[(( crc16 >> 8U ) ^ p_data[i] ) & 0xFFU ]);
+        }
+
+        return crc16;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get starting value of image CRC-32
+*
+* @return       crc - Initial CRC value (seed)
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t boot_crc32_init(void)
+{
+    return BOOT_CRC32_SEED;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Update image CRC-32 with new data
+*
+* @note     Calculation can be split into multiple calls. CRC of complete
+*           image is the same as if all data would be given at once.
+*
+* @param[in]    crc     - Current CRC value
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of data in bytes
+* @return       crc     - Updated CRC value
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t boot_crc32_update(const uint32_t crc, const uint8_t * const p_data, const uint32_t size)
+{
+    uint32_t crc32 = crc;
+
+    BOOT_ASSERT(( NULL != p_data ) || ( 0U == size ));
+
+#if ( BOOT_CRC32_ENGINE_BITWISE == BOOT_CFG_CRC32_ENGINE )
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        crc32 = ( crc32 ^ p_data[i] );
+
+        for (uint8_t j = 0U; j < 32U; j++)
+        {
+            if ( crc32 & 0x80000000U )
+            {
+                crc32 = (( crc32 << 1U ) ^ BOOT_CRC32_POLY );
+            }
+            else
+            {
+                crc32 = ( crc32 << 1U );
+            }
+        }
+    }
+
+#elif ( BOOT_CRC32_ENGINE_NIBBLE == BOOT_CFG_CRC32_ENGINE )
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        crc32 = ( crc32 ^ p_data[i] );
+
+        // 8 nibbles = 32 shifts
+        for (uint8_t j = 0U; j < 8U; j++)
+        {
+            crc32 = (( crc32 << 4U ) ^ gu32_crc32_table[ crc32 >> 28U ]);
+        }
+    }
+
+#elif ( BOOT_CRC32_ENGINE_SLICE4 == BOOT_CFG_CRC32_ENGINE )
+
+    uint32_t i = 0U;
+
+    // Four bytes per step
+    for (; ( size - i ) >= 4U; i += 4U )
+    {
+        const uint32_t v = ( crc32 ^ p_data[i] );
+
+        crc32 =     gu32_crc32_table[3][ v & 0xFFU ]
+                ^   gu32_crc32_table[4][( v >> 8U ) & 0xFFU ]
+                ^   gu32_crc32_table[5][( v >> 16U ) & 0xFFU ]
+                ^   gu32_crc32_table[6][ v >> 24U ]
+                ^   gu32_crc32_table[2][ p_data[i+1U] ]
+                ^   gu32_crc32_table[1][ p_data[i+2U] ]
+                ^   gu32_crc32_table[0][ p_data[i+3U] ];
+    }
+
+    // Tail
+    for (; i < size; i++ )
+    {
+        crc32 = boot_crc32_byte( crc32, p_data[i] );
+    }
+
+#elif ( BOOT_CRC32_ENGINE_SLICE8 == BOOT_CFG_CRC32_ENGINE )
+
+    uint32_t i = 0U;
+
+    // Eight bytes per step
+    for (; ( size - i ) >= 8U; i += 8U )
+    {
+        const uint32_t v = ( crc32 ^ p_data[i] );
+
+        crc32 =     gu32_crc32_table[7][ v & 0xFFU ]
+                ^   gu32_crc32_table[8][( v >> 8U ) & 0xFFU ]
+                ^   gu32_crc32_table[9][( v >> 16U ) & 0xFFU ]
+                ^   gu32_crc32_table[10][ v >> 24U ]
+                ^   gu32_crc32_table[6][ p_data[i+1U] ]
+                ^   gu32_crc32_table[5][ p_data[i+2U] ]
+                ^   gu32_crc32_table[4][ p_data[i+3U] ]
+                ^   gu32_crc32_table[3][ p_data[i+4U] ]
+                ^   gu32_crc32_table[2][ p_data[i+5U] ]
+                ^   gu32_crc32_table[1][ p_data[i+6U] ]
+                ^   gu32_crc32_table[0][ p_data[i+7U] ];
+    }
+
+    // Tail
+    for (; i < size; i++ )
+    {
+        crc32 = boot_crc32_byte( crc32, p_data[i] );
+    }
+
+#elif ( BOOT_CRC32_ENGINE_HW == BOOT_CFG_CRC32_ENGINE )
+
+    // Calculate with CRC peripheral
+    crc32 = boot_if_crc32_hw( crc32, p_data, size );
+
+#endif
+
+    return crc32;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
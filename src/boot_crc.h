@@ -0,0 +1,56 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_crc.h
+*@brief     Bootloader CRC engine
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_CRC_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __BOOT_CRC_H
+#define __BOOT_CRC_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../../boot_cfg.h"
+#include "boot_types.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+uint8_t  boot_crc8_calc     (const uint8_t * const p_data, const uint32_t size);
+uint32_t boot_crc32_init    (void);
+uint32_t boot_crc32_update  (const uint32_t crc, const uint8_t * const p_data, const uint32_t size);
+
+#if ( 1 == BOOT_CFG_COM_FRAME_CRC_EN )
+    uint16_t boot_crc16_init    (void);
+    uint16_t boot_crc16_update  (const uint16_t crc, const uint8_t * const p_data, const uint32_t size);
+#endif
+
+#endif // __BOOT_CRC_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,430 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_delta.c
+*@brief     Bootloader delta (differential) image patching
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup Bootloader delta image patching
+* @{ <!-- BEGIN GROUP -->
+*
+*   Delta image payload (shared with "app_sign_tool.py"), all fields little
+*   endian:
+*
+*       Delta header:   magic (u32), base header hash (32 bytes), base size (u32)
+*       Operations:
+*           COPY:       0x01, base offset (u32), length (u32)
+*           DATA:       0x02, length (u32), followed by length of new data
+*
+*   Patch is applied in a streaming fashion: data can be split at any point
+*   between calls and new image is output in order of operations, thus only
+*   state of current operation is kept in RAM. COPY reads base image (old
+*   application) from flash.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "boot_delta.h"
+#include "../../boot_cfg.h"
+#include "../../boot_if.h"
+
+#if ( 1 == BOOT_CFG_DELTA_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Delta header magic
+ */
+#define BOOT_DELTA_MAGIC                        ( 0xB00DE17AU )
+
+/**
+ *  Delta operations
+ */
+#define BOOT_DELTA_OP_COPY                      ( 0x01U )   /**<Copy from base image */
+#define BOOT_DELTA_OP_DATA                      ( 0x02U )   /**<New data */
+
+/**
+ *  Size of operations incl. operation code
+ */
+#define BOOT_DELTA_OP_COPY_SIZE                 ( 9U )
+#define BOOT_DELTA_OP_DATA_SIZE                 ( 5U )
+
+/**
+ *  Size of block read from base image at once
+ */
+#define BOOT_DELTA_COPY_CHUNK_SIZE              ( 256U )
+
+/**
+ *  Delta header
+ *
+ *  Sizeof: 40 bytes
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    uint32_t    magic;                                  /**<Delta header magic number */
+    uint8_t     base_hash[BOOT_DELTA_BASE_HASH_SIZE];   /**<SHA-256 of base application header */
+    uint32_t    base_size;                              /**<Base image size in bytes */
+} boot_delta_head_t;
+
+BOOT_CFG_STATIC_ASSERT( sizeof(boot_delta_head_t) == 40U );
+
+/**
+ *  Delta decoder states
+ */
+typedef enum
+{
+    eBOOT_DELTA_HEAD = 0,       /**<Receiving delta header */
+    eBOOT_DELTA_OP,             /**<Receiving operation */
+    eBOOT_DELTA_DATA,           /**<Receiving new data */
+    eBOOT_DELTA_ERROR,          /**<Malformed patch or wrong base */
+} boot_delta_state_t;
+
+/**
+ *  Delta decoder
+ */
+typedef struct
+{
+    uint8_t             buf[sizeof(boot_delta_head_t)];         /**<Header and operation assembly buffer */
+    uint8_t             base_hash[BOOT_DELTA_BASE_HASH_SIZE];   /**<Expected base header hash */
+    uint32_t            base_addr;                              /**<Base image address */
+    uint32_t            base_size;                              /**<Base image size in bytes */
+    uint32_t            remaining;                              /**<Remaining bytes of new data */
+    uint8_t             buf_cnt;                                /**<Number of bytes inside assembly buffer */
+    boot_delta_state_t  state;                                  /**<Decoder state */
+} boot_delta_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Delta decoder
+ */
+static boot_delta_t g_boot_delta = {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t         boot_delta_get_u32      (const uint8_t * const p_data);
+static uint8_t          boot_delta_needed       (void);
+static boot_status_t    boot_delta_head_check   (void);
+static boot_status_t    boot_delta_copy         (const uint32_t ofs, const uint32_t size, pf_boot_data_out_t pf_out, void * const p_ctx);
+static boot_status_t    boot_delta_op_exec      (pf_boot_data_out_t pf_out, void * const p_ctx);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get little endian 32-bit value
+*
+* @param[in]    p_data  - Pointer to (unaligned) data
+* @return       value   - Value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t boot_delta_get_u32(const uint8_t * const p_data)
+{
+    return  (   ((uint32_t) p_data[0] )
+            |   ((uint32_t) p_data[1] << 8U )
+            |   ((uint32_t) p_data[2] << 16U )
+            |   ((uint32_t) p_data[3] << 24U ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get number of bytes needed in assembly buffer
+*
+* @return       needed - Size of complete delta header or operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t boot_delta_needed(void)
+{
+    uint8_t needed = 1U;
+
+    if ( eBOOT_DELTA_HEAD == g_boot_delta.state )
+    {
+        needed = sizeof( boot_delta_head_t );
+    }
+
+    // Operation size known after operation code
+    else if ( g_boot_delta.buf_cnt > 0U )
+    {
+        if ( BOOT_DELTA_OP_COPY == g_boot_delta.buf[0] )
+        {
+            needed = BOOT_DELTA_OP_COPY_SIZE;
+        }
+        else if ( BOOT_DELTA_OP_DATA == g_boot_delta.buf[0] )
+        {
+            needed = BOOT_DELTA_OP_DATA_SIZE;
+        }
+        else
+        {
+            // Unknown operation -> handled at execution
+        }
+    }
+
+    else
+    {
+        // No actions...
+    }
+
+    return needed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check delta header
+*
+* @note     Patch must be made against installed (base) application!
+*
+* @return       status - Status of check
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_delta_head_check(void)
+{
+    boot_status_t                   status  = eBOOT_OK;
+    const boot_delta_head_t * const p_head  = (const boot_delta_head_t*) &g_boot_delta.buf;
+
+    if ( BOOT_DELTA_MAGIC != boot_delta_get_u32((const uint8_t*) &p_head->magic ))
+    {
+        status = eBOOT_ERROR;
+        BOOT_DBG_PRINT( "DELTA ERROR: Invalid delta header!" );
+    }
+    else if (   ( g_boot_delta.base_size != boot_delta_get_u32((const uint8_t*) &p_head->base_size ))
+            ||  ( 0 != memcmp( &p_head->base_hash, &g_boot_delta.base_hash, BOOT_DELTA_BASE_HASH_SIZE )))
+    {
+        status = eBOOT_ERROR;
+        BOOT_DBG_PRINT( "DELTA ERROR: Patch made for different base image!" );
+    }
+    else
+    {
+        // No actions...
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Copy block of base image to output
+*
+* @param[in]    ofs     - Offset inside base image
+* @param[in]    size    - Size of block in bytes
+* @param[in]    pf_out  - Output callback
+* @param[in]    p_ctx   - Output callback context
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_delta_copy(const uint32_t ofs, const uint32_t size, pf_boot_data_out_t pf_out, void * const p_ctx)
+{
+            boot_status_t   status                              = eBOOT_OK;
+    static  uint8_t         buf[BOOT_DELTA_COPY_CHUNK_SIZE]     = {0};
+
+    // Copy must stay inside base image
+    if  (   ( ofs > g_boot_delta.base_size )
+        ||  ( size > ( g_boot_delta.base_size - ofs )))
+    {
+        status = eBOOT_ERROR;
+        BOOT_DBG_PRINT( "DELTA ERROR: Copy outside of base image!" );
+    }
+
+    // Flash memory mapped -> zero copy
+    else if ( true == boot_if_flash_is_mapped(( g_boot_delta.base_addr + ofs ), size ))
+    {
+        status = pf_out((const uint8_t*)( g_boot_delta.base_addr + ofs ), size, p_ctx );
+    }
+
+    // Read block by block
+    else
+    {
+        for ( uint32_t i = 0U; ( i < size ) && ( eBOOT_OK == status ); i += BOOT_DELTA_COPY_CHUNK_SIZE )
+        {
+            const uint32_t block_size = ((( size - i ) > BOOT_DELTA_COPY_CHUNK_SIZE ) ? BOOT_DELTA_COPY_CHUNK_SIZE : ( size - i ));
+
+            status = boot_if_flash_read(( g_boot_delta.base_addr + ofs + i ), block_size, (uint8_t*) &buf );
+
+            if ( eBOOT_OK == status )
+            {
+                status = pf_out((const uint8_t*) &buf, block_size, p_ctx );
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Execute assembled operation
+*
+* @param[in]    pf_out  - Output callback
+* @param[in]    p_ctx   - Output callback context
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_delta_op_exec(pf_boot_data_out_t pf_out, void * const p_ctx)
+{
+    boot_status_t status = eBOOT_OK;
+
+    switch( g_boot_delta.buf[0] )
+    {
+        case BOOT_DELTA_OP_COPY:
+            status = boot_delta_copy( boot_delta_get_u32( &g_boot_delta.buf[1] ), boot_delta_get_u32( &g_boot_delta.buf[5] ), pf_out, p_ctx );
+            break;
+
+        case BOOT_DELTA_OP_DATA:
+            g_boot_delta.remaining = boot_delta_get_u32( &g_boot_delta.buf[1] );
+
+            if ( g_boot_delta.remaining > 0U )
+            {
+                g_boot_delta.state = eBOOT_DELTA_DATA;
+            }
+            break;
+
+        default:
+            status = eBOOT_ERROR;
+            BOOT_DBG_PRINT( "DELTA ERROR: Unknown operation 0x%02X!", g_boot_delta.buf[0] );
+            break;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_DELTA_API
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of Bootloader delta image patching API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize delta patching
+*
+* @param[in]    base_addr   - Address of base image (without header)
+* @param[in]    base_size   - Size of base image in bytes
+* @param[in]    p_base_hash - SHA-256 of base application header
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_delta_init(const uint32_t base_addr, const uint32_t base_size, const uint8_t * const p_base_hash)
+{
+    BOOT_ASSERT( NULL != p_base_hash );
+
+    memset( &g_boot_delta, 0U, sizeof( g_boot_delta ));
+    memcpy( &g_boot_delta.base_hash, p_base_hash, BOOT_DELTA_BASE_HASH_SIZE );
+
+    g_boot_delta.base_addr  = base_addr;
+    g_boot_delta.base_size  = base_size;
+    g_boot_delta.state      = eBOOT_DELTA_HEAD;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Apply next part of patch
+*
+* @note     Patch can be split at any point. New image data is handed to
+*           output callback in order, in blocks of arbitrary size.
+*
+* @param[in]    p_data  - Patch data
+* @param[in]    size    - Size of patch data in bytes
+* @param[in]    pf_out  - Output callback
+* @param[in]    p_ctx   - Output callback context
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_delta_apply(const uint8_t * const p_data, const uint32_t size, pf_boot_data_out_t pf_out, void * const p_ctx)
+{
+    boot_status_t   status  = eBOOT_OK;
+    uint32_t        i       = 0U;
+
+    BOOT_ASSERT( NULL != pf_out );
+
+    while (( i < size ) && ( eBOOT_OK == status ))
+    {
+        // Pass new data directly to output
+        if ( eBOOT_DELTA_DATA == g_boot_delta.state )
+        {
+            const uint32_t block_size = ((( size - i ) > g_boot_delta.remaining ) ? g_boot_delta.remaining : ( size - i ));
+
+            status = pf_out( &p_data[i], block_size, p_ctx );
+
+            i                       += block_size;
+            g_boot_delta.remaining  -= block_size;
+
+            if ( 0U == g_boot_delta.remaining )
+            {
+                g_boot_delta.state = eBOOT_DELTA_OP;
+            }
+        }
+
+        // Assemble delta header or operation
+        else if ( eBOOT_DELTA_ERROR != g_boot_delta.state )
+        {
+            g_boot_delta.buf[ g_boot_delta.buf_cnt ] = p_data[i];
+            g_boot_delta.buf_cnt++;
+            i++;
+
+            if ( g_boot_delta.buf_cnt >= boot_delta_needed())
+            {
+                if ( eBOOT_DELTA_HEAD == g_boot_delta.state )
+                {
+                    status = boot_delta_head_check();
+                    g_boot_delta.state = eBOOT_DELTA_OP;
+                }
+                else
+                {
+                    status = boot_delta_op_exec( pf_out, p_ctx );
+                }
+
+                g_boot_delta.buf_cnt = 0U;
+            }
+        }
+
+        // Previous error
+        else
+        {
+            status = eBOOT_ERROR;
+        }
+    }
+
+    if ( eBOOT_OK != status )
+    {
+        g_boot_delta.state = eBOOT_DELTA_ERROR;
+    }
+
+    return status;
+}
+
+#endif // ( 1 == BOOT_CFG_DELTA_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
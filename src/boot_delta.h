@@ -0,0 +1,57 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_delta.h
+*@brief     Bootloader delta (differential) image patching
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_DELTA_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __BOOT_DELTA_H
+#define __BOOT_DELTA_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../../boot_cfg.h"
+#include "boot_types.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Size of base image header hash (SHA-256)
+ */
+#define BOOT_DELTA_BASE_HASH_SIZE               ( 32U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+#if ( 1 == BOOT_CFG_DELTA_EN )
+    void            boot_delta_init     (const uint32_t base_addr, const uint32_t base_size, const uint8_t * const p_base_hash);
+    boot_status_t   boot_delta_apply    (const uint8_t * const p_data, const uint32_t size, pf_boot_data_out_t pf_out, void * const p_ctx);
+#endif
+
+#endif // __BOOT_DELTA_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1508 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_mngr.c
+*@brief     Boot Manager engine
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup Boot Manager engine
+* @{ <!-- BEGIN GROUP -->
+*
+*   Boot Manager side of upgrade, built on same framing code as bootloader
+*   (boot_com.c with "BOOT_CFG_COM_MANAGER_EN" enabled).
+*
+*   Each device has own session state machine and own communication
+*   channel (port). Single handler pass services all devices without
+*   blocking, thus many devices are upgraded concurrently from one event
+*   loop and station time is set by slowest device:
+*
+*       INFO -> CONNECT -> [SCAN] -> PREPARE -> FLASH -> [VERIFY] -> EXIT -> DONE
+*
+*   With sector skipping target slot is scanned first, sectors holding
+*   same data as new image are kept and their data is not sent.
+*
+*   Sequenced flash data frames are pipelined up to window reported by
+*   bootloader. Acknowledges are cumulative, missing frames are resent
+*   from first unacknowledged one (go-back-N). Bootloaders without window
+*   are served stop-and-wait.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "boot_mngr.h"
+#include "boot_com.h"
+#include "boot_crc.h"
+#include "../../boot_cfg.h"
+
+#if ( 1 == BOOT_CFG_COM_MANAGER_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Lowest protocol versions of bootloader features
+ */
+#define BOOT_MNGR_PROTO_VER_SEQ                 ( 2U )  /**<Sequenced flash data */
+#define BOOT_MNGR_PROTO_VER_PAYLOAD             ( 4U )  /**<Payload size negotiation */
+#define BOOT_MNGR_PROTO_VER_CRC                 ( 5U )  /**<Frame check negotiation */
+#define BOOT_MNGR_PROTO_VER_VERIFY              ( 7U )  /**<Verify commands */
+#define BOOT_MNGR_PROTO_VER_SKIP                ( 8U )  /**<Prepare skip command */
+#define BOOT_MNGR_PROTO_VER_VERIFY_OPT          ( 10U ) /**<Verify commands optional, whole sectors only */
+
+/**
+ *  Maximum number of frames parsed per device in single handler pass
+ */
+#define BOOT_MNGR_RX_FRAMES_MAX                 ( BOOT_CFG_MNGR_WINDOW_MAX + 2U )
+
+/**
+ *  No missing frame reported
+ */
+#define BOOT_MNGR_NAK_NONE                      ( UINT32_MAX )
+
+#if ( 1 == BOOT_CFG_MNGR_SKIP_EN )
+
+    /**
+     *  Maximum number of runs of equally sized sectors in image space
+     *
+     *  @note   Sector sizes are run-length coded, image space of more runs
+     *          is programmed completely.
+     */
+    #define BOOT_MNGR_SECTORS_MAX               ( 8U )
+
+    /**
+     *  Number of tracked frame offsets, frames in flight and next one
+     */
+    #define BOOT_MNGR_FRAME_OFS_NUM_OF          ( BOOT_CFG_MNGR_WINDOW_MAX + 1U )
+
+    /**
+     *  Run of equally sized sectors
+     */
+    typedef struct
+    {
+        uint32_t    size;       /**<Sector size within image in bytes */
+        uint32_t    num_of;     /**<Number of sectors */
+    } boot_mngr_sectors_t;
+
+#endif
+
+/**
+ *  Window shall fit into 8-bit statistics field
+ */
+BOOT_CFG_STATIC_ASSERT( BOOT_CFG_MNGR_WINDOW_MAX <= 255U );
+
+/**
+ *  Device channel index shall fit into 8-bit
+ */
+BOOT_CFG_STATIC_ASSERT(( BOOT_CFG_MNGR_DEV_NUM_OF > 0U ) && ( BOOT_CFG_MNGR_DEV_NUM_OF <= 255U ));
+
+/**
+ *  Device upgrade session
+ */
+typedef struct
+{
+    const ver_image_header_t *  p_head;         /**<Image header */
+    const uint8_t *             p_data;         /**<Image data (following header) */
+    boot_mngr_stats_t           stats;          /**<Session statistics */
+    boot_mngr_state_t           state;          /**<Session state */
+    bool                        req_pend;       /**<Request sent, waiting for response */
+    uint8_t                     retry;          /**<Retries without progress */
+    uint8_t                     proto_ver;      /**<Bootloader protocol version */
+    uint16_t                    payload_max;    /**<Bootloader maximum payload size, 0 - unknown */
+    uint32_t                    start_ts;       /**<Session start timestamp */
+    uint32_t                    req_ts;         /**<Timestamp of request or last acknowledge progress */
+    uint32_t                    flash_ts;       /**<Flash data phase start timestamp */
+    uint32_t                    frames;         /**<Number of flash data frames of image */
+    uint32_t                    base;           /**<First unacknowledged frame */
+    uint32_t                    next;           /**<Next frame to send */
+    uint32_t                    top;            /**<Frames sent at least once */
+    uint32_t                    nak;            /**<Frame already resent on missing frame report */
+    uint32_t                    verify_ofs;     /**<Image offset verified (scanned) so far */
+    uint8_t                     features;       /**<Bootloader optional features */
+
+    #if ( 1 == BOOT_CFG_MNGR_SKIP_EN )
+        bool                    is_skip;                                /**<Unchanged sectors are skipped */
+        uint8_t                 skip_map[BOOT_SKIP_MAP_SIZE];           /**<Sectors to program, bit per sector from image header sector on */
+        boot_mngr_sectors_t     sectors[BOOT_MNGR_SECTORS_MAX];         /**<Scanned sector sizes */
+        uint8_t                 sectors_num_of;                         /**<Number of sector runs */
+        uint32_t                sector;                                 /**<Number of scanned sectors */
+        uint32_t                frame_ofs[BOOT_MNGR_FRAME_OFS_NUM_OF];  /**<Image offsets of frames from first unacknowledged one on */
+    #endif
+} boot_mngr_dev_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Device sessions
+ */
+static boot_mngr_dev_t g_mngr_dev[BOOT_CFG_MNGR_DEV_NUM_OF] = {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static boot_mngr_dev_t *    boot_mngr_get_dev       (void);
+static bool                 boot_mngr_dev_is_busy   (const boot_mngr_dev_t * const p_dev);
+static void                 boot_mngr_set_state     (boot_mngr_dev_t * const p_dev, const boot_mngr_state_t state);
+static void                 boot_mngr_fail          (boot_mngr_dev_t * const p_dev, const boot_msg_status_t msg_status);
+static void                 boot_mngr_ack           (boot_mngr_dev_t * const p_dev, const uint32_t ack);
+static bool                 boot_mngr_image_is_plain(const ver_image_header_t * const p_head);
+static uint32_t             boot_mngr_crc32_pad     (const uint32_t crc32, const uint32_t size);
+static uint32_t             boot_mngr_sector_crc32  (const boot_mngr_dev_t * const p_dev, const uint32_t ofs, const uint32_t size);
+#if ( 1 == BOOT_CFG_MNGR_SKIP_EN )
+    static bool             boot_mngr_skip_is_prog  (const boot_mngr_dev_t * const p_dev, const uint32_t sector);
+    static uint32_t         boot_mngr_skip_next     (const boot_mngr_dev_t * const p_dev, const uint32_t ofs, uint32_t * const p_end);
+    static void             boot_mngr_skip_frames   (boot_mngr_dev_t * const p_dev);
+    static void             boot_mngr_skip_scan     (boot_mngr_dev_t * const p_dev, const boot_verify_sectors_rsp_t * const p_rsp, const boot_msg_status_t msg_status);
+#endif
+static void                 boot_mngr_frame_get     (boot_mngr_dev_t * const p_dev, const uint32_t n, uint32_t * const p_ofs, uint16_t * const p_len);
+static boot_status_t        boot_mngr_req_send      (boot_mngr_dev_t * const p_dev);
+static void                 boot_mngr_req_hndl      (boot_mngr_dev_t * const p_dev);
+static void                 boot_mngr_flash_hndl    (boot_mngr_dev_t * const p_dev);
+static void                 boot_mngr_dev_hndl      (boot_mngr_dev_t * const p_dev);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get session of device on selected communication channel
+*
+* @return       p_dev - Device session
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_mngr_dev_t * boot_mngr_get_dev(void)
+{
+    return &g_mngr_dev[ boot_com_get_ch() ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if device session is ongoing
+*
+* @param[in]    p_dev   - Device session
+* @return       busy    - True if session is ongoing
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_mngr_dev_is_busy(const boot_mngr_dev_t * const p_dev)
+{
+    return  (   ( eBOOT_MNGR_STATE_IDLE  != p_dev->state )
+            &&  ( eBOOT_MNGR_STATE_DONE  != p_dev->state )
+            &&  ( eBOOT_MNGR_STATE_ERROR != p_dev->state ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Enter session state
+*
+* @note     Request of new state is sent at next handler pass.
+*
+* @param[in]    p_dev   - Device session
+* @param[in]    state   - New state
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_mngr_set_state(boot_mngr_dev_t * const p_dev, const boot_mngr_state_t state)
+{
+    p_dev->state    = state;
+    p_dev->req_pend = false;
+    p_dev->retry    = 0U;
+    p_dev->req_ts   = BOOT_GET_SYSTICK();
+
+    // Session finished
+    if  (   ( eBOOT_MNGR_STATE_DONE  == state )
+        ||  ( eBOOT_MNGR_STATE_ERROR == state ))
+    {
+        p_dev->stats.time_ms = (uint32_t)( BOOT_GET_SYSTICK() - p_dev->start_ts );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Fail device session
+*
+* @param[in]    p_dev       - Device session
+* @param[in]    msg_status  - Status of failed response, OK on timeout
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_mngr_fail(boot_mngr_dev_t * const p_dev, const boot_msg_status_t msg_status)
+{
+    p_dev->stats.err_state  = p_dev->state;
+    p_dev->stats.msg_status = msg_status;
+
+    boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_ERROR );
+
+    BOOT_DBG_PRINT( "Device %d: upgrade failed in state %d, status 0x%02X!", boot_com_get_ch(), p_dev->stats.err_state, msg_status );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Acknowledge flash data frames
+*
+* @note     Flash data phase ends when all frames are acknowledged.
+*
+* @param[in]    p_dev   - Device session
+* @param[in]    ack     - Number of acknowledged frames
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_mngr_ack(boot_mngr_dev_t * const p_dev, const uint32_t ack)
+{
+    if ( ack > p_dev->base )
+    {
+        p_dev->base     = ack;
+        p_dev->retry    = 0U;
+        p_dev->req_ts   = BOOT_GET_SYSTICK();
+
+        // Resent frames are acknowledged as well
+        if ( p_dev->next < p_dev->base )
+        {
+            p_dev->next = p_dev->base;
+        }
+
+        // All image data acknowledged
+        if ( p_dev->base >= p_dev->frames )
+        {
+            const uint32_t size = p_dev->p_head->data.image_size;
+
+            p_dev->stats.flash_ms       = (uint32_t)( BOOT_GET_SYSTICK() - p_dev->flash_ts );
+            p_dev->stats.bytes_per_s    = (uint32_t)(((uint64_t) size * 1000ULL ) / (( 0U != p_dev->stats.flash_ms ) ? p_dev->stats.flash_ms : 1U ));
+
+            // NOTE: Container is spread over several targets, bootloader checks its sub-images itself!
+            #if ( 1 == BOOT_CFG_MNGR_VERIFY_EN )
+                if  (   ((( p_dev->proto_ver >= BOOT_MNGR_PROTO_VER_VERIFY ) && ( p_dev->proto_ver < BOOT_MNGR_PROTO_VER_VERIFY_OPT ))
+                        ||  ( 0U != ( p_dev->features & BOOT_INFO_FEATURE_VERIFY )))
+                    &&  ( BOOT_IMAGE_TYPE_MULTI != p_dev->p_head->ctrl.image_type ))
+                {
+                    p_dev->verify_ofs = 0U;
+                    boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_VERIFY );
+                }
+                else
+            #endif
+                {
+                    boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_EXIT );
+                }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if image is sent as it is stored in flash
+*
+* @note     Encrypted, compressed and delta images are transformed by
+*           bootloader, thus flash content differs from sent data.
+*
+* @param[in]    p_head      - Image header
+* @return       is_plain    - True if image is plain
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool boot_mngr_image_is_plain(const ver_image_header_t * const p_head)
+{
+    // NOTE: Compression type is kept in reserved field of header control part!
+    return  (   ( eVER_IMAGE_TYPE_APP   == p_head->ctrl.image_type )
+            &&  ( eVER_ENC_TYPE_NONE    == p_head->data.enc_type )
+            &&  ( 0U                    == p_head->ctrl.res[0] ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Continue CRC-32 over erased (0xFF) flash
+*
+* @param[in]    crc32   - CRC-32 so far
+* @param[in]    size    - Number of erased bytes
+* @return       crc32   - CRC-32 including erased bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t boot_mngr_crc32_pad(const uint32_t crc32, const uint32_t size)
+{
+    static const uint8_t    pad[16] = { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+    uint32_t                crc     = crc32;
+
+    for ( uint32_t n = 0U; n < size; n += sizeof( pad ))
+    {
+        crc = boot_crc32_update( crc, (const uint8_t*) &pad, ((( size - n ) < sizeof( pad )) ? ( size - n ) : sizeof( pad )));
+    }
+
+    return crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Calculate expected CRC-32 of sector reported by bootloader
+*
+* @note     Bootloader reports whole sectors, part of sector behind image
+*           end is erased (0xFF) flash.
+*
+* @param[in]    p_dev   - Device session
+* @param[in]    ofs     - Image offset of sector
+* @param[in]    size    - Size of sector in bytes
+* @return       crc32   - Expected CRC-32 of sector
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t boot_mngr_sector_crc32(const boot_mngr_dev_t * const p_dev, const uint32_t ofs, const uint32_t size)
+{
+    const uint32_t image_size  = p_dev->p_head->data.image_size;
+    const uint32_t data_size   = ((( image_size - ofs ) < size ) ? ( image_size - ofs ) : size );
+
+    return boot_mngr_crc32_pad( boot_crc32_update( boot_crc32_init(), &p_dev->p_data[ ofs ], data_size ), ( size - data_size ));
+}
+
+#if ( 1 == BOOT_CFG_MNGR_SKIP_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check if sector shall be programmed
+    *
+    * @param[in]    p_dev   - Device session
+    * @param[in]    sector  - Sector number from image header sector on
+    * @return       is_prog - True if sector is programmed
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool boot_mngr_skip_is_prog(const boot_mngr_dev_t * const p_dev, const uint32_t sector)
+    {
+        // NOTE: Sectors beyond map are always programmed!
+        return  (   ( sector >= ( BOOT_SKIP_MAP_SIZE * 8U ))
+                ||  ( 0U != ( p_dev->skip_map[ sector / 8U ] & ( 1U << ( sector % 8U )))));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get next image data to send
+    *
+    * @note     Kept sectors at image offset are skipped, data to send ends at
+    *           next kept sector or at image end.
+    *
+    * @param[in]    p_dev   - Device session
+    * @param[in]    ofs     - Image offset
+    * @param[out]   p_end   - End of data to send (exclusive)
+    * @return       ofs     - Image offset of data to send, image size if none
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t boot_mngr_skip_next(const boot_mngr_dev_t * const p_dev, const uint32_t ofs, uint32_t * const p_end)
+    {
+        const   uint32_t    image_size  = p_dev->p_head->data.image_size;
+                uint32_t    next        = ofs;
+                uint32_t    start       = 0U;
+                uint32_t    sector      = 0U;
+                bool        is_found    = false;
+                bool        is_done     = false;
+
+        *p_end = image_size;
+
+        for ( uint32_t r = 0U; ( r < p_dev->sectors_num_of ) && ( false == is_done ); r++ )
+        {
+            for ( uint32_t n = 0U; ( n < p_dev->sectors[r].num_of ) && ( false == is_done ); n++ )
+            {
+                const uint32_t stop     = ( start + p_dev->sectors[r].size );
+                const bool     is_prog  = boot_mngr_skip_is_prog( p_dev, sector );
+
+                // Look for programmed sector at or after offset
+                if ( false == is_found )
+                {
+                    if ( next < stop )
+                    {
+                        if ( true == is_prog )
+                        {
+                            is_found = true;
+                        }
+                        else
+                        {
+                            next = stop;
+                        }
+                    }
+                }
+
+                // Data ends at next kept sector
+                else if ( false == is_prog )
+                {
+                    *p_end  = start;
+                    is_done = true;
+                }
+                else
+                {
+                    // No actions...
+                }
+
+                start = stop;
+                sector++;
+            }
+        }
+
+        return (( next < image_size ) ? next : image_size );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Count flash data frames of skipped image
+    *
+    * @note     Frames do not cross kept sectors, thus they are counted over
+    *           programmed data runs.
+    *
+    * @param[in]    p_dev   - Device session
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_mngr_skip_frames(boot_mngr_dev_t * const p_dev)
+    {
+        const   uint32_t    image_size  = p_dev->p_head->data.image_size;
+                uint32_t    end         = 0U;
+                uint32_t    sent        = 0U;
+                uint32_t    ofs         = boot_mngr_skip_next( p_dev, 0U, &end );
+
+        p_dev->frames = 0U;
+
+        while ( ofs < image_size )
+        {
+            const uint32_t len = ((( end - ofs ) < p_dev->stats.payload_size ) ? ( end - ofs ) : p_dev->stats.payload_size );
+
+            p_dev->frames++;
+            sent += len;
+            ofs = boot_mngr_skip_next( p_dev, ( ofs + len ), &end );
+        }
+
+        p_dev->stats.kept   = ( image_size - sent );
+        p_dev->frame_ofs[0] = 0U;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Scan sectors of target slot
+    *
+    * @note     Sectors with same CRC-32 as new image are kept, except sector
+    *           holding image header. Upgrade falls back to complete image
+    *           when target slot cannot be scanned.
+    *
+    * @param[in]    p_dev       - Device session
+    * @param[in]    p_rsp       - Covered range and sector entries
+    * @param[in]    msg_status  - Status of verify sectors command
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void boot_mngr_skip_scan(boot_mngr_dev_t * const p_dev, const boot_verify_sectors_rsp_t * const p_rsp, const boot_msg_status_t msg_status)
+    {
+        const uint32_t image_size   = p_dev->p_head->data.image_size;
+        const uint32_t entry_size   = ( sizeof( uint32_t ) + sizeof( uint32_t ));
+        const uint32_t sector_max   = ( BOOT_SKIP_MAP_SIZE * 8U );
+
+        if  (   ( eBOOT_MSG_OK == msg_status )
+            &&  ( BOOT_VERIFY_TYPE_CRC32 == p_rsp->range.type )
+            &&  ( p_rsp->range.size > 0U ))
+        {
+            for ( uint32_t i = 0U; ( i < p_rsp->num_of ) && ( p_dev->verify_ofs < image_size ) && ( p_dev->sector < sector_max ); i++ )
+            {
+                uint32_t size   = 0U;
+                uint32_t crc32  = 0U;
+
+                memcpy( &size,  &p_rsp->entry[ i * entry_size ], sizeof( uint32_t ));
+                memcpy( &crc32, &p_rsp->entry[( i * entry_size ) + sizeof( uint32_t )], sizeof( uint32_t ));
+
+                // Run-length code sector sizes
+                if  (   ( p_dev->sectors_num_of > 0U )
+                    &&  ( size == p_dev->sectors[ p_dev->sectors_num_of - 1U ].size ))
+                {
+                    p_dev->sectors[ p_dev->sectors_num_of - 1U ].num_of++;
+                }
+                else if ( p_dev->sectors_num_of < BOOT_MNGR_SECTORS_MAX )
+                {
+                    p_dev->sectors[ p_dev->sectors_num_of ].size    = size;
+                    p_dev->sectors[ p_dev->sectors_num_of ].num_of  = 1U;
+                    p_dev->sectors_num_of++;
+                }
+                else
+                {
+                    p_dev->is_skip = false;
+                }
+
+                // Unchanged sector is kept
+                if  (   ( p_dev->sector > 0U )
+                    &&  ( crc32 == boot_mngr_sector_crc32( p_dev, p_dev->verify_ofs, size )))
+                {
+                    p_dev->skip_map[ p_dev->sector / 8U ] &= (uint8_t) ~( 1U << ( p_dev->sector % 8U ));
+                }
+
+                p_dev->verify_ofs += size;
+                p_dev->sector++;
+            }
+
+            // Scan finished
+            if  (   ( p_dev->verify_ofs >= image_size )
+                ||  ( p_dev->sector >= sector_max ))
+            {
+                bool is_kept = false;
+
+                for ( uint32_t i = 0U; i < BOOT_SKIP_MAP_SIZE; i++ )
+                {
+                    is_kept |= ( 0xFFU != p_dev->skip_map[i] );
+                }
+
+                p_dev->is_skip = (( true == p_dev->is_skip ) && ( true == is_kept ));
+
+                boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_PREPARE );
+
+                BOOT_DBG_PRINT( "Device %d: %d of %d sectors unchanged", boot_com_get_ch(), ( p_dev->is_skip ? (int)( p_dev->sector - 1U ) : 0 ), p_dev->sector );
+            }
+
+            // Request rest of image
+            else
+            {
+                p_dev->req_pend = false;
+                p_dev->retry    = 0U;
+            }
+        }
+
+        // Program complete image
+        else
+        {
+            p_dev->is_skip = false;
+            boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_PREPARE );
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get flash data frame
+*
+* @param[in]    p_dev   - Device session
+* @param[in]    n       - Frame number
+* @param[out]   p_ofs   - Image offset of frame data
+* @param[out]   p_len   - Size of frame data in bytes
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_mngr_frame_get(boot_mngr_dev_t * const p_dev, const uint32_t n, uint32_t * const p_ofs, uint16_t * const p_len)
+{
+    const uint32_t size = p_dev->p_head->data.image_size;
+
+    #if ( 1 == BOOT_CFG_MNGR_SKIP_EN )
+        if ( true == p_dev->is_skip )
+        {
+            uint32_t end = 0U;
+
+            // Frames follow each other, except over kept sectors
+            *p_ofs = boot_mngr_skip_next( p_dev, p_dev->frame_ofs[ n % BOOT_MNGR_FRAME_OFS_NUM_OF ], &end );
+            *p_len = (uint16_t)((( end - *p_ofs ) < p_dev->stats.payload_size ) ? ( end - *p_ofs ) : p_dev->stats.payload_size );
+
+            p_dev->frame_ofs[( n + 1U ) % BOOT_MNGR_FRAME_OFS_NUM_OF ] = ( *p_ofs + *p_len );
+        }
+        else
+    #endif
+        {
+            *p_ofs = ( n * p_dev->stats.payload_size );
+            *p_len = (uint16_t)((( size - *p_ofs ) < p_dev->stats.payload_size ) ? ( size - *p_ofs ) : p_dev->stats.payload_size );
+        }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Send request of current session state
+*
+* @param[in]    p_dev   - Device session
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static boot_status_t boot_mngr_req_send(boot_mngr_dev_t * const p_dev)
+{
+    boot_status_t   status      = eBOOT_OK;
+    uint16_t        payload     = BOOT_CFG_DATA_PAYLOAD_SIZE;
+    uint8_t         crc_type    = BOOT_COM_CRC_TYPE_CRC8;
+    boot_verify_t   range       = {0};
+
+    switch( p_dev->state )
+    {
+        case eBOOT_MNGR_STATE_INFO:
+            status = boot_com_send_info();
+            break;
+
+        case eBOOT_MNGR_STATE_CONNECT:
+
+            // Largest payload supported on both sides
+            if (( 0U != p_dev->payload_max ) && ( p_dev->payload_max < payload ))
+            {
+                payload = p_dev->payload_max;
+            }
+
+            // Older bootloaders do not support CRC-16/CRC-32 frame check
+            if  (   ( p_dev->proto_ver >= BOOT_MNGR_PROTO_VER_CRC )
+                &&  ( true == boot_com_crc_type_is_supported( BOOT_CFG_MNGR_CRC_TYPE )))
+            {
+                crc_type = BOOT_CFG_MNGR_CRC_TYPE;
+            }
+
+            // Connect is always sent with CRC-8 frame check
+            boot_com_set_crc_type( BOOT_COM_CRC_TYPE_CRC8 );
+
+            status = boot_com_send_connect( payload, crc_type );
+            break;
+
+    #if ( 1 == BOOT_CFG_MNGR_SKIP_EN )
+        case eBOOT_MNGR_STATE_SCAN:
+            range.addr = ( p_dev->p_head->data.image_addr + sizeof( ver_image_header_t ) + p_dev->verify_ofs );
+            range.size = ( p_dev->p_head->data.image_size - p_dev->verify_ofs );
+            range.type = BOOT_VERIFY_TYPE_CRC32;
+
+            status = boot_com_send_verify_sectors( &range );
+            break;
+    #endif
+
+        case eBOOT_MNGR_STATE_PREPARE:
+
+            #if ( 1 == BOOT_CFG_MNGR_SKIP_EN )
+                if ( true == p_dev->is_skip )
+                {
+                    status = boot_com_send_prepare_skip( p_dev->p_head, p_dev->skip_map );
+                }
+                else
+            #endif
+                {
+                    status = boot_com_send_prepare( p_dev->p_head );
+                }
+            break;
+
+        case eBOOT_MNGR_STATE_VERIFY:
+
+            range.addr = ( p_dev->p_head->data.image_addr + sizeof( ver_image_header_t ) + p_dev->verify_ofs );
+            range.size = ( p_dev->p_head->data.image_size - p_dev->verify_ofs );
+            range.type = BOOT_VERIFY_TYPE_CRC32;
+
+            // Plain image sector by sector, otherwise complete image against header
+            if ( true == boot_mngr_image_is_plain( p_dev->p_head ))
+            {
+                status = boot_com_send_verify_sectors( &range );
+            }
+            else
+            {
+                status = boot_com_send_verify( &range );
+            }
+            break;
+
+        case eBOOT_MNGR_STATE_EXIT:
+            status = boot_com_send_exit();
+            break;
+
+        default:
+            status = eBOOT_ERROR;
+            break;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle request-response session states
+*
+* @note     Request is resent on response timeout, erase at prepare and
+*           image validation at exit get long timeout. Verify is sent while
+*           bootloader is still in FLASH state, thus it gets flash data
+*           acknowledge timeout to be resent before bootloader idle timeout.
+*
+* @param[in]    p_dev - Device session
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_mngr_req_hndl(boot_mngr_dev_t * const p_dev)
+{
+    uint32_t timeout = BOOT_CFG_MNGR_RSP_TIMEOUT_MS;
+
+    if  (   ( eBOOT_MNGR_STATE_PREPARE == p_dev->state )
+        ||  ( eBOOT_MNGR_STATE_EXIT    == p_dev->state ))
+    {
+        timeout = BOOT_CFG_MNGR_LONG_TIMEOUT_MS;
+    }
+    else if ( eBOOT_MNGR_STATE_VERIFY == p_dev->state )
+    {
+        timeout = BOOT_CFG_MNGR_FLASH_TIMEOUT_MS;
+    }
+    else
+    {
+        // No actions...
+    }
+
+    // Send request
+    if ( false == p_dev->req_pend )
+    {
+        if ( eBOOT_OK == boot_mngr_req_send( p_dev ))
+        {
+            p_dev->req_pend = true;
+            p_dev->req_ts   = BOOT_GET_SYSTICK();
+        }
+    }
+
+    // Response timeout
+    else if ((uint32_t) ( BOOT_GET_SYSTICK() - p_dev->req_ts ) >= timeout )
+    {
+        p_dev->stats.timeouts++;
+        p_dev->req_pend = false;
+        p_dev->retry++;
+
+        if ( p_dev->retry > BOOT_CFG_MNGR_RETRY_NUM_OF )
+        {
+            // Target slot cannot be scanned -> program complete image
+            #if ( 1 == BOOT_CFG_MNGR_SKIP_EN )
+                if ( eBOOT_MNGR_STATE_SCAN == p_dev->state )
+                {
+                    p_dev->is_skip = false;
+                    boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_PREPARE );
+                }
+                else
+            #endif
+                {
+                    boot_mngr_fail( p_dev, eBOOT_MSG_OK );
+                }
+        }
+    }
+    else
+    {
+        // Waiting for response...
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle flash data phase
+*
+* @note     Window is filled with frames each pass, interface shall queue
+*           them for transmission without blocking. On acknowledge timeout
+*           frames are resent from first unacknowledged one.
+*
+*           Stop-and-wait bootloader cannot detect duplicated frames, thus
+*           timeout fails session instead of resending.
+*
+* @param[in]    p_dev - Device session
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_mngr_flash_hndl(boot_mngr_dev_t * const p_dev)
+{
+    const uint32_t  window  = (( 0U == p_dev->stats.window ) ? 1U : p_dev->stats.window );
+    boot_status_t   status  = eBOOT_OK;
+
+    // Fill window
+    while   (   ( eBOOT_OK == status )
+            &&  ( p_dev->next < p_dev->frames )
+            &&  ( p_dev->next < ( p_dev->base + window )))
+    {
+        uint32_t ofs = 0U;
+        uint16_t len = 0U;
+
+        boot_mngr_frame_get( p_dev, p_dev->next, &ofs, &len );
+
+        if ( 0U == p_dev->stats.window )
+        {
+            status = boot_com_send_flash( &p_dev->p_data[ofs], len );
+        }
+        else
+        {
+            status = boot_com_send_flash_seq((uint16_t) p_dev->next, &p_dev->p_data[ofs], len );
+        }
+
+        if ( eBOOT_OK == status )
+        {
+            p_dev->stats.frames++;
+            p_dev->stats.sent += len;
+
+            if ( p_dev->next < p_dev->top )
+            {
+                p_dev->stats.retransmits++;
+            }
+
+            p_dev->next++;
+
+            if ( p_dev->next > p_dev->top )
+            {
+                p_dev->top = p_dev->next;
+            }
+        }
+    }
+
+    // Acknowledge timeout
+    if ((uint32_t) ( BOOT_GET_SYSTICK() - p_dev->req_ts ) >= BOOT_CFG_MNGR_FLASH_TIMEOUT_MS )
+    {
+        p_dev->stats.timeouts++;
+        p_dev->retry++;
+        p_dev->req_ts = BOOT_GET_SYSTICK();
+
+        if  (   ( 0U == p_dev->stats.window )
+            ||  ( p_dev->retry > BOOT_CFG_MNGR_RETRY_NUM_OF ))
+        {
+            boot_mngr_fail( p_dev, eBOOT_MSG_OK );
+        }
+        else
+        {
+            // Go back
+            p_dev->next = p_dev->base;
+            p_dev->nak  = BOOT_MNGR_NAK_NONE;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle device session
+*
+* @param[in]    p_dev - Device session
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void boot_mngr_dev_hndl(boot_mngr_dev_t * const p_dev)
+{
+    switch( p_dev->state )
+    {
+        case eBOOT_MNGR_STATE_INFO:
+        case eBOOT_MNGR_STATE_CONNECT:
+        case eBOOT_MNGR_STATE_SCAN:
+        case eBOOT_MNGR_STATE_PREPARE:
+        case eBOOT_MNGR_STATE_VERIFY:
+        case eBOOT_MNGR_STATE_EXIT:
+            boot_mngr_req_hndl( p_dev );
+            break;
+
+        case eBOOT_MNGR_STATE_FLASH:
+            boot_mngr_flash_hndl( p_dev );
+            break;
+
+        default:
+            // No actions...
+            break;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Info Response Bootloader Message Reception Callback
+*
+* @param[in]    p_info      - Bootloader information
+* @param[in]    msg_status  - Status of info command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_com_info_rsp_msg_rcv_cb(const boot_info_t * const p_info, const boot_msg_status_t msg_status)
+{
+    boot_mngr_dev_t * const p_dev = boot_mngr_get_dev();
+
+    if ( eBOOT_MNGR_STATE_INFO == p_dev->state )
+    {
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            p_dev->proto_ver    = p_info->proto_ver;
+            p_dev->payload_max  = (( p_info->proto_ver >= BOOT_MNGR_PROTO_VER_PAYLOAD ) ? p_info->payload_size : 0U );
+
+            p_dev->features     = (( p_info->proto_ver >= BOOT_MNGR_PROTO_VER_SKIP ) ? p_info->features : 0U );
+
+            // Pipelined flash data
+            if ( p_info->proto_ver >= BOOT_MNGR_PROTO_VER_SEQ )
+            {
+                p_dev->stats.window = (( p_info->flash_window < BOOT_CFG_MNGR_WINDOW_MAX ) ? p_info->flash_window : BOOT_CFG_MNGR_WINDOW_MAX );
+            }
+
+            boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_CONNECT );
+        }
+        else
+        {
+            boot_mngr_fail( p_dev, msg_status );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Connect Response Bootloader Message Reception Callback
+*
+* @param[in]    payload_size    - Negotiated flash data payload size in bytes
+* @param[in]    crc_type        - Negotiated frame check type
+* @param[in]    msg_status      - Status of connect command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_com_connect_rsp_msg_rcv_cb(const uint16_t payload_size, const uint8_t crc_type, const boot_msg_status_t msg_status)
+{
+    boot_mngr_dev_t * const p_dev = boot_mngr_get_dev();
+
+    if ( eBOOT_MNGR_STATE_CONNECT == p_dev->state )
+    {
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            // Older bootloaders accept requested payload size
+            p_dev->stats.payload_size = payload_size;
+
+            if ( 0U == p_dev->stats.payload_size )
+            {
+                p_dev->stats.payload_size = ((( 0U != p_dev->payload_max ) && ( p_dev->payload_max < BOOT_CFG_DATA_PAYLOAD_SIZE )) ? p_dev->payload_max : BOOT_CFG_DATA_PAYLOAD_SIZE );
+            }
+
+            p_dev->stats.crc_type = crc_type;
+            p_dev->frames = (( p_dev->p_head->data.image_size + p_dev->stats.payload_size - 1U ) / p_dev->stats.payload_size );
+
+            // Following frames are checked with negotiated type
+            boot_com_set_crc_type( crc_type );
+
+            // Compare target slot with plain image first
+            #if ( 1 == BOOT_CFG_MNGR_SKIP_EN )
+                if  (   ( 0U != ( p_dev->features & BOOT_INFO_FEATURE_SKIP ))
+                    &&  ( true == boot_mngr_image_is_plain( p_dev->p_head )))
+                {
+                    p_dev->is_skip          = true;
+                    p_dev->verify_ofs       = 0U;
+                    p_dev->sector           = 0U;
+                    p_dev->sectors_num_of   = 0U;
+                    memset( &p_dev->skip_map, 0xFFU, sizeof( p_dev->skip_map ));
+
+                    boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_SCAN );
+                }
+                else
+            #endif
+                {
+                    boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_PREPARE );
+                }
+        }
+        else
+        {
+            boot_mngr_fail( p_dev, msg_status );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Prepare Response Bootloader Message Reception Callback
+*
+* @param[in]    msg_status - Status of prepare command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_com_prepare_rsp_msg_rcv_cb(const boot_msg_status_t msg_status)
+{
+    boot_mngr_dev_t * const p_dev = boot_mngr_get_dev();
+
+    if ( eBOOT_MNGR_STATE_PREPARE == p_dev->state )
+    {
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            p_dev->base     = 0U;
+            p_dev->next     = 0U;
+            p_dev->top      = 0U;
+            p_dev->nak      = BOOT_MNGR_NAK_NONE;
+            p_dev->flash_ts = BOOT_GET_SYSTICK();
+
+            boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_FLASH );
+        }
+        else
+        {
+            boot_mngr_fail( p_dev, msg_status );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Prepare Skip Response Bootloader Message Reception Callback
+*
+* @note     Frames of flash data phase follow applied sector map.
+*
+* @param[in]    p_map       - Applied sector map, set bit - program sector
+* @param[in]    msg_status  - Status of prepare skip command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_com_prepare_skip_rsp_msg_rcv_cb(const uint8_t * const p_map, const boot_msg_status_t msg_status)
+{
+    #if ( 1 == BOOT_CFG_MNGR_SKIP_EN )
+        boot_mngr_dev_t * const p_dev = boot_mngr_get_dev();
+
+        if  (   ( eBOOT_MNGR_STATE_PREPARE == p_dev->state )
+            &&  ( true == p_dev->is_skip ))
+        {
+            if ( eBOOT_MSG_OK == msg_status )
+            {
+                memcpy( &p_dev->skip_map, p_map, sizeof( p_dev->skip_map ));
+                boot_mngr_skip_frames( p_dev );
+            }
+
+            boot_com_prepare_rsp_msg_rcv_cb( msg_status );
+        }
+    #else
+        // Unused
+        (void) p_map;
+        (void) msg_status;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Prepare or Resume Response Bootloader Message Reception Callback
+*
+* @note     Engine always starts fresh upgrade with prepare command.
+*
+* @param[in]    ofs         - Image offset to continue streaming from
+* @param[in]    msg_status  - Status of prepare or resume command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_com_prepare_resume_rsp_msg_rcv_cb(const uint32_t ofs, const boot_msg_status_t msg_status)
+{
+    // Unused
+    (void) ofs;
+    (void) msg_status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Flash Response Bootloader Message Reception Callback
+*
+* @param[in]    msg_status - Status of flash command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_com_flash_rsp_msg_rcv_cb(const boot_msg_status_t msg_status)
+{
+    boot_mngr_dev_t * const p_dev = boot_mngr_get_dev();
+
+    if  (   ( eBOOT_MNGR_STATE_FLASH == p_dev->state )
+        &&  ( 0U == p_dev->stats.window ))
+    {
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            boot_mngr_ack( p_dev, ( p_dev->base + 1U ));
+        }
+        else
+        {
+            boot_mngr_fail( p_dev, msg_status );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Sequenced Flash Response Bootloader Message Reception Callback
+*
+* @note     Acknowledge is cumulative. Frames in flight after missing one
+*           are rejected as well, thus sender goes back only once per
+*           missing frame.
+*
+* @param[in]    seq_next    - Sequence number expected next by bootloader
+* @param[in]    msg_status  - Status of sequenced flash command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_com_flash_seq_rsp_msg_rcv_cb(const uint16_t seq_next, const boot_msg_status_t msg_status)
+{
+    boot_mngr_dev_t * const p_dev = boot_mngr_get_dev();
+
+    if  (   ( eBOOT_MNGR_STATE_FLASH == p_dev->state )
+        &&  ( 0U != p_dev->stats.window ))
+    {
+        // Unwrap 16-bit sequence number around first unacknowledged frame
+        uint32_t ack = (( p_dev->base & 0xFFFF0000U ) | seq_next );
+
+        if (( ack < p_dev->base ) && (( p_dev->base - ack ) > 0x8000U ))
+        {
+            ack += 0x10000U;
+        }
+
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            boot_mngr_ack( p_dev, ack );
+        }
+
+        // Frames missing
+        else if ( eBOOT_MSG_ERROR_INVALID_REQ == msg_status )
+        {
+            if  (   ( ack > p_dev->base )
+                ||  (( ack == p_dev->base ) && ( p_dev->nak != p_dev->base )))
+            {
+                boot_mngr_ack( p_dev, ack );
+
+                if ( eBOOT_MNGR_STATE_FLASH == p_dev->state )
+                {
+                    p_dev->next = p_dev->base;
+                    p_dev->nak  = p_dev->base;
+                }
+            }
+        }
+        else
+        {
+            boot_mngr_fail( p_dev, msg_status );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Exit Response Bootloader Message Reception Callback
+*
+* @param[in]    msg_status - Status of exit command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_com_exit_rsp_msg_rcv_cb(const boot_msg_status_t msg_status)
+{
+    boot_mngr_dev_t * const p_dev = boot_mngr_get_dev();
+
+    if ( eBOOT_MNGR_STATE_EXIT == p_dev->state )
+    {
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_DONE );
+
+            BOOT_DBG_PRINT( "Device %d: upgrade done in %d ms, %d bytes/s", boot_com_get_ch(), p_dev->stats.time_ms, p_dev->stats.bytes_per_s );
+        }
+        else
+        {
+            boot_mngr_fail( p_dev, msg_status );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Statistics Response Bootloader Message Reception Callback
+*
+* @note     Statistics are not requested by engine.
+*
+* @param[in]    p_stats     - Bootloader statistics
+* @param[in]    msg_status  - Status of statistics command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_com_stats_rsp_msg_rcv_cb(const boot_stats_t * const p_stats, const boot_msg_status_t msg_status)
+{
+    // Unused
+    (void) p_stats;
+    (void) msg_status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Verify Response Bootloader Message Reception Callback
+*
+* @note     Used for images transformed by bootloader, CRC-32 of complete
+*           flashed image shall match image header. Range is rounded to
+*           whole sectors by bootloader, rest of last sector is erased.
+*
+* @param[in]    p_rsp       - Verified range and its digest
+* @param[in]    msg_status  - Status of verify command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_com_verify_rsp_msg_rcv_cb(const boot_verify_rsp_t * const p_rsp, const boot_msg_status_t msg_status)
+{
+    boot_mngr_dev_t * const p_dev = boot_mngr_get_dev();
+    uint32_t                crc32 = 0U;
+
+    if ( eBOOT_MNGR_STATE_VERIFY == p_dev->state )
+    {
+        if ( eBOOT_MSG_OK == msg_status )
+        {
+            const uint32_t image_size = p_dev->p_head->data.image_size;
+
+            memcpy( &crc32, &p_rsp->digest, sizeof( uint32_t ));
+
+            if  (   ( p_rsp->range.size < image_size )
+                ||  ( crc32 != boot_mngr_crc32_pad( p_dev->p_head->data.image_crc, ( p_rsp->range.size - image_size ))))
+            {
+                p_dev->stats.verify_err++;
+                boot_mngr_fail( p_dev, eBOOT_MSG_ERROR_VALIDATION );
+            }
+            else
+            {
+                boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_EXIT );
+            }
+        }
+        else
+        {
+            boot_mngr_fail( p_dev, msg_status );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Verify Sectors Response Bootloader Message Reception Callback
+*
+* @note     Sector digests are compared with sent image, requests are
+*           repeated for rest of image until it is covered. Session fails
+*           after complete image is checked if any sector differs. In scan
+*           state unchanged sectors of target slot are collected instead.
+*
+* @param[in]    p_rsp       - Covered range and sector entries
+* @param[in]    msg_status  - Status of verify sectors command
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_com_verify_sectors_rsp_msg_rcv_cb(const boot_verify_sectors_rsp_t * const p_rsp, const boot_msg_status_t msg_status)
+{
+    boot_mngr_dev_t * const p_dev       = boot_mngr_get_dev();
+    const uint32_t          image_size  = p_dev->p_head->data.image_size;
+    const uint32_t          entry_size  = ( sizeof( uint32_t ) + sizeof( uint32_t ));
+
+    #if ( 1 == BOOT_CFG_MNGR_SKIP_EN )
+        if  (   ( eBOOT_MNGR_STATE_SCAN == p_dev->state )
+            &&  ( p_rsp->range.addr == ( p_dev->p_head->data.image_addr + sizeof( ver_image_header_t ) + p_dev->verify_ofs )))
+        {
+            boot_mngr_skip_scan( p_dev, p_rsp, msg_status );
+        }
+        else
+    #endif
+    if  (   ( eBOOT_MNGR_STATE_VERIFY == p_dev->state )
+        &&  ( p_rsp->range.addr == ( p_dev->p_head->data.image_addr + sizeof( ver_image_header_t ) + p_dev->verify_ofs )))
+    {
+        if  (   ( eBOOT_MSG_OK == msg_status )
+            &&  ( BOOT_VERIFY_TYPE_CRC32 == p_rsp->range.type )
+            &&  ( p_rsp->range.size > 0U ))
+        {
+            for ( uint32_t i = 0U; ( i < p_rsp->num_of ) && ( p_dev->verify_ofs < image_size ); i++ )
+            {
+                uint32_t size   = 0U;
+                uint32_t crc32  = 0U;
+
+                memcpy( &size,  &p_rsp->entry[ i * entry_size ], sizeof( uint32_t ));
+                memcpy( &crc32, &p_rsp->entry[( i * entry_size ) + sizeof( uint32_t )], sizeof( uint32_t ));
+
+                if ( crc32 != boot_mngr_sector_crc32( p_dev, p_dev->verify_ofs, size ))
+                {
+                    p_dev->stats.verify_err++;
+
+                    BOOT_DBG_PRINT( "Device %d: sector at image offset 0x%08X differs!", boot_com_get_ch(), p_dev->verify_ofs );
+                }
+
+                p_dev->verify_ofs += size;
+            }
+
+            // Complete image checked
+            if ( p_dev->verify_ofs >= image_size )
+            {
+                if ( 0U == p_dev->stats.verify_err )
+                {
+                    boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_EXIT );
+                }
+                else
+                {
+                    boot_mngr_fail( p_dev, eBOOT_MSG_ERROR_VALIDATION );
+                }
+            }
+
+            // Request rest of image
+            else
+            {
+                p_dev->req_pend = false;
+                p_dev->retry    = 0U;
+            }
+        }
+        else
+        {
+            boot_mngr_fail( p_dev, (( eBOOT_MSG_OK != msg_status ) ? msg_status : eBOOT_MSG_ERROR_VALIDATION ));
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_MNGR_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part of Boot Manager engine API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize Boot Manager engine
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_mngr_init(void)
+{
+    memset( &g_mngr_dev, 0U, sizeof( g_mngr_dev ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle Boot Manager engine
+*
+* @note     Single non-blocking pass over all devices: received responses
+*           of each device are parsed on its channel and its session is
+*           advanced. Shall be called from main (event) loop.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_mngr_hndl(void)
+{
+    for ( uint8_t dev = 0U; dev < BOOT_CFG_MNGR_DEV_NUM_OF; dev++ )
+    {
+        if ( true == boot_mngr_dev_is_busy( &g_mngr_dev[dev] ))
+        {
+            boot_status_t status = eBOOT_OK;
+
+            boot_com_select_ch( dev );
+
+            // Parse received responses
+            for ( uint32_t n = 0U; n < BOOT_MNGR_RX_FRAMES_MAX; n++ )
+            {
+                status = boot_com_hndl();
+
+                if  (   ( eBOOT_OK        != status )
+                    &&  ( eBOOT_ERROR_CRC != status ))
+                {
+                    break;
+                }
+            }
+
+            // Advance session
+            boot_mngr_dev_hndl( &g_mngr_dev[dev] );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Start device upgrade session
+*
+* @note     Image shall stay valid till session is finished, same image
+*           can be shared by many devices.
+*
+* @param[in]    dev     - Device (communication channel) index
+* @param[in]    p_head  - Image header
+* @param[in]    p_data  - Image data of "p_head->data.image_size" bytes
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_status_t boot_mngr_start(const uint8_t dev, const ver_image_header_t * const p_head, const uint8_t * const p_data)
+{
+    boot_status_t status = eBOOT_OK;
+
+    BOOT_ASSERT( dev < BOOT_CFG_MNGR_DEV_NUM_OF );
+    BOOT_ASSERT( NULL != p_head );
+    BOOT_ASSERT( NULL != p_data );
+
+    if ( true == boot_mngr_dev_is_busy( &g_mngr_dev[dev] ))
+    {
+        status = eBOOT_WAR_BUSY;
+    }
+    else
+    {
+        boot_mngr_dev_t * const p_dev = &g_mngr_dev[dev];
+
+        memset( p_dev, 0U, sizeof( boot_mngr_dev_t ));
+
+        p_dev->p_head   = p_head;
+        p_dev->p_data   = p_data;
+        p_dev->start_ts = BOOT_GET_SYSTICK();
+
+        // Drop leftovers of previous session
+        boot_com_select_ch( dev );
+        boot_com_reset_ch();
+
+        boot_mngr_set_state( p_dev, eBOOT_MNGR_STATE_INFO );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set addressed node of device
+*
+* @note     Node 0 is device connected directly to port, nodes 1..15 are
+*           downstream MCUs reached through bridge node (BOOT_CFG_BRIDGE_EN)
+*           on the same port. Node is kept over following sessions.
+*
+* @param[in]    dev     - Device (communication channel) index
+* @param[in]    node    - Node address
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_mngr_set_node(const uint8_t dev, const uint8_t node)
+{
+    BOOT_ASSERT( dev < BOOT_CFG_MNGR_DEV_NUM_OF );
+    BOOT_ASSERT( node < BOOT_COM_NODE_NUM_OF );
+
+    boot_com_select_ch( dev );
+    boot_com_set_node( node );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get device session state
+*
+* @param[in]    dev     - Device (communication channel) index
+* @return       state   - Session state
+*/
+////////////////////////////////////////////////////////////////////////////////
+boot_mngr_state_t boot_mngr_get_state(const uint8_t dev)
+{
+    BOOT_ASSERT( dev < BOOT_CFG_MNGR_DEV_NUM_OF );
+
+    return g_mngr_dev[dev].state;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get device session statistics
+*
+* @param[in]    dev     - Device (communication channel) index
+* @param[out]   p_stats - Session statistics
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void boot_mngr_get_stats(const uint8_t dev, boot_mngr_stats_t * const p_stats)
+{
+    BOOT_ASSERT( dev < BOOT_CFG_MNGR_DEV_NUM_OF );
+    BOOT_ASSERT( NULL != p_stats );
+
+    memcpy( p_stats, &g_mngr_dev[dev].stats, sizeof( boot_mngr_stats_t ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if any device session is ongoing
+*
+* @return       busy - True if any session is ongoing
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool boot_mngr_is_busy(void)
+{
+    bool busy = false;
+
+    for ( uint8_t dev = 0U; dev < BOOT_CFG_MNGR_DEV_NUM_OF; dev++ )
+    {
+        busy = ( busy || boot_mngr_dev_is_busy( &g_mngr_dev[dev] ));
+    }
+
+    return busy;
+}
+
+#endif // ( 1 == BOOT_CFG_COM_MANAGER_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,99 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_mngr.h
+*@brief     Boot Manager engine
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BOOT_MNGR_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __BOOT_MNGR_H
+#define __BOOT_MNGR_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../../boot_cfg.h"
+#include "boot_types.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Upgrade session states
+ */
+typedef enum
+{
+    eBOOT_MNGR_STATE_IDLE = 0,      /**<No session */
+    eBOOT_MNGR_STATE_INFO,          /**<Reading bootloader capabilities */
+    eBOOT_MNGR_STATE_CONNECT,       /**<Negotiating payload size and frame check */
+    eBOOT_MNGR_STATE_SCAN,          /**<Comparing sector digests of target slot with image (BOOT_CFG_MNGR_SKIP_EN) */
+    eBOOT_MNGR_STATE_PREPARE,       /**<Sending image header, bootloader erases */
+    eBOOT_MNGR_STATE_FLASH,         /**<Streaming image data */
+    eBOOT_MNGR_STATE_VERIFY,        /**<Comparing flash digests with image (BOOT_CFG_MNGR_VERIFY_EN) */
+    eBOOT_MNGR_STATE_EXIT,          /**<Bootloader validates image */
+    eBOOT_MNGR_STATE_DONE,          /**<Upgrade finished with success */
+    eBOOT_MNGR_STATE_ERROR,         /**<Upgrade failed */
+
+    eBOOT_MNGR_STATE_NUM_OF
+} boot_mngr_state_t;
+
+/**
+ *  Upgrade session statistics
+ *
+ *  @note   Times are measured by Boot Manager time base (BOOT_GET_SYSTICK).
+ */
+typedef struct
+{
+    uint32_t            time_ms;        /**<Session time, from info request till exit response */
+    uint32_t            flash_ms;       /**<Flash data phase time */
+    uint32_t            bytes_per_s;    /**<Image data throughput of flash data phase */
+    uint32_t            sent;           /**<Image data bytes sent incl. retransmissions */
+    uint32_t            frames;         /**<Flash data frames sent incl. retransmissions */
+    uint32_t            retransmits;    /**<Retransmitted flash data frames */
+    uint32_t            timeouts;       /**<Response timeouts */
+    uint32_t            verify_err;     /**<Sectors (or complete image) with digest mismatch */
+    uint32_t            kept;           /**<Image data bytes kept unchanged in flash, not sent */
+    uint16_t            payload_size;   /**<Negotiated flash data payload size */
+    uint8_t             window;         /**<Used flash data window, 0 - stop-and-wait */
+    uint8_t             crc_type;       /**<Negotiated frame check type */
+    boot_mngr_state_t   err_state;      /**<State in which session failed */
+    boot_msg_status_t   msg_status;     /**<Status of failed response, OK on timeout */
+} boot_mngr_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+#if ( 1 == BOOT_CFG_COM_MANAGER_EN )
+    void                boot_mngr_init      (void);
+    void                boot_mngr_hndl      (void);
+    boot_status_t       boot_mngr_start     (const uint8_t dev, const ver_image_header_t * const p_head, const uint8_t * const p_data);
+    void                boot_mngr_set_node  (const uint8_t dev, const uint8_t node);
+    boot_mngr_state_t   boot_mngr_get_state (const uint8_t dev);
+    void                boot_mngr_get_stats (const uint8_t dev, boot_mngr_stats_t * const p_stats);
+    bool                boot_mngr_is_busy   (void);
+#endif
+
+#endif // __BOOT_MNGR_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -28,10 +28,36 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "../../boot_cfg.h"
+
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
 ////////////////////////////////////////////////////////////////////////////////
 
+/**
+ *  CRC-32 engine options
+ *
+ *  @note   Select one with "BOOT_CFG_CRC32_ENGINE" inside "boot_cfg.h"!
+ */
+#define BOOT_CRC32_ENGINE_BITWISE               ( 0 )   /**<Bitwise calculation, no tables */
+#define BOOT_CRC32_ENGINE_NIBBLE                ( 1 )   /**<Nibble table, 64 bytes of flash */
+#define BOOT_CRC32_ENGINE_SLICE4                ( 2 )   /**<Slice-by-4 tables, 7 kB of flash */
+#define BOOT_CRC32_ENGINE_SLICE8                ( 3 )   /**<Slice-by-8 tables, 11 kB of flash */
+#define BOOT_CRC32_ENGINE_HW                    ( 4 )   /**<Hardware CRC unit over "boot_if_crc32_hw()" */
+
+/**
+ *  ECDSA curve options
+ *
+ *  @note   Select one with "BOOT_CFG_ECDSA_CURVE" inside "boot_cfg.h"!
+ */
+#define BOOT_ECDSA_CURVE_SECP256K1              ( 0 )   /**<secp256k1 (Koblitz) curve */
+#define BOOT_ECDSA_CURVE_SECP256R1              ( 1 )   /**<secp256r1 (NIST P-256) curve, supported by most crypto HW */
+
+/**
+ *  External flash staged image descriptor magic
+ */
+#define BOOT_EXT_IMAGE_MAGIC                    ( 0x5EF1B007U )
+
 /**
  *  Bootloader status
  */
@@ -45,6 +71,7 @@ typedef enum
 
     eBOOT_WAR_EMPTY         = (uint8_t)( 0x20U ),   /**<Reception queue empty */
     eBOOT_WAR_FULL          = (uint8_t)( 0x40U ),   /**<Reception queue full */
+    eBOOT_WAR_BUSY          = (uint8_t)( 0x80U ),   /**<Operation still in progress */
 } boot_status_t;
 
 /**
@@ -84,14 +111,282 @@ typedef enum
 	eBOOT_REASON_NONE = 0U, /**<Idle, jumpt to application */
 	eBOOT_REASON_COM,       /**<Communication reason to stay in bootloader, expect boot sequence from Bootloader Manager */
 	eBOOT_REASON_FLASH,     /**<Boot from external FLAHS memory */
+	eBOOT_REASON_BACKDOOR,  /**<Open back-door entry window once, then jump to application (BOOT_CFG_FAST_BOOT_EN) */
 
 	eBOOT_REASON_NUM_OF
 } boot_reason_t;
 
+/**
+ *      Bootloader information
+ *
+ *  @note   Payload of info response message. Bootloader version shall
+ *          stay first for compatibility with older Boot Managers!
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    uint32_t boot_ver;          /**<Bootloader software version */
+    uint8_t  proto_ver;         /**<Communication protocol version */
+    uint8_t  flash_window;      /**<Number of sequenced flash frames that can be sent without acknowledge, 0 - stop-and-wait only */
+    uint16_t payload_size;      /**<Maximum flash data payload size in bytes */
+    uint8_t  flash_slot;        /**<Application slot new image shall be linked for, 0 - slot A, 1 - slot B */
+    uint16_t write_size;        /**<Flash write granularity in bytes, negotiated payload size is multiple of it */
+    uint8_t  features;          /**<Optional features supported, see BOOT_INFO_FEATURE_* */
+} boot_info_t;
+
+/**
+ *      Bootloader optional features
+ */
+#define BOOT_INFO_FEATURE_SKIP          ( 0x01U )   /**<Prepare skip command, unchanged sectors are kept */
+#define BOOT_INFO_FEATURE_VERIFY        ( 0x02U )   /**<Verify and verify sectors commands */
+
+/**
+ *      Communication statistics
+ *
+ *  @note   Counted since last connect command.
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    uint32_t frames;            /**<Number of received valid frames */
+    uint16_t crc_err;           /**<Number of frames with corrupted integrity */
+    uint16_t timeouts;          /**<Number of frame reception timeouts */
+    uint16_t rx_overflows;      /**<Number of reception buffer overflows */
+} boot_com_stats_t;
+
+/**
+ *      Bootloader statistics
+ *
+ *  @note   Payload of stats response message. Times are in microseconds and
+ *          together with counters accumulated since last connect command.
+ *          Link time is session time minus all other phases.
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    uint32_t            session_us;     /**<Time since connect command */
+    uint32_t            erase_us;       /**<Flash erase time */
+    uint32_t            program_us;     /**<Flash programming time */
+    uint32_t            decrypt_us;     /**<Decryption time */
+    uint32_t            hash_us;        /**<Running digest (SHA-256/CRC-32) time */
+    uint32_t            verify_us;      /**<Post-validation (digest and signature check) time */
+    uint32_t            boot_valid_us;  /**<Image validation time at last boot */
+    uint32_t            programmed;     /**<Number of programmed image bytes */
+    boot_com_stats_t    com;            /**<Communication statistics */
+} boot_stats_t;
+
+/**
+ *  Verify command digest types
+ */
+#define BOOT_VERIFY_TYPE_CRC32                  ( 0x01U )   /**<CRC-32, same as image CRC-32 */
+#define BOOT_VERIFY_TYPE_SHA256                 ( 0x02U )   /**<SHA-256 */
+
+/**
+ *  Size of verify command digest
+ */
+#define BOOT_VERIFY_DIGEST_SIZE(type)           (( BOOT_VERIFY_TYPE_SHA256 == (type)) ? 32U : sizeof( uint32_t ))
+
+/**
+ *  Maximum number of sector digests in single verify sectors response
+ */
+#define BOOT_VERIFY_SECTORS_MAX                 ( 16U )
+
+/**
+ *      Verify range
+ *
+ *  @note   Payload of verify and verify sectors command. Response carries
+ *          verified range, with verify sectors command size is covered
+ *          part of requested range.
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    uint32_t addr;              /**<Start address */
+    uint32_t size;              /**<Size in bytes */
+    uint8_t  type;              /**<Digest type */
+} boot_verify_t;
+
+/**
+ *      Verify response
+ *
+ *  @note   Only "BOOT_VERIFY_DIGEST_SIZE()" bytes of digest are sent.
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    boot_verify_t   range;      /**<Verified range */
+    uint8_t         digest[32]; /**<Digest of range */
+} boot_verify_rsp_t;
+
+/**
+ *      Verify sectors response
+ *
+ *  @note   Each entry is sector size (uint32) followed by digest of
+ *          "BOOT_VERIFY_DIGEST_SIZE()" bytes, first and last sector are
+ *          clipped to requested range. Only "num_of" entries are sent.
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    boot_verify_t   range;                                                      /**<Covered range */
+    uint8_t         num_of;                                                     /**<Number of sector entries */
+    uint8_t         entry[ BOOT_VERIFY_SECTORS_MAX * ( sizeof( uint32_t ) + 32U )];  /**<Sector entries */
+} boot_verify_sectors_rsp_t;
+
+/**
+ *      Prepare skip sector map size
+ *
+ *  @note   Bit "n" (LSB of first byte first) stands for n-th flash sector
+ *          of image, counted from sector holding image header. Set bit
+ *          means sector is erased and programmed, cleared bit means sector
+ *          is kept unchanged and its data is not sent. Sectors beyond map
+ *          are always programmed.
+ *
+ *  Unit: byte
+ */
+#define BOOT_SKIP_MAP_SIZE                      ( 32U )
+
+/**
+ *      Flash region of equally sized sectors
+ *
+ *  @note   Used as entry of "BOOT_CFG_FLASH_SECTOR_MAP".
+ */
+typedef struct
+{
+    uint32_t addr;              /**<Start address of region */
+    uint32_t sector_size;       /**<Size of single erasable sector in bytes */
+    uint32_t num_of;            /**<Number of sectors in region */
+} boot_flash_region_t;
+
+/**
+ *      Multi-image container
+ *
+ *  @note   Image of type "BOOT_IMAGE_TYPE_MULTI" carries manifest followed
+ *          by sub-images in manifest order. Container header hash (or
+ *          image CRC without signature) covers manifest only, manifest
+ *          holds SHA-256 hash of each sub-image. Complete set is thus
+ *          authenticated with single signature check.
+ */
+#define BOOT_IMAGE_TYPE_MULTI                   ( 3U )
+#define BOOT_MULTI_MAGIC                        ( 0x544C554DU )     /**<"MULT" */
+#define BOOT_MULTI_ENTRY_MAX                    ( 8U )
+
+/**
+ *      Multi-image container sub-image types
+ */
+#define BOOT_MULTI_TYPE_APP                     ( 0U )  /**<Application image with its header, written to application slot */
+#define BOOT_MULTI_TYPE_DATA                    ( 1U )  /**<Raw data, written to address inside one of "BOOT_CFG_MULTI_DATA_REGIONS" */
+#define BOOT_MULTI_TYPE_FORWARD                 ( 2U )  /**<Passed to "boot_if_forward()", address is target specific */
+
+/**
+ *      Multi-image container manifest entry
+ *
+ *  Sizeof: 44 bytes
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    uint8_t  type;              /**<Sub-image type, one of "BOOT_MULTI_TYPE_x" */
+    uint8_t  res[3];            /**<Reserved space (alignment) */
+    uint32_t addr;              /**<Target address */
+    uint32_t size;              /**<Size of sub-image in bytes */
+    uint8_t  hash[32];          /**<SHA-256 hash of sub-image */
+} boot_multi_entry_t;
+
+/**
+ *      Multi-image container manifest
+ *
+ *  @note   Manifest is always sent in full, unused entries shall be zero.
+ *
+ *  Sizeof: 360 bytes
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    uint32_t            magic;                          /**<Manifest magic, shall be "BOOT_MULTI_MAGIC" */
+    uint8_t             num_of;                         /**<Number of sub-images */
+    uint8_t             res[3];                         /**<Reserved space (alignment) */
+    boot_multi_entry_t  entry[BOOT_MULTI_ENTRY_MAX];    /**<Sub-images */
+} boot_multi_manifest_t;
+
+/**
+ *      Flash region of container data sub-images
+ *
+ *  @note   Used as entry of "BOOT_CFG_MULTI_DATA_REGIONS".
+ */
+typedef struct
+{
+    uint32_t addr;              /**<Start address of region */
+    uint32_t size;              /**<Size of region in bytes */
+} boot_data_region_t;
+
+/**
+ *      External flash staged image descriptor
+ *
+ *  @note   Written by application at "BOOT_CFG_EXT_FLASH_IMAGE_ADDR" only
+ *          after complete image file (as generated by signature tool) is
+ *          stored right behind descriptor.
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    uint32_t magic;             /**<Descriptor magic, shall be "BOOT_EXT_IMAGE_MAGIC" */
+    uint32_t size;              /**<Size of image file (header + payload) in bytes */
+} boot_ext_image_desc_t;
+
+/**
+ *      Data output callback
+ *
+ *  @note   Used by stream decoders (delta patch, decompression) to hand
+ *          decoded data to next stage.
+ */
+typedef boot_status_t (*pf_boot_data_out_t)(const uint8_t * const p_data, const uint32_t size, void * const p_ctx);
+
+/**
+ *      Shared memory extension record types
+ *
+ *  @note   Extension area is list of type-length-value records, record
+ *          type is followed by value length and value itself. List is
+ *          terminated by "eBOOT_SHARED_MEM_EXT_END" or end of area.
+ */
+typedef enum
+{
+    eBOOT_SHARED_MEM_EXT_END     = (uint8_t) ( 0x00U ),    /**<End of records */
+    eBOOT_SHARED_MEM_EXT_TIMING  = (uint8_t) ( 0x01U ),    /**<Boot timing, value is @boot_shared_mem_timing_t */
+    eBOOT_SHARED_MEM_EXT_VALID   = (uint8_t) ( 0x02U ),    /**<Validation cache token, value is @boot_shared_mem_valid_t */
+    eBOOT_SHARED_MEM_EXT_RESUME  = (uint8_t) ( 0x03U ),    /**<Upgrade resume checkpoint, value is @boot_shared_mem_resume_t */
+    eBOOT_SHARED_MEM_EXT_APP     = (uint8_t) ( 0x80U ),    /**<First application defined record type */
+} boot_shared_mem_ext_t;
+
+/**
+ *      Boot timing extension record
+ *
+ *  Sizeof: 8 bytes
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    uint32_t boot_ms;   /**<Time spent in bootloader till application start in milliseconds */
+    uint32_t valid_us;  /**<Image validation time in microseconds, 0 if not measured */
+} boot_shared_mem_timing_t;
+
+/**
+ *      Validation cache token extension record
+ *
+ *  Sizeof: 8 bytes
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    uint32_t token;     /**<CRC-32 of validation cache record image was accepted against */
+    uint8_t  valid_cnt; /**<Boots since last full image validation */
+    uint8_t  res[3];    /**<Reserved space */
+} boot_shared_mem_valid_t;
+
+/**
+ *      Upgrade resume checkpoint extension record
+ *
+ *  Sizeof: 8 bytes
+ */
+typedef struct __BOOT_CFG_PACKED__
+{
+    uint32_t ofs;       /**<Number of image bytes committed to flash by interrupted upgrade */
+    uint32_t head_id;   /**<First four bytes of SHA-256 of interrupted image header */
+} boot_shared_mem_resume_t;
+
 /**
  *      Shared memory layout
  *
- *  Sizeof: 32bytes
+ *  Sizeof: 32 bytes + BOOT_CFG_SHARED_MEM_EXT_SIZE
  */
 typedef struct __BOOT_CFG_PACKED__
 {
@@ -103,9 +398,10 @@ typedef struct __BOOT_CFG_PACKED__
      */
     struct
     {
-        uint8_t crc;    /**<CRC8 of shared memory */
-        uint8_t ver;    /**<Shared memory layout version */
-        uint8_t res[6]; /**<Reserved fields */
+        uint8_t crc;        /**<CRC8 of shared memory */
+        uint8_t ver;        /**<Shared memory layout version */
+        uint8_t ext_size;   /**<Extension area size */
+        uint8_t res[5];     /**<Reserved fields */
     } ctrl;
 
     /**     Data fields
@@ -119,14 +415,34 @@ typedef struct __BOOT_CFG_PACKED__
         uint32_t boot_ver;      /**<Bootloader software version */
         uint8_t  boot_reason;   /**<Boot reason. Shall be value of @boot_reason_t */
         uint8_t  boot_cnt;      /**<Boot counter */
-        uint8_t  res[18];       /**<Reserved space */
+        uint8_t  valid_cnt;     /**<Boots since last full image validation */
+        uint8_t  res_0;         /**<Reserved space (alignment) */
+        uint32_t valid_us;      /**<Image validation time at last boot in microseconds, 0 if not measured */
+        uint8_t  res[12];       /**<Reserved space */
     } data;
+
+    #if ( BOOT_CFG_SHARED_MEM_EXT_SIZE > 0U )
+
+        /**     Extension area
+         *
+         *  Sizeof: BOOT_CFG_SHARED_MEM_EXT_SIZE
+         *
+         *  @note   Records are versioned by area version, unknown record
+         *          types shall be skipped.
+         */
+        struct
+        {
+            uint8_t ver;                                        /**<Extension area layout version */
+            uint8_t tlv[ BOOT_CFG_SHARED_MEM_EXT_SIZE - 1U ];   /**<Type-length-value records */
+        } ext;
+
+    #endif
 } boot_shared_mem_t;
 
 /**
  *  Shared memory size check
  */
-_Static_assert( 32 == sizeof(boot_shared_mem_t));
+_Static_assert(( 32 + BOOT_CFG_SHARED_MEM_EXT_SIZE ) == sizeof(boot_shared_mem_t));
 
 #endif // __BOOT_TYPES_H
 
@@ -0,0 +1,89 @@
+// Copyright (c) 2024 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      boot_uecc.c
+*@brief     Bootloader build of micro-ecc
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      14.10.2026
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup Bootloader build of micro-ecc
+* @{ <!-- BEGIN GROUP -->
+*
+*   micro-ecc is kept as distributed, this unit maps bootloader configuration
+*   (BOOT_CFG_ECDSA_*) to micro-ecc build options and then compiles library
+*   itself. Compile this file instead of "micro_ecc/uECC.c".
+*
+*   Options already given to compiler (-D) take precedence.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "boot_types.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Portable C implementation when ARM assembly is disabled
+ */
+#if ( 0 == BOOT_CFG_ECDSA_ASM_EN ) && !defined( uECC_PLATFORM )
+    #define uECC_PLATFORM                       uECC_arch_other
+#endif
+
+/**
+ *  Optimization level and squaring function
+ */
+#ifndef uECC_OPTIMIZATION_LEVEL
+    #define uECC_OPTIMIZATION_LEVEL             BOOT_CFG_ECDSA_OPT_LEVEL
+#endif
+
+#ifndef uECC_SQUARE_FUNC
+    #define uECC_SQUARE_FUNC                    BOOT_CFG_ECDSA_SQUARE_EN
+#endif
+
+/**
+ *  Only selected curve is compiled, no point compression
+ */
+#ifndef uECC_SUPPORTS_secp160r1
+    #define uECC_SUPPORTS_secp160r1             0
+#endif
+
+#ifndef uECC_SUPPORTS_secp192r1
+    #define uECC_SUPPORTS_secp192r1             0
+#endif
+
+#ifndef uECC_SUPPORTS_secp224r1
+    #define uECC_SUPPORTS_secp224r1             0
+#endif
+
+#ifndef uECC_SUPPORTS_secp256r1
+    #define uECC_SUPPORTS_secp256r1             ( BOOT_ECDSA_CURVE_SECP256R1 == BOOT_CFG_ECDSA_CURVE )
+#endif
+
+#ifndef uECC_SUPPORTS_secp256k1
+    #define uECC_SUPPORTS_secp256k1             ( BOOT_ECDSA_CURVE_SECP256K1 == BOOT_CFG_ECDSA_CURVE )
+#endif
+
+#ifndef uECC_SUPPORT_COMPRESSED_POINT
+    #define uECC_SUPPORT_COMPRESSED_POINT       0
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Library
+////////////////////////////////////////////////////////////////////////////////
+#include "micro_ecc/uECC.c"
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////